@@ -1,21 +1,365 @@
+// Global Includes
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// Project Includes
+#include <LatencyHistogram.hpp>
+#include <Network.hpp>
+#include <Protocol.hpp>
 #include <Types.hpp>
 
-int main() {
-    int port = 8080;
-
-    // Create the test order request
-    OrderRequest orderRequest;
-    orderRequest.symbol    = "TEMP";
-    orderRequest.qty       = 100;
-    orderRequest.price     = 76.50;
-    orderRequest.orderSide = OrderSide::BUY;
-    orderRequest.orderType = OrderType::LIMIT;
-
-    // create client socket
-    // serialize the orderRequest
-    // send the orderRequest
-    // wait for the orderResponse
-    // deserialize the order response
-
-    return 0;
-}
\ No newline at end of file
+/**
+ * @brief Settings of a load generator run.
+ */
+struct LoadConfig {
+    std::string host = "127.0.0.1"; // Address of the order book manager
+    int port = 8080;                 // Port of the order book manager
+    std::string symbol = "TEMP";     // Symbol the orders are sent to
+    uint32_t connections = 16;       // Connections the orders are spread over (round robin)
+    double rate = 10000.0;           // Orders per second over all connections
+    uint32_t burst = 1;              // Orders sent back to back at each send time (bursty load)
+    double durationSeconds = 10.0;   // Time orders are sent for
+    double warmupSeconds = 1.0;      // Orders scheduled in the first seconds are not recorded
+    double drainSeconds = 5.0;       // Time to wait for the last responses
+    std::string histogramFile;       // Percentile distribution output (HdrHistogram text format)
+};
+
+/**
+ * @brief Order waiting for its response. Responses come back in request
+ * order, so each connection keeps its orders in a FIFO.
+ */
+struct InFlightOrder {
+    int64_t intendedNs; // Time the schedule said to send the order
+    int64_t issuedNs;   // Time the order was actually written
+    bool recorded;      // False for warmup orders
+};
+
+/**
+ * @brief Connection of the load generator.
+ */
+struct LoadConnection {
+    SOCKET socket = INVALID_SOCKET;    // Connected socket
+    std::string outbound;              // Frames not yet written
+    size_t outboundOffset = 0;         // Bytes of outbound already written
+    std::string inbound;               // Bytes received and not yet decoded
+    std::deque<InFlightOrder> pending; // Orders waiting for a response
+    bool open = false;                 // False once the server closed it
+};
+
+/**
+ * @brief Counters of a load generator run.
+ */
+struct LoadStats {
+    uint64_t sent = 0;            // Orders sent
+    uint64_t responses = 0;       // Order responses received
+    uint64_t rejects = 0;         // Responses with an error code
+    uint64_t reports = 0;         // Execution reports received
+    int64_t lastResponseNs = 0;   // Time of the last response
+    LatencyHistogram corrected;   // Intended send => response
+    LatencyHistogram uncorrected; // Actual send => response
+};
+
+/**
+ * @brief Print the command line options.
+ */
+void printUsage() {
+    std::cerr <<
+        "Usage: test_client [options]\n"
+        "  --host <ip>           address of the order book manager (default 127.0.0.1)\n"
+        "  -p, --port <port>     port of the order book manager (default 8080)\n"
+        "  -s, --symbol <s>      symbol the orders are sent to (default TEMP)\n"
+        "  --connections <n>     connections the orders are spread over (default 16)\n"
+        "  --rate <r>            orders per second over all connections (default 10000)\n"
+        "  --burst <n>           orders sent back to back at each send time (default 1)\n"
+        "  --duration <s>        seconds to send for (default 10)\n"
+        "  --warmup <s>          seconds of orders not recorded (default 1)\n"
+        "  --histogram <file>    write the latency percentile distribution (HdrHistogram format)\n";
+}
+
+/**
+ * @brief Apply the command line arguments to the settings.
+ *
+ * @param argc - number of command line arguments
+ * @param argv - command line arguments
+ * @param config - settings to update
+ *
+ * @return bool - true if every argument was valid; false otherwise
+ */
+bool parseArguments(int argc, char* argv[], LoadConfig& config) {
+    for (int index = 1; index < argc; index++) {
+        std::string arg = argv[index];
+        if (index + 1 >= argc) {
+            std::cerr << "test_client: missing value for " << arg << "\n";
+            return false;
+        }
+
+        std::string value = argv[++index];
+        char* end = nullptr;
+        double number = std::strtod(value.c_str(), &end);
+        bool numeric = !value.empty() && *end == '\0' && number >= 0;
+
+        if (arg == "--host") config.host = value;
+        else if (arg == "-s" || arg == "--symbol") config.symbol = value;
+        else if (arg == "--histogram") config.histogramFile = value;
+        else if (!numeric) {
+            std::cerr << "test_client: invalid value '" << value << "' for " << arg << "\n";
+            return false;
+        }
+        else if (arg == "-p" || arg == "--port") config.port = static_cast<int>(number);
+        else if (arg == "--connections" && number >= 1) config.connections = static_cast<uint32_t>(number);
+        else if (arg == "--rate" && number > 0) config.rate = number;
+        else if (arg == "--burst" && number >= 1) config.burst = static_cast<uint32_t>(number);
+        else if (arg == "--duration" && number > 0) config.durationSeconds = number;
+        else if (arg == "--warmup") config.warmupSeconds = number;
+        else {
+            std::cerr << "test_client: invalid option " << arg << " " << value << "\n";
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Write as much of a connection's outbound frames as the socket takes.
+ *
+ * @param connection - connection to flush
+ */
+void flushConnection(LoadConnection& connection) {
+    while (connection.open && connection.outboundOffset < connection.outbound.size()) {
+        net::IoSlice slice;
+        net::setSlice(slice, connection.outbound.data() + connection.outboundOffset,
+                      connection.outbound.size() - connection.outboundOffset);
+
+        long sent = net::sendVectored(connection.socket, &slice, 1);
+        if (sent < 0) {
+            if (!net::wouldBlock()) connection.open = false;
+            return;
+        }
+        connection.outboundOffset += static_cast<size_t>(sent);
+    }
+
+    connection.outbound.clear();
+    connection.outboundOffset = 0;
+}
+
+/**
+ * @brief Read the available bytes of a connection and match its responses
+ * with the orders waiting for them.
+ *
+ * @param connection - readable connection
+ * @param nowNs - time of the read (ns since the run started)
+ * @param stats - counters and histograms to update
+ */
+void readConnection(LoadConnection& connection, int64_t nowNs, LoadStats& stats) {
+    char buffer[65536];
+
+    long received = net::receive(connection.socket, buffer, sizeof(buffer));
+    if (received == 0 || (received < 0 && !net::wouldBlock())) {
+        connection.open = false;
+        return;
+    }
+    if (received < 0) return;
+
+    connection.inbound.append(buffer, static_cast<size_t>(received));
+
+    size_t offset = 0;
+    protocol::Frame frame;
+    size_t frameSize = 0;
+    protocol::DecodeStatus status = protocol::DecodeStatus::INCOMPLETE;
+
+    while ((status = protocol::decodeFrame(connection.inbound.data() + offset, connection.inbound.size() - offset,
+                                           frame, frameSize)) == protocol::DecodeStatus::COMPLETE) {
+        offset += frameSize;
+
+        if (frame.type == MessageType::EXECUTION_REPORT) {
+            stats.reports++;
+            continue;
+        }
+        if (frame.type != MessageType::ORDER_RESPONSE || connection.pending.empty()) continue;
+
+        OrderResponse response;
+        InFlightOrder order = connection.pending.front();
+        connection.pending.pop_front();
+        stats.responses++;
+        stats.lastResponseNs = nowNs;
+
+        if (!protocol::deserialize(frame, response) || response.errCode != ErrorCode::OK) stats.rejects++;
+
+        if (order.recorded) {
+            stats.corrected.record(nowNs - order.intendedNs);
+            stats.uncorrected.record(nowNs - order.issuedNs);
+        }
+    }
+
+    if (status == protocol::DecodeStatus::INVALID) {
+        std::cerr << "test_client: invalid frame from the server\n";
+        connection.open = false;
+    }
+
+    connection.inbound.erase(0, offset);
+}
+
+/**
+ * @brief Print the percentiles of a latency histogram (us).
+ *
+ * @param label - name of the histogram
+ * @param histogram - histogram to print
+ */
+void printLatency(const std::string& label, const LatencyHistogram& histogram) {
+    std::cout << std::fixed << std::setprecision(1) << label << " (us): p50=" << histogram.valueAtPercentile(50) / 1000.0
+              << " p90=" << histogram.valueAtPercentile(90) / 1000.0
+              << " p99=" << histogram.valueAtPercentile(99) / 1000.0
+              << " p99.9=" << histogram.valueAtPercentile(99.9) / 1000.0
+              << " max=" << histogram.getMax() / 1000.0
+              << " mean=" << histogram.getMean() / 1000.0 << "\n";
+}
+
+/**
+ * @brief Open-loop load generator for the order book manager.
+ *
+ * Orders are sent on a fixed schedule (rate, optionally in bursts) spread
+ * round robin over many connections, whether or not earlier orders have been
+ * answered. Latency is measured from the time the schedule said to send each
+ * order, not from when it was actually written, so time the generator spends
+ * stalled behind a slow server is charged to the orders that should have been
+ * sent meanwhile (coordinated omission correction). The uncorrected response
+ * time is reported alongside for comparison.
+ *
+ * Orders are LIMIT orders on a random side a few ticks either side of 100,
+ * so about half of them trade.
+ *
+ * @param argc - number of command line arguements
+ * @param argv - command line arguements (@see printUsage())
+ *
+ * @return int - status code
+ */
+int main(int argc, char* argv[]) {
+    LoadConfig config;
+    if (!parseArguments(argc, argv, config)) {
+        printUsage();
+        return 1;
+    }
+
+    if (!net::startup()) {
+        std::cerr << "test_client: socket library unavailable\n";
+        return 1;
+    }
+
+    // Connect every connection before the clock starts
+    std::vector<LoadConnection> connections(config.connections);
+    for (LoadConnection& connection : connections) {
+        connection.socket = net::connectTo(config.host, config.port);
+        if (connection.socket == INVALID_SOCKET || !net::setNonBlocking(connection.socket)) {
+            std::cerr << "test_client: cannot connect to " << config.host << ":" << config.port << "\n";
+            return 1;
+        }
+        net::setNoDelay(connection.socket);
+        connection.open = true;
+    }
+
+    std::mt19937_64 random(12345);
+    std::uniform_int_distribution<int> offsetTicks(-5, 5);
+    std::uniform_int_distribution<int> quantity(1, 100);
+    std::bernoulli_distribution buySide(0.5);
+
+    const int64_t intervalNs = static_cast<int64_t>(1e9 * config.burst / config.rate);
+    const int64_t warmupNs = static_cast<int64_t>(config.warmupSeconds * 1e9);
+    const int64_t sendEndNs = warmupNs + static_cast<int64_t>(config.durationSeconds * 1e9);
+    const int64_t drainEndNs = sendEndNs + static_cast<int64_t>(config.drainSeconds * 1e9);
+
+    LoadStats stats;
+    std::vector<net::PollFd> pollFds(connections.size());
+    size_t nextConnection = 0;
+    int64_t nextSendNs = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    auto elapsedNs = [&start]() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    while (true) {
+        int64_t nowNs = elapsedNs();
+
+        // Issue every order whose send time has come, whether or not earlier ones were answered
+        while (nextSendNs <= nowNs && nextSendNs < sendEndNs) {
+            for (uint32_t order = 0; order < config.burst; order++) {
+                LoadConnection& connection = connections[nextConnection++ % connections.size()];
+                if (!connection.open) continue;
+
+                bool buy = buySide(random);
+                OrderRequest request{config.symbol, quantity(random), 100.0 + offsetTicks(random) * 0.01,
+                                     buy ? OrderSide::BUY : OrderSide::SELL, OrderType::LIMIT};
+                protocol::serialize(request, connection.outbound);
+                connection.pending.push_back(InFlightOrder{nextSendNs, nowNs, nextSendNs >= warmupNs});
+                stats.sent++;
+            }
+            nextSendNs += intervalNs;
+        }
+
+        bool waiting = false;
+        bool anyOpen = false;
+        for (size_t index = 0; index < connections.size(); index++) {
+            LoadConnection& connection = connections[index];
+            flushConnection(connection);
+
+            waiting |= connection.open && !connection.pending.empty();
+            anyOpen |= connection.open;
+
+            pollFds[index].fd = connection.socket;
+            pollFds[index].events = static_cast<short>(connection.open ? POLLIN | (connection.outbound.empty() ? 0 : POLLOUT) : 0);
+            pollFds[index].revents = 0;
+        }
+
+        if (!anyOpen || (nowNs >= sendEndNs && (!waiting || nowNs >= drainEndNs))) break;
+
+        // Sleep until the next send time; spin (timeout 0) when it is under a millisecond away
+        int timeoutMs = 10;
+        if (nextSendNs < sendEndNs) {
+            timeoutMs = static_cast<int>(std::max<int64_t>(nextSendNs - nowNs, 0) / 1000000);
+        }
+
+        if (net::pollSockets(pollFds.data(), pollFds.size(), timeoutMs) <= 0) continue;
+
+        nowNs = elapsedNs();
+        for (size_t index = 0; index < connections.size(); index++) {
+            if (pollFds[index].revents & (POLLIN | POLLERR | POLLHUP)) {
+                readConnection(connections[index], nowNs, stats);
+            }
+        }
+    }
+
+    uint64_t missing = 0;
+    for (LoadConnection& connection : connections) {
+        missing += connection.pending.size();
+        if (connection.socket != INVALID_SOCKET) net::closeSocket(connection.socket);
+    }
+    net::cleanup();
+
+    // Throughput over the recorded window (after the warmup, until the last response)
+    double windowSeconds = std::max<int64_t>(stats.lastResponseNs - warmupNs, 1) / 1e9;
+
+    std::cout << "connections=" << config.connections << " rate=" << config.rate << "/s burst=" << config.burst
+              << " duration=" << config.durationSeconds << "s warmup=" << config.warmupSeconds << "s symbol=" << config.symbol << "\n"
+              << "sent=" << stats.sent << " responses=" << stats.responses << " rejects=" << stats.rejects
+              << " reports=" << stats.reports << " missing=" << missing << "\n"
+              << "throughput: offered=" << config.rate << "/s achieved=" << stats.corrected.getCount() / windowSeconds << "/s\n";
+    printLatency("latency, intended send => response", stats.corrected);
+    printLatency("response time, actual send => response", stats.uncorrected);
+
+    if (!config.histogramFile.empty()) {
+        std::ofstream out(config.histogramFile);
+        stats.corrected.writePercentiles(out, 1000.0);
+    }
+
+    return missing == 0 ? 0 : 2;
+}
@@ -50,5 +50,21 @@ if errorlevel 1 (
     exit /b 1
 )
 
+REM ===============================
+REM Building the load generator
+REM ===============================
+echo ===============================
+echo Building load generator...
+echo ===============================
+set "OBJECTS="
+for %%f in ("%BUILD_DIR%\*.o") do (
+    if /I not "%%~nf"=="main" set "OBJECTS=!OBJECTS! "%%f""
+)
+g++ -std=c++17 -Wall -Wextra -I "%INCLUDE_DIR%" "agent\test_client.cpp" !OBJECTS! -o "%BUILD_DIR%\test_client.exe" -lws2_32
+if errorlevel 1 (
+    echo Load generator build failed.
+    exit /b 1
+)
+
 echo Build succeeded. Output: %OUTPUT_EXE%
 endlocal
\ No newline at end of file
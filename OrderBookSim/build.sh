@@ -0,0 +1,135 @@
+#!/usr/bin/env bash
+# ===============================
+# Building order book simulator (Linux)
+# ===============================
+#
+# Usage: ./build.sh [debug|release|lto|pgo]   (default release)
+#
+#   debug   - -O0 -g
+#   release - -O2 -g
+#   lto     - release with link-time optimization
+#   pgo     - lto, built twice: an instrumented build runs the training
+#             workload, then the final build is optimized with its profile
+#
+# Builds build/<variant>/orderBook, test_client, test, benchmark and fuzz.
+# CXX selects the compiler (g++ or clang++; default g++) and CXXFLAGS adds
+# flags to every compile (e.g. CXXFLAGS="-march=native -DOBM_STAGE_TIMERS=1").
+set -euo pipefail
+
+cd "$(dirname "$0")"
+
+VARIANT="${1:-release}"
+CXX="${CXX:-g++}"
+EXTRA_FLAGS="${CXXFLAGS:-}"
+JOBS="$(nproc 2>/dev/null || echo 4)"
+
+BUILD_DIR="build/${VARIANT}"
+OBJ_DIR="${BUILD_DIR}/obj"
+PROFILE_DIR="${BUILD_DIR}/profile"
+
+COMMON_FLAGS="-std=c++17 -Wall -Wextra -pthread -I include -I tests/include"
+
+case "${VARIANT}" in
+    debug)   OPT_FLAGS="-O0 -g" ;;
+    release) OPT_FLAGS="-O2 -g" ;;
+    lto)     OPT_FLAGS="-O2 -g -flto" ;;
+    pgo)     OPT_FLAGS="-O2 -g -flto" ;;
+    *)
+        echo "Usage: ./build.sh [debug|release|lto|pgo]"
+        exit 1
+        ;;
+esac
+
+# GCC runs the link-time code generation in parallel with -flto=auto
+if [[ "${OPT_FLAGS}" == *-flto* && "$("${CXX}" --version)" != *clang* ]]; then
+    OPT_FLAGS="${OPT_FLAGS/-flto/-flto=auto}"
+fi
+
+# ===============================
+# Compile every source file into ${OBJ_DIR}, in parallel
+#   $1 - extra compile flags of this stage
+# ===============================
+compile_objects() {
+    local flags="$1"
+
+    mkdir -p "${OBJ_DIR}"
+    rm -f "${OBJ_DIR}"/*.o
+
+    printf '%s\n' src/*.cpp tests/src/*.cpp agent/*.cpp |
+        xargs -P "${JOBS}" -I {} sh -c \
+            'echo "Compiling $1 ..." && exec '"${CXX} ${COMMON_FLAGS} ${OPT_FLAGS} ${flags} ${EXTRA_FLAGS}"' -c "$1" -o "'"${OBJ_DIR}"'/$(basename "$1" .cpp).o"' \
+            sh {}
+}
+
+# ===============================
+# Link the executables from ${OBJ_DIR}
+#   $1 - extra link flags of this stage
+# ===============================
+link_executables() {
+    local flags="$1"
+    local objects=()
+
+    # Objects shared by every executable (every source except the mains)
+    for object in "${OBJ_DIR}"/*.o; do
+        case "$(basename "${object}")" in
+            main.o|test_main.o|benchmark_main.o|fuzz_main.o|test_client.o) ;;
+            *) objects+=("${object}") ;;
+        esac
+    done
+
+    echo "Linking object files..."
+    ${CXX} ${OPT_FLAGS} ${flags} -pthread "${objects[@]}" "${OBJ_DIR}/main.o" -o "${BUILD_DIR}/orderBook"
+    ${CXX} ${OPT_FLAGS} ${flags} -pthread "${objects[@]}" "${OBJ_DIR}/test_client.o" -o "${BUILD_DIR}/test_client"
+    ${CXX} ${OPT_FLAGS} ${flags} -pthread "${objects[@]}" "${OBJ_DIR}/test_main.o" -o "${BUILD_DIR}/test"
+    ${CXX} ${OPT_FLAGS} ${flags} -pthread "${objects[@]}" "${OBJ_DIR}/benchmark_main.o" -o "${BUILD_DIR}/benchmark"
+    ${CXX} ${OPT_FLAGS} ${flags} -pthread "${objects[@]}" "${OBJ_DIR}/fuzz_main.o" -o "${BUILD_DIR}/fuzz"
+}
+
+# ===============================
+# PGO training workload: an in-process simulation (zero-intelligence agents,
+# order flow agents and a market maker on three books, seeded so every
+# training run is identical) and the order book benchmark suite (deep,
+# skewed and aggressive books through matchOrders)
+# ===============================
+train() {
+    echo "Running PGO training workload..."
+    "${BUILD_DIR}/orderBook" --agents 1000 --steps 200 --seed 7 --flow-agents 3 --market-maker -s AAA BBB CCC > /dev/null
+    "${BUILD_DIR}/benchmark" --ops 5000 > /dev/null 2>&1
+}
+
+echo "==============================="
+echo "Building order book simulator (${VARIANT}, ${CXX})"
+echo "==============================="
+
+if [[ "${VARIANT}" != "pgo" ]]; then
+    compile_objects ""
+    link_executables ""
+else
+    rm -rf "${PROFILE_DIR}"
+    mkdir -p "${PROFILE_DIR}"
+
+    if [[ "$("${CXX}" --version)" == *clang* ]]; then
+        GENERATE_FLAGS="-fprofile-generate=${PROFILE_DIR}"
+        USE_FLAGS="-fprofile-use=${PROFILE_DIR}/merged.profdata -Wno-profile-instr-unprofiled"
+    else
+        # Engine, transport and logger threads update the counters concurrently
+        GENERATE_FLAGS="-fprofile-generate -fprofile-update=atomic -fprofile-dir=${PWD}/${PROFILE_DIR}"
+        USE_FLAGS="-fprofile-use -fprofile-correction -fprofile-dir=${PWD}/${PROFILE_DIR} -Wno-missing-profile"
+    fi
+
+    echo "Stage 1: instrumented build"
+    compile_objects "${GENERATE_FLAGS}"
+    link_executables "${GENERATE_FLAGS}"
+
+    train
+
+    if [[ "$("${CXX}" --version)" == *clang* ]]; then
+        llvm-profdata merge -output="${PROFILE_DIR}/merged.profdata" "${PROFILE_DIR}"/*.profraw
+    fi
+
+    echo "Stage 2: profile-optimized build"
+    compile_objects "${USE_FLAGS}"
+    link_executables "${USE_FLAGS}"
+fi
+
+echo "Build succeeded. Output: ${BUILD_DIR}/"
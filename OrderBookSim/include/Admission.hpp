@@ -0,0 +1,65 @@
+// Global Includes
+#include <cstddef>
+#include <cstdint>
+
+#ifndef ADMISSION_H
+#define ADMISSION_H
+
+/**
+ * @brief Flow control limits of the order book manager. Per-session limits are
+ * enforced on the transport thread before a request is queued to an engine;
+ * a request over a limit is answered with THROTTLED. A limit of 0 disables it.
+ *
+ * The open order limit bounds the orders a session has resting in the books;
+ * the outstanding limit bounds its requests in flight (queued to the engines
+ * and not yet answered). A new order is counted once its engine has rested
+ * it, so a session may briefly exceed maxOpenOrders by its orders in flight.
+ */
+struct AdmissionLimits {
+    double messageRate      = 1000000; // Sustained requests per second per session
+    double messageBurst     = 100000;  // Requests a session may send at once (bucket size)
+    uint32_t maxOutstanding = 65536;   // Requests per session queued to the engines and not yet answered
+    uint32_t maxOpenOrders  = 65536;   // Orders per session resting in the books; new orders are throttled at the limit
+
+    // Engine queue watermarks. Past the high watermark an engine's requests are
+    // throttled and the transports stop reading until it drains to the low one
+    size_t engineHighWatermark = 262144;
+    size_t engineLowWatermark  = 65536;
+};
+
+/**
+ * Token bucket rate limiter. The bucket starts full, refills at the rate
+ * (tokens per second) and holds at most the burst. The rate and burst are
+ * passed on every call so the limits can live with the manager rather than
+ * in every session. Not thread-safe; owned by one transport thread.
+ */
+class TokenBucket {
+    public:
+        /**
+         * @brief Constructor for a new, full token bucket.
+         */
+        TokenBucket();
+
+        /**
+         * @brief Take one token if available.
+         *
+         * @param rate - refill rate (tokens per second); 0 for no limit
+         * @param burst - bucket size (tokens)
+         * @param now - current time (ns, steady clock)
+         *
+         * @return bool - true if a token was taken; false if the bucket is empty
+         */
+        bool tryConsume(double rate, double burst, int64_t now);
+
+        /**
+         * @brief Refill the bucket and forget the last refill time.
+         */
+        void reset();
+
+    private:
+        double tokens;      // Tokens available
+        int64_t lastRefill; // Time of the last refill (ns)
+        bool started;       // False until the first call (bucket is full)
+}; // TokenBucket
+
+#endif // ADMISSION_H
@@ -0,0 +1,316 @@
+// Global Includes
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Project Includes
+#include <BookEvents.hpp>
+#include <OrderFlow.hpp>
+#include <Types.hpp>
+
+#ifndef AGENT_H
+#define AGENT_H
+
+/**
+ * Deterministic random stream of one agent (xoshiro256**). Streams are seeded
+ * from the simulation seed and the agent ID, so every agent draws the same
+ * numbers on every run and platform regardless of how many agents exist or
+ * the order they are woken in. Satisfies UniformRandomBitGenerator, but the
+ * helpers below should be preferred: the standard distributions are not
+ * reproducible across standard libraries.
+ */
+class AgentRandom {
+    public:
+        using result_type = uint64_t;
+
+        /**
+         * @brief Constructor for the stream of one agent.
+         *
+         * @param seed - simulation seed
+         * @param streamId - stream identifier (agent ID)
+         */
+        AgentRandom(uint64_t seed, uint64_t streamId);
+
+        /**
+         * @return uint64_t - next 64 random bits
+         */
+        uint64_t operator()();
+
+        /**
+         * @brief Draw an integer uniformly from [low, high].
+         *
+         * @param low - smallest value
+         * @param high - largest value (>= low)
+         *
+         * @return int64_t - random integer
+         */
+        int64_t uniformInt(int64_t low, int64_t high);
+
+        /**
+         * @return double - random number uniformly drawn from [0, 1)
+         */
+        double uniformReal();
+
+        /**
+         * @brief Draw true with a probability.
+         *
+         * @param probability - probability of true (0 to 1)
+         *
+         * @return bool - random outcome
+         */
+        bool chance(double probability);
+
+        /**
+         * @brief Draw from an exponential distribution (e.g. the gaps of a
+         * Poisson arrival process).
+         *
+         * @param mean - mean of the distribution
+         *
+         * @return double - random value >= 0
+         */
+        double exponential(double mean);
+
+        static constexpr uint64_t min() { return 0; }
+        static constexpr uint64_t max() { return UINT64_MAX; }
+
+    private:
+        uint64_t state[4]; // Generator state (never all zero)
+}; // AgentRandom
+
+/**
+ * @brief Resting order of an agent, as known to the agent.
+ */
+struct AgentOrder {
+    std::string orderId; // ID of the order
+    uint32_t bookIndex;  // Order book of the order (index of its symbol in the AgentManager)
+    OrderSide side;      // Side of the order
+    double price;        // Limit price of the order
+    int leavesQty;       // Quantity still resting
+};
+
+/**
+ * Market access of the agent being woken. Implemented by the AgentManager;
+ * requests are executed immediately against the order book (no network), and
+ * the fills they cause are delivered through Agent::onExecution() before the
+ * call returns. In virtual time with latency (@see AgentManager::runUntil()),
+ * requests and their executions are delivered after the configured delays.
+ */
+class AgentContext {
+    public:
+        virtual ~AgentContext() = default;
+
+        /**
+         * @brief Submit a new order for the current agent.
+         *
+         * @param bookIndex - order book to trade in
+         * @param qty - quantity of the order
+         * @param price - price of the order
+         * @param side - side of the order
+         * @param type - type of the order
+         * @param orderId - populated with the new order ID (optional; left
+         *                  empty while the order is in flight to the book)
+         * @param timeToLiveNs - virtual time after which the order is canceled
+         *                       if still resting; 0 for no expiry (virtual time only)
+         *
+         * @return ErrorCode - OK if the order was accepted (or sent, while in flight)
+         */
+        virtual ErrorCode submitOrder(uint32_t bookIndex, int qty, double price, OrderSide side, OrderType type,
+                                      std::string* orderId = nullptr, int64_t timeToLiveNs = 0) = 0;
+
+        /**
+         * @brief Cancel a resting order of the current agent.
+         *
+         * @param bookIndex - order book of the order
+         * @param orderId - ID of the order
+         *
+         * @return ErrorCode - OK if the order was canceled
+         */
+        virtual ErrorCode cancelOrder(uint32_t bookIndex, const std::string& orderId) = 0;
+
+        /**
+         * @brief Wake the current agent again after a delay (virtual time
+         * only; ignored by step runs, which wake every agent each step).
+         *
+         * @param delayNs - virtual time until the wakeup (at least 1 ns)
+         */
+        virtual void scheduleWakeup(int64_t delayNs) = 0;
+
+        /**
+         * @brief Accessor functions for the market (getters).
+         *
+         * getBookCount() - gets the number of order books
+         * getBestBid() / getBestAsk() - gets the best price of a book; 0 if the side is empty
+         * getLastTradePrice() - gets the price of the last trade in a book; 0 before the first trade
+         * getStep() - gets the current simulation step
+         * getTime() - gets the current virtual time (ns); 0 in step runs
+         */
+        virtual uint32_t getBookCount() const = 0;
+        virtual double getBestBid(uint32_t bookIndex) const = 0;
+        virtual double getBestAsk(uint32_t bookIndex) const = 0;
+        virtual double getLastTradePrice(uint32_t bookIndex) const = 0;
+        virtual uint64_t getStep() const = 0;
+        virtual int64_t getTime() const = 0;
+}; // AgentContext
+
+/**
+ * Simulated trader run in-process by the AgentManager. The manager wakes every
+ * agent once per step (or when it asked to be, in virtual time); an agent trades through the AgentContext and is told
+ * about the fills and cancels of its own orders. The manager keeps the agent's
+ * resting orders, position and cash up to date before onExecution() is called.
+ */
+class Agent {
+    public:
+        /**
+         * @brief Constructor for a new agent.
+         *
+         * @param agentId - agent (trader) identifier
+         * @param seed - simulation seed of the agent's random stream
+         */
+        Agent(
+            uint32_t agentId,
+            uint64_t seed
+        );
+        virtual ~Agent() = default;
+
+        /**
+         * @brief Called once per simulation step (or when a scheduled wakeup
+         * is due, in virtual time) to let the agent trade.
+         *
+         * @param context - market access for this wakeup
+         */
+        virtual void onWakeup(AgentContext& context) = 0;
+
+        /**
+         * @brief Called for every fill and cancel of one of the agent's orders.
+         *
+         * @param event - execution details
+         */
+        virtual void onExecution(const ExecutionEvent& event) { (void)event; }
+
+        /**
+         * @brief Record an execution of one of the agent's orders (called by
+         * the AgentManager before onExecution()).
+         *
+         * @param bookIndex - order book of the order
+         * @param event - execution details
+         */
+        void applyExecution(uint32_t bookIndex, const ExecutionEvent& event);
+
+        /**
+         * @brief Record a new resting order of the agent (called by the AgentManager).
+         *
+         * @param order - resting order details
+         */
+        void addOpenOrder(const AgentOrder& order);
+
+        /**
+         * @brief Accessor functions for the agent (getters).
+         *
+         * getAgentId() - gets the agent identifier
+         * getPosition() - gets the net position per book (bought - sold)
+         * getCash() - gets the cash balance (sold value - bought value)
+         * getFillCount() - gets the number of fills of the agent's orders
+         * getOpenOrders() - gets the resting orders of the agent, oldest first
+         */
+        uint32_t getAgentId() const;
+        int64_t getPosition(uint32_t bookIndex) const;
+        double getCash() const;
+        uint64_t getFillCount() const;
+        const std::vector<AgentOrder>& getOpenOrders() const;
+
+    protected:
+        AgentRandom random; // Deterministic random stream of the agent
+
+    private:
+        uint32_t agentId;               // Agent identifier
+        std::vector<int64_t> positions; // Net position per book
+        double cash;                    // Sold value - bought value
+        uint64_t fillCount;             // Fills of the agent's orders
+
+        // Resting orders, oldest first. Kept in placement order (not hashed by
+        // ID) so the agent's choices never depend on the order IDs
+        std::vector<AgentOrder> openOrders;
+}; // Agent
+
+/**
+ * @brief Parameters of a ZeroIntelligenceAgent.
+ */
+struct ZeroIntelligenceParams {
+    double initialPrice = 100.0;  // Reference price before the first trade
+    double tickSize = 0.01;       // Price increment
+    int maxOffsetTicks = 50;      // Orders are priced within +/- this many ticks of the reference
+    int maxQty = 100;             // Orders are sized 1 to maxQty
+    double activity = 1.0;        // Probability of acting on a wakeup
+    double cancelRate = 0.3;      // Probability an action cancels a resting order instead of placing one
+    double marketRate = 0.05;     // Probability a new order is a MARKET order
+    uint32_t maxOpenOrders = 10;  // Resting orders kept before the agent only cancels
+
+    // Virtual time only
+    int64_t meanWakeupIntervalNs = 1000000000; // Mean gap between wakeups (Poisson arrivals)
+    int64_t orderTimeToLiveNs = 0;             // Expiry of resting orders; 0 for none
+};
+
+/**
+ * Zero-intelligence trader: places random LIMIT (and some MARKET) orders
+ * around the mid price (last trade or initial price if a side is empty) in a
+ * random book, and randomly cancels its resting orders. Its only state is its
+ * random stream and its resting orders, which makes it a cheap background
+ * order flow for large simulations.
+ */
+class ZeroIntelligenceAgent : public Agent {
+    public:
+        /**
+         * @brief Constructor for a new zero-intelligence agent.
+         *
+         * @param agentId - agent (trader) identifier
+         * @param seed - simulation seed of the agent's random stream
+         * @param params - order flow parameters
+         */
+        ZeroIntelligenceAgent(
+            uint32_t agentId,
+            uint64_t seed,
+            const ZeroIntelligenceParams& params = ZeroIntelligenceParams()
+        );
+
+        void onWakeup(AgentContext& context) override;
+
+    private:
+        ZeroIntelligenceParams params; // Order flow parameters
+}; // ZeroIntelligenceAgent
+
+/**
+ * Trader replaying a stochastic order flow (@see OrderFlowGenerator) into one
+ * book. In virtual time the agent wakes at the generated arrival times, so the
+ * book sees Poisson or Hawkes arrivals; in step runs it applies one event per
+ * wakeup. Limit and market orders are priced against the book's best bid and
+ * ask when they are applied; cancels remove a random resting order of the
+ * agent (or do nothing if it has none). Once the agent rests maxOpenOrders,
+ * new orders turn into cancels, which keeps the book from growing without
+ * bound when limit orders outnumber cancels.
+ */
+class OrderFlowAgent : public Agent {
+    public:
+        /**
+         * @brief Constructor for a new order flow agent.
+         *
+         * @param agentId - agent (trader) identifier (also the flow's stream)
+         * @param seed - simulation seed of the agent's order flow
+         * @param params - arrival process, event mix and price distribution
+         * @param bookIndex - book the flow trades in
+         */
+        OrderFlowAgent(
+            uint32_t agentId,
+            uint64_t seed,
+            const OrderFlowParams& params = OrderFlowParams(),
+            uint32_t bookIndex = 0
+        );
+
+        void onWakeup(AgentContext& context) override;
+
+    private:
+        OrderFlowGenerator flow;  // Generated order flow
+        OrderFlowEvent pending;   // Next event to apply
+        uint32_t bookIndex;       // Book the flow trades in
+}; // OrderFlowAgent
+
+#endif // AGENT_H
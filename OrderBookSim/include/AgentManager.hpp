@@ -0,0 +1,326 @@
+// Global Includes
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Project Includes
+#include <Agent.hpp>
+#include <BookEvents.hpp>
+#include <EventQueue.hpp>
+#include <OrderBook.hpp>
+#include <Strategy.hpp>
+#include <utils.hpp>
+
+#ifndef AGENTMANAGER_H
+#define AGENTMANAGER_H
+
+/**
+ * @brief Counters of an agent simulation.
+ */
+struct AgentManagerStats {
+    uint64_t steps           = 0; // Simulation steps run
+    uint64_t wakeups         = 0; // Agent wakeups
+    uint64_t orders          = 0; // Orders accepted
+    uint64_t cancels         = 0; // Cancels accepted
+    uint64_t expiries        = 0; // Resting orders canceled by their time to live
+    uint64_t rejects         = 0; // Requests rejected (any error code)
+    uint64_t fills           = 0; // Order fills (two per trade)
+    uint64_t trades          = 0; // Trades
+    uint64_t scheduledEvents = 0; // Virtual time events processed
+    uint64_t auctions        = 0; // Batch auctions run (one per book per interval)
+
+    /**
+     * @return uint64_t - book events (orders, cancels, expiries, rejects and trades)
+     */
+    uint64_t events() const { return orders + cancels + expiries + rejects + trades; }
+};
+
+/**
+ * @brief Simulated network delays of a virtual time run. A delay of 0 delivers
+ * immediately, inside the call that caused it.
+ */
+struct AgentLatency {
+    int64_t orderLatencyNs  = 0; // Agent => book: orders and cancels
+    int64_t reportLatencyNs = 0; // Book => agent: order acks, fills and cancels
+};
+
+/**
+ * @brief Frequent batch auctions of a simulation. Between auctions the books
+ * only collect LIMIT orders (@see MatchingMode); every interval each book is
+ * uncrossed. An interval of 0 leaves the books matching continuously.
+ */
+struct AuctionSchedule {
+    uint64_t intervalSteps = 0;                                      // Step runs: steps between auctions
+    int64_t intervalNs = 0;                                          // Virtual time runs: time between auctions
+    AuctionAllocation allocation = AuctionAllocation::TIME_PRIORITY; // Rationing at the clearing price
+};
+
+/**
+ * In-process simulation of N agents trading against a set of order books. The
+ * agents call the books directly (no sockets, no matching engine threads), so
+ * a simulation is single threaded and fully deterministic: every agent draws
+ * from its own stream (@see AgentRandom). With the same seed, symbols and
+ * agents, two runs produce the same trades.
+ *
+ * A simulation runs either in steps (run()), where each step wakes every agent
+ * once in an order shuffled by the manager's own random stream, or in virtual
+ * time (runUntil()), a discrete-event simulation where agents schedule their
+ * own wakeups and orders, cancels and executions travel with simulated
+ * latency. Virtual time jumps from one event to the next, so idle time costs
+ * nothing, and the books are stamped with it.
+ *
+ * The books match continuously, or in frequent batch auctions (setAuctions()).
+ *
+ * The manager listens to its books and routes the fills and cancels of every
+ * resting order to the agent that placed it. Strategies (@see Strategy) can be
+ * attached to the books to react to every book event as it happens.
+ */
+class AgentManager : public AgentContext {
+    public:
+        /**
+         * @brief Constructor for a new simulation.
+         *
+         * @param symbols - symbols of the order books (one book each)
+         * @param seed - simulation seed (shuffles the wake order; agents should be created with it)
+         */
+        AgentManager(
+            const std::vector<std::string>& symbols,
+            uint64_t seed
+        );
+        ~AgentManager() override;
+
+        AgentManager(const AgentManager&) = delete;
+        AgentManager& operator=(const AgentManager&) = delete;
+
+        /**
+         * @brief Add an agent to the simulation.
+         *
+         * @param agent - agent to add
+         *
+         * @return Agent& - the added agent (owned by the manager)
+         */
+        Agent& addAgent(std::unique_ptr<Agent> agent);
+
+        /**
+         * @brief Attach a strategy to a book. The strategy reacts to every
+         * event of the book; its requests are executed after each agent
+         * request, before control returns to the agent.
+         *
+         * @param bookIndex - book the strategy trades in
+         * @param strategy - strategy to run (must outlive the manager)
+         *
+         * @return StrategyHost& - host running the strategy (owned by the manager)
+         */
+        StrategyHost& addStrategy(uint32_t bookIndex, Strategy& strategy);
+
+        /**
+         * @brief Run simulation steps. Each step wakes every agent once.
+         *
+         * @param steps - number of steps to run
+         */
+        void run(uint64_t steps);
+
+        /**
+         * @brief Run the simulation in virtual time, processing every event
+         * scheduled up to a time. On the first call every agent is woken at
+         * the current time; afterwards agents are only woken when they asked
+         * to be (AgentContext::scheduleWakeup()). May be called repeatedly to
+         * advance the simulation in slices.
+         *
+         * @param endTimeNs - virtual time to run until (ns, inclusive)
+         */
+        void runUntil(int64_t endTimeNs);
+
+        /**
+         * @brief Set the simulated network delays of virtual time runs.
+         *
+         * @param t_latency - order and report delays
+         */
+        void setLatency(const AgentLatency& t_latency);
+
+        /**
+         * @brief Switch the books to frequent batch auctions, or back to
+         * continuous matching (which runs a final auction on every book).
+         *
+         * @param t_auctions - auction intervals and allocation rule
+         */
+        void setAuctions(const AuctionSchedule& t_auctions);
+
+        // AgentContext: requests of the agent being woken
+        ErrorCode submitOrder(uint32_t bookIndex, int qty, double price, OrderSide side, OrderType type,
+                              std::string* orderId = nullptr, int64_t timeToLiveNs = 0) override;
+        ErrorCode cancelOrder(uint32_t bookIndex, const std::string& orderId) override;
+        void scheduleWakeup(int64_t delayNs) override;
+        uint32_t getBookCount() const override;
+        double getBestBid(uint32_t bookIndex) const override;
+        double getBestAsk(uint32_t bookIndex) const override;
+        double getLastTradePrice(uint32_t bookIndex) const override;
+        uint64_t getStep() const override;
+        int64_t getTime() const override;
+
+        /**
+         * @brief Accessor functions for the simulation (getters).
+         *
+         * getSeed() - gets the simulation seed
+         * getAgentCount() - gets the number of agents
+         * getAgent() - gets an agent by index (order added)
+         * getOrderBook() - gets the order book of a symbol index
+         * getStats() - gets the simulation counters
+         */
+        uint64_t getSeed() const;
+        uint32_t getAgentCount() const;
+        Agent& getAgent(uint32_t index);
+        OrderBook& getOrderBook(uint32_t bookIndex);
+        const AgentManagerStats& getStats() const;
+
+    private:
+        /**
+         * @brief Listener of one order book; tags the book's events with its index.
+         */
+        class BookFeed : public OrderBookListener {
+            public:
+                BookFeed(AgentManager& manager, uint32_t bookIndex) : manager(manager), bookIndex(bookIndex) {}
+
+                void onTrade(const TradeEvent& event) override;
+                void onExecution(const ExecutionEvent& event) override;
+
+            private:
+                AgentManager& manager; // Manager receiving the events
+                uint32_t bookIndex;    // Index of the book
+        };
+
+        /**
+         * @brief Execution recorded while a request runs. The event's order ID
+         * points into the book and may not outlive the request, so it is copied.
+         */
+        struct PendingExecution {
+            uint32_t bookIndex;    // Book of the order
+            ExecutionEvent event;  // Execution details (orderId re-pointed at the copy)
+            std::string orderId;   // Copy of the order ID
+        };
+
+        /**
+         * @brief Scheduled event of a virtual time run.
+         */
+        enum class SimEventType : uint8_t {
+            WAKEUP,             // Wake an agent
+            ORDER_ARRIVAL,      // Order reaches its book
+            CANCEL_ARRIVAL,     // Cancel reaches its book
+            ORDER_EXPIRY,       // Resting order's time to live ran out
+            ORDER_ACCEPTED,     // Ack of a resting order reaches its agent
+            EXECUTION_DELIVERY, // Fill or cancel reaches its agent
+            AUCTION             // Batch auction on every book
+        };
+
+        struct SimEvent {
+            SimEventType type;        // Kind of event
+            uint32_t agentIndex;      // Agent the event belongs to
+            uint32_t bookIndex;       // Book of the order
+            int qty;                  // ORDER_ARRIVAL / ORDER_ACCEPTED: quantity
+            double price;             // ORDER_ARRIVAL / ORDER_ACCEPTED: price
+            OrderSide side;           // ORDER_ARRIVAL / ORDER_ACCEPTED: side
+            OrderType orderType;      // ORDER_ARRIVAL: type
+            int64_t timeToLiveNs;     // ORDER_ARRIVAL: time to live (0 = none)
+            std::string orderId;      // Order ID (except ORDER_ARRIVAL and WAKEUP)
+            ExecutionEvent execution; // EXECUTION_DELIVERY: details (orderId re-pointed at the copy)
+        };
+
+        /**
+         * @brief Execute an order for an agent against its book.
+         *
+         * @param agentIndex - agent placing the order
+         * @param bookIndex - book of the order
+         * @param qty - quantity of the order
+         * @param price - price of the order
+         * @param side - side of the order
+         * @param type - type of the order
+         * @param timeToLiveNs - time to live of the resting remainder (0 = none)
+         * @param orderId - populated with the new order ID (optional)
+         *
+         * @return ErrorCode - OK if the order was accepted
+         */
+        ErrorCode executeOrder(uint32_t agentIndex, uint32_t bookIndex, int qty, double price, OrderSide side,
+                               OrderType type, int64_t timeToLiveNs, std::string* orderId);
+
+        /**
+         * @brief Cancel a resting order for the agent that owns it.
+         *
+         * @param agentIndex - agent canceling the order
+         * @param bookIndex - book of the order
+         * @param orderId - ID of the order
+         * @param expiry - true if the order's time to live ran out
+         *
+         * @return ErrorCode - OK if the order was canceled
+         */
+        ErrorCode executeCancel(uint32_t agentIndex, uint32_t bookIndex, const std::string& orderId, bool expiry);
+
+        /**
+         * @brief Route the executions recorded during a request to the owners
+         * of the orders, now or after the report latency.
+         */
+        void routeExecutions();
+
+        /**
+         * @brief Apply an execution to its agent and notify it.
+         *
+         * @param agentIndex - owner of the order
+         * @param bookIndex - book of the order
+         * @param event - execution details
+         */
+        void deliverExecution(uint32_t agentIndex, uint32_t bookIndex, const ExecutionEvent& event);
+
+        /**
+         * @brief Execute the requests the strategies queued, routing the
+         * executions they cause to the agents, until no strategy has requests
+         * left (or a round limit is reached; the rest runs after the next request).
+         */
+        void drainStrategies();
+
+        /**
+         * @brief Run a batch auction on every book and route its executions.
+         */
+        void runAuctions();
+
+        /**
+         * @brief Process one scheduled event.
+         *
+         * @param event - event to process
+         */
+        void dispatch(SimEvent& event);
+
+        /**
+         * @return bool - true if reports travel with a delay in the current run
+         */
+        bool reportsDelayed() const;
+
+        uint64_t seed;           // Simulation seed
+        AgentRandom random;      // Shuffles the wake order
+        uint64_t step;           // Current step
+        AgentManagerStats stats; // Simulation counters
+
+        std::vector<std::unique_ptr<OrderBook>> books; // Order book per symbol
+        std::vector<std::unique_ptr<BookFeed>> feeds;  // Listener per book
+        std::vector<double> lastTradePrices;           // Last trade price per book (0 = none)
+
+        std::vector<std::unique_ptr<StrategyHost>> strategies; // Strategies attached to the books
+
+        std::vector<std::unique_ptr<Agent>> agents; // Agents, in the order added
+        std::vector<uint32_t> wakeOrder;            // Agent indexes, shuffled every step
+
+        std::unordered_map<std::string, uint32_t> orderOwners; // Resting order ID => agent index
+        std::vector<PendingExecution> executions;              // Executions of the running request
+        uint32_t currentAgent;                                 // Index of the agent being woken
+        bool routing;                                          // True while executions are delivered
+
+        utils::VirtualClock clock;   // Virtual time; installed on the thread during runUntil()
+        EventQueue<SimEvent> events; // Scheduled events of the virtual time run
+        AgentLatency latency;        // Simulated network delays
+        AuctionSchedule auctions;    // Batch auction intervals (none for continuous matching)
+        bool auctionScheduled;       // True while an AUCTION event is queued
+        bool virtualTime;            // True while runUntil() runs
+        bool agentsScheduled;        // True once every agent had its first wakeup scheduled
+}; // AgentManager
+
+#endif // AGENTMANAGER_H
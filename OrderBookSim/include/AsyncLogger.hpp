@@ -0,0 +1,258 @@
+// Global Includes
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Project Includes
+#include <ShmRing.hpp>
+#include <Threading.hpp>
+
+#ifndef ASYNCLOGGER_H
+#define ASYNCLOGGER_H
+
+/**
+ * Asynchronous binary logger. A logging call only copies a compact record
+ * (format string address, timestamp and raw argument values) into a ring
+ * owned by the calling thread. A background thread formats the records of
+ * every thread and writes them to the console in batches.
+ *
+ * The per-thread rings are single-producer/single-consumer (@see shm::ShmRing),
+ * so the logging call never takes a lock or makes a system call. If a ring is
+ * full the record is dropped and counted rather than blocking the caller.
+ */
+namespace logger {
+    constexpr size_t MAX_RECORD_SIZE    = 512;     // Largest record (bytes); long strings are truncated
+    constexpr uint64_t RING_CAPACITY    = 1 << 20; // Bytes of records buffered per thread (power of two)
+    constexpr int FLUSH_INTERVAL_MS     = 1;       // Background thread sleep when every ring is empty
+
+    /**
+     * @brief Type of an argument stored in a record.
+     */
+    enum class ArgType : uint8_t {
+        INT    = 1, // int64
+        UINT   = 2, // uint64
+        DOUBLE = 3, // double
+        STRING = 4  // uint16 length followed by the characters
+    };
+
+    /**
+     * @brief Fixed part of a record. The arguments follow it, each as a type
+     * byte and the raw value.
+     */
+    struct RecordHeader {
+        const char* format; // Format string with one "{}" per argument (string literal)
+        int64_t timestamp;  // Time of the call (ns since epoch)
+        uint16_t size;      // Total record size, header included (bytes)
+        uint8_t level;      // Logging level (@see LogLevel)
+        uint8_t argCount;   // Number of arguments
+    };
+
+    /**
+     * @brief Record being built on the caller's stack.
+     */
+    class Record {
+        public:
+            /**
+             * @brief Start a record.
+             *
+             * @param level - logging level
+             * @param format - format string (must outlive the logger; use a literal)
+             */
+            Record(uint8_t level, const char* format);
+
+            /**
+             * @brief Append an argument. Integers and floating point values are
+             * stored raw; strings are copied (truncated to fit the record).
+             *
+             * @param value - argument value
+             */
+            template <typename T>
+            void append(const T& value) {
+                if constexpr (std::is_floating_point<T>::value) {
+                    appendRaw(ArgType::DOUBLE, static_cast<double>(value));
+                }
+                else if constexpr (std::is_integral<T>::value && std::is_signed<T>::value) {
+                    appendRaw(ArgType::INT, static_cast<int64_t>(value));
+                }
+                else if constexpr (std::is_integral<T>::value) {
+                    appendRaw(ArgType::UINT, static_cast<uint64_t>(value));
+                }
+                else if constexpr (std::is_enum<T>::value) {
+                    appendRaw(ArgType::INT, static_cast<int64_t>(value));
+                }
+                else {
+                    appendString(value);
+                }
+            }
+
+            /**
+             * @brief Accessor functions for the record (getters).
+             *
+             * data() - gets the encoded record (header first)
+             * size() - gets the encoded size (bytes)
+             */
+            const char* data() const;
+            size_t size() const;
+
+        private:
+            /**
+             * @brief Append a fixed size value if it fits.
+             */
+            template <typename T>
+            void appendRaw(ArgType type, T value) {
+                if (length + 1 + sizeof(T) > MAX_RECORD_SIZE) return;
+
+                buffer[length] = static_cast<char>(type);
+                std::memcpy(buffer + length + 1, &value, sizeof(T));
+                length += 1 + sizeof(T);
+                header().size = static_cast<uint16_t>(length);
+                header().argCount++;
+            }
+
+            /**
+             * @brief Append a string argument, truncated to the remaining space.
+             */
+            void appendString(const std::string& value);
+            void appendString(const char* value);
+
+            RecordHeader& header();
+
+            alignas(RecordHeader) char buffer[MAX_RECORD_SIZE]; // Encoded record
+            size_t length;                                      // Bytes used
+    };
+
+    /**
+     * Background side of the logger: owns the per-thread rings and the thread
+     * that formats and writes their records.
+     */
+    class AsyncLogger {
+        public:
+            /**
+             * @brief Get the process-wide logger. The background thread is started
+             * on first use and stopped (after writing every record) at exit.
+             *
+             * @return AsyncLogger& - logger
+             */
+            static AsyncLogger& instance();
+
+            /**
+             * @brief Copy a record into the calling thread's ring.
+             *
+             * @param record - encoded record
+             */
+            void submit(const Record& record);
+
+            /**
+             * @brief Block until every record submitted before the call is written.
+             */
+            void flush();
+
+            /**
+             * @brief Get the number of records dropped because a ring was full.
+             *
+             * @return uint64_t - dropped records
+             */
+            uint64_t getDroppedRecords() const;
+
+            /**
+             * @brief Set the CPU of the background thread. Applied by the
+             * background thread on its next pass.
+             *
+             * @param t_placement - placement of the background thread
+             */
+            void setThreadPlacement(const threading::ThreadPlacement& t_placement);
+
+        private:
+            AsyncLogger();
+            ~AsyncLogger();
+
+            AsyncLogger(const AsyncLogger&) = delete;
+            AsyncLogger& operator=(const AsyncLogger&) = delete;
+
+            /**
+             * @brief Record ring of one thread. Retired when the thread exits;
+             * removed by the background thread once drained.
+             */
+            struct ThreadRing {
+                shm::ShmRing control;              // Ring positions
+                std::vector<char> data;            // Ring data (RING_CAPACITY bytes)
+                std::atomic<bool> retired{false};  // True once the owning thread exited
+            };
+
+            /**
+             * @brief Get the calling thread's ring, creating it on first use.
+             */
+            ThreadRing& threadRing();
+
+            /**
+             * @brief Background thread. Drains the rings, formats the records and
+             * writes them in batches.
+             */
+            void run();
+
+            /**
+             * @brief Format every record currently in the rings into the batch.
+             *
+             * @return bool - true if any record was formatted
+             */
+            bool drainRings();
+
+            /**
+             * @brief Format one record into the batch.
+             *
+             * @param record - encoded record
+             */
+            void formatRecord(const char* record);
+
+            /**
+             * @brief Append the "[YYYY-mm-dd HH:MM:SS.mmm] " prefix of a timestamp.
+             *
+             * @param timestamp - ns since epoch
+             */
+            void appendTimestamp(int64_t timestamp);
+
+            std::mutex ringsMutex;                          // Guards the ring list
+            std::vector<std::shared_ptr<ThreadRing>> rings; // Rings of every thread that logged
+
+            std::string batch;        // Formatted records not yet written
+            int64_t cachedSecond;     // Second of the cached timestamp prefix
+            std::string cachedPrefix; // "YYYY-mm-dd HH:MM:SS" of cachedSecond
+
+            std::mutex flushMutex;           // Guards the flush counters
+            std::condition_variable flushed; // Signalled after every background pass and on flush requests
+            uint64_t flushRequests;          // Callers waiting in flush()
+            uint64_t flushPasses;            // Background passes completed
+
+            threading::ThreadPlacement placement; // Placement of the background thread (guarded by flushMutex)
+            bool placementPending;                // True until the background thread applied the placement
+
+            std::atomic<uint64_t> dropped; // Records dropped because a ring was full
+            std::atomic<bool> running;     // False to stop the background thread
+            std::thread worker;            // Background thread
+    }; // AsyncLogger
+
+    /**
+     * @brief Encode a record and queue it on the calling thread's ring.
+     *
+     * @param level - logging level
+     * @param format - format string with one "{}" per argument (string literal)
+     * @param args - arguments
+     */
+    template <typename... Args>
+    void write(uint8_t level, const char* format, const Args&... args) {
+        Record record(level, format);
+        (record.append(args), ...);
+        AsyncLogger::instance().submit(record);
+    }
+}; // logger
+
+#endif // ASYNCLOGGER_H
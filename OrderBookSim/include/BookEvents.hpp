@@ -0,0 +1,77 @@
+// Project Includes
+#include <Types.hpp>
+
+#ifndef BOOKEVENTS_H
+#define BOOKEVENTS_H
+
+/**
+ * @brief Aggregated state of one price level after it changed. A quantity of
+ * zero means the level was removed from the book.
+ */
+struct BookLevelEvent {
+    const char* symbol;   // Symbol of the order book
+    OrderSide side;       // Side of the book the level is on
+    double price;         // Price of the level
+    int qty;              // Total resting quantity at the level
+    int orderCount;       // Number of resting orders at the level
+    long long timestamp;  // Time of the change (ms since epoch)
+};
+
+/**
+ * @brief A single execution between an incoming and a resting order.
+ */
+struct TradeEvent {
+    const char* symbol;      // Symbol of the order book
+    OrderSide aggressorSide; // Side of the incoming (aggressing) order
+    double price;            // Execution price (resting order's price)
+    int qty;                 // Executed quantity
+    long long timestamp;     // Time of the execution (ms since epoch)
+};
+
+/**
+ * @brief A change to a single order: a fill (either side of a trade) or the
+ * removal of its remaining quantity without a fill.
+ */
+struct ExecutionEvent {
+    const char* symbol;  // Symbol of the order book
+    const char* orderId; // ID of the order
+    ExecutionType type;  // FILL or CANCEL
+    OrderSide side;      // Side of the order
+    double price;        // Execution price (0 for CANCEL)
+    int qty;             // Executed / canceled quantity
+    int leavesQty;       // Quantity still resting after the event
+    long long timestamp; // Time of the event (ms since epoch)
+};
+
+/**
+ * Receives events from an order book. Callbacks run synchronously on the thread
+ * that is modifying the book, so implementations must return quickly and must
+ * not modify the book from inside a callback.
+ */
+class OrderBookListener {
+    public:
+        virtual ~OrderBookListener() = default;
+
+        /**
+         * @brief Called after a price level changed.
+         *
+         * @param event - new aggregated state of the level
+         */
+        virtual void onBookUpdate(const BookLevelEvent& event) { (void)event; }
+
+        /**
+         * @brief Called for every execution in the book.
+         *
+         * @param event - execution details
+         */
+        virtual void onTrade(const TradeEvent& event) { (void)event; }
+
+        /**
+         * @brief Called for every fill and cancel of an individual order.
+         *
+         * @param event - order, quantity and remaining quantity
+         */
+        virtual void onExecution(const ExecutionEvent& event) { (void)event; }
+}; // OrderBookListener
+
+#endif // BOOKEVENTS_H
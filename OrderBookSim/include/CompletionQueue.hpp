@@ -0,0 +1,98 @@
+// Global Includes
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Project Includes
+#include <RequestTrace.hpp>
+#include <Session.hpp>
+#include <Types.hpp>
+
+#ifndef COMPLETIONQUEUE_H
+#define COMPLETIONQUEUE_H
+
+/**
+ * @brief Response of a request handled by a matching engine, addressed to the
+ * session (and request position) it answers.
+ */
+struct Completion {
+    Session* session;                   // Session that sent the request
+    uint64_t seq;                       // Sequence number of the request in the session
+    OrderResponse response;             // Response of the request
+    std::shared_ptr<QueryResult> query; // Result of a query; nullptr for other requests
+    trace::RequestTrace trace;          // Timestamps of a sampled request
+};
+
+/**
+ * @brief Execution report addressed to the session that owns the order. The
+ * session is identified by ID because it may have disconnected while the
+ * order was resting; reports for unknown sessions are dropped.
+ */
+struct RoutedReport {
+    uint32_t sessionId;     // Session that owns the order
+    ExecutionReport report; // Report to send
+};
+
+/**
+ * Hands completed requests from the matching engines back to the transport
+ * thread that owns the sessions. Engines push completions in batches; the
+ * transport drains them all at once and writes each response to its session.
+ * The transport is woken only when the queue goes from empty to non-empty.
+ */
+class CompletionQueue {
+    public:
+        /**
+         * @brief Constructor for a new completion queue.
+         *
+         * @param wake - wakes the transport thread that drains the queue
+         */
+        explicit CompletionQueue(
+            std::function<void()> wake
+        );
+
+        /**
+         * @brief Append completions to the queue (any thread).
+         *
+         * @param completions - first completion
+         * @param count - number of completions
+         */
+        void push(const Completion* completions, size_t count);
+
+        /**
+         * @brief Append execution reports to the queue (any thread).
+         *
+         * @param reports - first report
+         * @param count - number of reports
+         */
+        void push(const RoutedReport* reports, size_t count);
+
+        /**
+         * @brief Take every queued completion and report (transport thread).
+         * The vectors are swapped with the queue's buffers, so both keep their
+         * capacity. Completions must be handled before the reports, so a report
+         * is never sent ahead of the response that created its order.
+         *
+         * @param completions - cleared and populated with the queued completions
+         * @param reports - cleared and populated with the queued reports
+         */
+        void drain(std::vector<Completion>& completions, std::vector<RoutedReport>& reports);
+
+        /**
+         * @brief Check whether completions are queued without locking.
+         *
+         * @return bool - true if the queue is empty
+         */
+        bool empty() const;
+
+    private:
+        std::function<void()> wake;              // Wakes the transport thread
+        std::mutex queueMutex;                   // Guards the queued completions and reports
+        std::vector<Completion> queued;          // Completions not yet drained
+        std::vector<RoutedReport> queuedReports; // Reports not yet drained
+        std::atomic<bool> hasCompletions;        // True while completions or reports are queued
+}; // CompletionQueue
+
+#endif // COMPLETIONQUEUE_H
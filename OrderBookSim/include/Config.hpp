@@ -0,0 +1,148 @@
+// Global Includes
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Project Includes
+#include <Admission.hpp>
+#include <Network.hpp>
+#include <OrderFlow.hpp>
+#include <Threading.hpp>
+#include <Types.hpp>
+
+#ifndef CONFIG_H
+#define CONFIG_H
+
+/**
+ * @brief Startup configuration of the order book simulator (@see main.cpp).
+ *
+ * Set from the command line and/or a config file. A config file holds one
+ * "key = value" option per line ('#' starts a comment); the keys are the long
+ * option names without the leading dashes (e.g. "busy-poll = true").
+ */
+struct ServerConfig {
+    int port = 8080;                                 // Port of the order book manager
+    std::vector<std::string> symbols;                // Symbols of the initial order books
+    bool logging = false;                            // Console logging
+    uint32_t shmSlots = 16;                          // Shared memory agent slots; 0 to disable
+    std::string marketDataGroup = "239.255.0.1";     // Multicast group of the market data feed
+    std::string marketDataInterface = "127.0.0.1";   // Interface the market data feed is published on
+    net::IoBackend ioBackend = net::IoBackend::POLL; // Socket event loop
+    uint32_t engineThreads = 1;                      // Matching engine threads
+    uint32_t warmBooks = 64;                         // Spare order books for symbols added at runtime
+    threading::ThreadConfig threads;                 // Busy-poll mode and thread placement
+    AdmissionLimits limits;                          // Flow control limits of the sessions and engines
+    bool marketMaker = false;                        // Run a QuotingStrategy on every book (server and simulation)
+    uint32_t traceSample = 0;                        // Trace one request in this many; 0 to disable
+    std::string traceOutput = "trace.json";          // Request trace file, written on SIGUSR2
+
+    // In-process simulation (@see AgentManager); runs instead of the server when agents > 0
+    uint32_t agents = 0;         // Zero-intelligence agents to simulate
+    uint64_t agentSteps = 1000;  // Steps to run (each wakes every agent once)
+    uint64_t seed = 1;           // Simulation seed
+    uint64_t simSeconds = 0;     // Virtual time to simulate instead of steps; 0 for steps
+    int64_t latencyNs = 0;       // Virtual time run: order and report latency
+    uint32_t flowAgents = 0;     // Order flow agents (@see OrderFlowAgent), one book each in turn
+    ArrivalParams flowArrivals;  // Arrival process of each order flow agent
+
+    // Batch auctions of the simulation (@see AuctionSchedule); continuous matching when the interval is 0
+    uint64_t auctionInterval = 0;                                           // Steps between auctions (ms of virtual time with simSeconds)
+    AuctionAllocation auctionAllocation = AuctionAllocation::TIME_PRIORITY; // Rationing at the clearing price
+
+    // Parameter sweep (@see SweepRunner); runs instead of the server when sweepFile is set
+    std::string sweepFile;                 // Sweep file (one run per line)
+    std::string sweepOutput = "sweep.csv"; // Results file
+    uint32_t sweepWorkers = 0;             // Worker threads; 0 for one per hardware thread
+};
+
+namespace config {
+    /**
+     * @brief Apply the command line arguments to a configuration, in order.
+     * A config file (-c) is applied where it appears, so later arguments
+     * override it.
+     *
+     * Options:
+     *   -p, --port <port>             port of the order book manager
+     *   -s, --symbols <s1,s2,...>     symbols of the initial order books
+     *   -l, --logging                 console logging
+     *   -c, --config <file>           config file
+     *   --engines <n>                 matching engine threads
+     *   --batch-workers <n>           work-stealing workers per engine for multi-symbol batches
+     *   --warm-books <n>              spare books for symbols added at runtime
+     *   --shm-slots <n>               shared memory agent slots (0 = disabled)
+     *   --io-backend <poll|io_uring>  socket event loop
+     *   --market-data-group <ip>      multicast group of the market data feed
+     *   --market-data-interface <ip>  interface the feed is published on
+     *   --trace-sample <n>            trace one request in n end to end (0 = disabled)
+     *   --trace-out <file>            request trace file, written on SIGUSR2
+     *   --busy-poll                   spin-poll instead of blocking
+     *   --cpu-engines <c1,c2,...>     CPUs of the engine threads
+     *   --cpu-network <cpu>           CPU of the socket event loop
+     *   --cpu-shm <cpu>               CPU of the shared memory transport
+     *   --cpu-market-data <cpu>       CPU of the market data publisher
+     *   --cpu-logger <cpu>            CPU of the logger
+     *   --rt-priority <1-99>          real-time priority of the engine and I/O threads
+     *   --max-msg-rate <n>            sustained requests per second per session
+     *   --msg-burst <n>               requests a session may send at once
+     *   --max-outstanding <n>         requests per session queued and not yet answered
+     *   --max-open-orders <n>         orders per session resting in the books
+     *   --engine-high-watermark <n>   engine queue depth at which requests are throttled
+     *   --engine-low-watermark <n>    engine queue depth at which throttling stops
+     *   --market-maker                quote every book with the example market making strategy
+     *   --agents <n>                  run an in-process simulation of n agents instead of the server
+     *   --steps <n>                   simulation steps
+     *   --seed <n>                    simulation seed
+     *   --sim-seconds <n>             simulate n seconds of virtual time instead of steps
+     *   --latency-us <n>              virtual time run: agent <=> book latency (us)
+     *   --flow-agents <n>             add n order flow agents (Poisson, or Hawkes with --flow-hawkes)
+     *   --flow-rate <r>               order flow agent arrival rate (events per second)
+     *   --flow-hawkes <a,b>           Hawkes arrivals: excitation a and decay b (per second)
+     *   --auction-interval <n>        batch auctions every n steps (ms of virtual time with --sim-seconds)
+     *   --auction-allocation <rule>   auction rationing at the clearing price (time or pro-rata)
+     *   --sweep <file>                run the simulations of a sweep file instead of the server
+     *   --sweep-out <file>            sweep results file
+     *   --workers <n>                 sweep worker threads (0 = one per hardware thread)
+     *
+     * A limit of 0 disables it (@see AdmissionLimits).
+     *
+     * @param argc - number of command line arguments
+     * @param argv - command line arguments
+     * @param config - configuration to update
+     * @param error - populated with the reason if the arguments are invalid
+     *
+     * @return bool - true if every argument was valid; false otherwise
+     */
+    bool parseArguments(int argc, const char* const argv[], ServerConfig& config, std::string& error);
+
+    /**
+     * @brief Apply a config file to a configuration.
+     *
+     * @param path - path of the config file
+     * @param config - configuration to update
+     * @param error - populated with the reason if the file is invalid
+     *
+     * @return bool - true if the file was read and every option was valid; false otherwise
+     */
+    bool parseConfigFile(const std::string& path, ServerConfig& config, std::string& error);
+
+    /**
+     * @brief Apply one option to a configuration.
+     *
+     * @param key - option name without leading dashes (e.g. "port")
+     * @param value - option value ("true" for flags)
+     * @param config - configuration to update
+     * @param error - populated with the reason if the option is invalid
+     *
+     * @return bool - true if the option was applied; false otherwise
+     */
+    bool applyOption(const std::string& key, const std::string& value, ServerConfig& config, std::string& error);
+
+    /**
+     * @brief Get the usage text of the command line.
+     *
+     * @return std::string - usage text
+     */
+    std::string usage();
+}; // config
+
+#endif // CONFIG_H
@@ -0,0 +1,139 @@
+// Global Includes
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#ifndef EVENTQUEUE_H
+#define EVENTQUEUE_H
+
+/**
+ * Timestamped event queue of a discrete-event simulation (binary min-heap).
+ * Events are popped in time order; events scheduled for the same time are
+ * popped in the order they were scheduled, so a simulation that schedules the
+ * same events always replays them in the same order.
+ *
+ * Not thread-safe; owned by the simulation thread.
+ */
+template <typename T>
+class EventQueue {
+    public:
+        /**
+         * @brief Scheduled event.
+         */
+        struct Entry {
+            int64_t time;  // Virtual time of the event (ns)
+            uint64_t seq;  // Scheduling order; breaks ties between equal times
+            T event;       // Event payload
+        };
+
+        EventQueue() : heap(), nextSeq(0) {}
+
+        /**
+         * @brief Schedule an event.
+         *
+         * @param time - virtual time of the event (ns)
+         * @param event - event payload
+         */
+        void push(int64_t time, T event) {
+            heap.push_back(Entry{time, nextSeq++, std::move(event)});
+            siftUp(heap.size() - 1);
+        }
+
+        /**
+         * @return const Entry& - earliest event (queue must not be empty)
+         */
+        const Entry& top() const {
+            return heap.front();
+        }
+
+        /**
+         * @brief Remove the earliest event.
+         *
+         * @return Entry - earliest event (queue must not be empty)
+         */
+        Entry pop() {
+            Entry earliest = std::move(heap.front());
+
+            heap.front() = std::move(heap.back());
+            heap.pop_back();
+            if (!heap.empty()) siftDown(0);
+
+            return earliest;
+        }
+
+        /**
+         * @return bool - true if no event is scheduled
+         */
+        bool empty() const {
+            return heap.empty();
+        }
+
+        /**
+         * @return size_t - number of scheduled events
+         */
+        size_t size() const {
+            return heap.size();
+        }
+
+        /**
+         * @brief Drop every scheduled event.
+         */
+        void clear() {
+            heap.clear();
+        }
+
+    private:
+        /**
+         * @brief Check whether an entry is due before another.
+         */
+        static bool earlier(const Entry& a, const Entry& b) {
+            return a.time < b.time || (a.time == b.time && a.seq < b.seq);
+        }
+
+        /**
+         * @brief Move an entry up until its parent is earlier.
+         *
+         * @param index - position of the entry
+         */
+        void siftUp(size_t index) {
+            Entry entry = std::move(heap[index]);
+
+            while (index > 0) {
+                size_t parent = (index - 1) / 2;
+                if (!earlier(entry, heap[parent])) break;
+
+                heap[index] = std::move(heap[parent]);
+                index = parent;
+            }
+
+            heap[index] = std::move(entry);
+        }
+
+        /**
+         * @brief Move an entry down until its children are later.
+         *
+         * @param index - position of the entry
+         */
+        void siftDown(size_t index) {
+            Entry entry = std::move(heap[index]);
+            size_t count = heap.size();
+
+            while (true) {
+                size_t child = 2 * index + 1;
+                if (child >= count) break;
+                if (child + 1 < count && earlier(heap[child + 1], heap[child])) child++;
+                if (!earlier(heap[child], entry)) break;
+
+                heap[index] = std::move(heap[child]);
+                index = child;
+            }
+
+            heap[index] = std::move(entry);
+        }
+
+        std::vector<Entry> heap; // Binary min-heap ordered by (time, seq)
+        uint64_t nextSeq;        // Sequence of the next scheduled event
+}; // EventQueue
+
+#endif // EVENTQUEUE_H
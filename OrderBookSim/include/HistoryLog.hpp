@@ -0,0 +1,167 @@
+// Global Includes
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#ifndef HISTORYLOG_H
+#define HISTORYLOG_H
+
+/**
+ * Append-only log stored in fixed-size chunks. Entries never move once
+ * appended, so a View taken by the owning thread can be read from another
+ * thread while the owner keeps appending: the view only covers the entries
+ * that existed when it was taken, and keeps their chunks alive even after the
+ * log is cleared.
+ *
+ * Not thread-safe for writers; appends and clears belong to one thread.
+ */
+template <typename T>
+class HistoryLog {
+    public:
+        static constexpr size_t CHUNK_SIZE = 1024; // Entries per chunk
+
+        /**
+         * @brief Immutable view of the first entries of a log. Taking a view
+         * copies one pointer per chunk, not the entries.
+         */
+        class View {
+            public:
+                View() : chunks(), entries(), count(0) {}
+
+                /**
+                 * @brief Get an entry of the view.
+                 *
+                 * @param index - position of the entry (< size())
+                 *
+                 * @return const T& - entry
+                 */
+                const T& operator[](size_t index) const {
+                    return entries[index / CHUNK_SIZE][index % CHUNK_SIZE];
+                }
+
+                /**
+                 * @return size_t - number of entries in the view
+                 */
+                size_t size() const {
+                    return count;
+                }
+
+            private:
+                friend class HistoryLog;
+
+                std::vector<std::shared_ptr<const std::vector<T>>> chunks; // Keeps the chunks alive
+                std::vector<const T*> entries;                             // First entry of each chunk
+                size_t count;                                              // Entries in the view
+        };
+
+        HistoryLog() : chunks(), count(0) {}
+
+        /**
+         * @brief Append an entry to the log.
+         *
+         * @param entry - entry to append
+         */
+        void push_back(const T& entry) {
+            // Chunks are reserved up front and never reallocate
+            if (count == capacity()) {
+                addChunk();
+            }
+
+            chunks[count / CHUNK_SIZE]->push_back(entry);
+            count++;
+        }
+
+        /**
+         * @brief Allocate chunks ahead, so the log can grow to a number of
+         * entries without allocating.
+         *
+         * @param entries - entries the log must hold without allocating
+         */
+        void reserve(size_t entries) {
+            chunks.reserve((entries + CHUNK_SIZE - 1) / CHUNK_SIZE);
+
+            while (capacity() < entries) {
+                addChunk();
+            }
+        }
+
+        /**
+         * @return T& - last entry of the log (log must not be empty)
+         */
+        T& back() {
+            return chunks[(count - 1) / CHUNK_SIZE]->back();
+        }
+
+        /**
+         * @return size_t - number of entries in the log
+         */
+        size_t size() const {
+            return count;
+        }
+
+        /**
+         * @return size_t - entries the allocated chunks can hold
+         */
+        size_t capacity() const {
+            return chunks.size() * CHUNK_SIZE;
+        }
+
+        /**
+         * @brief Remove every entry. Views already taken keep their entries.
+         */
+        void clear() {
+            chunks.clear();
+            count = 0;
+        }
+
+        /**
+         * @brief Take a view of every entry currently in the log.
+         *
+         * @return View - view of the log
+         */
+        View view() const {
+            View snapshot;
+            snapshot.chunks.reserve(chunks.size());
+            snapshot.entries.reserve(chunks.size());
+
+            for (const std::shared_ptr<std::vector<T>>& chunk : chunks) {
+                if (chunk->empty()) break;
+
+                snapshot.chunks.push_back(chunk);
+                snapshot.entries.push_back(chunk->data());
+            }
+
+            snapshot.count = count;
+            return snapshot;
+        }
+
+        /**
+         * @brief Copy every entry into a vector.
+         *
+         * @return std::vector<T> - entries, oldest first
+         */
+        std::vector<T> toVector() const {
+            std::vector<T> entries;
+            entries.reserve(count);
+
+            for (const std::shared_ptr<std::vector<T>>& chunk : chunks) {
+                entries.insert(entries.end(), chunk->begin(), chunk->end());
+            }
+
+            return entries;
+        }
+
+    private:
+        /**
+         * @brief Append an empty chunk with room for CHUNK_SIZE entries.
+         */
+        void addChunk() {
+            chunks.push_back(std::make_shared<std::vector<T>>());
+            chunks.back()->reserve(CHUNK_SIZE);
+        }
+
+        std::vector<std::shared_ptr<std::vector<T>>> chunks; // Chunks, oldest first; only the last used one grows
+        size_t count;                                        // Entries in the log
+}; // HistoryLog
+
+#endif // HISTORYLOG_H
@@ -0,0 +1,110 @@
+// Global Includes
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+#ifndef LATENCYHISTOGRAM_H
+#define LATENCYHISTOGRAM_H
+
+/**
+ * Latency histogram with HDR-style log-linear buckets: values below 2048 are
+ * counted exactly, and every power-of-two range above is split into 1024
+ * linear sub-buckets, so any recorded value is known to within 0.1% (three
+ * significant digits) at a fixed memory cost and O(1) per record. Values
+ * above MAX_VALUE are counted as MAX_VALUE.
+ *
+ * Not thread-safe; record per thread and merge().
+ */
+class LatencyHistogram {
+    public:
+        static constexpr int SUB_BUCKET_BITS = 10;              // log2 of the sub-buckets per power of two
+        static constexpr int64_t MAX_VALUE = (1LL << 40) - 1;   // Largest value tracked (~18 minutes in ns)
+
+        /**
+         * @brief Constructor for an empty histogram.
+         */
+        LatencyHistogram();
+
+        /**
+         * @brief Record a value.
+         *
+         * @param value - value to record (negative values are recorded as 0)
+         * @param count - number of times to record it
+         */
+        void record(int64_t value, uint64_t count = 1);
+
+        /**
+         * @brief Add the counts of another histogram.
+         *
+         * @param other - histogram to add
+         */
+        void merge(const LatencyHistogram& other);
+
+        /**
+         * @brief Remove every recorded value.
+         */
+        void reset();
+
+        /**
+         * @brief Get the value at a percentile: the largest value equivalent
+         * (same bucket) to the value below which the given share of the
+         * recorded values fall.
+         *
+         * @param percentile - percentile (0-100)
+         *
+         * @return int64_t - value at the percentile; 0 if empty
+         */
+        int64_t valueAtPercentile(double percentile) const;
+
+        /**
+         * @brief Write the percentile distribution in the HdrHistogram text
+         * format (Value, Percentile, TotalCount, 1/(1-Percentile)), which the
+         * usual HDR plotting tools read.
+         *
+         * @param out - stream to write to
+         * @param unitScale - values are divided by this (e.g. 1000 for ns => us)
+         * @param ticksPerHalfDistance - reporting steps per halving of the distance to 100%
+         */
+        void writePercentiles(std::ostream& out, double unitScale = 1.0, int ticksPerHalfDistance = 5) const;
+
+        /**
+         * @brief Accessor functions for the histogram (getters).
+         *
+         * getCount() - gets the number of recorded values
+         * getMin() / getMax() - gets the smallest / largest recorded value; 0 if empty
+         * getMean() - gets the mean of the recorded values; 0 if empty
+         */
+        uint64_t getCount() const;
+        int64_t getMin() const;
+        int64_t getMax() const;
+        double getMean() const;
+
+    private:
+        /**
+         * @brief Get the bucket counting a value.
+         *
+         * @param value - value in [0, MAX_VALUE]
+         *
+         * @return size_t - index into counts
+         */
+        static size_t indexOf(int64_t value);
+
+        /**
+         * @brief Get the smallest and largest value counted by a bucket.
+         *
+         * @param index - index into counts
+         *
+         * @return int64_t - lowest / highest value of the bucket
+         */
+        static int64_t lowestValueAt(size_t index);
+        static int64_t highestValueAt(size_t index);
+
+        std::vector<uint64_t> counts; // Count of every bucket
+        uint64_t totalCount;          // Number of recorded values
+        int64_t minValue;             // Smallest recorded value
+        int64_t maxValue;             // Largest recorded value
+        double sum;                   // Sum of the recorded values
+}; // LatencyHistogram
+
+#endif // LATENCYHISTOGRAM_H
@@ -1,12 +1,21 @@
 #pragma once
 
 // Global Includes
-#include <chrono>
-#include <iomanip>
-#include <iostream>
-#include <sstream>
+#include <cstdint>
 #include <string>
 
+// Project Includes
+#include <AsyncLogger.hpp>
+
+/**
+ * @brief Lowest severity compiled into the binary: 0 DEBUG, 1 INFO, 2 WARN,
+ * 3 ERR. Calls below it compile to nothing (e.g. -DOBM_LOG_LEVEL=2 keeps
+ * only warnings and errors).
+ */
+#ifndef OBM_LOG_LEVEL
+#define OBM_LOG_LEVEL 0
+#endif
+
 /**
  * @brief Specifies the system logging levels.
  */
@@ -18,23 +27,42 @@ enum class LogLevel {
 };
 
 /**
- * @brief Get the current timestamp in string format. The timestamp
- * format is: %Y-%m-%d %H:%M:%S
+ * @brief Check whether a logging level is compiled in (@see OBM_LOG_LEVEL).
+ *
+ * @param level - logging level
  *
- * @return std::string - string of the current timestamp
+ * @return bool - true if calls at the level are compiled in; false otherwise
  */
-inline std::string currentTimestamp() {
-    auto now     = std::chrono::system_clock::now();
-    auto time_t  = std::chrono::system_clock::to_time_t(now);
-    auto ms      = std::chrono::duration_cast<std::chrono::milliseconds>(
-                      now.time_since_epoch()) % 1000;
+constexpr bool isLogLevelEnabled(LogLevel level) {
+    int severity = 0;
 
-    // Build the timestamp string
-    std::ostringstream oss;
-    oss << std::put_time(std::localtime(&time_t), "%Y-%m-%d %H:%M:%S")
-        << '.' << std::setfill('0') << std::setw(3) << ms.count();
+    switch (level) {
+        case LogLevel::DEBUG: severity = 0; break;
+        case LogLevel::INFO:  severity = 1; break;
+        case LogLevel::WARN:  severity = 2; break;
+        case LogLevel::ERR:   severity = 3; break;
+    }
 
-    return oss.str();
+    return severity >= OBM_LOG_LEVEL;
+}
+
+/**
+ * @brief Log an event to the console at the correct logging level. The call
+ * only queues the format string address and the raw arguments; formatting
+ * and writing happen on the logger thread (@see logger::AsyncLogger).
+ *
+ * @param logEnabled - true if logging enabled; false to not log the event
+ * @param format - format string with one "{}" per argument (string literal)
+ * @param args - arguments (integers, floating point values, enums or strings)
+ */
+template <LogLevel level, typename... Args>
+inline void logEvent(bool logEnabled, const char* format, const Args&... args) {
+    if constexpr (isLogLevelEnabled(level)) {
+        // Logging not enabled
+        if (!logEnabled) return;
+
+        logger::write(static_cast<uint8_t>(level), format, args...);
+    }
 }
 
 /**
@@ -49,17 +77,7 @@ inline void logMessage(LogLevel level,
                        bool logEnabled = false) {
 
     // Logging not enabled
-    if (!logEnabled) return;
-
-    std::cout << "[" << currentTimestamp() << "] ";
+    if (!logEnabled || !isLogLevelEnabled(level)) return;
 
-    // Log the correct level information
-    switch (level) {
-        case LogLevel::INFO:  std::cout << "[INFO] ";  break;
-        case LogLevel::DEBUG: std::cout << "[DEBUG] "; break;
-        case LogLevel::WARN:  std::cout << "[WARN] ";  break;
-        case LogLevel::ERR:   std::cout << "[ERROR] "; break;
-    }
-
-    std::cout << message << std::endl;
-}
\ No newline at end of file
+    logger::write(static_cast<uint8_t>(level), "{}", message);
+}
@@ -0,0 +1,255 @@
+// Global Includes
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// Project Includes
+#include <BookEvents.hpp>
+#include <Logger.h>
+#include <Network.hpp>
+#include <Protocol.hpp>
+#include <SocketSession.hpp>
+#include <Threading.hpp>
+#include <Types.hpp>
+
+#ifndef MARKETDATAPUBLISHER_H
+#define MARKETDATAPUBLISHER_H
+
+/**
+ * Publishes sequenced incremental book updates and trades for every order book
+ * over UDP multicast, and serves book snapshots over TCP so late joiners and
+ * consumers that detect a sequence gap can resynchronize.
+ *
+ * The matching path only appends fixed-size event records to the feed of its
+ * book: a single-producer, single-consumer ring per book, indexed by the
+ * book's dense symbol ID. A book is only modified by one thread at a time (its
+ * engine thread, or one of the engine's batch workers), so pushing an event
+ * takes no lock and allocates nothing, and books matched on different threads
+ * never share a ring. Sequencing, datagram packing, sending and snapshot
+ * requests are all handled on the publisher thread, which drains the rings.
+ * The publisher keeps its own aggregated image of every book, built from the
+ * updates it publishes, so snapshots are always consistent with the published
+ * sequence numbers without touching the books.
+ */
+class MarketDataPublisher {
+    public:
+        /**
+         * @brief Constructor for a new market data publisher.
+         *
+         * @param multicastGroup - IPv4 multicast group of the update feed
+         * @param multicastPort - UDP port of the update feed
+         * @param multicastInterface - IPv4 address of the interface to publish on
+         * @param snapshotPort - TCP port of the snapshot service
+         * @param flushIntervalMs - maximum time updates are held to batch them into datagrams
+         * @param bookCount - number of order book slots (one feed per symbol ID)
+         * @param logging - console logging flag
+         */
+        MarketDataPublisher(
+            std::string multicastGroup,
+            int multicastPort,
+            std::string multicastInterface,
+            int snapshotPort,
+            int flushIntervalMs,
+            uint32_t bookCount,
+            bool logging
+        );
+        ~MarketDataPublisher();
+
+        /**
+         * @brief Create the multicast and snapshot sockets and start the publisher thread.
+         *
+         * @return bool - true if started; false otherwise
+         */
+        bool start();
+
+        /**
+         * @brief Publish pending updates, then stop the publisher thread.
+         */
+        void stop();
+
+        /**
+         * @brief Set the CPU and scheduling of the publisher thread; must be
+         * called before start().
+         *
+         * @param t_placement - placement of the publisher thread
+         */
+        void setThreadPlacement(const threading::ThreadPlacement& t_placement);
+
+        /**
+         * @brief Register the symbol assigned to a symbol ID, so snapshots can
+         * be served before its first update. May be called at any time (symbols
+         * are added at runtime), but must be called before the book publishes
+         * under the new symbol: events already in the feed are published under
+         * the symbol the ID had before.
+         *
+         * @param symbolId - dense symbol ID of the book (@see SymbolTable)
+         * @param symbol - symbol assigned to the book
+         */
+        void addSymbol(uint32_t symbolId, const std::string& symbol);
+
+        /**
+         * @brief Get the feed of a book, to attach to the book as a listener.
+         *
+         * @param symbolId - dense symbol ID of the book
+         *
+         * @return OrderBookListener* - feed of the book; nullptr if the ID is out of range
+         */
+        OrderBookListener* getFeed(uint32_t symbolId);
+
+        static constexpr uint64_t FEED_CAPACITY = 4096; // Events each feed holds (power of two)
+
+    private:
+        /**
+         * @brief Fixed-size record of a book event queued by the matching path.
+         */
+        struct PendingEvent {
+            MarketDataType type; // Type of the update
+            OrderSide side;      // Level side / aggressor side
+            int qty;             // Level quantity / executed quantity
+            double price;        // Level price / execution price
+            long long timestamp; // Time of the event
+        };
+
+        /**
+         * @brief Events of one book, from the thread modifying the book to the
+         * publisher thread. The producer waits for the publisher if the ring
+         * is full, so no event is ever dropped.
+         */
+        class Feed : public OrderBookListener {
+            public:
+                Feed();
+
+                /**
+                 * @brief Book event callbacks (@see OrderBookListener). Append
+                 * the event to the ring.
+                 */
+                void onBookUpdate(const BookLevelEvent& event) override;
+                void onTrade(const TradeEvent& event) override;
+
+                /**
+                 * @brief Append an event to the ring (thread modifying the book).
+                 *
+                 * @param event - event to append
+                 */
+                void push(const PendingEvent& event);
+
+                std::unique_ptr<PendingEvent[]> events; // Ring of FEED_CAPACITY events
+
+                alignas(64) std::atomic<uint64_t> tail; // Events ever appended (producer)
+                uint64_t cachedHead;                    // Producer's last read of head
+
+                alignas(64) std::atomic<uint64_t> head; // Events ever published (publisher thread)
+        }; // Feed
+
+        /**
+         * @brief Symbol assigned to a symbol ID, and the position of the
+         * book's feed from which its events belong to the new symbol.
+         */
+        struct SymbolAssignment {
+            uint32_t symbolId;  // Dense symbol ID of the book
+            std::string symbol; // Symbol assigned to the book
+            uint64_t position;  // Feed position (tail) when the symbol was assigned
+        };
+
+        /**
+         * @brief Publisher's aggregated image of one order book.
+         */
+        struct BookImage {
+            std::string symbol;         // Symbol the book currently has; empty if none
+            uint64_t seq = 0;           // Last published sequence number
+            std::map<double, int> bids; // Price => quantity
+            std::map<double, int> asks; // Price => quantity
+        };
+
+        /**
+         * @brief Publisher thread. Alternates between publishing pending updates
+         * and serving snapshot requests.
+         */
+        void run();
+
+        /**
+         * @brief Sequence the pending events, apply them to the book images and
+         * send them packed into as few datagrams as possible.
+         */
+        void publishPending();
+
+        /**
+         * @brief Publish the events of a book's feed up to a position.
+         *
+         * @param symbolId - dense symbol ID of the book
+         * @param end - feed position to publish up to (exclusive)
+         */
+        void publishFeed(uint32_t symbolId, uint64_t end);
+
+        /**
+         * @brief Give a book image a new symbol. The image is cleared if the
+         * symbol changes, so a recycled book starts from sequence number 1.
+         *
+         * @param symbolId - dense symbol ID of the book
+         * @param symbol - symbol assigned to the book
+         */
+        void assignSymbol(uint32_t symbolId, const std::string& symbol);
+
+        /**
+         * @brief Send the current datagram (if it holds updates) and start a new one.
+         */
+        void sendDatagram();
+
+        /**
+         * @brief Accept snapshot clients and handle their snapshot requests.
+         */
+        void serviceSnapshotClients();
+
+        /**
+         * @brief Append a snapshot of a book image to a session's outbound buffer.
+         *
+         * @param symbol - symbol requested
+         * @param session - session to answer
+         */
+        void writeSnapshot(const std::string& symbol, Session& session);
+
+        /**
+         * @brief Create the UDP multicast socket and the TCP snapshot listener.
+         *
+         * @return bool - true if created; false otherwise
+         */
+        bool createSockets();
+
+        std::string multicastGroup;     // Multicast group of the update feed
+        int multicastPort;              // UDP port of the update feed
+        std::string multicastInterface; // Interface the update feed is published on
+        int snapshotPort;               // TCP port of the snapshot service
+        int flushIntervalMs;            // Maximum batching delay (ms)
+        bool logging;                   // True to log to console, false otherwise
+        threading::ThreadPlacement placement; // CPU and scheduling of the publisher thread
+
+        SOCKET multicastSocket;         // UDP socket for the update feed
+        SOCKET snapshotSocket;          // TCP listener for snapshot requests
+        sockaddr_in groupAddress;       // Destination of the update feed
+
+        std::vector<std::unique_ptr<Feed>> feeds; // Symbol ID => events of the book
+
+        // Symbols assigned at runtime; swapped out by the publisher thread
+        std::mutex assignmentMutex;
+        std::vector<SymbolAssignment> pendingAssignments;
+        std::vector<SymbolAssignment> assigning;
+
+        std::vector<BookImage> images;                               // Symbol ID => published book image
+        std::unordered_map<std::string, uint32_t> imageIds;          // Symbol => symbol ID of its image
+        std::vector<std::unique_ptr<SocketSession>> snapshotClients; // Connected snapshot clients
+        std::vector<net::PollFd> pollFds;                             // [0] listener, [i + 1] snapshotClients[i]
+        std::string datagram;                                         // Datagram being packed
+        uint64_t packetSeq;                                           // Sequence number of the next datagram
+        uint32_t nextSessionId;                                       // Identifier of the next snapshot client
+
+        std::atomic<bool> running; // False to stop the publisher thread
+        std::thread worker;        // Publisher thread
+}; // MarketDataPublisher
+
+#endif // MARKETDATAPUBLISHER_H
@@ -0,0 +1,381 @@
+// Global Includes
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+// Project Includes
+#include <CompletionQueue.hpp>
+#include <Logger.h>
+#include <OrderBook.hpp>
+#include <QueryResult.hpp>
+#include <RequestTrace.hpp>
+#include <Strategy.hpp>
+#include <Threading.hpp>
+#include <Types.hpp>
+#include <WorkStealingPool.hpp>
+
+#ifndef MATCHINGENGINE_H
+#define MATCHINGENGINE_H
+
+/**
+ * @brief Trading state of a pooled order book.
+ */
+enum class BookState : uint8_t {
+    FREE,   // Not assigned to a symbol (warm pool)
+    ACTIVE, // Accepting orders
+    HALTED  // Assigned, but rejecting orders until resumed
+};
+
+/**
+ * @brief Session that created a live order.
+ */
+struct OrderOwner {
+    CompletionQueue* queue;                            // Queue of the transport that owns the session
+    uint32_t sessionId;                                // Session that created the order
+    std::shared_ptr<std::atomic<uint32_t>> openOrders; // Resting order count of the session (@see Session)
+};
+
+/**
+ * @brief Pooled order book padded to whole cache lines, so books matched on
+ * different threads never share a cache line. The state and owners are only
+ * accessed by the thread executing the book's commands: the engine thread
+ * that owns the book, or one of its batch workers (@see MatchingEngine).
+ */
+struct alignas(64) OrderBookSlot {
+    OrderBook book = OrderBook("");                     // Order book (reset when assigned a symbol)
+    BookState state = BookState::FREE;                  // Trading state of the book
+    uint32_t engineId = 0;                              // Engine thread that owns the book
+    std::unordered_map<std::string, OrderOwner> owners; // Order ID => creator, for live orders of the book
+};
+
+/**
+ * @brief Where the response of a command is delivered.
+ */
+struct ResponseRoute {
+    CompletionQueue* queue;    // Queue of the transport that owns the session; nullptr for no response
+    Session* session;          // Session that sent the request
+    uint64_t seq;              // Sequence number of the request in the session
+    trace::RequestTrace trace; // Timestamps of a sampled request (@see trace::TraceBuffer)
+};
+
+/**
+ * @brief Internal command: forget the live orders of a closed session in one
+ * book. The orders keep resting; their fills and cancels are no longer reported.
+ */
+struct SessionClose {
+    uint32_t sessionId; // Session that closed
+};
+
+/**
+ * @brief Request for a matching engine, already routed to its order book.
+ */
+struct EngineCommand {
+    uint32_t symbolId;   // Dense symbol ID of the book
+    OrderBookSlot* slot; // Book the command applies to
+    ResponseRoute route; // Destination of the response
+    std::variant<OrderRequest, OrderModify, OrderCancel, AdminRequest, QueryRequest, SessionClose> message; // Request
+};
+
+/**
+ * Engine thread that owns a subset of the order books. Every request for a
+ * book is executed by its owning engine, in the order it was submitted, so
+ * books never need locking and books owned by different engines are matched
+ * in parallel. Admin commands (add, halt, resume, remove) are ordered with the
+ * symbol's orders through the same queue, so changing one symbol never pauses
+ * matching on the others.
+ *
+ * The engine listens to its books and remembers the session that created each
+ * live order, so fills and cancels (including those caused by other agents)
+ * are pushed to the owner as execution reports. When a session closes, a
+ * SessionClose command for each book makes the engine forget its orders.
+ *
+ * Strategies (@see Strategy) attached to a book run on the thread executing
+ * the book's commands (the engine thread, or a batch worker): they see the book's events as they happen, and their orders are executed
+ * right after the command that triggered them, before the next command.
+ *
+ * Queries are ordered with the orders too, but the engine only captures a
+ * read view of the book (@see QueryResult); the result is encoded and sent by
+ * the transport thread.
+ *
+ * With batch workers (@see setBatchWorkers) a large batch spanning several
+ * books is split by book, keeping each book's commands in order, and the
+ * parts are executed on a work-stealing pool: busy symbols spread over the
+ * workers batch by batch instead of being pinned to one thread. The responses
+ * are delivered in batch order, as from a serial batch.
+ */
+class MatchingEngine : public OrderBookListener {
+    public:
+        /**
+         * @brief Constructor for a new matching engine.
+         *
+         * @param engineId - identifier of the engine
+         * @param releaseSymbol - called on the thread executing the book's
+         *                        commands once a removed symbol's book has
+         *                        been returned to the pool
+         * @param logging - console logging flag
+         */
+        MatchingEngine(
+            uint32_t engineId,
+            std::function<void(uint32_t)> releaseSymbol,
+            bool logging
+        );
+        ~MatchingEngine() override;
+
+        /**
+         * @brief Start the engine thread.
+         */
+        void start();
+
+        /**
+         * @brief Execute the commands already submitted, then stop the engine thread.
+         */
+        void stop();
+
+        /**
+         * @brief Queue commands for the engine thread (any thread). The vector is
+         * emptied; its capacity is kept.
+         *
+         * @param commands - commands for books owned by this engine, in order
+         */
+        void submit(std::vector<EngineCommand>& commands);
+
+        /**
+         * @brief Attach a strategy to a book owned by this engine (any thread).
+         * The engine thread attaches it before its next batch; from then on
+         * the strategy sees every event of the book on the thread executing
+         * the book's commands, and its requests are executed after each command for the book, before
+         * the next command.
+         *
+         * @param slot - book the strategy trades in
+         * @param strategy - strategy to run (must outlive the engine)
+         */
+        void addStrategy(OrderBookSlot* slot, Strategy& strategy);
+
+        /**
+         * @brief Set the queue watermarks. The engine becomes overloaded once
+         * its queue reaches the high watermark and stays overloaded until the
+         * queue drains to the low watermark.
+         *
+         * @param t_highWatermark - queued commands that start the overload; 0 for no limit
+         * @param t_lowWatermark - queued commands that end the overload
+         */
+        void setWatermarks(size_t t_highWatermark, size_t t_lowWatermark);
+
+        /**
+         * @brief Set how the engine thread runs; must be called before start().
+         * A busy-polling engine spins on its queue instead of sleeping, so
+         * submit() never has to wake it.
+         *
+         * @param t_placement - CPU and scheduling of the engine thread
+         * @param t_busyPoll - true to spin-poll the queue; false to block
+         */
+        void setThreadConfig(const threading::ThreadPlacement& t_placement, bool t_busyPoll);
+
+        /**
+         * @brief Set the batch workers; must be called before start(). Batches
+         * of at least PARALLEL_MIN_COMMANDS commands for two or more books are
+         * then executed on a pool of this many workers (one part per book).
+         *
+         * @param workers - work-stealing workers; 0 to execute every batch on the engine thread
+         */
+        void setBatchWorkers(uint32_t workers);
+
+        /**
+         * @brief Accessor functions for the engine (getters).
+         *
+         * getEngineId() - gets the engine identifier
+         * getQueueDepth() - gets the number of commands submitted and not yet executed
+         * isOverloaded() - true if the queue passed the high watermark (@see setWatermarks)
+         * getParallelBatches() - gets the number of batches executed by the batch workers
+         */
+        uint32_t getEngineId() const;
+        size_t getQueueDepth() const;
+        bool isOverloaded() const;
+        uint64_t getParallelBatches() const;
+
+        static constexpr size_t PARALLEL_MIN_COMMANDS = 64; // Smallest batch handed to the batch workers
+
+        /**
+         * @brief Book event callback (@see OrderBookListener). Records the
+         * event for the owner of the order; called on the thread executing
+         * the book's commands.
+         */
+        void onExecution(const ExecutionEvent& event) override;
+
+    private:
+        /**
+         * @brief Output of the commands executed by one thread: the engine
+         * thread, or a batch worker.
+         */
+        struct BatchContext {
+            std::vector<Completion> completed;             // Responses, in execution order
+            std::vector<CompletionQueue*> completedQueues; // Queue of each response
+            std::vector<size_t> completedPositions;        // Batch position of each response's command
+            std::shared_ptr<QueryResult> queryResult;      // Result of the current command, if a query
+            std::vector<ExecutionReport> executions;       // Executions of the current command
+            std::vector<RoutedReport> reports;             // Reports of the batch
+            std::vector<CompletionQueue*> reportQueues;    // Queue of each report
+        };
+
+        /**
+         * @brief Engine thread. Waits for commands and executes them in batches.
+         */
+        void run();
+
+        /**
+         * @brief Execute the current batch on the batch workers if it is large
+         * and spans several books, and merge their output into the engine's.
+         *
+         * @param dequeued - time the batch was taken from the queue (@see trace::now())
+         *
+         * @return bool - true if the batch was executed; false to execute it serially
+         */
+        bool runParallel(int64_t dequeued);
+
+        /**
+         * @brief Execute one command of the batch, route its executions and
+         * record its response.
+         *
+         * @param command - command to execute
+         * @param position - position of the command in the batch
+         * @param dequeued - time the batch was taken from the queue
+         * @param output - output of the executing thread
+         */
+        void executeCommand(EngineCommand& command, size_t position, int64_t dequeued, BatchContext& output);
+
+        /**
+         * @brief Execute one command against its order book.
+         *
+         * @param command - command to execute
+         * @param output - output of the executing thread
+         *
+         * @return OrderResponse - response of the command
+         */
+        OrderResponse execute(EngineCommand& command, BatchContext& output);
+
+        /**
+         * @brief Execute an admin command.
+         *
+         * @param command - command to execute
+         * @param request - admin request carried by the command
+         *
+         * @return OrderResponse - response of the command
+         */
+        OrderResponse executeAdmin(EngineCommand& command, const AdminRequest& request);
+
+        /**
+         * @brief Execute a query: capture a read view of the book as the
+         * command's query result.
+         *
+         * @param command - command to execute
+         * @param request - query carried by the command
+         * @param output - output of the executing thread
+         *
+         * @return OrderResponse - response of the command
+         */
+        OrderResponse executeQuery(EngineCommand& command, const QueryRequest& request, BatchContext& output);
+
+        /**
+         * @brief Forget the owner of every live order of a closed session in
+         * the command's book, releasing the session's open order count.
+         *
+         * @param command - command to execute
+         * @param request - closed session carried by the command
+         *
+         * @return OrderResponse - response of the command
+         */
+        OrderResponse executeSessionClose(EngineCommand& command, const SessionClose& request);
+
+        /**
+         * @brief Record the owner of an order created by a command, then address
+         * the executions of the command to the owners of their orders. Orders
+         * are forgotten once nothing of them is left resting. The owning
+         * session's open order count covers the orders recorded here.
+         *
+         * @param command - executed command
+         * @param response - response of the command
+         * @param output - output of the executing thread
+         */
+        void routeExecutions(const EngineCommand& command, const OrderResponse& response, BatchContext& output);
+
+        /**
+         * @brief Address the recorded executions of a book to the owners of
+         * their orders (executions of orders without a session owner are dropped).
+         * An order that has nothing left resting is forgotten and no longer
+         * counts against its session's open orders.
+         *
+         * @param slot - book the executions happened in
+         * @param output - output of the executing thread
+         */
+        void routeReports(OrderBookSlot* slot, BatchContext& output);
+
+        /**
+         * @brief Execute the requests queued by the strategies of a book and
+         * route the executions they cause. Requests of a book that is not
+         * active are rejected.
+         *
+         * @param slot - book whose strategies are drained
+         * @param output - output of the executing thread
+         */
+        void drainStrategies(OrderBookSlot* slot, BatchContext& output);
+
+        /**
+         * @brief Deliver the responses and execution reports of the current
+         * batch, one push per run of entries for the same queue. Responses are
+         * pushed before the reports.
+         */
+        void deliverCompletions();
+
+        static thread_local BatchContext* activeContext; // Output of the calling thread's commands (for onExecution)
+
+        uint32_t engineId;                           // Identifier of the engine
+        std::function<void(uint32_t)> releaseSymbol; // Returns a removed symbol's ID
+        bool logging;                                // True to log to console, false otherwise
+
+        // Commands submitted by the transports; swapped out by the engine thread
+        std::mutex queueMutex;
+        std::condition_variable queueReady;
+        std::vector<EngineCommand> queued;
+        std::vector<EngineCommand> executing;
+        std::vector<std::pair<OrderBookSlot*, Strategy*>> pendingStrategies; // Strategies waiting to be attached
+        std::vector<std::pair<OrderBookSlot*, Strategy*>> attaching;
+        std::atomic<bool> commandsPending; // True once commands are queued or a stop is requested
+
+        threading::ThreadPlacement placement; // CPU and scheduling of the engine thread
+        bool busyPoll;                        // True to spin on the queue instead of sleeping
+
+        std::atomic<size_t> queueDepth; // Commands submitted and not yet executed
+        std::atomic<bool> overloaded;   // True between the high and low watermark
+        size_t highWatermark;           // Depth that starts the overload; 0 for no limit
+        size_t lowWatermark;            // Depth that ends the overload
+
+        BatchContext context; // Output of the current batch
+
+        // Batch workers (@see setBatchWorkers); the partitions are rebuilt per batch
+        uint32_t batchWorkers;                                      // Workers of the pool; 0 for none
+        std::unique_ptr<WorkStealingPool> pool;                     // Work-stealing batch workers
+        std::vector<BatchContext> workerContexts;                   // Output of each worker
+        std::unordered_map<OrderBookSlot*, size_t> partitionOfBook; // Book => partition of the current batch
+        std::vector<std::vector<size_t>> partitions;                // Batch positions of each book's commands
+        std::vector<std::pair<uint32_t, size_t>> responseSources;   // Batch position => (worker, response); worker UINT32_MAX if none
+        std::atomic<uint64_t> parallelBatches;                      // Batches executed by the workers
+
+        // Strategies attached to the engine's books. A removed book's hosts
+        // are reset in place (batch workers may be iterating the vector) and
+        // erased by the engine thread before the next batch
+        std::vector<std::pair<OrderBookSlot*, std::unique_ptr<StrategyHost>>> strategies;
+
+        bool running;       // False to stop the engine thread (guarded by queueMutex)
+        std::thread worker; // Engine thread
+}; // MatchingEngine
+
+#endif // MATCHINGENGINE_H
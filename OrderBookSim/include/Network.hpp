@@ -0,0 +1,205 @@
+// Global Includes
+#include <cstddef>
+#include <string>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <cerrno>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+#ifndef NETWORK_H
+#define NETWORK_H
+
+#ifndef _WIN32
+// POSIX equivalents of the Winsock names used throughout the project
+using SOCKET   = int;
+using SOCKADDR = sockaddr;
+constexpr SOCKET INVALID_SOCKET = -1;
+constexpr int SOCKET_ERROR      = -1;
+#endif
+
+namespace net {
+    /**
+     * @brief Single buffer of a vectored (scatter/gather) send. Maps onto
+     * WSABUF on Windows and iovec on POSIX systems, so an array of slices can
+     * be passed directly to WSASend / writev.
+     */
+#ifdef _WIN32
+    using IoSlice = WSABUF;
+#else
+    using IoSlice = iovec;
+#endif
+
+    /**
+     * @brief Poll descriptor for a socket. Maps onto WSAPOLLFD on Windows
+     * and pollfd on POSIX systems.
+     */
+#ifdef _WIN32
+    using PollFd = WSAPOLLFD;
+#else
+    using PollFd = pollfd;
+#endif
+
+    /**
+     * @brief Maximum number of slices passed to a single vectored send.
+     * Matches the common IOV_MAX lower bound.
+     */
+    constexpr size_t MAX_IO_SLICES = 1024;
+
+    /**
+     * @brief Event loop used for the order book manager's socket I/O.
+     */
+    enum class IoBackend {
+        POLL,    // Readiness based (WSAPoll / poll); available everywhere
+        IO_URING // Completion based io_uring; Linux only
+    };
+
+    /**
+     * @brief Initialize the platform socket library (WSAStartup on Windows).
+     *
+     * @return bool - true if initialized; false otherwise
+     */
+    bool startup();
+
+    /**
+     * @brief Release the platform socket library (WSACleanup on Windows).
+     */
+    void cleanup();
+
+    /**
+     * @brief Close a socket.
+     *
+     * @param socket - socket to close
+     */
+    void closeSocket(SOCKET socket);
+
+    /**
+     * @brief Put a socket into non-blocking mode.
+     *
+     * @param socket - socket to update
+     *
+     * @return bool - true if the mode was set; false otherwise
+     */
+    bool setNonBlocking(SOCKET socket);
+
+    /**
+     * @brief Disable Nagle's algorithm on a connected socket. Responses are
+     * already coalesced by the caller, so delaying small writes only adds latency.
+     *
+     * @param socket - socket to update
+     */
+    void setNoDelay(SOCKET socket);
+
+    /**
+     * @brief Set the buffer pointer and length of a slice.
+     *
+     * @param slice - slice to populate
+     * @param data - start of the buffer
+     * @param length - number of bytes in the buffer
+     */
+    void setSlice(IoSlice& slice, const char* data, size_t length);
+
+    /**
+     * @brief Get the buffer pointer and length of a slice.
+     *
+     * @param slice - slice to read
+     *
+     * @return buffer start / number of bytes in the buffer
+     */
+    const char* sliceData(const IoSlice& slice);
+    size_t sliceLength(const IoSlice& slice);
+
+    /**
+     * @brief Receive bytes from a socket.
+     *
+     * @param socket - socket to read from
+     * @param buffer - destination buffer
+     * @param length - size of the destination buffer
+     *
+     * @return long - bytes read; 0 if the peer closed; -1 on error
+     */
+    long receive(SOCKET socket, char* buffer, size_t length);
+
+    /**
+     * @brief Send several buffers with a single system call (WSASend / writev).
+     *
+     * @param socket - socket to write to
+     * @param slices - buffers to send, in order
+     * @param count - number of slices (at most MAX_IO_SLICES)
+     *
+     * @return long - bytes sent; -1 on error
+     */
+    long sendVectored(SOCKET socket, IoSlice* slices, size_t count);
+
+    /**
+     * @brief Wait for events on a set of sockets (WSAPoll / poll).
+     *
+     * @param fds - poll descriptors
+     * @param count - number of descriptors
+     * @param timeoutMs - timeout in milliseconds; -1 to block
+     *
+     * @return int - number of ready descriptors; -1 on error
+     */
+    int pollSockets(PollFd* fds, size_t count, int timeoutMs);
+
+    /**
+     * @brief Open a TCP connection (blocking connect).
+     *
+     * @param host - IPv4 address of the server
+     * @param port - port of the server
+     *
+     * @return SOCKET - connected socket; INVALID_SOCKET on failure
+     */
+    SOCKET connectTo(const std::string& host, int port);
+
+    /**
+     * @brief Create a socket that wakes a poll loop from another thread. The
+     * socket is a non-blocking UDP socket bound to the loopback interface and
+     * connected to itself, so it can be polled with the client sockets on
+     * every platform (WSAPoll only accepts sockets).
+     *
+     * @return SOCKET - wakeup socket; INVALID_SOCKET on failure
+     */
+    SOCKET createWakeupSocket();
+
+    /**
+     * @brief Make a wakeup socket readable (any thread).
+     *
+     * @param socket - wakeup socket
+     */
+    void signalWakeup(SOCKET socket);
+
+    /**
+     * @brief Consume every pending wakeup signal.
+     *
+     * @param socket - wakeup socket
+     */
+    void drainWakeup(SOCKET socket);
+
+    /**
+     * @brief Check whether the last socket error was caused by a non-blocking
+     * socket having no data/space available.
+     *
+     * @return bool - true if the operation would have blocked
+     */
+    bool wouldBlock();
+
+    /**
+     * @brief Get the last socket error code.
+     *
+     * @return int - platform error code
+     */
+    int lastError();
+}; // net
+
+#endif // NETWORK_H
@@ -0,0 +1,119 @@
+// Global Includes
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#ifndef NODEPOOL_H
+#define NODEPOOL_H
+
+namespace memory {
+    /**
+     * @brief Memory accounting of one pool.
+     */
+    struct PoolStats {
+        uint64_t allocations = 0;     // Blocks handed to the containers
+        uint64_t heapAllocations = 0; // Allocations that reached the heap (not served from a free list)
+        size_t bytesInUse = 0;        // Bytes held by the containers
+        size_t peakBytesInUse = 0;    // Highest bytesInUse so far
+        size_t bytesReserved = 0;     // Bytes taken from the heap (in use and in the free lists)
+    };
+
+    /**
+     * Allocation hook of the order book containers: a free list per 16-byte
+     * size class up to 256 bytes, so the nodes of orders, price levels and the
+     * order index are recycled instead of returned to the heap. Blocks stay
+     * in the free lists until the pool is destroyed, so once a book has seen
+     * its peak depth it allocates nothing more. Larger blocks (bucket arrays)
+     * go straight to the heap. Every allocation is counted.
+     *
+     * Not thread-safe: a pool belongs to the thread running its book.
+     */
+    class NodePool {
+        public:
+            static constexpr size_t GRANULE = 16;      // Size class step (bytes); also the block alignment
+            static constexpr size_t SIZE_CLASSES = 16; // Size classes (blocks up to 256 bytes are pooled)
+
+            NodePool() = default;
+            ~NodePool();
+
+            NodePool(const NodePool&) = delete;
+            NodePool& operator=(const NodePool&) = delete;
+
+            /**
+             * @brief Allocate a block, from its free list if possible.
+             *
+             * @param bytes - block size
+             *
+             * @return void* - block (aligned to GRANULE)
+             */
+            void* allocate(size_t bytes);
+
+            /**
+             * @brief Return a block to its free list (or the heap if too large).
+             *
+             * @param block - block from allocate()
+             * @param bytes - size it was allocated with
+             */
+            void deallocate(void* block, size_t bytes);
+
+            /**
+             * @return const PoolStats& - accounting of the pool
+             */
+            const PoolStats& getStats() const { return stats; }
+
+        private:
+            /**
+             * @brief A free block, linked through its first bytes.
+             */
+            struct FreeBlock {
+                FreeBlock* next; // Next free block of the size class
+            };
+
+            FreeBlock* freeLists[SIZE_CLASSES] = {}; // Free blocks per size class
+            PoolStats stats;                         // Accounting
+    }; // NodePool
+
+    /**
+     * Standard allocator over a shared NodePool. Copies (and rebinds) share
+     * the pool, which lives as long as any container using it; a default
+     * constructed allocator uses the heap without accounting.
+     */
+    template <typename T>
+    class PoolAllocator {
+        public:
+            using value_type = T;
+            using propagate_on_container_copy_assignment = std::true_type;
+            using propagate_on_container_move_assignment = std::true_type;
+            using propagate_on_container_swap = std::true_type;
+
+            static_assert(alignof(T) <= NodePool::GRANULE, "PoolAllocator: over-aligned type");
+
+            PoolAllocator() noexcept : pool() {}
+            explicit PoolAllocator(std::shared_ptr<NodePool> pool) noexcept : pool(std::move(pool)) {}
+
+            template <typename U>
+            PoolAllocator(const PoolAllocator<U>& other) noexcept : pool(other.pool) {}
+
+            T* allocate(size_t count) {
+                if (!pool) return std::allocator<T>().allocate(count);
+                return static_cast<T*>(pool->allocate(count * sizeof(T)));
+            }
+
+            void deallocate(T* block, size_t count) {
+                if (!pool) return std::allocator<T>().deallocate(block, count);
+                pool->deallocate(block, count * sizeof(T));
+            }
+
+            template <typename U>
+            bool operator==(const PoolAllocator<U>& other) const noexcept { return pool == other.pool; }
+
+            template <typename U>
+            bool operator!=(const PoolAllocator<U>& other) const noexcept { return pool != other.pool; }
+
+            std::shared_ptr<NodePool> pool; // Pool shared by every copy
+    }; // PoolAllocator
+};
+
+#endif // NODEPOOL_H
@@ -80,7 +80,7 @@ class Order {
          * getOrderSide() - gets the side of the order
          * getOrderType() - gets the type of the order submitted
          */
-        std::string getOrderId() const;
+        const std::string& getOrderId() const;
         int getOrderQty() const;
         int getOrderRemainingQty() const;
         long long getOrderTimestamp() const;
@@ -101,7 +101,7 @@ class Order {
 
     private:
         /**
-         * @brief Generates an order ID based on the order's timestamp and a random
+         * @brief Generates an order ID based on the order's timestamp and a sequence
          * component.
          * @see SPEC.md for order ID structure.
          *
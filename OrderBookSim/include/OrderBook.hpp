@@ -1,11 +1,16 @@
 // Global Includes
+#include <cstdint>
 #include <list>
 #include <map>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 // Project Includes
+#include <BookEvents.hpp>
+#include <HistoryLog.hpp>
+#include <NodePool.hpp>
 #include <Types.hpp>
 #include <Order.hpp>
 #include <Trade.hpp>
@@ -14,6 +19,51 @@
 #ifndef ORDERBOOK_H
 #define ORDERBOOK_H
 
+/**
+ * @brief Operations of one kind and the allocations of the book structures
+ * they made.
+ */
+struct OperationAllocations {
+    uint64_t operations = 0;    // Operations run
+    uint64_t poolMisses = 0;    // Node allocations not served from a pool's free lists (went to the heap)
+    uint64_t historyChunks = 0; // History chunks allocated (one per HistoryLog::CHUNK_SIZE entries)
+};
+
+/**
+ * @brief Memory held by an order book, by component, and the allocations of
+ * its operations. Only the containers are counted; order and trade IDs fit in
+ * the small string buffer of std::string (@see utils::generateId()).
+ */
+struct BookMemoryStats {
+    memory::PoolStats levels;          // Price level nodes (both sides)
+    memory::PoolStats orders;          // Resting order nodes
+    memory::PoolStats index;           // Order ID index nodes and buckets
+    size_t orderHistoryBytes = 0;      // Order history chunks
+    size_t tradeHistoryBytes = 0;      // Trade history chunks
+    size_t priceLevels = 0;            // Price levels (both sides)
+    size_t restingOrders = 0;          // Resting orders
+    OperationAllocations creates;      // createOrder()
+    OperationAllocations modifies;     // modifyOrder()
+    OperationAllocations cancels;      // cancelOrder()
+
+    /**
+     * @return size_t - bytes taken from the heap by every component
+     */
+    size_t totalBytes() const {
+        return levels.bytesReserved + orders.bytesReserved + index.bytesReserved + orderHistoryBytes + tradeHistoryBytes;
+    }
+};
+
+/**
+ * @brief Outcome of a batch auction (@see OrderBook::uncross()).
+ */
+struct AuctionResult {
+    double price = 0;      // Clearing price; 0 if the book was not crossed
+    int64_t volume = 0;    // Quantity executed (on each side)
+    int64_t imbalance = 0; // Bid minus ask quantity willing to trade at the clearing price
+    uint64_t trades = 0;   // Trades recorded
+};
+
 class OrderBook {
     public:
         /**
@@ -86,6 +136,50 @@ class OrderBook {
             ErrorCode& errCode
         );
 
+        /**
+         * @brief Clear every order and all history, and reassign the book to a
+         * symbol. Listeners and the matching mode are kept, and listeners are
+         * sent the removal of every level. Used to recycle a pre-allocated book.
+         *
+         * @param exchangeSymbol - new symbol for this order book
+         */
+        void reset(const std::string& exchangeSymbol);
+
+        /**
+         * @brief Set how the book matches orders. In AUCTION mode new and
+         * modified LIMIT orders rest without matching (the book may be crossed)
+         * until uncross() runs; MARKET, STOP, FOK, IOC and ICEBERG orders need
+         * resting liquidity to execute against and are rejected with BAD_TYPE.
+         * Switching from AUCTION back to CONTINUOUS runs a final auction first.
+         *
+         * @param mode - matching mode; @see MatchingMode
+         * @param allocation - rationing of the auctions; @see AuctionAllocation
+         */
+        void setMatchingMode(MatchingMode mode, AuctionAllocation allocation = AuctionAllocation::TIME_PRIORITY);
+
+        /**
+         * @brief Get how the book matches orders.
+         *
+         * @return MatchingMode - current matching mode
+         */
+        MatchingMode getMatchingMode() const;
+
+        /**
+         * @brief Run a batch auction: execute every crossing order at a single
+         * clearing price. The price is the one that executes the most quantity,
+         * then leaves the smallest imbalance; remaining ties go to the highest
+         * price if buyers are left over, the lowest if sellers are, and the
+         * middle one otherwise. Orders better than the clearing price fill in
+         * full; the longer side is rationed at the clearing price (@see
+         * AuctionAllocation). Trades and executions are recorded and published
+         * as for continuous matching, with the side left over as the aggressor.
+         * NOTE: Only the levels between the best ask and the best bid take part,
+         * so the cost does not grow with the depth of the book outside them.
+         *
+         * @return AuctionResult - clearing price, volume, imbalance and trades
+         */
+        AuctionResult uncross();
+
         /**
          * @brief Get the Order Book exchange symbol.
          *
@@ -123,7 +217,117 @@ class OrderBook {
         std::map<double, std::list<Order>> getActiveBuyOrders();
         std::map<double, std::list<Order>> getActiveSellOrders();
 
+        /**
+         * @brief Get a read view of the trade / activity history. The view
+         * does not copy the entries and may be read from any thread while the
+         * book keeps matching; it only covers the entries recorded so far.
+         * @see HistoryLog
+         *
+         * @return HistoryLog<...>::View - view of the history, oldest first
+         */
+        HistoryLog<Trade>::View getTradeHistoryView() const;
+        HistoryLog<std::pair<OrderStatus, Order>>::View getOrderHistoryView() const;
+
+        /**
+         * @brief Copy the resting orders in priority order: bids best to worst,
+         * then asks best to worst.
+         *
+         * @param orders - cleared and populated with the resting orders
+         */
+        void getOpenOrders(std::vector<QueryOrder>& orders) const;
+
+        /**
+         * @brief Get the best (highest) bid / best (lowest) ask price without
+         * copying the book.
+         *
+         * @return double - best price; 0 if the side is empty
+         */
+        double getBestBidPrice() const;
+        double getBestAskPrice() const;
+
+        /**
+         * @brief Allocate the order and trade history ahead, so a run of
+         * known length appends to the history without allocating.
+         *
+         * @param orders - order history entries to hold
+         * @param trades - trade history entries to hold
+         */
+        void reserveHistory(size_t orders, size_t trades);
+
+        /**
+         * @brief Get the memory held by the book per component and the pool
+         * misses of its operations (owning thread only).
+         *
+         * @return BookMemoryStats - memory accounting of the book
+         */
+        BookMemoryStats getMemoryStats() const;
+
+        /**
+         * @brief Register a listener for book level updates and trades. Events
+         * are delivered synchronously while the book is being modified.
+         * @see OrderBookListener
+         *
+         * @param listener - listener to add; must outlive its registration
+         */
+        void addListener(OrderBookListener* listener);
+
+        /**
+         * @brief Unregister a listener.
+         *
+         * @param listener - listener to remove
+         */
+        void removeListener(OrderBookListener* listener);
+
     private:
+        using OrderList = std::list<Order, memory::PoolAllocator<Order>>;
+        using PriceLevels = std::map<double, OrderList, std::less<double>,
+                                     memory::PoolAllocator<std::pair<const double, OrderList>>>;
+        using OrderIndex = std::unordered_map<std::string, std::pair<double, OrderList::iterator>, std::hash<std::string>,
+                                              std::equal_to<std::string>,
+                                              memory::PoolAllocator<std::pair<const std::string, std::pair<double, OrderList::iterator>>>>;
+
+        /**
+         * @brief Quantity allocated to one resting order by a batch auction.
+         */
+        struct AuctionFill {
+            PriceLevels::iterator level; // Price level of the order
+            OrderList::iterator order;   // Order
+            int qty;                     // Quantity allocated; counted down as it is paired into trades
+        };
+
+        /**
+         * @brief Allocate batch auction quantity to the orders of one price
+         * level: every order in full if the level fits, otherwise rationed by
+         * the allocation rule.
+         *
+         * @param level - price level
+         * @param qty - quantity still to allocate on the level's side
+         * @param fills - appended with the fills of the level, in time priority
+         *
+         * @return int64_t - quantity allocated
+         */
+        int64_t allocateLevel(PriceLevels::iterator level, int64_t qty, std::vector<AuctionFill>& fills);
+
+        /**
+         * @return uint64_t - pool misses of the book structures so far
+         * (compared before and after an operation)
+         */
+        uint64_t poolMisses() const;
+
+        /**
+         * @return uint64_t - history chunks allocated so far
+         */
+        uint64_t historyChunks() const;
+
+        /**
+         * @brief Add an operation to its allocation counts.
+         *
+         * @param counts - counts of the operation's kind
+         * @param missesBefore - poolMisses() before the operation
+         * @param chunksBefore - history chunks before the operation
+         */
+        void countOperation(OperationAllocations& counts, uint64_t missesBefore, uint64_t chunksBefore);
+
         /**
          * @brief Find an order in the order book.
          *
@@ -162,18 +366,69 @@ class OrderBook {
          */
         void removeOrder(Order& order);
 
+        /**
+         * @brief Notify the listeners of the aggregated state of a price level.
+         * No work is done when there are no listeners.
+         *
+         * @param side - side of the book the level is on
+         * @param price - price of the level
+         */
+        void publishLevel(OrderSide side, double price);
+
+        /**
+         * @brief Notify the listeners of an execution.
+         *
+         * @param trade - executed trade
+         * @param aggressorSide - side of the incoming order
+         */
+        void publishTrade(Trade& trade, OrderSide aggressorSide);
+
+        /**
+         * @brief Notify the listeners of a fill or cancel of one order.
+         *
+         * @param order - order that changed
+         * @param type - FILL or CANCEL
+         * @param price - execution price (0 for CANCEL)
+         * @param qty - executed / canceled quantity
+         * @param leavesQty - quantity still resting after the event
+         */
+        void publishExecution(const Order& order, ExecutionType type, double price, int qty, int leavesQty);
+
         std::string exchangeSymbol; // Symbol for the order book's traded security
 
+        // Allocation hooks of the containers below (recycled nodes, accounting)
+        std::shared_ptr<memory::NodePool> levelPool; // Price level nodes
+        std::shared_ptr<memory::NodePool> orderPool; // Resting order nodes
+        std::shared_ptr<memory::NodePool> indexPool; // Order index nodes and buckets
+
         // Key => price, value => list of orders at that price, sorted by time
-        std::map<double, std::list<Order>> buyOrders;  // List of all active buy orders
-        std::map<double, std::list<Order>> sellOrders; // List of all active sell orders
+        PriceLevels buyOrders;  // List of all active buy orders
+        PriceLevels sellOrders; // List of all active sell orders
 
         // Map of Order IDs and their indexes
         // Key => order ID, value => pair(price, pointer index)
-        std::unordered_map<std::string, std::pair<double, std::list<Order>::iterator>> orderIndex;
+        OrderIndex orderIndex;
+
+        HistoryLog<std::pair<OrderStatus, Order>> orderHistory; // History of all order events in the order book
+        HistoryLog<Trade> tradeHistory;                         // History of all trades in the order book (matched orders)
+
+        std::vector<OrderBookListener*> listeners; // Receivers of book level and trade events
+
+        OperationAllocations createAllocations; // Allocation counts of createOrder()
+        OperationAllocations modifyAllocations; // Allocation counts of modifyOrder()
+        OperationAllocations cancelAllocations; // Allocation counts of cancelOrder()
+
+        MatchingMode matchingMode;           // Continuous matching or batch auctions
+        AuctionAllocation auctionAllocation; // Rationing of the batch auctions
 
-        std::vector<std::pair<OrderStatus, Order>> orderHistory; // History of all order events in the order book
-        std::vector<Trade> tradeHistory;                         // History of all trades in the order book (matched orders)
+        // Batch auction scratch space, kept between auctions
+        // Index i => i-th price of the crossed range, ascending
+        std::vector<double> ladderPrices;   // Prices with a bid or ask level
+        std::vector<int64_t> ladderDemand;  // Bid quantity at the price or higher
+        std::vector<int64_t> ladderSupply;  // Ask quantity at the price or lower
+        std::vector<int64_t> ladderVolume;  // Quantity executable at the price
+        std::vector<AuctionFill> buyFills;  // Bids filled, best price first
+        std::vector<AuctionFill> sellFills; // Asks filled, best price first
 }; // OrderBook
 
 #endif // ORDERBOOK_H
\ No newline at end of file
@@ -1,15 +1,30 @@
 // Global Includes
 #include <iostream>
-#include <map>
+#include <atomic>
+#include <memory>
+#include <shared_mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
-#include <winsock2.h>
-#include <ws2tcpip.h>
 
 // Project Includes
+#include <Admission.hpp>
+#include <CompletionQueue.hpp>
 #include <Logger.h>
+#include <MarketDataPublisher.hpp>
+#include <MatchingEngine.hpp>
+#include <Network.hpp>
 #include <OrderBook.hpp>
+#include <Protocol.hpp>
+#include <RequestTrace.hpp>
+#include <Session.hpp>
+#include <ShmTransport.hpp>
+#include <SocketSession.hpp>
+#include <Strategy.hpp>
+#include <SymbolTable.hpp>
+#include <Threading.hpp>
 #include <Types.hpp>
+#include <UringTransport.hpp>
 
 #ifndef ORDERBOOKMANAGER_H
 #define ORDERBOOKMANAGER_H
@@ -17,24 +32,105 @@
 class OrderBookManager {
     public:
         /**
-         * @brief Constructor for a new Order Book Manager object.
+         * @brief Constructor for a new Order Book Manager object. Order books are
+         * pre-allocated for the initial symbols plus a warm pool of spare books
+         * that symbols added at runtime (AdminRequest) are assigned from.
          *
          * @param port - listen for OrderRequests
          * @param symbols - symbols to create order books
          * @param logging - console logging flag
+         * @param engineThreads - number of matching engine threads
+         * @param warmBooks - number of spare books for symbols added at runtime
+         * @param limits - per-session rate limits and engine queue watermarks
+         * @param threads - busy-poll mode, CPU affinity and priority of the threads
          */
         OrderBookManager(
             int port,
             std::vector<std::string> symbols,
-            bool logging
+            bool logging,
+            uint32_t engineThreads = 1,
+            uint32_t warmBooks = 64,
+            AdmissionLimits limits = AdmissionLimits(),
+            threading::ThreadConfig threads = threading::ThreadConfig()
         );
         ~OrderBookManager();
 
         /**
          * @brief Start the order book manager socket listener. The socket
          * listens for agent connections for order request messages.
+         * Connections are persistent and clients may pipeline any number of
+         * requests. On each wakeup, every complete frame read from a client is
+         * handled as a batch and the responses are coalesced into a single
+         * vectored send per client.
+         *
+         * @param backend - event loop for the socket I/O; falls back to POLL if
+         *                  IO_URING is not available on this system
+         */
+        void startListener(net::IoBackend backend = net::IoBackend::POLL);
+
+        /**
+         * @brief Start the shared memory transport for agents on the same host.
+         * Requests received over shared memory are handled by the same request
+         * path as the socket listener. Must be called after
+         * startMarketDataPublisher() and before startListener().
+         *
+         * @param name - name of the shared memory region
+         * @param slotCount - maximum number of concurrently connected agents
+         * @param waitMode - how the transport waits for requests
+         *
+         * @return bool - true if started; false otherwise
+         */
+        bool startSharedMemoryTransport(
+            const std::string& name,
+            uint32_t slotCount,
+            shm::WaitMode waitMode
+        );
+
+        /**
+         * @brief Start publishing market data for every order book. Incremental
+         * book updates and trades are multicast over UDP; book snapshots are
+         * served over TCP. Must be called before any transport is started.
+         *
+         * @param multicastGroup - IPv4 multicast group of the update feed
+         * @param multicastPort - UDP port of the update feed
+         * @param multicastInterface - IPv4 address of the interface to publish on
+         * @param snapshotPort - TCP port of the snapshot service
+         *
+         * @return bool - true if started; false otherwise
+         */
+        bool startMarketDataPublisher(
+            const std::string& multicastGroup,
+            int multicastPort,
+            const std::string& multicastInterface,
+            int snapshotPort
+        );
+
+        /**
+         * @brief Run a strategy against a book, on the thread executing the
+         * book's commands (@see Strategy). Must be called before any transport is started.
+         *
+         * @param symbol - symbol of the book
+         * @param strategy - strategy to run (must outlive the manager)
+         *
+         * @return bool - true if attached; false if the symbol has no book
+         */
+        bool addStrategy(const std::string& symbol, Strategy& strategy);
+
+        /**
+         * @brief Trace one request in every sampleEvery from arrival to the
+         * send of its response, and write the traces in the Chrome trace
+         * format on SIGUSR2 (@see trace::TraceBuffer). Must be called before
+         * any transport is started.
+         *
+         * @param sampleEvery - trace one request in this many (0 disables)
+         * @param path - trace file written on each SIGUSR2
+         */
+        void startTracing(uint32_t sampleEvery, const std::string& path);
+
+        /**
+         * @return const trace::TraceBuffer& - sampled request traces
          */
-        void startListener();
+        const trace::TraceBuffer& getTraces() const;
 
     private:
         /**
@@ -53,44 +149,169 @@ class OrderBookManager {
         int cleanupSocket();
 
         /**
-         * @brief Handle the order request message.
+         * @brief Readiness based event loop (WSAPoll / poll) for the listener
+         * and every connected socket session.
+         */
+        void runPollLoop();
+
+        /**
+         * @brief Accept every pending client connection on the listener socket
+         * and create a session for each.
+         */
+        void acceptClients();
+
+        /**
+         * @brief Write the responses completed by the matching engines, then
+         * the execution reports, to the socket sessions.
+         */
+        void drainCompletions();
+
+        /**
+         * @brief Handle every complete frame received by a session as a batch.
+         * Each request is routed to the engine that owns its order book; the
+         * commands for each engine are submitted together at the end of the
+         * batch. Responses come back through the completion queue and are
+         * written by the session in request order.
+         *
+         * @param session - session with newly received bytes
+         * @param completions - completion queue of the session's transport
+         */
+        void processFrames(Session& session, CompletionQueue& completions);
+
+        /**
+         * @brief Forget the live orders of a closed session: every assigned
+         * book gets a SessionClose command, ordered after the session's last
+         * request. Called by the transports once a session is closed and no
+         * engine holds a request of it.
          *
-         * @param buffer - string message from client
+         * @param sessionId - ID of the closed session
+         */
+        void closeSession(uint32_t sessionId);
+
+        /**
+         * @brief Apply the session's flow control limits to a request, before
+         * anything is queued to an engine.
+         *
+         * @param session - session that sent the request (already counted as outstanding)
+         * @param type - type of the request (new orders are subject to the open order limit)
+         * @param now - current time (ns, steady clock)
+         *
+         * @return bool - true if the request is admitted; false to answer THROTTLED
+         */
+        bool admitRequest(Session& session, MessageType type, int64_t now);
+
+        /**
+         * @brief Check whether a transport may read more requests from a session.
+         * Reading stops while an engine is overloaded or while the session has
+         * the maximum number of outstanding requests, so the backlog stays in
+         * the client's socket or ring instead of the engine queues.
+         *
+         * @param session - session to check
+         *
+         * @return bool - true if the session may be read; false otherwise
+         */
+        bool admitsReads(const Session& session) const;
+
+        /**
+         * @brief Check whether any engine queue is past its high watermark.
+         *
+         * @return bool - true if an engine is overloaded; false otherwise
+         */
+        bool enginesOverloaded() const;
+
+        /**
+         * @brief Route an order request to the engine that owns its order book.
+         * The symbol lock must be held (shared).
+         *
+         * @param frame - decoded request frame from a client
+         * @param route - destination of the response
+         */
+        void dispatchMessage(const protocol::Frame& frame, const ResponseRoute& route);
+
+        /**
+         * @brief Handle an admin request. Adding and removing symbols updates the
+         * symbol table; the change to the book itself is ordered with the
+         * symbol's orders on its engine. The symbol lock must be held (exclusive).
          *
-         * @return OrderReponse - response of the order request.
+         * @param frame - decoded admin frame from a client
+         * @param route - destination of the response
          */
-        OrderResponse handleMessage(std::string& buffer);
+        void dispatchAdmin(const protocol::Frame& frame, const ResponseRoute& route);
 
         /**
-         * @brief Serialize an Order Response message from the order book.
-         * Converts a OrderResponse message (struct) to a string that can be sent
-         * over the socket.
+         * @brief Queue a command for the engine that owns its order book.
          *
-         * @param response - order response message from the order book
+         * @param command - routed command
+         */
+        void queueCommand(EngineCommand&& command);
+
+        /**
+         * @brief Submit the commands queued by the calling thread to the engines.
+         */
+        void submitCommands();
+
+        /**
+         * @brief Return the ID of a removed symbol to the symbol table once its
+         * engine has returned the book to the pool.
          *
-         * @return std::string - serializes (string) of the response
+         * @param symbolId - ID of the removed symbol
          */
-        std::string serialize(const OrderResponse& response);
+        void releaseSymbol(uint32_t symbolId);
 
         /**
-         * @brief Deserialize an Order Request message sent by the client.
-         * Converts a string buffer to an OrderResponse (struct) message.
+         * @brief Find the order book slot for a symbol. Requests are routed by
+         * symbol ID; the symbol name is only looked up once, when the message is
+         * decoded. The symbol lock must be held.
          *
-         * @param buffer - string (serialized) order request message
+         * @param symbolId - dense symbol ID (@see SymbolTable)
+         * @param symbol - exchange symbol
          *
-         * @return OrderRequest - order request message
+         * @return OrderBookSlot* - pointer to the slot; nullptr if the symbol has no book
          */
-        OrderRequest deserialize(const std::string& buffer);
+        OrderBookSlot* findOrderBook(uint32_t symbolId);
+        OrderBookSlot* findOrderBook(const std::string& symbol);
 
+        /**
+         * @brief Get the engine that owns the fewest order books.
+         *
+         * @return uint32_t - identifier of the engine
+         */
+        uint32_t leastLoadedEngine() const;
 
         bool logging;     // True to log to console, false otherwise
         int obmPort;      // Order book manager port
-        int BUFFER_SIZE;  // Size of the receive buffer
         SOCKET obmSocket; // Listener socket for order book manager
 
-        // Map of the exchange symbol and the order book
-        // Key => exchange symbol, value => associated order book
-        std::map<std::string, OrderBook> orderBookMap;
+        AdmissionLimits limits;          // Flow control limits
+        threading::ThreadConfig threads; // Run mode and placement of the threads
+
+        std::vector<std::unique_ptr<SocketSession>> sessions; // Connected socket client sessions
+        std::vector<net::PollFd> pollFds;                     // Poll descriptors; [0] listener, [1] wakeup, [i + 2] sessions[i]
+        std::atomic<uint32_t> nextSessionId;                  // Identifier for the next session (any transport)
+
+        SOCKET wakeupSocket;               // Wakes the poll loop when responses complete
+        CompletionQueue socketCompletions; // Responses for the poll loop's sessions
+        std::vector<Completion> completed; // Completions drained in the current wakeup
+        std::vector<RoutedReport> reports; // Execution reports drained in the current wakeup
+
+        std::unordered_map<uint32_t, SocketSession*> sessionIndex; // Session ID => connected socket session
+
+        std::unique_ptr<ShmTransport> shmTransport; // Shared memory transport; nullptr if disabled
+
+        // Order books in one contiguous array, indexed by symbol ID. The array
+        // is allocated once (initial symbols + warm pool) and never resized, so
+        // books keep their address. Symbols are looked up under a shared lock;
+        // adding and removing a symbol takes it exclusively.
+        std::shared_mutex symbolMutex;          // Guards the symbol table and book assignment
+        SymbolTable symbolTable;                // Exchange symbol <=> dense symbol ID
+        std::vector<OrderBookSlot> orderBooks;  // Symbol ID => order book
+
+        std::vector<std::unique_ptr<MatchingEngine>> engines; // Matching engine threads
+        std::vector<uint32_t> engineBookCounts;               // Engine => number of assigned books
+
+        std::unique_ptr<MarketDataPublisher> marketData; // Market data publisher; nullptr if disabled
+
+        trace::TraceBuffer traces; // Sampled request traces
 }; // OrderBookManager
 
 #endif // ORDERBOOKMAANGER_H
\ No newline at end of file
@@ -0,0 +1,212 @@
+// Global Includes
+#include <cstddef>
+#include <cstdint>
+
+// Project Includes
+#include <Types.hpp>
+
+#ifndef ORDERFLOW_H
+#define ORDERFLOW_H
+
+/**
+ * Random numbers generated in blocks. Four xoshiro256** generators run side
+ * by side with their states stored lane by lane, so one pass over a block
+ * advances every lane with the same instructions and the compiler can keep
+ * the lanes in vector registers. Uniform doubles are made by filling the
+ * mantissa of 1.0 (no integer => double conversion), which vectorizes too.
+ *
+ * Deterministic for a seed and stream, like AgentRandom, but the lanes are
+ * interleaved, so the sequence differs from AgentRandom's.
+ */
+class BlockRandom {
+    public:
+        static constexpr size_t LANES = 4; // Generators run side by side
+
+        /**
+         * @brief Constructor for one stream.
+         *
+         * @param seed - simulation seed
+         * @param streamId - stream identifier
+         */
+        BlockRandom(uint64_t seed, uint64_t streamId);
+
+        /**
+         * @brief Fill a block with uniform random numbers in [0, 1).
+         *
+         * @param out - block to fill
+         * @param count - number of values
+         */
+        void fillUniform(double* out, size_t count);
+
+    private:
+        // Generator state, one column per lane
+        uint64_t s0[LANES];
+        uint64_t s1[LANES];
+        uint64_t s2[LANES];
+        uint64_t s3[LANES];
+}; // BlockRandom
+
+/**
+ * @brief Arrival process of an order flow.
+ */
+enum class ArrivalModel : uint8_t {
+    POISSON, // Constant intensity: exponential gaps
+    HAWKES   // Self-exciting: every event raises the intensity, which decays back to the baseline
+};
+
+/**
+ * @brief Arrival times of an order flow.
+ *
+ * Hawkes intensity: rate + sum over past events of excitation * exp(-decay * age).
+ * The process is stationary when excitation < decay; its mean rate is then
+ * rate / (1 - excitation / decay).
+ */
+struct ArrivalParams {
+    ArrivalModel model = ArrivalModel::POISSON;
+    double rate = 1000.0;    // Events per second (Hawkes: baseline intensity)
+    double excitation = 0.0; // Hawkes: intensity added by each event (per second)
+    double decay = 0.0;      // Hawkes: decay rate of the added intensity (per second)
+};
+
+/**
+ * @brief How far from the book's best prices limit orders are placed.
+ */
+enum class PriceDistribution : uint8_t {
+    UNIFORM,    // Offsets uniform in [minOffsetTicks, maxOffsetTicks]
+    EXPONENTIAL // minOffsetTicks + geometric offsets of mean meanOffsetTicks (capped at maxOffsetTicks)
+};
+
+/**
+ * @brief Parameters of an OrderFlowGenerator.
+ *
+ * Limit orders are priced from the opposite best price: a buy at
+ * bestAsk - offset ticks and a sell at bestBid + offset ticks, so offsets of
+ * 1 and up never cross and offsets of 0 or less take liquidity. The event mix
+ * weights need not sum to 1.
+ */
+struct OrderFlowParams {
+    ArrivalParams arrivals;  // Arrival process
+
+    double limitWeight = 0.6;  // Share of new LIMIT orders
+    double marketWeight = 0.1; // Share of new MARKET orders
+    double cancelWeight = 0.3; // Share of cancels of a random resting order
+
+    double buyProbability = 0.5; // Probability an order buys
+
+    PriceDistribution priceDistribution = PriceDistribution::UNIFORM;
+    int minOffsetTicks = 1;      // Smallest limit price offset (may be negative to cross)
+    int maxOffsetTicks = 20;     // Largest limit price offset
+    double meanOffsetTicks = 5;  // EXPONENTIAL: mean offset above minOffsetTicks
+
+    int minQty = 1;              // Orders are sized minQty to maxQty (uniform)
+    int maxQty = 100;
+    double tickSize = 0.01;      // Price increment
+    double referencePrice = 100; // Price used while both sides of the book are empty
+
+    uint32_t maxOpenOrders = 100; // OrderFlowAgent: resting orders kept before new orders turn into cancels
+};
+
+/**
+ * @brief Kind of an order flow event.
+ */
+enum class FlowEventType : uint8_t {
+    LIMIT,
+    MARKET,
+    CANCEL
+};
+
+/**
+ * @brief One generated order flow event. Prices are relative to the book at
+ * the time the event is applied (@see OrderFlowGenerator::resolvePrice()).
+ */
+struct OrderFlowEvent {
+    int64_t timeNs;      // Time of the event since the generator started (ns)
+    FlowEventType type;  // Kind of event
+    OrderSide side;      // Side of a new order
+    int32_t offsetTicks; // LIMIT: price offset from the opposite best price
+    int32_t qty;         // Quantity of a new order
+    double pick;         // CANCEL: which resting order, as a fraction [0, 1) of the resting orders
+};
+
+/**
+ * Stochastic order flow: arrival times from a Poisson or Hawkes process and a
+ * zero-intelligence mix of limit orders, market orders and cancels. Events are
+ * generated a block at a time: the random numbers of a whole block are drawn
+ * in one pass (BlockRandom) and turned into events by branch-free loops; only
+ * the Hawkes intensity recursion runs event by event.
+ *
+ * Hawkes arrivals are simulated exactly (Dassios and Zhao, 2013): each gap is
+ * the smaller of the next baseline arrival and the next excited arrival, which
+ * takes two uniforms per event and no rejection sampling.
+ */
+class OrderFlowGenerator {
+    public:
+        static constexpr size_t BLOCK = 256; // Events generated per block
+
+        /**
+         * @brief Constructor for one stream of order flow.
+         *
+         * @param params - arrival process, event mix and price distribution
+         * @param seed - simulation seed
+         * @param streamId - stream identifier (e.g. agent ID)
+         */
+        OrderFlowGenerator(
+            const OrderFlowParams& params,
+            uint64_t seed,
+            uint64_t streamId = 0
+        );
+
+        /**
+         * @brief Generate the next events.
+         *
+         * @param out - populated with the events, in time order
+         * @param count - number of events
+         */
+        void generate(OrderFlowEvent* out, size_t count);
+
+        /**
+         * @brief Get the next event (served from an internal block).
+         *
+         * @return const OrderFlowEvent& - next event; valid until the next call
+         */
+        const OrderFlowEvent& next();
+
+        /**
+         * @brief Price a new order against the book.
+         *
+         * @param event - LIMIT or MARKET event
+         * @param bestBid - best bid of the book; 0 if none
+         * @param bestAsk - best ask of the book; 0 if none
+         *
+         * @return double - order price in whole ticks, at least one tick
+         */
+        double resolvePrice(const OrderFlowEvent& event, double bestBid, double bestAsk) const;
+
+        /**
+         * @brief Accessor functions for the generator (getters).
+         *
+         * getParams() - gets the generator parameters
+         * getTime() - gets the time of the last generated event (ns)
+         * getIntensity() - gets the arrival intensity just after the last event (per second)
+         */
+        const OrderFlowParams& getParams() const;
+        int64_t getTime() const;
+        double getIntensity() const;
+
+    private:
+        OrderFlowParams params; // Arrival process, event mix and price distribution
+        BlockRandom random;     // Block random stream
+
+        double timeSeconds; // Time of the last event (s)
+        double intensity;   // Hawkes: intensity just after the last event (per second)
+
+        // Precomputed thresholds of the event mix
+        double limitShare;  // P(LIMIT)
+        double marketShare; // P(LIMIT or MARKET)
+
+        double uniforms[BLOCK * 6];  // Random numbers of one block (6 per event)
+        OrderFlowEvent buffer[BLOCK]; // Block served by next()
+        size_t bufferIndex;           // Next event of the buffer
+}; // OrderFlowGenerator
+
+#endif // ORDERFLOW_H
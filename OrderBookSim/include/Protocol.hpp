@@ -0,0 +1,161 @@
+// Global Includes
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Project Includes
+#include <Types.hpp>
+
+#ifndef PROTOCOL_H
+#define PROTOCOL_H
+
+/**
+ * Wire protocol between agents (clients) and the order book manager (server).
+ *
+ * Every message is sent as a frame: a fixed 8 byte header followed by the
+ * message payload. Frames are self-delimiting, so a client can pipeline any
+ * number of requests on one connection and the server can decode every
+ * complete frame contained in a single read.
+ *
+ * Header: | payload size (uint32) | message type (uint16) | flags (uint16) |
+ *
+ * Payload fields are written back to back in host byte order (the simulator
+ * runs agents and server on the same architecture). Strings are encoded as a
+ * uint16 length followed by the raw characters.
+ */
+namespace protocol {
+    constexpr size_t HEADER_SIZE       = 8;    // Size of the frame header (bytes)
+    constexpr size_t MAX_PAYLOAD_SIZE  = 4096; // Largest accepted payload (bytes)
+    constexpr size_t MAX_STRING_LENGTH = 255;  // Longest accepted symbol/order ID
+
+    constexpr uint32_t DATAGRAM_MAGIC        = 0x444D424F; // "OBMD"
+    constexpr size_t DATAGRAM_HEADER_SIZE    = 16;         // Size of the market data datagram header
+    constexpr size_t MAX_DATAGRAM_SIZE       = 1400;       // Keeps datagrams below a typical MTU
+    constexpr size_t MAX_SNAPSHOT_LEVELS     = 200;        // Price levels per snapshot part
+
+    /**
+     * @brief Decoded view of a single frame. The payload points into the
+     * receive buffer it was decoded from and is only valid until that buffer
+     * is modified.
+     */
+    struct Frame {
+        MessageType type;    // Type of the message carried
+        uint16_t flags;      // Frame flags (reserved)
+        const char* payload; // Start of the payload bytes
+        size_t payloadSize;  // Number of payload bytes
+    };
+
+    /**
+     * @brief Result of decoding a frame from a byte buffer.
+     */
+    enum class DecodeStatus {
+        COMPLETE,   // A full frame was decoded
+        INCOMPLETE, // More bytes are required
+        INVALID     // The header is malformed; the stream cannot be recovered
+    };
+
+    /**
+     * @brief Decode the frame at the start of a byte buffer.
+     *
+     * @param data - start of the buffer
+     * @param size - number of bytes available
+     * @param frame - decoded frame; populated if COMPLETE
+     * @param frameSize - total bytes (header + payload) consumed; populated if COMPLETE
+     *
+     * @return DecodeStatus - result of decoding
+     */
+    DecodeStatus decodeFrame(const char* data, size_t size, Frame& frame, size_t& frameSize);
+
+    /**
+     * @brief Serialize a message and append it as a complete frame to the output
+     * buffer. Appending lets several frames be coalesced into one buffer.
+     *
+     * @param message - message to serialize
+     * @param out - buffer to append the frame to
+     */
+    void serialize(const OrderRequest& message, std::string& out);
+    void serialize(const OrderModify& message, std::string& out);
+    void serialize(const OrderCancel& message, std::string& out);
+    void serialize(const OrderResponse& message, std::string& out);
+    void serialize(const SnapshotRequest& message, std::string& out);
+    void serialize(const BookSnapshot& message, std::string& out);
+    void serialize(const AdminRequest& message, std::string& out);
+    void serialize(const ExecutionReport& message, std::string& out);
+    void serialize(const QueryRequest& message, std::string& out);
+    void serialize(const QueryPage& message, std::string& out);
+
+    /**
+     * @brief Deserialize the payload of a frame into a message.
+     *
+     * @param frame - decoded frame
+     * @param message - message to populate
+     *
+     * @return bool - true if the payload was valid for the message; false otherwise
+     */
+    bool deserialize(const Frame& frame, OrderRequest& message);
+    bool deserialize(const Frame& frame, OrderModify& message);
+    bool deserialize(const Frame& frame, OrderCancel& message);
+    bool deserialize(const Frame& frame, OrderResponse& message);
+    bool deserialize(const Frame& frame, SnapshotRequest& message);
+    bool deserialize(const Frame& frame, BookSnapshot& message);
+    bool deserialize(const Frame& frame, AdminRequest& message);
+    bool deserialize(const Frame& frame, ExecutionReport& message);
+    bool deserialize(const Frame& frame, QueryRequest& message);
+    bool deserialize(const Frame& frame, QueryPage& message);
+
+    /**
+     * @brief Get the encoded size of a query page before its items, or of one
+     * page item. Used to fill pages up to MAX_PAYLOAD_SIZE.
+     *
+     * @param symbol - symbol of the page
+     * @param item - item of the page
+     *
+     * @return size_t - encoded size (bytes)
+     */
+    size_t encodedPageHeaderSize(const std::string& symbol);
+    size_t encodedSize(const QueryOrder& item);
+    size_t encodedSize(const QueryTrade& item);
+
+    /**
+     * Market data datagram layout (UDP multicast):
+     *
+     * | magic (uint32) | packet sequence (uint64) | update count (uint16) | reserved (uint16) |
+     * | update 1 | update 2 | ... |
+     *
+     * Each update is: type (uint8), symbol (string), symbol sequence (uint64),
+     * side (uint8), price (double), qty (int32), timestamp (int64).
+     */
+
+    /**
+     * @brief Start a new market data datagram in the buffer (clears the buffer).
+     *
+     * @param packetSeq - sequence number of the datagram
+     * @param datagram - buffer to initialize
+     */
+    void beginDatagram(uint64_t packetSeq, std::string& datagram);
+
+    /**
+     * @brief Append an update to a datagram if it fits within MAX_DATAGRAM_SIZE.
+     *
+     * @param update - update to append
+     * @param datagram - datagram started with beginDatagram()
+     *
+     * @return bool - true if appended; false if the datagram is full
+     */
+    bool appendUpdate(const MarketDataUpdate& update, std::string& datagram);
+
+    /**
+     * @brief Decode a market data datagram.
+     *
+     * @param data - received datagram
+     * @param size - size of the datagram
+     * @param packetSeq - populated with the datagram sequence number
+     * @param updates - decoded updates are appended
+     *
+     * @return bool - true if the datagram was valid; false otherwise
+     */
+    bool decodeDatagram(const char* data, size_t size, uint64_t& packetSeq, std::vector<MarketDataUpdate>& updates);
+}; // protocol
+
+#endif // PROTOCOL_H
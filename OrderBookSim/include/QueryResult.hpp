@@ -0,0 +1,105 @@
+// Global Includes
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Project Includes
+#include <HistoryLog.hpp>
+#include <Order.hpp>
+#include <Trade.hpp>
+#include <Types.hpp>
+
+#ifndef QUERYRESULT_H
+#define QUERYRESULT_H
+
+/**
+ * Result of a QueryRequest, captured by the matching engine as a read view of
+ * the book and encoded into QueryPage frames by the session that asked for it.
+ *
+ * Histories are append-only, so the view only pins the entries recorded when
+ * the query ran (no copy); open orders change in place, so they are copied.
+ * Pages are encoded on the transport thread, one at a time as the client
+ * drains them, so the engine never waits on a large result.
+ */
+class QueryResult {
+    public:
+        /**
+         * @brief Constructor for a result without items (rejected query).
+         *
+         * @param request - query the result answers
+         * @param errCode - reason the query was rejected
+         */
+        QueryResult(
+            const QueryRequest& request,
+            ErrorCode errCode
+        );
+
+        /**
+         * @brief Constructor for an OPEN_ORDERS result.
+         *
+         * @param request - query the result answers
+         * @param openOrders - resting orders, in priority order
+         */
+        QueryResult(
+            const QueryRequest& request,
+            std::vector<QueryOrder> openOrders
+        );
+
+        /**
+         * @brief Constructor for an ORDER_HISTORY result.
+         *
+         * @param request - query the result answers
+         * @param orderHistory - view of the book's activity history
+         */
+        QueryResult(
+            const QueryRequest& request,
+            HistoryLog<std::pair<OrderStatus, Order>>::View orderHistory
+        );
+
+        /**
+         * @brief Constructor for a TRADE_HISTORY result.
+         *
+         * @param request - query the result answers
+         * @param tradeHistory - view of the book's trade history
+         */
+        QueryResult(
+            const QueryRequest& request,
+            HistoryLog<Trade>::View tradeHistory
+        );
+
+        /**
+         * @brief Append the next page of the result as a QueryPage frame. Each
+         * page holds as many items as fit in one frame.
+         *
+         * @param out - buffer to append the frame to
+         */
+        void writePage(std::string& out);
+
+        /**
+         * @brief Check whether the final page has been written.
+         *
+         * @return bool - true once the last page was written
+         */
+        bool isComplete() const;
+
+    private:
+        /**
+         * @brief Restrict the result to the requested window of items.
+         *
+         * @param request - query the result answers
+         * @param size - number of items in the view
+         */
+        void selectItems(const QueryRequest& request, size_t size);
+
+        QueryPage page;    // Page being encoded (reused; keeps its capacity)
+        uint64_t position; // Position of the next item to write
+        uint64_t end;      // Position after the last item to write
+        bool complete;     // True once the last page was written
+
+        std::vector<QueryOrder> openOrders;                           // OPEN_ORDERS: copied orders
+        HistoryLog<std::pair<OrderStatus, Order>>::View orderHistory; // ORDER_HISTORY: view of the events
+        HistoryLog<Trade>::View tradeHistory;                         // TRADE_HISTORY: view of the trades
+}; // QueryResult
+
+#endif // QUERYRESULT_H
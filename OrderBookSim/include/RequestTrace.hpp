@@ -0,0 +1,154 @@
+// Global Includes
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Project Includes
+#include <Types.hpp>
+
+#ifndef REQUESTTRACE_H
+#define REQUESTTRACE_H
+
+namespace trace {
+    class TraceBuffer;
+
+    /**
+     * @brief Get the time used by the request traces.
+     *
+     * @return int64_t - steady clock time (ns)
+     */
+    inline int64_t now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    /**
+     * @brief Timestamps carried with a sampled request (steady clock, ns).
+     * Requests that were not sampled carry no buffer and are never stamped.
+     */
+    struct RequestTrace {
+        TraceBuffer* buffer = nullptr;                 // Buffer the trace is recorded in; nullptr if not sampled
+        MessageType type = MessageType::ORDER_REQUEST; // Type of the request
+        uint32_t symbolId = UINT32_MAX;                // Dense symbol ID; UINT32_MAX if not routed to a book
+        int64_t arrival = 0;                           // Frame read from the transport
+        int64_t dequeue = 0;                           // Batch taken from the queue by the engine thread; 0 if rejected before
+        int64_t matchStart = 0;                        // Engine starts executing the request
+        int64_t matchEnd = 0;                          // Engine done executing the request
+    };
+
+    /**
+     * @brief A completed request trace.
+     */
+    struct TraceRecord {
+        RequestTrace stamps; // Timestamps up to the response
+        int64_t send;        // Response handed to the transport
+        uint32_t sessionId;  // Session of the request
+        uint64_t seq;        // Position of the request in the session
+    };
+
+    /**
+     * Sampled request traces, kept in a fixed ring that overwrites the oldest
+     * records. Recording is lock-free for any number of threads: a writer
+     * claims a slot with one atomic increment and publishes it with a version
+     * number (seqlock), so a dump never blocks the transports and skips a
+     * record that is being overwritten.
+     */
+    class TraceBuffer {
+        public:
+            static constexpr size_t DEFAULT_CAPACITY = 65536; // Records kept by default
+
+            /**
+             * @brief Create a trace buffer. Sampling is off until setSampleEvery().
+             *
+             * @param capacity - records kept (the most recent)
+             */
+            explicit TraceBuffer(size_t capacity = DEFAULT_CAPACITY);
+
+            /**
+             * @brief Set the sampling rate.
+             *
+             * @param every - trace one request in every (0 disables tracing)
+             */
+            void setSampleEvery(uint32_t every);
+
+            /**
+             * @brief Decide whether to trace the next request of the calling
+             * thread (a per-thread counter; no shared state).
+             *
+             * @return true if the request should be traced; false otherwise
+             */
+            bool sample();
+
+            /**
+             * @brief Start the trace of a sampled request.
+             *
+             * @param type - type of the request
+             * @param arrival - time its frame was read (@see now())
+             *
+             * @return RequestTrace - trace recording into this buffer
+             */
+            RequestTrace begin(MessageType type, int64_t arrival);
+
+            /**
+             * @brief Record a completed trace.
+             *
+             * @param record - trace to record
+             */
+            void record(const TraceRecord& record);
+
+            /**
+             * @brief Copy the records currently in the buffer, oldest first.
+             *
+             * @return std::vector<TraceRecord> - records
+             */
+            std::vector<TraceRecord> snapshot() const;
+
+            /**
+             * @brief Write the records in the Chrome trace event format (JSON),
+             * readable by chrome://tracing and Perfetto. Each request is an
+             * async slice with its queue, engine wait, match and response
+             * stages nested inside.
+             *
+             * @param out - stream to write to
+             */
+            void writeChromeTrace(std::ostream& out) const;
+
+            /**
+             * @brief Write the Chrome trace to a file whenever the process
+             * receives SIGUSR2 (POSIX only; no-op elsewhere). A watcher thread
+             * writes the file; the signal handler only flags it.
+             *
+             * @param path - trace file, overwritten on each dump
+             */
+            void dumpOnSignal(const std::string& path);
+
+            /**
+             * @return uint64_t - records written so far (including overwritten ones)
+             */
+            uint64_t getRecorded() const;
+
+        private:
+            static constexpr size_t RECORD_WORDS = (sizeof(TraceRecord) + 7) / 8; // Record size in 64-bit words
+
+            /**
+             * @brief One record of the ring. The record is stored as atomic
+             * words so a dump may read it while it is overwritten; the version
+             * tells the dump whether it read a whole record.
+             */
+            struct Slot {
+                std::atomic<uint64_t> version{0};               // Odd while written; 0 if never written
+                std::atomic<uint64_t> words[RECORD_WORDS] = {}; // Record
+            };
+
+            std::unique_ptr<Slot[]> slots;     // Ring of records
+            size_t capacity;                   // Slots in the ring
+            std::atomic<uint64_t> next;        // Records claimed so far
+            std::atomic<uint32_t> sampleEvery; // Trace one request in this many; 0 disables
+    }; // TraceBuffer
+};
+
+#endif // REQUESTTRACE_H
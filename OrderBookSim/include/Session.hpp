@@ -0,0 +1,244 @@
+// Global Includes
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Project Includes
+#include <Admission.hpp>
+#include <Network.hpp>
+#include <Protocol.hpp>
+#include <QueryResult.hpp>
+#include <RequestTrace.hpp>
+
+#ifndef SESSION_H
+#define SESSION_H
+
+/**
+ * A client session. The session buffers received bytes, decodes pipelined
+ * frames and coalesces outbound frames independently of the transport; the
+ * transport (socket, shared memory ring, ...) only moves bytes.
+ *
+ * Requests may complete out of order (they are matched on different engine
+ * threads); the session numbers every request and writes the responses back
+ * in request order. A query result is streamed page by page as the transport
+ * drains the outbound buffer; later responses wait behind it.
+ */
+class Session {
+    public:
+        /**
+         * @brief Constructor for a new client session.
+         *
+         * @param sessionId - identifier of the session
+         */
+        explicit Session(
+            uint32_t sessionId
+        );
+        virtual ~Session() = default;
+
+        Session(const Session&) = delete;
+        Session& operator=(const Session&) = delete;
+
+        /**
+         * @brief Read every byte currently available from the transport into the
+         * receive buffer. Reading stops once the transport has no more data or
+         * the buffer is full.
+         *
+         * @return long - bytes read; -1 if the read failed
+         */
+        long readAvailable();
+
+        /**
+         * @brief Decode the next complete frame in the receive buffer. Frames
+         * remain valid until compactReceiveBuffer() or readAvailable() is called.
+         *
+         * @param frame - decoded frame; populated if a frame was available
+         *
+         * @return bool - true if a frame was decoded; false if no complete frame
+         *                remains (@see hasProtocolError for malformed streams)
+         */
+        bool nextFrame(protocol::Frame& frame);
+
+        /**
+         * @brief Discard the decoded frames from the receive buffer and move any
+         * partial frame to the front.
+         */
+        void compactReceiveBuffer();
+
+        /**
+         * @brief Get a buffer to append outbound frames to. Frames appended to the
+         * buffer are coalesced and written by the next flush().
+         *
+         * @return std::string& - outbound buffer
+         */
+        std::string& outbound();
+
+        /**
+         * @brief Write all queued outbound frames to the transport with a single
+         * vectored write. Bytes the transport cannot accept stay queued. The
+         * next pages of a query being streamed are queued first.
+         *
+         * @return bool - true if the session is still usable; false on a write error
+         */
+        bool flush();
+
+        /**
+         * @brief Reserve the next response position for a request.
+         *
+         * @return uint64_t - sequence number of the request
+         */
+        uint64_t beginRequest();
+
+        /**
+         * @brief Record the response of a request. Responses are appended to the
+         * outbound buffer in request order, as soon as every earlier request
+         * has completed.
+         *
+         * @param seq - sequence number returned by beginRequest()
+         * @param response - response of the request
+         * @param query - result of a query (written as pages instead of the
+         *                response); nullptr for other requests
+         * @param trace - timestamps of a sampled request, recorded once the
+         *                response is sent
+         */
+        void completeRequest(uint64_t seq, const OrderResponse& response, std::shared_ptr<QueryResult> query = nullptr,
+                             const trace::RequestTrace& trace = trace::RequestTrace());
+
+        /**
+         * @brief Queue an execution report. The report is written after the
+         * responses of every request the session has already sent, so a client
+         * never sees a report for an order ID it has not been given yet.
+         *
+         * @param report - execution report of an order owned by the session
+         */
+        void deliverReport(const ExecutionReport& report);
+
+        /**
+         * @brief Mark the session as failed (transport error). A failed session
+         * is no longer read or written, and is destroyed once every outstanding
+         * request has completed.
+         */
+        void markFailed();
+
+        /**
+         * @brief Clear all buffered state so the session can be reused for a new client.
+         *
+         * @param t_sessionId - identifier of the new session
+         */
+        void reset(uint32_t t_sessionId);
+
+        /**
+         * @brief Accessor functions for the session (getters).
+         *
+         * getSessionId() - gets the session identifier
+         * hasPendingOutbound() - true if frames (or query pages) are waiting to be written
+         * hasProtocolError() - true if the client sent a malformed frame
+         * isPeerClosed() - true if the client closed its side of the connection
+         * hasFailed() - true if the transport failed
+         * hasOutstandingRequests() - true if an engine still holds a request of the session
+         * getOutstandingRequests() - gets the number of requests not answered yet
+         * getOpenOrders() - gets the number of the session's orders resting in the books
+         * getOpenOrderCount() - gets the counter of resting orders, shared with the engines
+         * getMessageBucket() - gets the session's request rate limiter (@see AdmissionLimits)
+         */
+        uint32_t getSessionId() const;
+        bool hasPendingOutbound() const;
+        bool hasProtocolError() const;
+        bool isPeerClosed() const;
+        bool hasFailed() const;
+        bool hasOutstandingRequests() const;
+        size_t getOutstandingRequests() const;
+        uint32_t getOpenOrders() const;
+        const std::shared_ptr<std::atomic<uint32_t>>& getOpenOrderCount() const;
+        TokenBucket& getMessageBucket();
+
+    protected:
+        /**
+         * @brief Read bytes from the transport.
+         *
+         * @param buffer - destination buffer
+         * @param length - size of the destination buffer
+         *
+         * @return long - bytes read; 0 if no data is available; -1 on error
+         */
+        virtual long receiveBytes(char* buffer, size_t length) = 0;
+
+        /**
+         * @brief Write a list of buffers to the transport with one operation.
+         *
+         * @param slices - buffers to write, in order
+         * @param count - number of slices
+         *
+         * @return long - bytes accepted (0 if the transport is full); -1 on error
+         */
+        virtual long sendSlices(net::IoSlice* slices, size_t count) = 0;
+
+        /**
+         * @brief Record that the client closed its side of the session.
+         */
+        void markPeerClosed();
+
+    private:
+        /**
+         * @brief Append every response that no longer waits for an earlier
+         * request to the outbound buffer. A query result is written until the
+         * outbound buffer holds MAX_STREAM_BLOCKS; the rest waits for flush().
+         */
+        void writeCompleted();
+
+        static constexpr size_t RECEIVE_BUFFER_SIZE = 64 * 1024; // Receive buffer capacity (bytes)
+        static constexpr size_t OUTBOUND_BLOCK_SIZE = 16 * 1024; // Preferred size of an outbound block (bytes)
+        static constexpr size_t MAX_STREAM_BLOCKS   = 16;        // Outbound blocks a query may fill ahead of the transport
+
+        uint32_t sessionId; // Session identifier
+
+        std::vector<char> rxBuffer; // Bytes read from the transport
+        size_t rxSize;              // Number of valid bytes in the receive buffer
+        size_t rxOffset;            // Offset of the next undecoded frame
+        bool protocolError;         // True if a malformed frame was received
+        bool peerClosed;            // True once the client closed the connection
+        bool failed;                // True once the transport failed
+
+        /**
+         * @brief Response position of a request.
+         */
+        struct PendingResponse {
+            bool complete;                      // True once the response was recorded
+            OrderResponse response;             // Response of the request
+            std::shared_ptr<QueryResult> query; // Result of a query; nullptr for other requests
+            trace::RequestTrace trace;          // Timestamps of a sampled request
+        };
+
+        // Responses waiting for an earlier request; front is nextResponseSeq
+        uint64_t nextResponseSeq;                    // Sequence number of the next response to write
+        std::deque<PendingResponse> pendingResponses; // Unwritten responses, in request order
+        size_t incompleteRequests;                   // Requests not completed by an engine yet
+
+        /**
+         * @brief Execution report waiting for an outstanding response.
+         */
+        struct HeldReport {
+            uint64_t afterSeq;      // Written right after the response with this sequence number
+            ExecutionReport report; // Report to write
+        };
+
+        std::deque<HeldReport> heldReports; // Reports waiting for a response, in delivery order
+
+        TokenBucket messageBucket; // Request rate limit of the session
+
+        // Orders of the session resting in the books; counted by the engines
+        // (@see OrderOwner), which keep it alive while the orders rest
+        std::shared_ptr<std::atomic<uint32_t>> openOrders;
+
+        // Outbound frames are coalesced into blocks; each block becomes one
+        // slice of the vectored write
+        std::vector<std::string> txBlocks; // Queued outbound blocks, in order
+        std::vector<std::string> txFree;   // Emptied blocks kept for reuse
+        size_t txOffset;                   // Bytes of the first block already sent
+
+        std::vector<trace::TraceRecord> sendTraces; // Traces of responses written but not sent yet
+}; // Session
+
+#endif // SESSION_H
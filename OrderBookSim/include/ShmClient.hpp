@@ -0,0 +1,83 @@
+// Global Includes
+#include <cstdint>
+#include <string>
+
+// Project Includes
+#include <ShmRing.hpp>
+
+#ifndef SHMCLIENT_H
+#define SHMCLIENT_H
+
+/**
+ * Agent side of the shared memory transport. Frames written with send() are
+ * handled by the order book manager exactly like frames sent over a socket
+ * (@see Protocol.hpp).
+ */
+class ShmClient {
+    public:
+        /**
+         * @brief Constructor for a new shared memory client.
+         *
+         * @param waitMode - how the client waits for responses
+         */
+        explicit ShmClient(
+            shm::WaitMode waitMode
+        );
+        ~ShmClient();
+
+        ShmClient(const ShmClient&) = delete;
+        ShmClient& operator=(const ShmClient&) = delete;
+
+        /**
+         * @brief Map the manager's shared memory region and claim a free slot.
+         *
+         * @param name - name of the shared memory region
+         *
+         * @return bool - true if connected; false if the region does not exist
+         *                or every slot is in use
+         */
+        bool connect(const std::string& name);
+
+        /**
+         * @brief Release the slot and unmap the region.
+         */
+        void disconnect();
+
+        /**
+         * @brief Write frames to the request ring, waiting for space if the ring
+         * is full. Several frames may be written at once.
+         *
+         * @param frames - serialized frames
+         *
+         * @return bool - true if written; false if not connected
+         */
+        bool send(const std::string& frames);
+
+        /**
+         * @brief Read bytes from the response ring, waiting (busy-poll or futex)
+         * up to the timeout if the ring is empty.
+         *
+         * @param buffer - destination buffer
+         * @param length - size of the destination buffer
+         * @param timeoutMs - maximum time to wait for a response
+         *
+         * @return size_t - bytes read; 0 on timeout
+         */
+        size_t receive(char* buffer, size_t length, int timeoutMs);
+
+    private:
+        /**
+         * @brief Wake the server if it is asleep on the region doorbell. Costs
+         * no system call while the server is polling.
+         */
+        void notifyServer();
+
+        shm::WaitMode waitMode;   // How the client waits for responses
+        shm::ShmMapping mapping;  // Mapped shared memory region
+        shm::ShmSlot* slot;       // Claimed client slot; nullptr if not connected
+        char* requestData;        // Request ring data
+        char* responseData;       // Response ring data
+        uint64_t ringCapacity;    // Capacity of each ring (bytes)
+}; // ShmClient
+
+#endif // SHMCLIENT_H
@@ -0,0 +1,216 @@
+// Global Includes
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#ifndef SHMRING_H
+#define SHMRING_H
+
+/**
+ * Shared memory layout used by the shared memory transport between co-located
+ * agents and the order book manager.
+ *
+ * The region holds a header followed by a fixed number of client slots. Each
+ * slot owns two single-producer/single-consumer byte rings: the request ring
+ * (agent => server) and the response ring (server => agent). The rings carry
+ * the same frames as the socket transport (@see Protocol.hpp).
+ *
+ * | ShmRegionHeader | ShmSlot 0 | ring data 0 | ShmSlot 1 | ring data 1 | ...
+ */
+namespace shm {
+    constexpr uint32_t REGION_MAGIC   = 0x4F424D31; // "OBM1"
+    constexpr size_t CACHE_LINE_SIZE  = 64;
+    constexpr int WAIT_TIMEOUT_MS     = 100;        // Upper bound of a single blocking wait
+
+    /**
+     * @brief How a consumer waits for an empty ring to receive data.
+     */
+    enum class WaitMode {
+        BUSY_POLL, // Spin on the ring; lowest latency, burns a core
+        FUTEX      // Sleep on a futex word until the producer wakes it
+    };
+
+    /**
+     * @brief State of a client slot.
+     */
+    enum class SlotState : uint32_t {
+        FREE      = 0, // Available to be claimed by an agent
+        CLAIMED   = 1, // Claimed; the agent is initializing the rings
+        CONNECTED = 2, // Agent connected; the server services the rings
+        CLOSED    = 3  // Agent disconnected; the server releases the slot
+    };
+
+    /**
+     * @brief Control block of a single-producer/single-consumer byte ring. The
+     * ring data follows the control block in the region. Positions increase
+     * monotonically; the data offset is the position modulo the capacity.
+     */
+    struct ShmRing {
+        alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> head;     // Producer write position
+        alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> tail;     // Consumer read position
+        alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> signal;   // Futex word; bumped when a waiting consumer is woken
+        std::atomic<uint32_t> consumerWaiting;                   // 1 while the consumer is asleep on the futex
+    };
+
+    /**
+     * @brief Client slot; owns one request and one response ring.
+     */
+    struct ShmSlot {
+        alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> state; // @see SlotState
+        uint32_t generation;                                  // Incremented every time the slot is claimed
+        ShmRing request;                                      // Agent => server frames
+        ShmRing response;                                     // Server => agent frames
+    };
+
+    /**
+     * @brief Header at the start of the shared memory region.
+     */
+    struct ShmRegionHeader {
+        alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> magic; // REGION_MAGIC once the server initialized the region
+        uint32_t slotCount;                                   // Number of client slots
+        uint64_t ringCapacity;                                // Bytes of data per ring (power of two)
+        alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> doorbell;      // Futex word the server sleeps on
+        std::atomic<uint32_t> serverWaiting;                          // 1 while the server is asleep on the doorbell
+    };
+
+    /**
+     * @brief Mapping of a named shared memory region into this process.
+     */
+    struct ShmMapping {
+        void* address = nullptr; // Start of the mapping; nullptr if not mapped
+        size_t size = 0;         // Size of the mapping (bytes)
+        intptr_t handle = -1;    // Platform handle (file descriptor / HANDLE)
+        std::string name;        // Region name
+        bool owner = false;      // True if this process created the region
+    };
+
+    /**
+     * @brief Compute the size of a region.
+     *
+     * @param slotCount - number of client slots
+     * @param ringCapacity - bytes of data per ring
+     *
+     * @return size_t - total region size (bytes)
+     */
+    size_t regionSize(uint32_t slotCount, uint64_t ringCapacity);
+
+    /**
+     * @brief Create (server) or open (agent) a named shared memory region.
+     * POSIX systems use shm_open (/dev/shm); Windows uses a named file mapping.
+     *
+     * @param name - region name (without a leading '/')
+     * @param size - region size; ignored when opening (read from the region)
+     * @param create - true to create the region; false to open an existing one
+     * @param mapping - populated with the mapping
+     *
+     * @return bool - true if mapped; false otherwise
+     */
+    bool mapRegion(const std::string& name, size_t size, bool create, ShmMapping& mapping);
+
+    /**
+     * @brief Unmap a region. The owner also removes the region name.
+     *
+     * @param mapping - mapping to release
+     */
+    void unmapRegion(ShmMapping& mapping);
+
+    /**
+     * @brief Accessors for the parts of a mapped region.
+     */
+    ShmRegionHeader* regionHeader(void* region);
+    ShmSlot* regionSlot(void* region, uint32_t slot);
+    char* requestData(void* region, uint32_t slot);
+    char* responseData(void* region, uint32_t slot);
+
+    /**
+     * @brief Reset a ring to empty. Only safe while neither side is using it.
+     *
+     * @param ring - ring to reset
+     */
+    void resetRing(ShmRing& ring);
+
+    /**
+     * @brief Copy bytes into a ring (producer side). Writes as many bytes as fit.
+     *
+     * @param ring - ring control block
+     * @param data - ring data
+     * @param capacity - ring capacity (power of two)
+     * @param source - bytes to write
+     * @param length - number of bytes to write
+     *
+     * @return size_t - bytes written
+     */
+    size_t ringWrite(ShmRing& ring, char* data, uint64_t capacity, const char* source, size_t length);
+
+    /**
+     * @brief Get the number of bytes the producer can write without blocking.
+     * Used by producers that must write a record whole or not at all.
+     *
+     * @param ring - ring control block
+     * @param capacity - ring capacity (power of two)
+     *
+     * @return size_t - free bytes in the ring
+     */
+    size_t ringFree(const ShmRing& ring, uint64_t capacity);
+
+    /**
+     * @brief Copy bytes out of a ring (consumer side).
+     *
+     * @param ring - ring control block
+     * @param data - ring data
+     * @param capacity - ring capacity (power of two)
+     * @param destination - buffer to copy into
+     * @param length - size of the destination buffer
+     *
+     * @return size_t - bytes read; 0 if the ring is empty
+     */
+    size_t ringRead(ShmRing& ring, const char* data, uint64_t capacity, char* destination, size_t length);
+
+    /**
+     * @brief Check whether a ring holds unread bytes.
+     *
+     * @param ring - ring control block
+     *
+     * @return bool - true if the ring is empty
+     */
+    bool ringEmpty(const ShmRing& ring);
+
+    /**
+     * @brief Block until the futex word no longer holds the expected value, the
+     * word is woken, or the timeout expires. On platforms without a shared
+     * futex the caller sleeps briefly instead.
+     *
+     * @param word - futex word in shared memory
+     * @param expected - value the word held when the caller decided to sleep
+     * @param timeoutMs - maximum time to sleep
+     */
+    void futexWait(std::atomic<uint32_t>& word, uint32_t expected, int timeoutMs);
+
+    /**
+     * @brief Wake every process sleeping on a futex word.
+     *
+     * @param word - futex word in shared memory
+     */
+    void futexWake(std::atomic<uint32_t>& word);
+
+    /**
+     * @brief Producer side wakeup. Wakes the consumer of a ring if it is asleep.
+     * Costs no system call while the consumer is spinning.
+     *
+     * @param ring - ring that received data
+     */
+    void notifyConsumer(ShmRing& ring);
+
+    /**
+     * @brief Consumer side wait. Returns once the ring holds data or the timeout
+     * expires.
+     *
+     * @param ring - ring to wait on
+     * @param mode - busy-poll or futex wait
+     * @param timeoutMs - maximum time to wait (futex mode)
+     */
+    void waitForData(ShmRing& ring, WaitMode mode, int timeoutMs);
+}; // shm
+
+#endif // SHMRING_H
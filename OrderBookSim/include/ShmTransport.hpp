@@ -0,0 +1,164 @@
+// Global Includes
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// Project Includes
+#include <CompletionQueue.hpp>
+#include <Logger.h>
+#include <Session.hpp>
+#include <ShmRing.hpp>
+#include <Threading.hpp>
+
+#ifndef SHMTRANSPORT_H
+#define SHMTRANSPORT_H
+
+/**
+ * Server side of a shared memory client slot. Moves frames between the slot's
+ * rings and the session buffers; frame handling is shared with the socket path.
+ */
+class ShmSession : public Session {
+    public:
+        /**
+         * @brief Constructor for a new shared memory session.
+         *
+         * @param region - mapped shared memory region
+         * @param slot - index of the client slot
+         * @param sessionId - identifier of the session
+         */
+        ShmSession(
+            void* region,
+            uint32_t slot,
+            uint32_t sessionId
+        );
+
+    protected:
+        /**
+         * @brief Shared memory transport (@see Session). Reads from the slot's
+         * request ring and writes to its response ring, waking the agent if it
+         * is asleep.
+         */
+        long receiveBytes(char* buffer, size_t length) override;
+        long sendSlices(net::IoSlice* slices, size_t count) override;
+
+    private:
+        shm::ShmSlot* slot;    // Client slot serviced by the session
+        char* requestData;     // Request ring data
+        char* responseData;    // Response ring data
+        uint64_t ringCapacity; // Capacity of each ring (bytes)
+}; // ShmSession
+
+class ShmTransport {
+    public:
+        using FrameHandler = std::function<void(Session&, CompletionQueue&)>;
+        using ReadGate = std::function<bool(const Session&)>;
+        using CloseHandler = std::function<void(uint32_t)>;
+
+        /**
+         * @brief Constructor for a new shared memory transport.
+         *
+         * @param name - name of the shared memory region
+         * @param slotCount - maximum number of concurrently connected agents
+         * @param ringCapacity - bytes per request/response ring (power of two)
+         * @param waitMode - how the transport thread waits for requests
+         * @param handler - handles the frames received by a session (same
+         *                  handler as the socket transport); responses are
+         *                  delivered through the transport's completion queue
+         * @param readGate - false while a session's requests must stay unread
+         *                   (flow control); its ring then fills up and the
+         *                   agent's writes block
+         * @param onClose - called with the ID of a session once its agent
+         *                  disconnected and its requests were handled
+         * @param sessionIds - shared source of session identifiers
+         * @param logging - console logging flag
+         */
+        ShmTransport(
+            std::string name,
+            uint32_t slotCount,
+            uint64_t ringCapacity,
+            shm::WaitMode waitMode,
+            FrameHandler handler,
+            ReadGate readGate,
+            CloseHandler onClose,
+            std::atomic<uint32_t>& sessionIds,
+            bool logging
+        );
+        ~ShmTransport();
+
+        /**
+         * @brief Create the shared memory region and start the transport thread.
+         *
+         * @return bool - true if started; false if the region could not be created
+         */
+        bool start();
+
+        /**
+         * @brief Stop the transport thread and remove the shared memory region.
+         */
+        void stop();
+
+        /**
+         * @brief Set the CPU and scheduling of the transport thread; must be
+         * called before start().
+         *
+         * @param t_placement - placement of the transport thread
+         */
+        void setThreadPlacement(const threading::ThreadPlacement& t_placement);
+
+    private:
+        /**
+         * @brief Transport thread. Services every connected slot and waits
+         * (busy-poll or futex) when no slot has pending requests.
+         */
+        void run();
+
+        /**
+         * @brief Service every slot once: accept new agents, handle received
+         * frames, write completed responses, flush them and release
+         * disconnected slots once none of their requests is outstanding.
+         *
+         * @return bool - true if any work was done
+         */
+        bool serviceSlots();
+
+        /**
+         * @brief Check whether any slot needs servicing. Used before sleeping.
+         *
+         * @return bool - true if a slot has pending requests or changed state
+         */
+        bool slotsPending();
+
+        /**
+         * @brief Wake the transport thread if it is asleep on the doorbell.
+         * Called by the matching engines when responses are completed.
+         */
+        void ringDoorbell();
+
+        std::string name;                     // Name of the shared memory region
+        uint32_t slotCount;                   // Number of client slots
+        uint64_t ringCapacity;                // Capacity of each ring (bytes)
+        shm::WaitMode waitMode;               // How the transport thread waits for requests
+        FrameHandler handler;                 // Handles frames received by a session
+        ReadGate readGate;                    // False while a session must not be read
+        CloseHandler onClose;                 // Called when a session is released
+        bool readsPaused;                     // True if the last pass left a session unread
+        std::atomic<uint32_t>& sessionIds;    // Shared source of session identifiers
+        bool logging;                         // True to log to console, false otherwise
+        threading::ThreadPlacement placement; // CPU and scheduling of the transport thread
+
+        shm::ShmMapping mapping;                             // Mapped shared memory region
+        std::vector<std::unique_ptr<ShmSession>> slots;      // Session per slot; nullptr if not connected
+        CompletionQueue completions;                         // Responses completed by the matching engines
+        std::vector<Completion> completed;                   // Completions drained in the current pass
+        std::vector<RoutedReport> reports;                   // Execution reports drained in the current pass
+        std::unordered_map<uint32_t, uint32_t> sessionSlots; // Session ID => slot of a connected agent
+        std::atomic<bool> running;                           // False to stop the transport thread
+        std::thread worker;                                  // Transport thread
+}; // ShmTransport
+
+#endif // SHMTRANSPORT_H
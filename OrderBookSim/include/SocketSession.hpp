@@ -0,0 +1,42 @@
+// Project Includes
+#include <Network.hpp>
+#include <Session.hpp>
+
+#ifndef SOCKETSESSION_H
+#define SOCKETSESSION_H
+
+class SocketSession : public Session {
+    public:
+        /**
+         * @brief Constructor for a new socket client session. The session takes
+         * ownership of the connected socket and closes it when destroyed.
+         *
+         * @param socket - connected (non-blocking) client socket
+         * @param sessionId - identifier of the session
+         */
+        SocketSession(
+            SOCKET socket,
+            uint32_t sessionId
+        );
+        ~SocketSession() override;
+
+        /**
+         * @brief Get the client socket.
+         *
+         * @return SOCKET - connected client socket
+         */
+        SOCKET getSocket() const;
+
+    protected:
+        /**
+         * @brief Socket transport (@see Session). Reads with recv and writes
+         * with a single vectored send (WSASend / sendmsg).
+         */
+        long receiveBytes(char* buffer, size_t length) override;
+        long sendSlices(net::IoSlice* slices, size_t count) override;
+
+    private:
+        SOCKET socket; // Connected client socket
+}; // SocketSession
+
+#endif // SOCKETSESSION_H
@@ -0,0 +1,197 @@
+// Global Includes
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#ifndef STAGETIMERS_H
+#define STAGETIMERS_H
+
+/**
+ * @brief Hot path stage timers: 1 compiles the OBM_STAGE() probes in, 0 (the
+ * default) compiles them to nothing (e.g. -DOBM_STAGE_TIMERS=1).
+ */
+#ifndef OBM_STAGE_TIMERS
+#define OBM_STAGE_TIMERS 0
+#endif
+
+#if OBM_STAGE_TIMERS
+#define OBM_STAGE_CONCAT_(a, b) a##b
+#define OBM_STAGE_CONCAT(a, b) OBM_STAGE_CONCAT_(a, b)
+
+/**
+ * @brief Time the rest of the enclosing scope as a stage (@see stages::Stage).
+ */
+#define OBM_STAGE(stage) stages::StageProbe OBM_STAGE_CONCAT(stageProbe, __LINE__)(stages::Stage::stage)
+#else
+#define OBM_STAGE(stage) ((void)0)
+#endif
+
+namespace stages {
+    constexpr bool ENABLED = OBM_STAGE_TIMERS != 0; // True if the probes are compiled in
+
+    /**
+     * @brief Stages of a request. Stages nest: MATCH includes the INSERT and
+     * HISTORY of the orders it rests and trades it records, and EXECUTE
+     * includes every book stage of the command.
+     */
+    enum class Stage : uint8_t {
+        DECODE,    // Frame payload => request (OrderBookManager)
+        ROUTE,     // Symbol lookup and queueing to the book's engine (OrderBookManager)
+        EXECUTE,   // One command on an engine thread or batch worker (MatchingEngine)
+        VALIDATE,  // Order parameter checks (OrderBook)
+        MATCH,     // Matching an incoming or modified order, or a batch auction (OrderBook)
+        INSERT,    // Resting an order at its price level (OrderBook)
+        HISTORY,   // Appending to the order and trade histories (OrderBook)
+        SERIALIZE, // Response / report => frame (Session)
+        SEND,      // Vectored send of a session's frames (Session)
+        COUNT
+    };
+
+    /**
+     * @brief Read the CPU timestamp counter (rdtsc on x86, the virtual
+     * counter on AArch64, the steady clock in ns elsewhere).
+     *
+     * @return uint64_t - current tick count
+     */
+    inline uint64_t readTicks() {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        return __rdtsc();
+#elif defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#elif defined(__aarch64__)
+        uint64_t ticks;
+        asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+        return ticks;
+#else
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    /**
+     * Tick histogram of one stage on one thread: 16 log-linear sub-buckets
+     * per power of two (6% resolution) in a few KB. Written only by its
+     * thread with relaxed atomic loads and stores (plain moves, no locked
+     * instructions), so a dump can read it while the thread keeps recording.
+     */
+    class StageHistogram {
+        public:
+            static constexpr int SUB_BUCKET_BITS = 4;                                             // log2 of the sub-buckets per power of two
+            static constexpr size_t BUCKETS = (64 - SUB_BUCKET_BITS + 1) * (1 << SUB_BUCKET_BITS); // Buckets covering 64-bit values
+
+            /**
+             * @brief Record a duration (owning thread only).
+             *
+             * @param ticks - duration in ticks
+             */
+            void record(uint64_t ticks) {
+                std::atomic<uint64_t>& bucket = counts[indexOf(ticks)];
+                bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                total.store(total.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                if (ticks > maxTicks.load(std::memory_order_relaxed)) maxTicks.store(ticks, std::memory_order_relaxed);
+            }
+
+            /**
+             * @brief Get the bucket counting a duration.
+             *
+             * @param ticks - duration in ticks
+             *
+             * @return size_t - bucket index
+             */
+            static size_t indexOf(uint64_t ticks) {
+                constexpr uint64_t exact = 2ULL << SUB_BUCKET_BITS;
+                if (ticks < exact) return static_cast<size_t>(ticks);
+
+                int highestBit = 63;
+                while (!(ticks >> highestBit)) highestBit--;
+                int shift = highestBit - SUB_BUCKET_BITS;
+
+                return (static_cast<size_t>(shift) << SUB_BUCKET_BITS) + static_cast<size_t>(ticks >> shift);
+            }
+
+            /**
+             * @brief Get the middle of the durations counted by a bucket.
+             *
+             * @param index - bucket index
+             *
+             * @return double - middle duration (ticks)
+             */
+            static double midpointOf(size_t index);
+
+            std::atomic<uint64_t> counts[BUCKETS] = {}; // Durations per bucket
+            std::atomic<uint64_t> total{0};             // Durations recorded
+            std::atomic<uint64_t> maxTicks{0};          // Longest duration recorded
+    }; // StageHistogram
+
+    /**
+     * @brief Stage histograms of one thread.
+     */
+    struct ThreadStages {
+        char name[32] = "thread";                                      // Name given with setThreadName()
+        StageHistogram histograms[static_cast<size_t>(Stage::COUNT)]; // One histogram per stage
+    };
+
+    /**
+     * @brief Get the stage histograms of the calling thread, registering them
+     * on first use (kept after the thread exits, so dumps still show it).
+     *
+     * @return ThreadStages& - histograms of the calling thread
+     */
+    ThreadStages& threadStages();
+
+    /**
+     * @brief Name the calling thread in dumps (no-op when the probes are
+     * compiled out).
+     *
+     * @param name - thread name (truncated to 31 characters)
+     */
+    void setThreadName(const std::string& name);
+
+    /**
+     * @brief Write the percentiles (ns) of every stage recorded, per thread
+     * and over all threads.
+     *
+     * @param out - stream to write to
+     */
+    void dump(std::ostream& out);
+
+    /**
+     * @brief Dump the stage timers to stderr whenever the process receives
+     * SIGUSR1 (POSIX only; no-op elsewhere). A watcher thread performs the
+     * dump; the signal handler only flags it.
+     */
+    void dumpOnSignal();
+
+    /**
+     * Times the scope it lives in as one stage of the calling thread. Two
+     * timestamp counter reads and one histogram update; use OBM_STAGE() so
+     * the probe compiles away when OBM_STAGE_TIMERS is 0.
+     */
+    class StageProbe {
+        public:
+            explicit StageProbe(Stage stage) :
+                histogram(threadStages().histograms[static_cast<size_t>(stage)]),
+                start(readTicks()) {}
+
+            ~StageProbe() {
+                histogram.record(readTicks() - start);
+            }
+
+            StageProbe(const StageProbe&) = delete;
+            StageProbe& operator=(const StageProbe&) = delete;
+
+        private:
+            StageHistogram& histogram; // Histogram of the stage on this thread
+            uint64_t start;            // Tick count at the start of the stage
+    }; // StageProbe
+}; // stages
+
+#endif // STAGETIMERS_H
@@ -0,0 +1,366 @@
+// Global Includes
+#include <cstddef>
+#include <cstdint>
+
+// Project Includes
+#include <BookEvents.hpp>
+#include <OrderBook.hpp>
+#include <Types.hpp>
+
+#ifndef STRATEGY_H
+#define STRATEGY_H
+
+/**
+ * @brief Fill or cancel of one of a strategy's orders. The order is named by
+ * the tag the strategy gave it, so the record holds no strings.
+ */
+struct FillEvent {
+    uint64_t clientTag;  // Tag the strategy gave the order
+    ExecutionType type;  // FILL or CANCEL
+    OrderSide side;      // Side of the order
+    double price;        // Execution price (0 for CANCEL)
+    int qty;             // Executed / canceled quantity
+    int leavesQty;       // Quantity still resting after the event (0 = order done)
+    long long timestamp; // Time of the event (ms since epoch)
+};
+
+/**
+ * @brief Request queued by a strategy through its OrderGateway.
+ */
+struct GatewayRequest {
+    uint64_t clientTag; // Tag of the order
+    bool cancel;        // True to cancel the tagged order; false for a new order
+    OrderSide side;     // New order: side
+    OrderType type;     // New order: type
+    int qty;            // New order: quantity
+    double price;       // New order: price
+};
+
+/**
+ * Order entry of a strategy. Requests are copied into a fixed ring (no
+ * allocation) and executed by the strategy's host right after the book
+ * operation that triggered the callback, still on the matching thread, so a
+ * strategy never modifies the book from inside its own callback. Requests are
+ * executed in the order they were queued.
+ */
+class OrderGateway {
+    public:
+        static constexpr size_t CAPACITY = 64; // Requests queued at once (also the strategy's open order limit)
+
+        /**
+         * @brief Queue a new order.
+         *
+         * @param clientTag - tag naming the order in later fills and cancels (unique per live order)
+         * @param qty - quantity of the order
+         * @param price - price of the order
+         * @param side - side of the order
+         * @param type - type of the order
+         *
+         * @return bool - true if queued; false if the queue is full
+         */
+        bool submitOrder(uint64_t clientTag, int qty, double price, OrderSide side, OrderType type);
+
+        /**
+         * @brief Queue a cancel of a resting order.
+         *
+         * @param clientTag - tag of the order
+         *
+         * @return bool - true if queued; false if the queue is full
+         */
+        bool cancelOrder(uint64_t clientTag);
+
+        /**
+         * @brief Accessor functions for the market (getters).
+         *
+         * getBestBid() / getBestAsk() - gets the best price of the book; 0 if the side is empty
+         * getPendingCount() - gets the number of requests not yet executed
+         */
+        double getBestBid() const;
+        double getBestAsk() const;
+        size_t getPendingCount() const;
+
+    private:
+        friend class StrategyHost;
+
+        explicit OrderGateway(const OrderBook& book) : book(book), requests(), head(0), count(0) {}
+
+        /**
+         * @brief Take the oldest queued request.
+         *
+         * @param request - populated with the request
+         *
+         * @return bool - true if a request was taken; false if the queue is empty
+         */
+        bool pop(GatewayRequest& request);
+
+        const OrderBook& book;             // Book the strategy trades in
+        GatewayRequest requests[CAPACITY]; // Ring of queued requests
+        size_t head;                       // Index of the oldest request
+        size_t count;                      // Number of queued requests
+}; // OrderGateway
+
+/**
+ * In-process trading strategy driven by one order book's events. Callbacks
+ * run synchronously on the thread executing the book's commands (the engine
+ * thread or one of its batch workers on the server, the simulation thread in
+ * an AgentManager), right after each change,
+ * with references to the book's event records (valid only during the call).
+ * A strategy trades through its gateway; it must not block and must not touch
+ * the book directly.
+ */
+class Strategy {
+    public:
+        virtual ~Strategy() = default;
+
+        /**
+         * @brief Called once, when the strategy is attached to its book.
+         */
+        virtual void onStart() {}
+
+        /**
+         * @brief Called after a price level of the book changed.
+         *
+         * @param event - new aggregated state of the level
+         */
+        virtual void onBookUpdate(const BookLevelEvent& event) { (void)event; }
+
+        /**
+         * @brief Called for every trade in the book (including the strategy's).
+         *
+         * @param event - execution details
+         */
+        virtual void onTrade(const TradeEvent& event) { (void)event; }
+
+        /**
+         * @brief Called for every fill and cancel of one of the strategy's orders.
+         *
+         * @param event - order tag, quantity and remaining quantity
+         */
+        virtual void onFill(const FillEvent& event) { (void)event; }
+
+        /**
+         * @brief Called when a queued request was rejected.
+         *
+         * @param clientTag - tag of the request's order
+         * @param errCode - reason (BAD_ID if the order is no longer resting)
+         */
+        virtual void onReject(uint64_t clientTag, ErrorCode errCode) { (void)clientTag; (void)errCode; }
+
+    protected:
+        /**
+         * @return OrderGateway& - order entry of the strategy (only valid once attached)
+         */
+        OrderGateway& gateway() { return *orderGateway; }
+
+    private:
+        friend class StrategyHost;
+
+        OrderGateway* orderGateway = nullptr; // Set by the host that runs the strategy
+}; // Strategy
+
+/**
+ * @brief Counters of a hosted strategy.
+ */
+struct StrategyStats {
+    uint64_t orders  = 0; // New orders accepted by the book
+    uint64_t cancels = 0; // Cancels accepted by the book
+    uint64_t rejects = 0; // Requests rejected
+    uint64_t fills   = 0; // Fills of the strategy's orders
+};
+
+/**
+ * Runs one strategy against one order book: listens to the book, forwards its
+ * events to the strategy, and executes the strategy's queued requests when
+ * drain() is called by the book's owner after each operation. Knows which
+ * resting orders belong to the strategy (a fixed table, no allocation) and
+ * reports their fills and cancels through onFill().
+ *
+ * Not thread-safe; used on the thread matching the book.
+ */
+class StrategyHost : public OrderBookListener {
+    public:
+        static constexpr size_t MAX_DRAIN = 1024; // Requests executed per drain() (stops runaway feedback)
+
+        /**
+         * @brief Constructor; attaches the strategy to the book and calls onStart().
+         *
+         * @param book - book the strategy trades in
+         * @param strategy - strategy to run (must outlive the host)
+         */
+        StrategyHost(
+            OrderBook& book,
+            Strategy& strategy
+        );
+        ~StrategyHost() override;
+
+        StrategyHost(const StrategyHost&) = delete;
+        StrategyHost& operator=(const StrategyHost&) = delete;
+
+        /**
+         * @brief Execute the strategy's queued requests (and the requests its
+         * callbacks queue meanwhile), up to MAX_DRAIN.
+         *
+         * @return size_t - number of requests executed
+         */
+        size_t drain();
+
+        /**
+         * @brief Reject every queued request without executing it (e.g. the
+         * book is halted).
+         *
+         * @param errCode - reason given to the strategy
+         */
+        void rejectPending(ErrorCode errCode);
+
+        /**
+         * @brief Accessor functions for the host (getters).
+         *
+         * getBook() - gets the book the strategy trades in
+         * getStrategy() - gets the hosted strategy
+         * hasPending() - true if the strategy has queued requests
+         * getOpenOrderCount() - gets the number of the strategy's resting orders
+         * getStats() - gets the strategy counters
+         */
+        OrderBook& getBook();
+        Strategy& getStrategy();
+        bool hasPending() const;
+        size_t getOpenOrderCount() const;
+        const StrategyStats& getStats() const;
+
+        // OrderBookListener: forwarded to the strategy
+        void onBookUpdate(const BookLevelEvent& event) override;
+        void onTrade(const TradeEvent& event) override;
+        void onExecution(const ExecutionEvent& event) override;
+
+    private:
+        static constexpr size_t ID_SIZE = 32; // Room for an order ID and its terminator
+
+        /**
+         * @brief Resting order of the strategy.
+         */
+        struct OpenOrder {
+            uint64_t clientTag;    // Tag the strategy gave the order
+            char orderId[ID_SIZE]; // ID assigned by the book
+        };
+
+        /**
+         * @brief Execute one queued request against the book.
+         *
+         * @param request - request to execute
+         */
+        void execute(const GatewayRequest& request);
+
+        /**
+         * @brief Find a resting order of the strategy by its book ID.
+         *
+         * @param orderId - order ID
+         *
+         * @return OpenOrder* - the order; nullptr if not the strategy's
+         */
+        OpenOrder* findById(const char* orderId);
+
+        /**
+         * @brief Find a resting order of the strategy by its tag.
+         *
+         * @param clientTag - order tag
+         *
+         * @return OpenOrder* - the order; nullptr if not resting
+         */
+        OpenOrder* findByTag(uint64_t clientTag);
+
+        /**
+         * @brief Forget a resting order.
+         *
+         * @param order - order to forget (from the table)
+         */
+        void removeOpenOrder(OpenOrder* order);
+
+        OrderBook& book;           // Book the strategy trades in
+        Strategy& strategy;        // Hosted strategy
+        OrderGateway orderGateway; // Order entry of the strategy
+        StrategyStats stats;       // Strategy counters
+
+        OpenOrder openOrders[OrderGateway::CAPACITY]; // Resting orders of the strategy
+        size_t openOrderCount;                        // Entries of openOrders in use
+
+        const GatewayRequest* submitting; // New order being executed; its own executions precede its ID
+        int submittingLeavesQty;          // Leaves quantity of the last execution of the new order
+        bool submittingExecuted;          // True once the new order had an execution
+}; // StrategyHost
+
+/**
+ * @brief Parameters of a QuotingStrategy.
+ */
+struct QuotingParams {
+    double referencePrice = 100.0; // Quote center before the first trade
+    double tickSize = 0.01;        // Price increment
+    int halfSpreadTicks = 5;       // Quotes rest this many ticks either side of the center
+    int quoteQty = 10;             // Size of each quote
+    int maxPosition = 500;         // Side quoted only while |position| stays within this
+    double skewTicksPerUnit = 0.0; // Center moves against the position by this many ticks per unit held
+};
+
+/**
+ * Example market maker: keeps one bid and one ask around the last trade price,
+ * skewed against its inventory, and moves them whenever a trade moves the
+ * center. Stops quoting the side that would grow its position past the limit.
+ */
+class QuotingStrategy : public Strategy {
+    public:
+        /**
+         * @brief Constructor for a new quoting strategy.
+         *
+         * @param params - quote placement and risk limits
+         */
+        explicit QuotingStrategy(const QuotingParams& params = QuotingParams());
+
+        void onStart() override;
+        void onTrade(const TradeEvent& event) override;
+        void onFill(const FillEvent& event) override;
+        void onReject(uint64_t clientTag, ErrorCode errCode) override;
+
+        /**
+         * @brief Accessor functions for the strategy (getters).
+         *
+         * getPosition() - gets the net position (bought - sold)
+         * getCash() - gets the cash balance (sold value - bought value)
+         * getBidPrice() / getAskPrice() - gets the price of the live quote; 0 if none
+         */
+        int64_t getPosition() const;
+        double getCash() const;
+        double getBidPrice() const;
+        double getAskPrice() const;
+
+    private:
+        /**
+         * @brief Live quote on one side.
+         */
+        struct Quote {
+            uint64_t tag; // Tag of the quote's order; 0 if none
+            double price; // Price of the quote
+        };
+
+        /**
+         * @brief Cancel and replace the quotes that are away from their target.
+         */
+        void requote();
+
+        /**
+         * @brief Move one side's quote to a target price (0 to pull it).
+         *
+         * @param quote - live quote of the side
+         * @param side - side of the quote
+         * @param target - target price; 0 for no quote
+         */
+        void moveQuote(Quote& quote, OrderSide side, double target);
+
+        QuotingParams params; // Quote placement and risk limits
+        double center;        // Last trade price (quote center before skew)
+        int64_t position;     // Net position
+        double cash;          // Sold value - bought value
+        Quote bid;            // Live bid
+        Quote ask;            // Live ask
+        uint64_t nextTag;     // Tag of the next order
+}; // QuotingStrategy
+
+#endif // STRATEGY_H
@@ -0,0 +1,140 @@
+// Global Includes
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Project Includes
+#include <Agent.hpp>
+#include <AgentManager.hpp>
+#include <WorkStealingPool.hpp>
+
+#ifndef SWEEPRUNNER_H
+#define SWEEPRUNNER_H
+
+/**
+ * @brief Parameters of one simulation of a sweep.
+ */
+struct SweepRun {
+    uint64_t seed = 1;             // Simulation seed
+    uint32_t agents = 100;         // Zero-intelligence agents
+    uint64_t steps = 1000;         // Steps to run (when simSeconds is 0)
+    uint64_t simSeconds = 0;       // Virtual time to simulate instead of steps; 0 for steps
+    int64_t latencyNs = 0;         // Virtual time run: order and report latency
+    ZeroIntelligenceParams params; // Order flow of every agent
+};
+
+/**
+ * @brief Summary of one simulation of a sweep.
+ */
+struct SweepResult {
+    uint32_t runIndex = 0;               // Index of the run in the sweep
+    SweepRun run;                        // Parameters of the run
+    AgentManagerStats stats;             // Simulation counters
+    std::vector<double> lastTradePrices; // Last trade price per book (0 = no trade)
+    double elapsedSeconds = 0;           // Wall time of the run
+    uint32_t worker = 0;                 // Worker that ran it
+    std::string error;                   // Reason the run failed; empty on success
+};
+
+/**
+ * Runs many independent simulations (@see AgentManager) at once, one per
+ * worker of a WorkStealingPool. Every simulation stays single threaded and
+ * owns its order books, agents and virtual clock; nothing is shared between
+ * runs, so a run's results do not depend on the number of workers or on which
+ * worker ran it. Each run is built, run and destroyed on its worker thread, so
+ * its allocations come from that thread's malloc arena and are released as
+ * soon as the run ends.
+ *
+ * Sweep files hold one run per line as "key=value" pairs applied over a base
+ * run ('#' starts a comment):
+ *
+ *   agents=500 sim-seconds=60 cancel-rate=0.2 repeat=16
+ *
+ * Keys: seed, agents, steps, sim-seconds, latency-us, initial-price, tick-size,
+ * max-offset-ticks, max-qty, activity, cancel-rate, market-rate,
+ * max-open-orders, mean-wakeup-us, ttl-us, and repeat (n runs with seeds seed
+ * to seed + n - 1).
+ */
+class SweepRunner {
+    public:
+        /**
+         * @brief Constructor; starts the workers.
+         *
+         * @param symbols - symbols of the order books of every run
+         * @param workers - worker threads; 0 for one per hardware thread
+         */
+        SweepRunner(
+            const std::vector<std::string>& symbols,
+            uint32_t workers = 0
+        );
+
+        /**
+         * @brief Run every simulation of a sweep and wait for all of them.
+         *
+         * @param runs - parameters of the simulations
+         *
+         * @return std::vector<SweepResult> - summaries, in the order of the runs
+         */
+        std::vector<SweepResult> run(const std::vector<SweepRun>& runs);
+
+        /**
+         * @brief Write sweep results as a table with one named column per
+         * parameter and counter (comma separated, header row first).
+         *
+         * @param out - stream to write to
+         * @param symbols - symbols of the books (names the last price columns)
+         * @param results - results to write
+         */
+        static void writeColumns(std::ostream& out, const std::vector<std::string>& symbols,
+                                 const std::vector<SweepResult>& results);
+
+        /**
+         * @brief Parse one line of a sweep file into runs.
+         *
+         * @param line - "key=value" pairs (comments and blank lines yield no run)
+         * @param base - parameters the line is applied over
+         * @param runs - populated with the line's runs
+         * @param error - populated with the reason if the line is invalid
+         *
+         * @return bool - true if the line is valid; false otherwise
+         */
+        static bool parseSweepLine(const std::string& line, const SweepRun& base,
+                                   std::vector<SweepRun>& runs, std::string& error);
+
+        /**
+         * @brief Parse a sweep file into runs.
+         *
+         * @param path - path of the sweep file
+         * @param base - parameters every line is applied over
+         * @param runs - populated with the file's runs
+         * @param error - populated with the reason if the file is invalid
+         *
+         * @return bool - true if the file was read and every line was valid; false otherwise
+         */
+        static bool parseSweepFile(const std::string& path, const SweepRun& base,
+                                   std::vector<SweepRun>& runs, std::string& error);
+
+        /**
+         * @brief Accessor functions for the runner (getters).
+         *
+         * getWorkerCount() - gets the number of worker threads
+         * getSteals() - gets the number of runs stolen by idle workers
+         */
+        uint32_t getWorkerCount() const;
+        uint64_t getSteals() const;
+
+    private:
+        /**
+         * @brief Run one simulation on the calling thread.
+         *
+         * @param run - parameters of the simulation
+         * @param result - populated with the summary
+         */
+        void runOne(const SweepRun& run, SweepResult& result) const;
+
+        std::vector<std::string> symbols; // Symbols of the order books of every run
+        WorkStealingPool pool;            // Workers running the simulations
+}; // SweepRunner
+
+#endif // SWEEPRUNNER_H
@@ -0,0 +1,118 @@
+// Global Includes
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#ifndef SYMBOLTABLE_H
+#define SYMBOLTABLE_H
+
+/**
+ * Assigns every exchange symbol a dense integer ID (0, 1, 2, ...) so order
+ * books can be stored in a flat array and routed by index. Symbol names are
+ * only hashed once per message, at the wire boundary, using an open
+ * addressing hash table with linear probing. The table is kept at most half
+ * full, so a lookup usually touches one or two slots and compares one string.
+ *
+ * IDs are bounded by the capacity of the table. A removed symbol's ID is only
+ * reused after it is released, so its owner can finish with it first.
+ */
+class SymbolTable {
+    public:
+        static constexpr uint32_t INVALID_ID = 0xFFFFFFFF; // ID returned for unknown symbols
+
+        /**
+         * @brief Constructor for a new, empty symbol table.
+         *
+         * @param capacity - maximum number of IDs
+         */
+        explicit SymbolTable(uint32_t capacity = INVALID_ID);
+
+        /**
+         * @brief Assign a dense ID to a symbol. Released IDs are reused first.
+         *
+         * @param symbol - exchange symbol
+         *
+         * @return uint32_t - ID of the symbol; the existing ID if already added;
+         *                    INVALID_ID if every ID is in use
+         */
+        uint32_t add(const std::string& symbol);
+
+        /**
+         * @brief Remove a symbol. Lookups no longer find it, but its ID is not
+         * reused until release() is called.
+         *
+         * @param symbol - exchange symbol
+         *
+         * @return uint32_t - ID the symbol had; INVALID_ID if unknown
+         */
+        uint32_t remove(const std::string& symbol);
+
+        /**
+         * @brief Make the ID of a removed symbol available to add() again.
+         *
+         * @param id - ID returned by remove()
+         */
+        void release(uint32_t id);
+
+        /**
+         * @brief Find the ID of a symbol.
+         *
+         * @param symbol - start of the symbol characters
+         * @param length - number of characters
+         *
+         * @return uint32_t - ID of the symbol; INVALID_ID if unknown
+         */
+        uint32_t find(const char* symbol, size_t length) const;
+        uint32_t find(const std::string& symbol) const;
+
+        /**
+         * @brief Accessor functions for the symbol table (getters).
+         *
+         * getSymbol() - gets the symbol assigned to an ID (empty if unassigned)
+         * size() - gets the number of IDs handed out so far (IDs are 0 to size() - 1)
+         * count() - gets the number of symbols currently in the table
+         */
+        const std::string& getSymbol(uint32_t id) const;
+        size_t size() const;
+        size_t count() const;
+
+    private:
+        /**
+         * @brief Hash the characters of a symbol (FNV-1a).
+         */
+        static uint32_t hash(const char* symbol, size_t length);
+
+        /**
+         * @brief Insert an ID into the hash table (the symbol must be stored).
+         */
+        void insertSlot(uint32_t id);
+
+        /**
+         * @brief Rebuild the hash table with a new number of slots.
+         *
+         * @param slotCount - number of slots (power of two)
+         */
+        void rehash(size_t slotCount);
+
+        /**
+         * @brief Hash table slot. Comparing the stored hash first avoids most
+         * string comparisons on collisions.
+         */
+        struct Slot {
+            uint32_t hash; // Hash of the symbol in the slot
+            uint32_t id;   // ID of the symbol; INVALID_ID if empty, REMOVED_ID if removed
+        };
+
+        static constexpr uint32_t REMOVED_ID = 0xFFFFFFFE; // Marks a slot whose symbol was removed
+
+        uint32_t capacity;                 // Maximum number of IDs
+        std::vector<std::string> symbols;  // ID => symbol
+        std::vector<uint32_t> releasedIds; // IDs available for reuse
+        std::vector<Slot> slots;           // Open addressing hash table
+        size_t slotMask;                   // Number of slots - 1
+        size_t usedSlots;                  // Slots holding a symbol or a removed marker
+        size_t symbolCount;                // Symbols currently in the table
+}; // SymbolTable
+
+#endif // SYMBOLTABLE_H
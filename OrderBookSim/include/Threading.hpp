@@ -0,0 +1,92 @@
+// Global Includes
+#include <cstdint>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
+#ifndef THREADING_H
+#define THREADING_H
+
+namespace threading {
+    /**
+     * @brief Roles of the threads of the order book manager.
+     */
+    enum class ThreadRole {
+        ENGINE,        // Matching engine (one thread per engine)
+        NETWORK,       // Socket event loop (thread calling startListener)
+        SHARED_MEMORY, // Shared memory transport
+        MARKET_DATA,   // Market data publisher and snapshot service
+        LOGGER         // Asynchronous logger
+    };
+
+    /**
+     * @brief CPU and scheduling of one thread.
+     */
+    struct ThreadPlacement {
+        int cpu = -1;     // CPU the thread is pinned to; -1 to let the OS schedule it
+        int priority = 0; // Real-time priority (1-99, SCHED_FIFO); 0 for normal scheduling
+    };
+
+    /**
+     * @brief Thread configuration of the order book manager.
+     *
+     * In busy-poll mode the engine and network threads spin on their queues
+     * instead of sleeping, and producers skip the wake-up system calls. Each
+     * spinning thread keeps a core fully busy, so busy-poll is meant for
+     * dedicated hosts with the threads pinned to isolated CPUs.
+     */
+    struct ThreadConfig {
+        bool busyPoll = false; // True to spin-poll instead of blocking
+
+        // CPU of each role; -1 to leave the thread unpinned. Engine i is
+        // pinned to engineCpus[i % size] (empty = unpinned)
+        std::vector<int> engineCpus;
+        int networkCpu      = -1;
+        int sharedMemoryCpu = -1;
+        int marketDataCpu   = -1;
+        int loggerCpu       = -1;
+
+        // Real-time priority of the engine, network and shared memory threads
+        // (0 = normal scheduling). Usually requires elevated privileges
+        int realtimePriority = 0;
+
+        // Work-stealing workers per engine for large batches spanning several
+        // books (0 = every batch runs on its engine thread)
+        uint32_t batchWorkers = 0;
+
+        /**
+         * @brief Get the placement of a thread.
+         *
+         * @param role - role of the thread
+         * @param index - index of the thread within its role (engine ID)
+         *
+         * @return ThreadPlacement - placement of the thread
+         */
+        ThreadPlacement placement(ThreadRole role, uint32_t index = 0) const;
+    };
+
+    /**
+     * @brief Apply a placement to the calling thread. Each thread applies its
+     * own placement when it starts.
+     *
+     * @param placement - CPU and scheduling to apply
+     *
+     * @return bool - true if applied (or nothing to apply); false if the OS refused
+     */
+    bool applyPlacement(const ThreadPlacement& placement);
+
+    /**
+     * @brief Hint to the CPU that the calling thread is spin-waiting.
+     */
+    inline void cpuRelax() {
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+        _mm_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield");
+#endif
+    }
+}; // threading
+
+#endif // THREADING_H
@@ -37,17 +37,17 @@ class Trade {
          * getTimestamp() - gets the time the trade was executed
          * getPrice() - gets the price the trade was executed at
          */
-        std::string getTradeId();
-        std::string getBuyOrderId();
-        std::string getSellOrderId();
-        std::string getSymbol();
-        int getQty();
-        long long getTimestamp();
-        double getPrice();
+        std::string getTradeId() const;
+        std::string getBuyOrderId() const;
+        std::string getSellOrderId() const;
+        std::string getSymbol() const;
+        int getQty() const;
+        long long getTimestamp() const;
+        double getPrice() const;
 
     private:
         /**
-         * @brief Generates a trade ID based on the trade's timestamp and a random
+         * @brief Generates a trade ID based on the trade's timestamp and a sequence
          * component.
          * @see SPEC.md for trade ID structure.
          *
@@ -1,5 +1,7 @@
 // Global Includes
+#include <cstdint>
 #include <string>
+#include <vector>
 
 #ifndef TYPES_H
 #define TYPES_H
@@ -39,6 +41,24 @@ enum class OrderStatus {
     CANCEL
 };
 
+/**
+ * @brief Specifies how an order book matches orders.
+ */
+enum class MatchingMode : uint8_t {
+    CONTINUOUS, // Every order is matched on arrival (price-time priority)
+    AUCTION     // Orders are collected and matched together at one clearing price (batch auction)
+};
+
+/**
+ * @brief Specifies how a batch auction rations the side with more quantity
+ * at the clearing price. Orders at better prices always fill in full; only
+ * the orders at the clearing price itself are rationed.
+ */
+enum class AuctionAllocation : uint8_t {
+    TIME_PRIORITY, // Earliest orders fill first
+    PRO_RATA       // Orders fill in proportion to their quantity (rounding remainders go in time priority)
+};
+
 /**
  * @brief Error codes used for identifying request processing statuses
  * to return to clients.
@@ -52,9 +72,59 @@ enum class ErrorCode {
 	BAD_TYPE,     // Invalid order type; See OrderType
     BAD_ID,       // Invalid order ID
     PARTIAL_FILL, // Cannot process because order was partially filled
+    BAD_SYMBOL,   // No order book exists for the symbol
+    SYMBOL_HALTED, // Trading in the symbol is halted
+    SYMBOL_EXISTS, // An order book already exists for the symbol
+    NO_CAPACITY,   // No pre-allocated order book is available for a new symbol
+    THROTTLED,     // Rejected by flow control (rate limit or engine overload); retry later
     FATAL         // Unclassified fatal internal error
 };
 
+/**
+ * @brief Identifies the message carried by a wire frame.
+ * @see Protocol.hpp for the frame layout.
+ */
+enum class MessageType : uint16_t {
+    ORDER_REQUEST  = 1, // Client => server; OrderRequest
+    ORDER_MODIFY   = 2, // Client => server; OrderModify
+    ORDER_CANCEL   = 3, // Client => server; OrderCancel
+    ORDER_RESPONSE = 4, // Server => client; OrderResponse
+    SNAPSHOT_REQUEST = 5, // Client => snapshot service; SnapshotRequest
+    BOOK_SNAPSHOT    = 6, // Snapshot service => client; BookSnapshot
+    ADMIN_REQUEST    = 7, // Client => server; AdminRequest (answered with an OrderResponse)
+    EXECUTION_REPORT = 8, // Server => client; ExecutionReport (unsolicited)
+    QUERY_REQUEST    = 9, // Client => server; QueryRequest
+    QUERY_PAGE       = 10 // Server => client; QueryPage (one or more per QueryRequest)
+};
+
+/**
+ * @brief Administrative actions on the symbols of the order book manager.
+ */
+enum class AdminAction : uint8_t {
+    ADD_SYMBOL    = 1, // Create an order book for a new symbol
+    HALT_SYMBOL   = 2, // Reject new requests for the symbol; resting orders are kept
+    RESUME_SYMBOL = 3, // Accept requests for a halted symbol again
+    REMOVE_SYMBOL = 4  // Remove the symbol and its order book (resting orders are dropped)
+};
+
+/**
+ * @brief Message structure for an administrative request. The response is an
+ * OrderResponse with the symbol in place of the order ID.
+ * @see AdminAction
+ */
+struct AdminRequest {
+    AdminAction action; // Action to perform
+    std::string symbol; // Symbol the action applies to
+};
+
+/**
+ * @brief Identifies a market data update.
+ */
+enum class MarketDataType : uint8_t {
+    BOOK_UPDATE = 1, // Aggregated state of a price level changed
+    TRADE       = 2  // Execution in the order book
+};
+
 /**
  * @brief Message structure for a new order request.
  * @see OrderSide
@@ -72,6 +142,7 @@ struct OrderRequest {
  * @brief Message structure to modify an existing order.
  */
 struct OrderModify {
+    std::string symbol;  // Symbol of the order book holding the order
     std::string orderId; // ID of the order to modify
     int qty;             // New quantity of the order
     double price;        // New price of of the order (required; only used for LIMIT, STOP, ICEBERG)
@@ -81,6 +152,7 @@ struct OrderModify {
  * @brief Message structure to cancel an existing order.
  */
 struct OrderCancel {
+    std::string symbol;  // Symbol of the order book holding the order
     std::string orderId; // ID of the order to cancel
 };
 
@@ -94,4 +166,137 @@ struct OrderResponse {
     ErrorCode errCode;   // Response code of the request
 };
 
+/**
+ * @brief Identifies what happened to an order in an execution report.
+ */
+enum class ExecutionType : uint8_t {
+    FILL   = 1, // The order was (partially) filled
+    CANCEL = 2  // The order's remaining quantity left the book without filling
+};
+
+/**
+ * @brief Execution report pushed to the session that owns an order whenever
+ * the order is filled or canceled, including fills of resting orders caused by
+ * other agents. Reports are sent after the response to the request that
+ * created the order.
+ * @see ExecutionType
+ */
+struct ExecutionReport {
+    std::string symbol;  // Symbol of the order book
+    std::string orderId; // ID of the order
+    ExecutionType type;  // What happened to the order
+    OrderSide side;      // Side of the order
+    double price;        // FILL: execution price; CANCEL: 0
+    int qty;             // FILL: executed quantity; CANCEL: canceled quantity
+    int leavesQty;       // Quantity still resting after the event (0 = order done)
+    long long timestamp; // Time of the event (ms since epoch)
+};
+
+/**
+ * @brief Incremental market data update published over multicast. Updates are
+ * sequenced per symbol; a gap in the sequence means updates were lost and the
+ * consumer should resynchronize from a snapshot.
+ * @see MarketDataType
+ */
+struct MarketDataUpdate {
+    MarketDataType type; // Type of the update
+    std::string symbol;  // Symbol of the order book
+    uint64_t seq;        // Per-symbol sequence number (starts at 1)
+    OrderSide side;      // BOOK_UPDATE: side of the level; TRADE: aggressor side
+    double price;        // BOOK_UPDATE: level price; TRADE: execution price
+    int qty;             // BOOK_UPDATE: level quantity (0 = removed); TRADE: executed quantity
+    long long timestamp; // Time of the event (ms since epoch)
+};
+
+/**
+ * @brief Message structure to request a book snapshot from the snapshot service.
+ */
+struct SnapshotRequest {
+    std::string symbol; // Symbol of the order book
+};
+
+/**
+ * @brief Aggregated price level of a book snapshot.
+ */
+struct SnapshotLevel {
+    OrderSide side; // Side of the book the level is on
+    double price;   // Price of the level
+    int qty;        // Total resting quantity at the level
+};
+
+/**
+ * @brief Message structure for (one part of) a book snapshot. Large books are
+ * sent as several parts; the final part has last set. Applying the snapshot and
+ * then every update with a higher sequence number rebuilds the book.
+ */
+struct BookSnapshot {
+    std::string symbol;                // Symbol of the order book
+    uint64_t seq;                      // Sequence number of the last update included
+    bool last;                         // True for the final part of the snapshot
+    ErrorCode errCode;                 // BAD_SYMBOL if the symbol is unknown
+    std::vector<SnapshotLevel> levels; // Aggregated price levels in this part
+};
+
+/**
+ * @brief Data set returned by a query.
+ */
+enum class QueryType : uint8_t {
+    OPEN_ORDERS   = 1, // Resting orders (bids best to worst, then asks best to worst)
+    ORDER_HISTORY = 2, // Every order event (create, modify, cancel), oldest first
+    TRADE_HISTORY = 3  // Every trade, oldest first
+};
+
+/**
+ * @brief Message structure to query the orders or trades of an order book. The
+ * result is streamed back as QueryPage messages; the final page has last set.
+ * @see QueryType
+ */
+struct QueryRequest {
+    std::string symbol; // Symbol of the order book
+    QueryType type;     // Data set to return
+    uint64_t cursor;    // Position of the first item (0 for the start; nextCursor to resume)
+    uint32_t maxItems;  // Most items to return (0 = no limit)
+};
+
+/**
+ * @brief Order entry of a query result.
+ */
+struct QueryOrder {
+    std::string orderId; // ID of the order
+    OrderStatus status;  // ORDER_HISTORY: event recorded; OPEN_ORDERS: CREATE
+    OrderSide side;      // Side of the order
+    OrderType type;      // Type of the order
+    double price;        // Price of the order
+    int qty;             // Quantity of the order
+    int remainingQty;    // Quantity not filled yet
+    long long timestamp; // Time the order was created
+};
+
+/**
+ * @brief Trade entry of a query result.
+ */
+struct QueryTrade {
+    std::string tradeId;     // ID of the trade
+    std::string buyOrderId;  // ID of the buy order
+    std::string sellOrderId; // ID of the sell order
+    double price;            // Execution price
+    int qty;                 // Executed quantity
+    long long timestamp;     // Time of the trade
+};
+
+/**
+ * @brief Message structure for one page of a query result. Items hold orders
+ * for OPEN_ORDERS and ORDER_HISTORY, and trades for TRADE_HISTORY.
+ */
+struct QueryPage {
+    std::string symbol;             // Symbol of the order book
+    QueryType type;                 // Data set of the query
+    ErrorCode errCode;              // BAD_SYMBOL if the symbol is unknown
+    uint64_t cursor;                // Position of the first item in this page
+    uint64_t nextCursor;            // Position after the last item (resume point)
+    bool last;                      // True for the final page of the result
+    std::vector<QueryOrder> orders; // Order items in this page
+    std::vector<QueryTrade> trades; // Trade items in this page
+};
+
 #endif // TYPES_H
\ No newline at end of file
@@ -0,0 +1,327 @@
+// Global Includes
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Project Includes
+#include <CompletionQueue.hpp>
+#include <Logger.h>
+#include <Network.hpp>
+#include <Session.hpp>
+
+#ifndef URINGTRANSPORT_H
+#define URINGTRANSPORT_H
+
+/**
+ * Socket session driven by io_uring completions. Received bytes are handed
+ * to the session from the kernel-selected buffer of a recv completion, and
+ * outbound frames are staged for one send submission at a time.
+ */
+class UringSession : public Session {
+    public:
+        /**
+         * @brief Constructor for a new io_uring client session. The session
+         * takes ownership of the connected socket and closes it when destroyed.
+         *
+         * @param socket - connected client socket
+         * @param slot - connection slot of the session in the transport
+         * @param sessionId - identifier of the session
+         */
+        UringSession(
+            SOCKET socket,
+            uint32_t slot,
+            uint32_t sessionId
+        );
+        ~UringSession() override;
+
+        /**
+         * @brief Hand the data of a recv completion to the session. The data is
+         * consumed by the following readAvailable() calls.
+         *
+         * @param data - received bytes (owned by the caller)
+         * @param length - number of received bytes
+         */
+        void deliver(const char* data, size_t length);
+
+        /**
+         * @brief Record that the client closed the connection.
+         */
+        void endOfStream();
+
+        /**
+         * @brief Get the staged outbound bytes if they need to be submitted.
+         *
+         * @param data - populated with the start of the unsent bytes
+         * @param length - populated with the number of unsent bytes
+         *
+         * @return bool - true if a send should be submitted; false otherwise
+         */
+        bool nextSend(const char*& data, size_t& length);
+
+        /**
+         * @brief Record the completion of a submitted send.
+         *
+         * @param bytesSent - bytes written by the send
+         */
+        void sendCompleted(size_t bytesSent);
+
+        /**
+         * @brief Accessor functions for the io_uring session (getters).
+         *
+         * getSocket() - gets the client socket
+         * getSlot() - gets the connection slot of the session
+         * hasUndelivered() - true if delivered bytes have not been read yet
+         * hasSendInProgress() - true if staged bytes have not been fully sent
+         */
+        SOCKET getSocket() const;
+        uint32_t getSlot() const;
+        bool hasUndelivered() const;
+        bool hasSendInProgress() const;
+
+    protected:
+        /**
+         * @brief io_uring transport (@see Session). Reads from the delivered
+         * completion data and stages all slices for a single send submission.
+         */
+        long receiveBytes(char* buffer, size_t length) override;
+        long sendSlices(net::IoSlice* slices, size_t count) override;
+
+    private:
+        SOCKET socket; // Connected client socket
+        uint32_t slot; // Connection slot in the transport
+
+        const char* rxData; // Delivered completion data not yet read
+        size_t rxLength;    // Number of delivered bytes not yet read
+
+        std::string txStage; // Outbound bytes of the current send
+        size_t txSent;       // Bytes of the stage already sent
+        bool txInFlight;     // True while a send is submitted
+}; // UringSession
+
+/**
+ * io_uring event loop for the order book manager's socket I/O. One multishot
+ * accept and one multishot recv per connection stay armed in the kernel, recv
+ * completions land in a ring of buffers registered with the kernel, and all
+ * sends prepared while handling a batch of completions are submitted together
+ * with the wait for the next batch, so one io_uring_enter services many
+ * connections. While a session's read gate is closed its recv is canceled and
+ * its requests stay in the socket.
+ */
+class UringTransport {
+    public:
+        using FrameHandler = std::function<void(Session&, CompletionQueue&)>;
+        using ReadGate = std::function<bool(const Session&)>;
+        using CloseHandler = std::function<void(uint32_t)>;
+
+        /**
+         * @brief Constructor for a new io_uring transport.
+         *
+         * @param listenSocket - bound and listening socket to accept clients on
+         * @param handler - handles the frames received by a session (same
+         *                  handler as the poll loop); responses are delivered
+         *                  through the transport's completion queue
+         * @param readGate - false while a session's requests must stay unread
+         *                   (flow control); its recv is then canceled and the
+         *                   requests back up in the client's socket
+         * @param onClose - called with the ID of a session once it is closed
+         *                  and no engine holds a request of it
+         * @param sessionIds - shared source of session identifiers
+         * @param logging - console logging flag
+         */
+        UringTransport(
+            SOCKET listenSocket,
+            FrameHandler handler,
+            ReadGate readGate,
+            CloseHandler onClose,
+            std::atomic<uint32_t>& sessionIds,
+            bool logging
+        );
+        ~UringTransport();
+
+        /**
+         * @brief Create the io_uring instance, register the receive buffers and
+         * arm the multishot accept.
+         *
+         * @return bool - true if started; false if io_uring is not available
+         */
+        bool start();
+
+        /**
+         * @brief Run the event loop on the calling thread. Returns only if the
+         * io_uring instance fails.
+         */
+        void run();
+
+        /**
+         * @brief Spin on the completion queue instead of waiting in
+         * io_uring_enter; must be called before run(). The engines then never
+         * signal the eventfd.
+         *
+         * @param t_busyPoll - true to busy-poll; false to block
+         */
+        void setBusyPoll(bool t_busyPoll);
+
+    private:
+        /**
+         * @brief Operation carried by a submission, encoded in its user data.
+         */
+        enum class Operation : uint8_t {
+            ACCEPT  = 1,
+            RECV    = 2,
+            SEND    = 3,
+            WAKEUP  = 4,
+            CANCEL  = 5,
+            TIMEOUT = 6
+        };
+
+        /**
+         * @brief Connection slot. The generation invalidates completions that
+         * arrive for a previous connection in the same slot.
+         */
+        struct Connection {
+            std::unique_ptr<UringSession> session; // Session; nullptr if the slot is free
+            uint16_t generation = 0;               // Incremented each time the slot is released
+            bool recvArmed = false;                // True while the multishot recv is active
+            bool recvCanceled = false;             // True once the armed recv is being canceled
+            bool sendArmed = false;                // True while a send is submitted
+            bool closing = false;                  // True once the connection is shut down
+            bool active = false;                   // True if queued for servicing in this batch
+        };
+
+        /**
+         * @brief Prepare a submission queue entry; submits the queue if it is full.
+         *
+         * @return void* - zeroed io_uring_sqe
+         */
+        void* nextSqe();
+
+        /**
+         * @brief Submit the prepared entries and optionally wait for a completion.
+         *
+         * @param waitForCompletion - true to block until at least one completion
+         *
+         * @return bool - true on success; false if io_uring_enter failed
+         */
+        bool submit(bool waitForCompletion);
+
+        /**
+         * @brief Prepare the submissions of an operation.
+         */
+        void armAccept();
+        void armRecv(uint32_t slot);
+        void armWakeup();
+        void armTimeout();
+        void cancelRecv(uint32_t slot);
+        void submitSend(uint32_t slot);
+
+        /**
+         * @brief Handle one completion queue entry.
+         */
+        void handleCompletion(uint64_t userData, int32_t result, uint32_t flags);
+
+        /**
+         * @brief Handle a completed accept, recv or send.
+         */
+        void onAccept(int32_t result);
+        void onRecv(uint32_t slot, int32_t result, uint32_t flags);
+        void onSend(uint32_t slot, int32_t result);
+
+        /**
+         * @brief Write the responses completed by the matching engines to their
+         * sessions and queue those connections for servicing.
+         */
+        void drainCompletions();
+
+        /**
+         * @brief Wake the event loop from another thread (signals the wakeup
+         * eventfd). Called by the matching engines when responses are completed.
+         */
+        void wake();
+
+        /**
+         * @brief Flush and close (if required) every connection serviced in the
+         * current batch of completions, and arm or cancel its recv as its read
+         * gate allows.
+         */
+        void serviceActive();
+
+        /**
+         * @brief Queue a connection for servicing after the current batch.
+         */
+        void markActive(uint32_t slot);
+
+        /**
+         * @brief Shut down a connection; the slot is released once no operation
+         * on it is outstanding.
+         */
+        void closeConnection(uint32_t slot);
+
+        /**
+         * @brief Return a receive buffer to the kernel's buffer ring.
+         */
+        void recycleBuffer(uint16_t bufferId);
+
+        /**
+         * @brief Unmap the rings and close the io_uring instance.
+         */
+        void destroyRing();
+
+        static constexpr unsigned QUEUE_DEPTH     = 1024;      // Submission queue entries
+        static constexpr unsigned BUFFER_COUNT    = 256;       // Receive buffers (power of two)
+        static constexpr size_t BUFFER_SIZE       = 16 * 1024; // Bytes per receive buffer
+        static constexpr uint16_t BUFFER_GROUP    = 0;         // Buffer group of the receive buffers
+        static constexpr int64_t PAUSE_CHECK_NS   = 1000000;   // Interval between read gate checks of paused sessions
+
+        SOCKET listenSocket;               // Listening socket
+        FrameHandler handler;              // Handles frames received by a session
+        ReadGate readGate;                 // False while a session must not be read
+        CloseHandler onClose;              // Called when a session is released
+        std::atomic<uint32_t>& sessionIds; // Shared source of session identifiers
+        bool logging;                      // True to log to console, false otherwise
+        bool busyPoll;                     // True to poll the completion queue without waiting
+
+        // io_uring instance and its shared rings (layout owned by the kernel)
+        int ringFd;              // io_uring file descriptor; -1 if not created
+        void* sqRing;            // Mapped submission queue ring
+        size_t sqRingSize;       // Size of the submission queue mapping
+        void* cqRing;            // Mapped completion queue ring (may alias sqRing)
+        size_t cqRingSize;       // Size of the completion queue mapping
+        void* sqes;              // Mapped submission queue entries
+        size_t sqesSize;         // Size of the entries mapping
+        unsigned* sqHead;        // Kernel-owned submission head
+        unsigned* sqTail;        // Submission tail
+        unsigned* sqArray;       // Submission index array
+        unsigned sqMask;         // Submission ring mask
+        unsigned sqEntries;      // Submission ring size
+        unsigned sqLocalTail;    // Tail including entries not yet published
+        unsigned sqPending;      // Entries prepared since the last submit
+        unsigned* cqHead;        // Completion head
+        unsigned* cqTail;        // Kernel-owned completion tail
+        unsigned cqMask;         // Completion ring mask
+        void* cqes;              // Completion queue entries
+
+        int wakeupFd;                      // eventfd signalled by wake(); -1 if not created
+        CompletionQueue completions;       // Responses completed by the matching engines
+        std::vector<Completion> completed; // Completions drained in the current batch
+        std::vector<RoutedReport> reports; // Execution reports drained in the current batch
+
+        void* bufferRing;           // Provided buffer ring shared with the kernel
+        size_t bufferRingSize;      // Size of the buffer ring mapping
+        std::vector<char> buffers;  // Receive buffer memory (BUFFER_COUNT * BUFFER_SIZE)
+        uint16_t bufferTail;        // Next free entry of the buffer ring
+
+        std::vector<Connection> connections;                 // Connection slots
+        std::unordered_map<uint32_t, uint32_t> sessionSlots; // Session ID => slot of a connected session
+        std::vector<uint32_t> freeSlots;     // Released slots available for reuse
+        std::vector<uint32_t> activeSlots;   // Slots serviced in the current batch
+        std::vector<uint32_t> pausedSlots;   // Slots whose read gate was closed in the last batch
+
+        int64_t pauseCheck[2];     // Timeout of the read gate check (__kernel_timespec)
+        bool pauseCheckArmed;      // True while the read gate check timeout is submitted
+}; // UringTransport
+
+#endif // URINGTRANSPORT_H
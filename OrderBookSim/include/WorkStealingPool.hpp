@@ -0,0 +1,112 @@
+// Global Includes
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifndef WORKSTEALINGPOOL_H
+#define WORKSTEALINGPOOL_H
+
+/**
+ * Fixed set of worker threads running batches of independent tasks.
+ *
+ * Each batch (run()) is split into one contiguous range of task indexes per
+ * worker. A worker takes tasks from the back of its own deque; once its deque
+ * is empty it steals from the front of the other workers' deques, so uneven
+ * tasks (e.g. simulations of different lengths) still keep every worker busy.
+ * Tasks never add tasks, so a worker that finds every deque empty is done with
+ * the batch.
+ *
+ * Meant for coarse tasks (a simulation run, or one book's share of a large
+ * engine batch): the deques are guarded by a mutex each, which costs little
+ * next to the tasks themselves.
+ */
+class WorkStealingPool {
+    public:
+        /**
+         * @brief Task body; called once per task index, on the worker running it.
+         *
+         * @param task - index of the task in the batch
+         * @param worker - index of the worker running it
+         */
+        using Task = std::function<void(size_t task, uint32_t worker)>;
+
+        /**
+         * @brief Constructor; starts the workers.
+         *
+         * @param workers - number of worker threads; 0 for one per hardware thread
+         */
+        explicit WorkStealingPool(uint32_t workers = 0);
+        ~WorkStealingPool();
+
+        WorkStealingPool(const WorkStealingPool&) = delete;
+        WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+        /**
+         * @brief Run a batch of tasks on the workers and wait for all of them.
+         * If tasks throw, the remaining tasks still run and the first exception
+         * is rethrown here. Not reentrant; one batch at a time.
+         *
+         * @param taskCount - number of tasks (indexes 0 to taskCount - 1)
+         * @param task - task body
+         */
+        void run(size_t taskCount, const Task& task);
+
+        /**
+         * @brief Accessor functions for the pool (getters).
+         *
+         * getWorkerCount() - gets the number of worker threads
+         * getSteals() - gets the number of tasks run by a worker other than the one they were assigned to
+         */
+        uint32_t getWorkerCount() const;
+        uint64_t getSteals() const;
+
+    private:
+        /**
+         * @brief Task indexes assigned to one worker.
+         */
+        struct WorkerQueue {
+            std::mutex mutex;          // Guards tasks
+            std::deque<size_t> tasks;  // Owner pops the back; thieves pop the front
+        };
+
+        /**
+         * @brief Worker thread loop: wait for a batch, drain it, repeat.
+         *
+         * @param worker - index of the worker
+         */
+        void workerLoop(uint32_t worker);
+
+        /**
+         * @brief Take the next task of a worker: its own first, then stolen.
+         *
+         * @param worker - index of the worker
+         * @param task - populated with the task index
+         *
+         * @return bool - true if a task was taken; false if every queue is empty
+         */
+        bool takeTask(uint32_t worker, size_t& task);
+
+        std::vector<std::unique_ptr<WorkerQueue>> queues; // Task queue per worker
+        std::vector<std::thread> threads;                 // Worker threads
+
+        std::mutex mutex;                   // Guards the batch state below
+        std::condition_variable batchReady; // Signals workers that a batch started (or shutdown)
+        std::condition_variable batchDone;  // Signals run() that every worker finished
+        const Task* batchTask;              // Body of the running batch
+        uint64_t batchId;                   // Incremented for every batch
+        uint32_t busyWorkers;               // Workers still draining the batch
+        std::exception_ptr batchError;      // First exception thrown by a task
+        bool stopping;                      // True once the destructor runs
+
+        std::atomic<uint64_t> steals; // Tasks run by a thief
+}; // WorkStealingPool
+
+#endif // WORKSTEALINGPOOL_H
@@ -1,7 +1,34 @@
+// Global Includes
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
 // Project Includes
 #include <Types.hpp>
 
+#ifndef UTILS_H
+#define UTILS_H
+
 namespace utils {
+    /**
+     * @brief Virtual clock of a simulation. While a clock is installed on a
+     * thread (@see setThreadClock()), timestamps and sequence numbers generated
+     * on that thread come from the clock instead of the system clock and the
+     * process-wide sequence, so the order books it drives stamp virtual time
+     * and produce the same IDs on every run.
+     */
+    struct VirtualClock {
+        int64_t nowNs = 0;          // Current virtual time (ns)
+        uint64_t sequence = 100000; // Next sequence number
+    };
+
+    /**
+     * @brief Install a virtual clock on the calling thread.
+     *
+     * @param clock - clock to read; nullptr to return to the system clock
+     */
+    void setThreadClock(VirtualClock* clock);
+
     /**
      * @brief Generates a random 6-digit number using the Mersenne
      * Twister randomizer. The randomizer and distribution are static
@@ -11,9 +38,34 @@ namespace utils {
      */
     int generateRandom_6DigitNum();
 
+    /**
+     * @brief Generates the next number of a process-wide sequence (or of the
+     * thread's virtual clock). The sequence starts at 100000 (6 digits) and is
+     * thread-safe, so every call returns a distinct number.
+     *
+     * @return uint64_t - next sequence number
+     */
+    uint64_t generateSequenceNum();
+
+    constexpr size_t ID_LENGTH = 15; // Characters of an order or trade ID (@see generateId())
+
+    /**
+     * @brief Generates the ID of an order or trade: "{timestamp}_{sequence}",
+     * with the timestamp (ms) and the next sequence number each written in
+     * fixed-width base 36 (8 and 6 digits). At ID_LENGTH characters an ID fits
+     * in the small string buffer of std::string, so creating, copying and
+     * indexing IDs never allocates. The sequence keeps IDs created in the same
+     * millisecond unique; it wraps after 36^6 IDs.
+     *
+     * @param timestamp - creation time of the order or trade (ms)
+     *
+     * @return std::string - ID
+     */
+    std::string generateId(long long timestamp);
+
     /**
      * @brief Generates a timestamp in the format of milliseconds
-     * since Unix epoch.
+     * since Unix epoch (or since the start of the thread's virtual clock).
      *
      * @return long long - timesamp in millisecond format
      */
@@ -38,4 +90,6 @@ namespace utils {
      * @return bool - true if order type exists; false otherwise
      */
     bool validOrderType(OrderType type);
-}; // utils
\ No newline at end of file
+}; // utils
+
+#endif // UTILS_H
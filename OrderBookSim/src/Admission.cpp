@@ -0,0 +1,38 @@
+// Global Includes
+#include <algorithm>
+
+// Project Includes
+#include <Admission.hpp>
+
+//#########################################################################
+TokenBucket::TokenBucket() :
+    tokens(0),
+    lastRefill(0),
+    started(false) {}
+
+//#########################################################################
+bool TokenBucket::tryConsume(double rate, double burst, int64_t now) {
+    if (rate <= 0) return true;
+
+    if (!started) {
+        tokens = burst;
+        lastRefill = now;
+        started = true;
+    }
+    else if (now > lastRefill) {
+        tokens = std::min(burst, tokens + (now - lastRefill) * rate / 1e9);
+        lastRefill = now;
+    }
+
+    if (tokens < 1) return false;
+
+    tokens -= 1;
+    return true;
+}
+
+//#########################################################################
+void TokenBucket::reset() {
+    tokens = 0;
+    lastRefill = 0;
+    started = false;
+}
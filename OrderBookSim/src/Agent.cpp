@@ -0,0 +1,252 @@
+// Global Includes
+#include <algorithm>
+#include <cmath>
+
+// Project Includes
+#include <Agent.hpp>
+
+namespace {
+    /**
+     * @brief Advance a splitmix64 state and return its next output. Used to
+     * expand a seed into a full generator state.
+     *
+     * @param state - splitmix64 state
+     *
+     * @return uint64_t - next output
+     */
+    uint64_t splitMix64(uint64_t& state) {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    /**
+     * @brief Rotate a 64-bit value left.
+     *
+     * @param value - value to rotate
+     * @param bits - number of bits to rotate by (1-63)
+     *
+     * @return uint64_t - rotated value
+     */
+    inline uint64_t rotateLeft(uint64_t value, int bits) {
+        return (value << bits) | (value >> (64 - bits));
+    }
+}
+
+//#########################################################################
+AgentRandom::AgentRandom(uint64_t seed, uint64_t streamId) {
+    // Mix the stream ID in before expanding, so neighbouring IDs get unrelated streams
+    uint64_t mix = seed;
+    uint64_t expand = splitMix64(mix) ^ (streamId * 0xD1342543DE82EF95ULL);
+
+    for (uint64_t& word : state) {
+        word = splitMix64(expand);
+    }
+}
+
+//#########################################################################
+uint64_t AgentRandom::operator()() {
+    uint64_t result = rotateLeft(state[1] * 5, 7) * 9;
+    uint64_t shifted = state[1] << 17;
+
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= shifted;
+    state[3] = rotateLeft(state[3], 45);
+
+    return result;
+}
+
+//#########################################################################
+int64_t AgentRandom::uniformInt(int64_t low, int64_t high) {
+    uint64_t range = static_cast<uint64_t>(high - low) + 1;
+    if (range == 0) return static_cast<int64_t>((*this)()); // Full 64-bit range
+
+    // Reject the values that would bias the modulo
+    uint64_t threshold = (0 - range) % range;
+    uint64_t value = (*this)();
+    while (value < threshold) {
+        value = (*this)();
+    }
+
+    return low + static_cast<int64_t>(value % range);
+}
+
+//#########################################################################
+double AgentRandom::uniformReal() {
+    return ((*this)() >> 11) * (1.0 / 9007199254740992.0); // 53 random bits / 2^53
+}
+
+//#########################################################################
+bool AgentRandom::chance(double probability) {
+    return uniformReal() < probability;
+}
+
+//#########################################################################
+double AgentRandom::exponential(double mean) {
+    return -mean * std::log(1.0 - uniformReal());
+}
+
+//#########################################################################
+Agent::Agent (
+    uint32_t agentId,
+    uint64_t seed
+) : random(seed, agentId),
+    agentId(agentId),
+    positions(),
+    cash(0.0),
+    fillCount(0),
+    openOrders() {}
+
+//#########################################################################
+void Agent::applyExecution(uint32_t bookIndex, const ExecutionEvent& event) {
+    if (event.type == ExecutionType::FILL) {
+        if (positions.size() <= bookIndex) positions.resize(bookIndex + 1, 0);
+
+        if (event.side == OrderSide::BUY) {
+            positions[bookIndex] += event.qty;
+            cash -= event.price * event.qty;
+        }
+        else {
+            positions[bookIndex] -= event.qty;
+            cash += event.price * event.qty;
+        }
+
+        fillCount++;
+    }
+
+    // Agents rest few orders; a scan beats hashing the ID
+    for (auto order = openOrders.begin(); order != openOrders.end(); ++order) {
+        if (order->bookIndex != bookIndex || order->orderId != event.orderId) continue;
+
+        if (event.leavesQty == 0) {
+            openOrders.erase(order);
+        }
+        else {
+            order->leavesQty = event.leavesQty;
+        }
+        break;
+    }
+}
+
+//#########################################################################
+void Agent::addOpenOrder(const AgentOrder& order) {
+    openOrders.push_back(order);
+}
+
+//#########################################################################
+uint32_t Agent::getAgentId() const {
+    return agentId;
+}
+
+//#########################################################################
+int64_t Agent::getPosition(uint32_t bookIndex) const {
+    return bookIndex < positions.size() ? positions[bookIndex] : 0;
+}
+
+//#########################################################################
+double Agent::getCash() const {
+    return cash;
+}
+
+//#########################################################################
+uint64_t Agent::getFillCount() const {
+    return fillCount;
+}
+
+//#########################################################################
+const std::vector<AgentOrder>& Agent::getOpenOrders() const {
+    return openOrders;
+}
+
+//#########################################################################
+ZeroIntelligenceAgent::ZeroIntelligenceAgent (
+    uint32_t agentId,
+    uint64_t seed,
+    const ZeroIntelligenceParams& params
+) : Agent(agentId, seed),
+    params(params) {}
+
+//#########################################################################
+void ZeroIntelligenceAgent::onWakeup(AgentContext& context) {
+    context.scheduleWakeup(static_cast<int64_t>(random.exponential(static_cast<double>(params.meanWakeupIntervalNs))));
+
+    if (!random.chance(params.activity)) return;
+
+    const std::vector<AgentOrder>& resting = getOpenOrders();
+
+    // Cancel a random resting order
+    if (!resting.empty() && (resting.size() >= params.maxOpenOrders || random.chance(params.cancelRate))) {
+        // Copied; the cancel removes the order from the resting list
+        AgentOrder order = resting[random.uniformInt(0, static_cast<int64_t>(resting.size()) - 1)];
+        context.cancelOrder(order.bookIndex, order.orderId);
+        return;
+    }
+
+    if (context.getBookCount() == 0) return;
+
+    uint32_t bookIndex = static_cast<uint32_t>(random.uniformInt(0, context.getBookCount() - 1));
+
+    // Reference price: mid when both sides rest, else the last trade, else the initial price
+    double bid = context.getBestBid(bookIndex);
+    double ask = context.getBestAsk(bookIndex);
+    double reference = params.initialPrice;
+    if (bid > 0 && ask > 0) {
+        reference = (bid + ask) / 2;
+    }
+    else if (context.getLastTradePrice(bookIndex) > 0) {
+        reference = context.getLastTradePrice(bookIndex);
+    }
+
+    OrderSide side = random.chance(0.5) ? OrderSide::BUY : OrderSide::SELL;
+    int qty = static_cast<int>(random.uniformInt(1, params.maxQty));
+    OrderType type = random.chance(params.marketRate) ? OrderType::MARKET : OrderType::LIMIT;
+
+    // Whole ticks, never below one tick
+    int64_t ticks = static_cast<int64_t>(std::llround(reference / params.tickSize)) +
+                    random.uniformInt(-params.maxOffsetTicks, params.maxOffsetTicks);
+    double price = std::max<int64_t>(ticks, 1) * params.tickSize;
+
+    context.submitOrder(bookIndex, qty, price, side, type, nullptr, params.orderTimeToLiveNs);
+}
+
+//#########################################################################
+OrderFlowAgent::OrderFlowAgent (
+    uint32_t agentId,
+    uint64_t seed,
+    const OrderFlowParams& params,
+    uint32_t bookIndex
+) : Agent(agentId, seed),
+    flow(params, seed, agentId),
+    pending(flow.next()),
+    bookIndex(bookIndex) {}
+
+//#########################################################################
+void OrderFlowAgent::onWakeup(AgentContext& context) {
+    OrderFlowEvent event = pending;
+    pending = flow.next();
+
+    // Wake again at the next arrival
+    context.scheduleWakeup(pending.timeNs - event.timeNs);
+
+    if (bookIndex >= context.getBookCount()) return;
+
+    const std::vector<AgentOrder>& resting = getOpenOrders();
+    if (event.type == FlowEventType::CANCEL || resting.size() >= flow.getParams().maxOpenOrders) {
+        if (resting.empty()) return;
+
+        // Copied; the cancel removes the order from the resting list
+        size_t index = std::min(static_cast<size_t>(event.pick * resting.size()), resting.size() - 1);
+        AgentOrder order = resting[index];
+        context.cancelOrder(order.bookIndex, order.orderId);
+        return;
+    }
+
+    double price = flow.resolvePrice(event, context.getBestBid(bookIndex), context.getBestAsk(bookIndex));
+    OrderType type = event.type == FlowEventType::MARKET ? OrderType::MARKET : OrderType::LIMIT;
+
+    context.submitOrder(bookIndex, event.qty, price, event.side, type);
+}
@@ -0,0 +1,493 @@
+// Global Includes
+#include <algorithm>
+#include <utility>
+
+// Project Includes
+#include <AgentManager.hpp>
+
+//#########################################################################
+void AgentManager::BookFeed::onTrade(const TradeEvent& event) {
+    manager.lastTradePrices[bookIndex] = event.price;
+    manager.stats.trades++;
+}
+
+//#########################################################################
+void AgentManager::BookFeed::onExecution(const ExecutionEvent& event) {
+    manager.executions.push_back(PendingExecution{bookIndex, event, event.orderId});
+}
+
+//#########################################################################
+AgentManager::AgentManager (
+    const std::vector<std::string>& symbols,
+    uint64_t seed
+) : seed(seed),
+    random(seed, UINT64_MAX),
+    step(0),
+    stats(),
+    books(),
+    feeds(),
+    lastTradePrices(symbols.size(), 0.0),
+    strategies(),
+    agents(),
+    wakeOrder(),
+    orderOwners(),
+    executions(),
+    currentAgent(0),
+    routing(false),
+    clock(),
+    events(),
+    latency(),
+    auctions(),
+    auctionScheduled(false),
+    virtualTime(false),
+    agentsScheduled(false) {
+
+    for (const std::string& symbol : symbols) {
+        books.push_back(std::make_unique<OrderBook>(symbol));
+        feeds.push_back(std::make_unique<BookFeed>(*this, static_cast<uint32_t>(books.size() - 1)));
+        books.back()->addListener(feeds.back().get());
+    }
+}
+
+//#########################################################################
+AgentManager::~AgentManager() {
+    strategies.clear();
+
+    for (size_t i = 0; i < books.size(); i++) {
+        books[i]->removeListener(feeds[i].get());
+    }
+}
+
+//#########################################################################
+Agent& AgentManager::addAgent(std::unique_ptr<Agent> agent) {
+    wakeOrder.push_back(static_cast<uint32_t>(agents.size()));
+    agents.push_back(std::move(agent));
+
+    // Room for a few resting orders per agent without rehashing mid-run
+    if (orderOwners.bucket_count() < agents.size() * 8) {
+        orderOwners.reserve(agents.size() * 16);
+    }
+
+    // Joining a virtual time run already in progress; wake it now
+    if (agentsScheduled) {
+        SimEvent wakeup{};
+        wakeup.type = SimEventType::WAKEUP;
+        wakeup.agentIndex = static_cast<uint32_t>(agents.size() - 1);
+        events.push(clock.nowNs, std::move(wakeup));
+    }
+
+    return *agents.back();
+}
+
+//#########################################################################
+void AgentManager::run(uint64_t steps) {
+    for (uint64_t i = 0; i < steps; i++) {
+        // Fisher-Yates shuffle; no agent is always first to the book
+        for (size_t n = wakeOrder.size(); n > 1; n--) {
+            size_t j = static_cast<size_t>(random.uniformInt(0, static_cast<int64_t>(n) - 1));
+            std::swap(wakeOrder[n - 1], wakeOrder[j]);
+        }
+
+        for (uint32_t index : wakeOrder) {
+            currentAgent = index;
+            agents[index]->onWakeup(*this);
+        }
+
+        stats.wakeups += wakeOrder.size();
+        stats.steps++;
+        step++;
+
+        if (auctions.intervalSteps > 0 && step % auctions.intervalSteps == 0) {
+            runAuctions();
+        }
+    }
+}
+
+//#########################################################################
+ErrorCode AgentManager::submitOrder(
+    uint32_t bookIndex,
+    int qty,
+    double price,
+    OrderSide side,
+    OrderType type,
+    std::string* orderId,
+    int64_t timeToLiveNs
+) {
+    // Agents trade from onWakeup() only
+    if (routing || bookIndex >= books.size()) {
+        stats.rejects++;
+        return ErrorCode::BAD_REQUEST;
+    }
+
+    if (virtualTime && latency.orderLatencyNs > 0) {
+        SimEvent arrival{};
+        arrival.type = SimEventType::ORDER_ARRIVAL;
+        arrival.agentIndex = currentAgent;
+        arrival.bookIndex = bookIndex;
+        arrival.qty = qty;
+        arrival.price = price;
+        arrival.side = side;
+        arrival.orderType = type;
+        arrival.timeToLiveNs = timeToLiveNs;
+        events.push(clock.nowNs + latency.orderLatencyNs, std::move(arrival));
+
+        if (orderId) orderId->clear();
+        return ErrorCode::OK;
+    }
+
+    return executeOrder(currentAgent, bookIndex, qty, price, side, type, timeToLiveNs, orderId);
+}
+
+//#########################################################################
+ErrorCode AgentManager::cancelOrder(uint32_t bookIndex, const std::string& orderId) {
+    if (routing || bookIndex >= books.size()) {
+        stats.rejects++;
+        return ErrorCode::BAD_ID;
+    }
+
+    if (virtualTime && latency.orderLatencyNs > 0) {
+        SimEvent arrival{};
+        arrival.type = SimEventType::CANCEL_ARRIVAL;
+        arrival.agentIndex = currentAgent;
+        arrival.bookIndex = bookIndex;
+        arrival.orderId = orderId;
+        events.push(clock.nowNs + latency.orderLatencyNs, std::move(arrival));
+
+        return ErrorCode::OK;
+    }
+
+    return executeCancel(currentAgent, bookIndex, orderId, false);
+}
+
+//#########################################################################
+void AgentManager::scheduleWakeup(int64_t delayNs) {
+    if (!virtualTime) return;
+
+    SimEvent wakeup{};
+    wakeup.type = SimEventType::WAKEUP;
+    wakeup.agentIndex = currentAgent;
+    events.push(clock.nowNs + std::max<int64_t>(delayNs, 1), std::move(wakeup));
+}
+
+//#########################################################################
+ErrorCode AgentManager::executeOrder(
+    uint32_t agentIndex,
+    uint32_t bookIndex,
+    int qty,
+    double price,
+    OrderSide side,
+    OrderType type,
+    int64_t timeToLiveNs,
+    std::string* orderId
+) {
+    ErrorCode errCode = ErrorCode::FATAL;
+    std::string newOrderId = books[bookIndex]->createOrder(qty, price, side, type, errCode);
+
+    if (errCode != ErrorCode::OK) {
+        stats.rejects++;
+        return errCode;
+    }
+
+    // The new order's own fills were recorded before its ID was known; it is
+    // registered as resting first and the executions settle its remainder
+    orderOwners[newOrderId] = agentIndex;
+    stats.orders++;
+
+    if (reportsDelayed()) {
+        SimEvent accepted{};
+        accepted.type = SimEventType::ORDER_ACCEPTED;
+        accepted.agentIndex = agentIndex;
+        accepted.bookIndex = bookIndex;
+        accepted.qty = qty;
+        accepted.price = price;
+        accepted.side = side;
+        accepted.orderId = newOrderId;
+        events.push(clock.nowNs + latency.reportLatencyNs, std::move(accepted));
+    }
+    else {
+        agents[agentIndex]->addOpenOrder(AgentOrder{newOrderId, bookIndex, side, price, qty});
+    }
+
+    routeExecutions();
+
+    // Still resting; expire it unless it fills or is canceled first
+    if (virtualTime && timeToLiveNs > 0 && orderOwners.count(newOrderId)) {
+        SimEvent expiry{};
+        expiry.type = SimEventType::ORDER_EXPIRY;
+        expiry.agentIndex = agentIndex;
+        expiry.bookIndex = bookIndex;
+        expiry.orderId = newOrderId;
+        events.push(clock.nowNs + timeToLiveNs, std::move(expiry));
+    }
+
+    drainStrategies();
+
+    if (orderId) *orderId = std::move(newOrderId);
+    return errCode;
+}
+
+//#########################################################################
+ErrorCode AgentManager::executeCancel(uint32_t agentIndex, uint32_t bookIndex, const std::string& orderId, bool expiry) {
+    // Only the owner may cancel an order
+    auto owner = orderOwners.find(orderId);
+    if (owner == orderOwners.end() || owner->second != agentIndex) {
+        // An expiry finding the order already gone is not a reject
+        if (!expiry) stats.rejects++;
+        return ErrorCode::BAD_ID;
+    }
+
+    ErrorCode errCode = ErrorCode::FATAL;
+    books[bookIndex]->cancelOrder(orderId, errCode);
+
+    if (errCode != ErrorCode::OK) {
+        stats.rejects++;
+        executions.clear();
+        return errCode;
+    }
+
+    if (expiry) {
+        stats.expiries++;
+    }
+    else {
+        stats.cancels++;
+    }
+
+    routeExecutions();
+    drainStrategies();
+
+    return errCode;
+}
+
+//#########################################################################
+StrategyHost& AgentManager::addStrategy(uint32_t bookIndex, Strategy& strategy) {
+    strategies.push_back(std::make_unique<StrategyHost>(*books[bookIndex], strategy));
+
+    // Orders placed by onStart()
+    drainStrategies();
+
+    return *strategies.back();
+}
+
+//#########################################################################
+void AgentManager::drainStrategies() {
+    // Strategies may keep answering each other; bound the rounds per request
+    for (int round = 0; round < 16; round++) {
+        bool executed = false;
+
+        for (std::unique_ptr<StrategyHost>& host : strategies) {
+            if (host->hasPending()) {
+                executed |= host->drain() > 0;
+                routeExecutions();
+            }
+        }
+
+        if (!executed) break;
+    }
+}
+
+//#########################################################################
+void AgentManager::routeExecutions() {
+    for (PendingExecution& execution : executions) {
+        auto owner = orderOwners.find(execution.orderId);
+        if (owner == orderOwners.end()) continue;
+
+        uint32_t agentIndex = owner->second;
+        if (execution.event.leavesQty == 0) {
+            orderOwners.erase(owner);
+        }
+        if (execution.event.type == ExecutionType::FILL) {
+            stats.fills++;
+        }
+
+        if (reportsDelayed()) {
+            SimEvent delivery{};
+            delivery.type = SimEventType::EXECUTION_DELIVERY;
+            delivery.agentIndex = agentIndex;
+            delivery.bookIndex = execution.bookIndex;
+            delivery.orderId = std::move(execution.orderId);
+            delivery.execution = execution.event;
+            events.push(clock.nowNs + latency.reportLatencyNs, std::move(delivery));
+        }
+        else {
+            execution.event.orderId = execution.orderId.c_str();
+            deliverExecution(agentIndex, execution.bookIndex, execution.event);
+        }
+    }
+
+    executions.clear();
+}
+
+//#########################################################################
+void AgentManager::deliverExecution(uint32_t agentIndex, uint32_t bookIndex, const ExecutionEvent& event) {
+    Agent& agent = *agents[agentIndex];
+
+    routing = true;
+    agent.applyExecution(bookIndex, event);
+    agent.onExecution(event);
+    routing = false;
+}
+
+//#########################################################################
+void AgentManager::runUntil(int64_t endTimeNs) {
+    virtualTime = true;
+    utils::setThreadClock(&clock);
+
+    // Every agent starts awake; afterwards agents schedule their own wakeups
+    if (!agentsScheduled) {
+        for (uint32_t index = 0; index < agents.size(); index++) {
+            SimEvent wakeup{};
+            wakeup.type = SimEventType::WAKEUP;
+            wakeup.agentIndex = index;
+            events.push(clock.nowNs, std::move(wakeup));
+        }
+        agentsScheduled = true;
+    }
+
+    if (auctions.intervalNs > 0 && !auctionScheduled) {
+        SimEvent auction{};
+        auction.type = SimEventType::AUCTION;
+        events.push(clock.nowNs + auctions.intervalNs, std::move(auction));
+        auctionScheduled = true;
+    }
+
+    while (!events.empty() && events.top().time <= endTimeNs) {
+        EventQueue<SimEvent>::Entry entry = events.pop();
+        clock.nowNs = entry.time;
+        dispatch(entry.event);
+        stats.scheduledEvents++;
+    }
+
+    clock.nowNs = std::max(clock.nowNs, endTimeNs);
+
+    utils::setThreadClock(nullptr);
+    virtualTime = false;
+}
+
+//#########################################################################
+void AgentManager::dispatch(SimEvent& event) {
+    switch (event.type) {
+        case SimEventType::WAKEUP:
+            currentAgent = event.agentIndex;
+            agents[event.agentIndex]->onWakeup(*this);
+            stats.wakeups++;
+            break;
+        case SimEventType::ORDER_ARRIVAL:
+            executeOrder(event.agentIndex, event.bookIndex, event.qty, event.price, event.side, event.orderType,
+                         event.timeToLiveNs, nullptr);
+            break;
+        case SimEventType::CANCEL_ARRIVAL:
+            executeCancel(event.agentIndex, event.bookIndex, event.orderId, false);
+            break;
+        case SimEventType::ORDER_EXPIRY:
+            executeCancel(event.agentIndex, event.bookIndex, event.orderId, true);
+            break;
+        case SimEventType::ORDER_ACCEPTED:
+            agents[event.agentIndex]->addOpenOrder(
+                AgentOrder{std::move(event.orderId), event.bookIndex, event.side, event.price, event.qty});
+            break;
+        case SimEventType::EXECUTION_DELIVERY:
+            event.execution.orderId = event.orderId.c_str();
+            deliverExecution(event.agentIndex, event.bookIndex, event.execution);
+            break;
+        case SimEventType::AUCTION:
+            auctionScheduled = false;
+            runAuctions();
+
+            if (auctions.intervalNs > 0) {
+                events.push(clock.nowNs + auctions.intervalNs, std::move(event));
+                auctionScheduled = true;
+            }
+            break;
+    }
+}
+
+//#########################################################################
+void AgentManager::runAuctions() {
+    for (std::unique_ptr<OrderBook>& book : books) {
+        book->uncross();
+        stats.auctions++;
+
+        routeExecutions();
+    }
+
+    drainStrategies();
+}
+
+//#########################################################################
+bool AgentManager::reportsDelayed() const {
+    return virtualTime && latency.reportLatencyNs > 0;
+}
+
+//#########################################################################
+void AgentManager::setLatency(const AgentLatency& t_latency) {
+    latency = t_latency;
+}
+
+//#########################################################################
+void AgentManager::setAuctions(const AuctionSchedule& t_auctions) {
+    auctions = t_auctions;
+
+    MatchingMode mode = (auctions.intervalSteps > 0 || auctions.intervalNs > 0) ? MatchingMode::AUCTION : MatchingMode::CONTINUOUS;
+    for (std::unique_ptr<OrderBook>& book : books) {
+        book->setMatchingMode(mode, auctions.allocation);
+    }
+
+    // The final auctions of a switch back to continuous matching
+    routeExecutions();
+    drainStrategies();
+}
+
+//#########################################################################
+uint32_t AgentManager::getBookCount() const {
+    return static_cast<uint32_t>(books.size());
+}
+
+//#########################################################################
+double AgentManager::getBestBid(uint32_t bookIndex) const {
+    return bookIndex < books.size() ? books[bookIndex]->getBestBidPrice() : 0.0;
+}
+
+//#########################################################################
+double AgentManager::getBestAsk(uint32_t bookIndex) const {
+    return bookIndex < books.size() ? books[bookIndex]->getBestAskPrice() : 0.0;
+}
+
+//#########################################################################
+double AgentManager::getLastTradePrice(uint32_t bookIndex) const {
+    return bookIndex < books.size() ? lastTradePrices[bookIndex] : 0.0;
+}
+
+//#########################################################################
+uint64_t AgentManager::getStep() const {
+    return step;
+}
+
+//#########################################################################
+int64_t AgentManager::getTime() const {
+    return clock.nowNs;
+}
+
+//#########################################################################
+uint64_t AgentManager::getSeed() const {
+    return seed;
+}
+
+//#########################################################################
+uint32_t AgentManager::getAgentCount() const {
+    return static_cast<uint32_t>(agents.size());
+}
+
+//#########################################################################
+Agent& AgentManager::getAgent(uint32_t index) {
+    return *agents[index];
+}
+
+//#########################################################################
+OrderBook& AgentManager::getOrderBook(uint32_t bookIndex) {
+    return *books[bookIndex];
+}
+
+//#########################################################################
+const AgentManagerStats& AgentManager::getStats() const {
+    return stats;
+}
@@ -0,0 +1,339 @@
+// Global Includes
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+
+// Project Includes
+#include <AsyncLogger.hpp>
+
+namespace logger {
+    namespace {
+        /**
+         * @brief Owns the calling thread's ring; retires it when the thread exits.
+         */
+        struct ThreadRingOwner {
+            std::shared_ptr<void> ring;          // Ring registered with the logger
+            std::atomic<bool>* retired = nullptr; // Retired flag of the ring
+
+            ~ThreadRingOwner() {
+                if (retired != nullptr) {
+                    retired->store(true, std::memory_order_release);
+                }
+            }
+        };
+
+        thread_local ThreadRingOwner threadRingOwner;
+
+        /**
+         * @brief Read a raw value from a record.
+         */
+        template <typename T>
+        T readRaw(const char*& position) {
+            T value;
+            std::memcpy(&value, position, sizeof(T));
+            position += sizeof(T);
+            return value;
+        }
+
+        /**
+         * @brief Text of a logging level, matching the console format.
+         */
+        const char* levelText(uint8_t level) {
+            switch (level) {
+                case 0:  return "[INFO] ";
+                case 1:  return "[DEBUG] ";
+                case 2:  return "[WARN] ";
+                case 3:  return "[ERROR] ";
+                default: return "[LOG] ";
+            }
+        }
+    }
+
+    //#########################################################################
+    Record::Record(uint8_t level, const char* format) : length(sizeof(RecordHeader)) {
+        RecordHeader& recordHeader = header();
+        recordHeader.format = format;
+        recordHeader.timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        recordHeader.size = static_cast<uint16_t>(length);
+        recordHeader.level = level;
+        recordHeader.argCount = 0;
+    }
+
+    //#########################################################################
+    void Record::appendString(const std::string& value) {
+        if (length + 1 + sizeof(uint16_t) > MAX_RECORD_SIZE) return;
+
+        uint16_t count = static_cast<uint16_t>(
+            std::min(value.size(), MAX_RECORD_SIZE - length - 1 - sizeof(uint16_t)));
+
+        buffer[length] = static_cast<char>(ArgType::STRING);
+        std::memcpy(buffer + length + 1, &count, sizeof(count));
+        std::memcpy(buffer + length + 1 + sizeof(count), value.data(), count);
+        length += 1 + sizeof(count) + count;
+        header().size = static_cast<uint16_t>(length);
+        header().argCount++;
+    }
+
+    //#########################################################################
+    void Record::appendString(const char* value) {
+        appendString(std::string(value != nullptr ? value : ""));
+    }
+
+    //#########################################################################
+    const char* Record::data() const {
+        return buffer;
+    }
+
+    //#########################################################################
+    size_t Record::size() const {
+        return length;
+    }
+
+    //#########################################################################
+    RecordHeader& Record::header() {
+        return *reinterpret_cast<RecordHeader*>(buffer);
+    }
+
+    //#########################################################################
+    AsyncLogger& AsyncLogger::instance() {
+        static AsyncLogger logger;
+        return logger;
+    }
+
+    //#########################################################################
+    AsyncLogger::AsyncLogger() :
+        ringsMutex(),
+        rings(),
+        batch(),
+        cachedSecond(-1),
+        cachedPrefix(),
+        flushMutex(),
+        flushed(),
+        flushRequests(0),
+        flushPasses(0),
+        placement(),
+        placementPending(false),
+        dropped(0),
+        running(true),
+        worker() {
+
+        worker = std::thread(&AsyncLogger::run, this);
+    }
+
+    AsyncLogger::~AsyncLogger() {
+        running = false;
+
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+
+    //#########################################################################
+    void AsyncLogger::submit(const Record& record) {
+        ThreadRing& ring = threadRing();
+
+        // Records are written whole; drop rather than block if the ring is full
+        if (shm::ringFree(ring.control, RING_CAPACITY) < record.size()) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        // The background thread only sees the record once all of it is written
+        shm::ringWrite(ring.control, ring.data.data(), RING_CAPACITY, record.data(), record.size());
+    }
+
+    //#########################################################################
+    void AsyncLogger::flush() {
+        std::unique_lock<std::mutex> lock(flushMutex);
+
+        // Two full passes guarantee one started after the call
+        uint64_t target = flushPasses + 2;
+        flushRequests++;
+        flushed.notify_all();
+
+        flushed.wait(lock, [this, target]() { return flushPasses >= target || !running; });
+        flushRequests--;
+    }
+
+    //#########################################################################
+    uint64_t AsyncLogger::getDroppedRecords() const {
+        return dropped.load(std::memory_order_relaxed);
+    }
+
+    //#########################################################################
+    void AsyncLogger::setThreadPlacement(const threading::ThreadPlacement& t_placement) {
+        std::lock_guard<std::mutex> lock(flushMutex);
+        placement = t_placement;
+        placementPending = true;
+        flushed.notify_all();
+    }
+
+    //#########################################################################
+    AsyncLogger::ThreadRing& AsyncLogger::threadRing() {
+        if (threadRingOwner.ring) {
+            return *static_cast<ThreadRing*>(threadRingOwner.ring.get());
+        }
+
+        // First record of this thread; register a new ring
+        std::shared_ptr<ThreadRing> ring = std::make_shared<ThreadRing>();
+        ring->data.resize(RING_CAPACITY);
+        shm::resetRing(ring->control);
+
+        {
+            std::lock_guard<std::mutex> lock(ringsMutex);
+            rings.push_back(ring);
+        }
+
+        threadRingOwner.ring = ring;
+        threadRingOwner.retired = &ring->retired;
+
+        return *ring;
+    }
+
+    //#########################################################################
+    void AsyncLogger::run() {
+        while (true) {
+            bool stopping = !running.load(std::memory_order_acquire);
+            bool work = drainRings();
+
+            // One write per batch of records
+            if (!batch.empty()) {
+                std::fwrite(batch.data(), 1, batch.size(), stdout);
+                std::fflush(stdout);
+                batch.clear();
+            }
+
+            std::unique_lock<std::mutex> lock(flushMutex);
+            flushPasses++;
+            flushed.notify_all();
+
+            if (placementPending) {
+                threading::applyPlacement(placement);
+                placementPending = false;
+            }
+
+            // Every record submitted before the stop was written
+            if (stopping) break;
+
+            // Sleep while idle; a flush request cuts the sleep short
+            if (!work && flushRequests == 0) {
+                flushed.wait_for(lock, std::chrono::milliseconds(FLUSH_INTERVAL_MS),
+                                 [this]() { return flushRequests > 0 || placementPending; });
+            }
+        }
+    }
+
+    //#########################################################################
+    bool AsyncLogger::drainRings() {
+        std::vector<std::shared_ptr<ThreadRing>> snapshot;
+        {
+            std::lock_guard<std::mutex> lock(ringsMutex);
+            snapshot = rings;
+        }
+
+        bool work = false;
+        char record[MAX_RECORD_SIZE];
+
+        for (const std::shared_ptr<ThreadRing>& ring : snapshot) {
+            // A retired ring holds no more records once it is observed empty
+            bool retired = ring->retired.load(std::memory_order_acquire);
+
+            while (shm::ringRead(ring->control, ring->data.data(), RING_CAPACITY, record, sizeof(RecordHeader)) > 0) {
+                RecordHeader recordHeader;
+                std::memcpy(&recordHeader, record, sizeof(recordHeader));
+
+                shm::ringRead(ring->control, ring->data.data(), RING_CAPACITY,
+                              record + sizeof(RecordHeader), recordHeader.size - sizeof(RecordHeader));
+
+                formatRecord(record);
+                work = true;
+            }
+
+            if (retired) {
+                std::lock_guard<std::mutex> lock(ringsMutex);
+                rings.erase(std::remove(rings.begin(), rings.end(), ring), rings.end());
+            }
+        }
+
+        return work;
+    }
+
+    //#########################################################################
+    void AsyncLogger::formatRecord(const char* record) {
+        RecordHeader recordHeader;
+        std::memcpy(&recordHeader, record, sizeof(recordHeader));
+
+        appendTimestamp(recordHeader.timestamp);
+        batch += levelText(recordHeader.level);
+
+        const char* argument = record + sizeof(RecordHeader);
+        uint8_t argsLeft = recordHeader.argCount;
+        char number[32];
+
+        // Replace each "{}" with the next argument
+        for (const char* c = recordHeader.format; *c != '\0'; c++) {
+            if (c[0] != '{' || c[1] != '}' || argsLeft == 0) {
+                batch += *c;
+                continue;
+            }
+
+            ArgType type = static_cast<ArgType>(*argument++);
+            int written = 0;
+
+            switch (type) {
+                case ArgType::INT:
+                    written = std::snprintf(number, sizeof(number), "%lld", static_cast<long long>(readRaw<int64_t>(argument)));
+                    break;
+                case ArgType::UINT:
+                    written = std::snprintf(number, sizeof(number), "%llu", static_cast<unsigned long long>(readRaw<uint64_t>(argument)));
+                    break;
+                case ArgType::DOUBLE:
+                    written = std::snprintf(number, sizeof(number), "%.6f", readRaw<double>(argument));
+                    break;
+                case ArgType::STRING: {
+                    uint16_t count = readRaw<uint16_t>(argument);
+                    batch.append(argument, count);
+                    argument += count;
+                    break;
+                }
+            }
+
+            batch.append(number, static_cast<size_t>(std::max(written, 0)));
+            argsLeft--;
+            c++;
+        }
+
+        batch += '\n';
+    }
+
+    //#########################################################################
+    void AsyncLogger::appendTimestamp(int64_t timestamp) {
+        int64_t second = timestamp / 1000000000;
+        int64_t millis = (timestamp / 1000000) % 1000;
+
+        // Date and time only change once per second; localtime is not called per record
+        if (second != cachedSecond) {
+            std::time_t time = static_cast<std::time_t>(second);
+            std::tm local{};
+#ifdef _WIN32
+            localtime_s(&local, &time);
+#else
+            localtime_r(&time, &local);
+#endif
+            char text[32];
+            std::strftime(text, sizeof(text), "%Y-%m-%d %H:%M:%S", &local);
+
+            cachedSecond = second;
+            cachedPrefix = text;
+        }
+
+        char millisText[8];
+        std::snprintf(millisText, sizeof(millisText), ".%03d", static_cast<int>(millis));
+
+        batch += '[';
+        batch += cachedPrefix;
+        batch += millisText;
+        batch += "] ";
+    }
+};
@@ -0,0 +1,64 @@
+// Project Includes
+#include <CompletionQueue.hpp>
+
+//#########################################################################
+CompletionQueue::CompletionQueue (
+    std::function<void()> wake
+) : wake(wake),
+    queueMutex(),
+    queued(),
+    queuedReports(),
+    hasCompletions(false) {}
+
+//#########################################################################
+void CompletionQueue::push(const Completion* completions, size_t count) {
+    if (count == 0) return;
+
+    bool wasEmpty = false;
+
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        wasEmpty = queued.empty() && queuedReports.empty();
+        queued.insert(queued.end(), completions, completions + count);
+        hasCompletions.store(true, std::memory_order_release);
+    }
+
+    // The transport is already due to drain a non-empty queue
+    if (wasEmpty) {
+        wake();
+    }
+}
+
+//#########################################################################
+void CompletionQueue::push(const RoutedReport* reports, size_t count) {
+    if (count == 0) return;
+
+    bool wasEmpty = false;
+
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        wasEmpty = queued.empty() && queuedReports.empty();
+        queuedReports.insert(queuedReports.end(), reports, reports + count);
+        hasCompletions.store(true, std::memory_order_release);
+    }
+
+    if (wasEmpty) {
+        wake();
+    }
+}
+
+//#########################################################################
+void CompletionQueue::drain(std::vector<Completion>& completions, std::vector<RoutedReport>& reports) {
+    completions.clear();
+    reports.clear();
+
+    std::lock_guard<std::mutex> lock(queueMutex);
+    completions.swap(queued);
+    reports.swap(queuedReports);
+    hasCompletions.store(false, std::memory_order_relaxed);
+}
+
+//#########################################################################
+bool CompletionQueue::empty() const {
+    return !hasCompletions.load(std::memory_order_acquire);
+}
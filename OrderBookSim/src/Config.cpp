@@ -0,0 +1,547 @@
+// Global Includes
+#include <cerrno>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+// Project Includes
+#include <Config.hpp>
+
+namespace {
+    /**
+     * @brief Remove leading and trailing whitespace.
+     *
+     * @param text - text to trim
+     *
+     * @return std::string - trimmed text
+     */
+    std::string trim(const std::string& text) {
+        size_t first = text.find_first_not_of(" \t\r\n");
+        if (first == std::string::npos) return "";
+
+        size_t last = text.find_last_not_of(" \t\r\n");
+        return text.substr(first, last - first + 1);
+    }
+
+    /**
+     * @brief Split a comma separated list, skipping empty items.
+     *
+     * @param text - list to split
+     *
+     * @return std::vector<std::string> - trimmed items
+     */
+    std::vector<std::string> splitList(const std::string& text) {
+        std::vector<std::string> items;
+        std::stringstream stream(text);
+        std::string item;
+
+        while (std::getline(stream, item, ',')) {
+            item = trim(item);
+            if (!item.empty()) items.push_back(item);
+        }
+
+        return items;
+    }
+
+    /**
+     * @brief Parse a whole decimal integer within a range.
+     *
+     * @param text - text to parse
+     * @param min - smallest accepted value
+     * @param max - largest accepted value
+     * @param value - populated with the parsed value
+     *
+     * @return bool - true if the text is an integer in [min, max]; false otherwise
+     */
+    bool parseInt(const std::string& text, long min, long max, long& value) {
+        if (text.empty()) return false;
+
+        char* end = nullptr;
+        errno = 0;
+        long parsed = std::strtol(text.c_str(), &end, 10);
+
+        if (errno != 0 || *end != '\0' || parsed < min || parsed > max) return false;
+
+        value = parsed;
+        return true;
+    }
+
+    /**
+     * @brief Parse a decimal number.
+     *
+     * @param text - text to parse
+     * @param value - populated with the parsed value
+     *
+     * @return bool - true if the whole text is a finite number; false otherwise
+     */
+    bool parseReal(const std::string& text, double& value) {
+        if (text.empty()) return false;
+
+        char* end = nullptr;
+        errno = 0;
+        double parsed = std::strtod(text.c_str(), &end);
+
+        if (errno != 0 || *end != '\0' || !std::isfinite(parsed)) return false;
+
+        value = parsed;
+        return true;
+    }
+
+    /**
+     * @brief Parse a boolean ("true"/"false", "1"/"0", "yes"/"no", "on"/"off").
+     *
+     * @param text - text to parse
+     * @param value - populated with the parsed value
+     *
+     * @return bool - true if the text is a boolean; false otherwise
+     */
+    bool parseBool(const std::string& text, bool& value) {
+        if (text == "true" || text == "1" || text == "yes" || text == "on") {
+            value = true;
+            return true;
+        }
+        if (text == "false" || text == "0" || text == "no" || text == "off") {
+            value = false;
+            return true;
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief Check whether an option is a flag (takes no value on the command line).
+     *
+     * @param key - option name without leading dashes
+     *
+     * @return bool - true for flags; false otherwise
+     */
+    bool isFlag(const std::string& key) {
+        return key == "logging" || key == "busy-poll" || key == "market-maker";
+    }
+
+    /**
+     * @brief Get the option name of a command line argument.
+     *
+     * @param arg - command line argument
+     *
+     * @return std::string - option name; empty if the argument is not an option
+     */
+    std::string optionName(const std::string& arg) {
+        if (arg == "-p") return "port";
+        if (arg == "-s") return "symbols";
+        if (arg == "-l") return "logging";
+        if (arg == "-c") return "config";
+        if (arg.size() > 2 && arg.compare(0, 2, "--") == 0) return arg.substr(2);
+
+        return "";
+    }
+}
+
+namespace config {
+    //#########################################################################
+    bool applyOption(const std::string& key, const std::string& value, ServerConfig& config, std::string& error) {
+        long number = 0;
+        double rate = 0;
+        bool flag = false;
+
+        if (key == "port") {
+            if (!parseInt(value, 1, 65533, number)) {
+                error = "invalid port '" + value + "' (1-65533; port + 1 and port + 2 are used by market data)";
+                return false;
+            }
+            config.port = static_cast<int>(number);
+        }
+        else if (key == "symbols") {
+            std::vector<std::string> symbols = splitList(value);
+            config.symbols.insert(config.symbols.end(), symbols.begin(), symbols.end());
+        }
+        else if (key == "logging") {
+            if (!parseBool(value, flag)) {
+                error = "invalid value '" + value + "' for logging";
+                return false;
+            }
+            config.logging = flag;
+        }
+        else if (key == "busy-poll") {
+            if (!parseBool(value, flag)) {
+                error = "invalid value '" + value + "' for busy-poll";
+                return false;
+            }
+            config.threads.busyPoll = flag;
+        }
+        else if (key == "market-maker") {
+            if (!parseBool(value, flag)) {
+                error = "invalid value '" + value + "' for market-maker";
+                return false;
+            }
+            config.marketMaker = flag;
+        }
+        else if (key == "engines") {
+            if (!parseInt(value, 1, 256, number)) {
+                error = "invalid engine thread count '" + value + "' (1-256)";
+                return false;
+            }
+            config.engineThreads = static_cast<uint32_t>(number);
+        }
+        else if (key == "batch-workers") {
+            if (!parseInt(value, 0, 256, number)) {
+                error = "invalid batch worker count '" + value + "' (0-256)";
+                return false;
+            }
+            config.threads.batchWorkers = static_cast<uint32_t>(number);
+        }
+        else if (key == "warm-books") {
+            if (!parseInt(value, 0, 1000000, number)) {
+                error = "invalid warm book count '" + value + "'";
+                return false;
+            }
+            config.warmBooks = static_cast<uint32_t>(number);
+        }
+        else if (key == "shm-slots") {
+            if (!parseInt(value, 0, 4096, number)) {
+                error = "invalid shared memory slot count '" + value + "' (0-4096)";
+                return false;
+            }
+            config.shmSlots = static_cast<uint32_t>(number);
+        }
+        else if (key == "io-backend") {
+            if (value == "poll") {
+                config.ioBackend = net::IoBackend::POLL;
+            }
+            else if (value == "io_uring" || value == "uring") {
+                config.ioBackend = net::IoBackend::IO_URING;
+            }
+            else {
+                error = "invalid I/O backend '" + value + "' (poll or io_uring)";
+                return false;
+            }
+        }
+        else if (key == "market-data-group") {
+            if (value.empty()) {
+                error = "missing market data group";
+                return false;
+            }
+            config.marketDataGroup = value;
+        }
+        else if (key == "market-data-interface") {
+            if (value.empty()) {
+                error = "missing market data interface";
+                return false;
+            }
+            config.marketDataInterface = value;
+        }
+        else if (key == "trace-sample") {
+            if (!parseInt(value, 0, 1000000000, number)) {
+                error = "invalid trace sample rate '" + value + "' (0-1000000000)";
+                return false;
+            }
+            config.traceSample = static_cast<uint32_t>(number);
+        }
+        else if (key == "trace-out") {
+            if (value.empty()) {
+                error = "missing trace file";
+                return false;
+            }
+            config.traceOutput = value;
+        }
+        else if (key == "cpu-engines") {
+            std::vector<int> cpus;
+            for (const std::string& item : splitList(value)) {
+                if (!parseInt(item, 0, 4095, number)) {
+                    error = "invalid CPU '" + item + "' for cpu-engines";
+                    return false;
+                }
+                cpus.push_back(static_cast<int>(number));
+            }
+            config.threads.engineCpus = cpus;
+        }
+        else if (key == "cpu-network" || key == "cpu-shm" || key == "cpu-market-data" || key == "cpu-logger") {
+            if (!parseInt(value, -1, 4095, number)) {
+                error = "invalid CPU '" + value + "' for " + key + " (-1 for any)";
+                return false;
+            }
+
+            int cpu = static_cast<int>(number);
+            if (key == "cpu-network") config.threads.networkCpu = cpu;
+            else if (key == "cpu-shm") config.threads.sharedMemoryCpu = cpu;
+            else if (key == "cpu-market-data") config.threads.marketDataCpu = cpu;
+            else config.threads.loggerCpu = cpu;
+        }
+        else if (key == "agents") {
+            if (!parseInt(value, 0, 10000000, number)) {
+                error = "invalid agent count '" + value + "'";
+                return false;
+            }
+            config.agents = static_cast<uint32_t>(number);
+        }
+        else if (key == "steps") {
+            if (!parseInt(value, 1, LONG_MAX, number)) {
+                error = "invalid step count '" + value + "'";
+                return false;
+            }
+            config.agentSteps = static_cast<uint64_t>(number);
+        }
+        else if (key == "seed") {
+            if (!parseInt(value, 0, LONG_MAX, number)) {
+                error = "invalid seed '" + value + "'";
+                return false;
+            }
+            config.seed = static_cast<uint64_t>(number);
+        }
+        else if (key == "sim-seconds") {
+            if (!parseInt(value, 0, 10000000, number)) {
+                error = "invalid simulated time '" + value + "'";
+                return false;
+            }
+            config.simSeconds = static_cast<uint64_t>(number);
+        }
+        else if (key == "latency-us") {
+            if (!parseInt(value, 0, 10000000, number)) {
+                error = "invalid latency '" + value + "'";
+                return false;
+            }
+            config.latencyNs = static_cast<int64_t>(number) * 1000;
+        }
+        else if (key == "flow-agents") {
+            if (!parseInt(value, 0, 10000000, number)) {
+                error = "invalid order flow agent count '" + value + "'";
+                return false;
+            }
+            config.flowAgents = static_cast<uint32_t>(number);
+        }
+        else if (key == "flow-rate") {
+            if (!parseReal(value, rate) || !(rate > 0)) {
+                error = "invalid order flow rate '" + value + "' (events per second > 0)";
+                return false;
+            }
+            config.flowArrivals.rate = rate;
+        }
+        else if (key == "flow-hawkes") {
+            std::vector<std::string> items = splitList(value);
+            double excitation = 0;
+            double decay = 0;
+            if (items.size() != 2 || !parseReal(items[0], excitation) || !parseReal(items[1], decay) ||
+                !(excitation > 0) || !(decay > excitation)) {
+                error = "invalid Hawkes parameters '" + value + "' (excitation,decay with 0 < excitation < decay)";
+                return false;
+            }
+            config.flowArrivals.model = ArrivalModel::HAWKES;
+            config.flowArrivals.excitation = excitation;
+            config.flowArrivals.decay = decay;
+        }
+        else if (key == "auction-interval") {
+            if (!parseInt(value, 0, 1000000000, number)) {
+                error = "invalid auction interval '" + value + "'";
+                return false;
+            }
+            config.auctionInterval = static_cast<uint64_t>(number);
+        }
+        else if (key == "auction-allocation") {
+            if (value == "time") {
+                config.auctionAllocation = AuctionAllocation::TIME_PRIORITY;
+            }
+            else if (value == "pro-rata") {
+                config.auctionAllocation = AuctionAllocation::PRO_RATA;
+            }
+            else {
+                error = "invalid auction allocation '" + value + "' (time or pro-rata)";
+                return false;
+            }
+        }
+        else if (key == "sweep" || key == "sweep-out") {
+            if (value.empty()) {
+                error = "missing file for " + key;
+                return false;
+            }
+            if (key == "sweep") config.sweepFile = value;
+            else config.sweepOutput = value;
+        }
+        else if (key == "workers") {
+            if (!parseInt(value, 0, 4096, number)) {
+                error = "invalid worker count '" + value + "' (0-4096; 0 for one per hardware thread)";
+                return false;
+            }
+            config.sweepWorkers = static_cast<uint32_t>(number);
+        }
+        else if (key == "rt-priority") {
+            if (!parseInt(value, 0, 99, number)) {
+                error = "invalid real-time priority '" + value + "' (0-99; 0 to disable)";
+                return false;
+            }
+            config.threads.realtimePriority = static_cast<int>(number);
+        }
+        else if (key == "max-msg-rate" || key == "msg-burst") {
+            if (!parseReal(value, rate) || rate < 0) {
+                error = "invalid value '" + value + "' for " + key + " (0 to disable)";
+                return false;
+            }
+
+            if (key == "max-msg-rate") config.limits.messageRate = rate;
+            else config.limits.messageBurst = rate;
+        }
+        else if (key == "max-outstanding" || key == "max-open-orders") {
+            if (!parseInt(value, 0, 1000000000, number)) {
+                error = "invalid limit '" + value + "' for " + key + " (0 to disable)";
+                return false;
+            }
+
+            if (key == "max-outstanding") config.limits.maxOutstanding = static_cast<uint32_t>(number);
+            else config.limits.maxOpenOrders = static_cast<uint32_t>(number);
+        }
+        else if (key == "engine-high-watermark" || key == "engine-low-watermark") {
+            if (!parseInt(value, 0, LONG_MAX, number)) {
+                error = "invalid queue depth '" + value + "' for " + key;
+                return false;
+            }
+
+            if (key == "engine-high-watermark") config.limits.engineHighWatermark = static_cast<size_t>(number);
+            else config.limits.engineLowWatermark = static_cast<size_t>(number);
+        }
+        else {
+            error = "unknown option '" + key + "'";
+            return false;
+        }
+
+        return true;
+    }
+
+    //#########################################################################
+    bool parseConfigFile(const std::string& path, ServerConfig& config, std::string& error) {
+        std::ifstream file(path);
+        if (!file) {
+            error = "unable to open config file '" + path + "'";
+            return false;
+        }
+
+        std::string line;
+        int lineNumber = 0;
+
+        while (std::getline(file, line)) {
+            lineNumber++;
+
+            size_t comment = line.find('#');
+            if (comment != std::string::npos) line.erase(comment);
+
+            line = trim(line);
+            if (line.empty()) continue;
+
+            size_t separator = line.find('=');
+            if (separator == std::string::npos) {
+                error = path + ":" + std::to_string(lineNumber) + ": expected 'key = value'";
+                return false;
+            }
+
+            std::string key = trim(line.substr(0, separator));
+            if (key == "config") {
+                error = path + ":" + std::to_string(lineNumber) + ": config files cannot include other config files";
+                return false;
+            }
+
+            if (!applyOption(key, trim(line.substr(separator + 1)), config, error)) {
+                error = path + ":" + std::to_string(lineNumber) + ": " + error;
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    //#########################################################################
+    bool parseArguments(int argc, const char* const argv[], ServerConfig& config, std::string& error) {
+        for (int i = 1; i < argc; i++) {
+            std::string arg = argv[i];
+            std::string key = optionName(arg);
+
+            if (key.empty()) {
+                error = "unexpected argument '" + arg + "'";
+                return false;
+            }
+
+            // "--key=value" form
+            std::string value;
+            bool hasValue = false;
+            size_t separator = key.find('=');
+            if (separator != std::string::npos) {
+                value = key.substr(separator + 1);
+                key = key.substr(0, separator);
+                hasValue = true;
+            }
+
+            if (isFlag(key)) {
+                if (!hasValue) value = "true";
+            }
+            else if (!hasValue) {
+                if (i + 1 >= argc) {
+                    error = "missing value for '" + arg + "'";
+                    return false;
+                }
+                value = argv[++i];
+
+                // Symbols may also be given as separate arguments (-s AAPL MSFT)
+                if (key == "symbols") {
+                    while (i + 1 < argc && argv[i + 1][0] != '-') {
+                        value += ",";
+                        value += argv[++i];
+                    }
+                }
+            }
+
+            if (key == "config") {
+                if (!parseConfigFile(value, config, error)) return false;
+            }
+            else if (!applyOption(key, value, config, error)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    //#########################################################################
+    std::string usage() {
+        return
+            "Usage: orderBook [options]\n"
+            "  -p, --port <port>             port of the order book manager (default 8080)\n"
+            "  -s, --symbols <s1,s2,...>     symbols of the initial order books\n"
+            "  -l, --logging                 console logging\n"
+            "  -c, --config <file>           config file of 'key = value' lines (keys are the long options)\n"
+            "  --engines <n>                 matching engine threads (default 1)\n"
+            "  --batch-workers <n>           work-stealing workers per engine for multi-symbol batches (default 0)\n"
+            "  --warm-books <n>              spare books for symbols added at runtime (default 64)\n"
+            "  --shm-slots <n>               shared memory agent slots; 0 to disable (default 16)\n"
+            "  --io-backend <poll|io_uring>  socket event loop (default poll)\n"
+            "  --market-data-group <ip>      multicast group of the market data feed (default 239.255.0.1)\n"
+            "  --market-data-interface <ip>  interface the feed is published on (default 127.0.0.1)\n"
+            "  --trace-sample <n>            trace one request in n end to end; 0 to disable (default 0)\n"
+            "  --trace-out <file>            request trace file, written on SIGUSR2 (default trace.json)\n"
+            "  --busy-poll                   spin-poll instead of blocking (burns one core per thread)\n"
+            "  --cpu-engines <c1,c2,...>     CPUs of the engine threads\n"
+            "  --cpu-network <cpu>           CPU of the socket event loop\n"
+            "  --cpu-shm <cpu>               CPU of the shared memory transport\n"
+            "  --cpu-market-data <cpu>       CPU of the market data publisher\n"
+            "  --cpu-logger <cpu>            CPU of the logger\n"
+            "  --rt-priority <1-99>          real-time priority of the engine and I/O threads\n"
+            "  --max-msg-rate <n>            sustained requests per second per session; 0 to disable (default 1000000)\n"
+            "  --msg-burst <n>               requests a session may send at once (default 100000)\n"
+            "  --max-outstanding <n>         requests per session queued and not yet answered; 0 to disable (default 65536)\n"
+            "  --max-open-orders <n>         orders per session resting in the books; 0 to disable (default 65536)\n"
+            "  --engine-high-watermark <n>   engine queue depth at which requests are throttled; 0 to disable (default 262144)\n"
+            "  --engine-low-watermark <n>    engine queue depth at which throttling stops (default 65536)\n"
+            "  --market-maker                quote every book with the example market making strategy\n"
+            "  --agents <n>                  run an in-process simulation of n agents instead of the server\n"
+            "  --steps <n>                   simulation steps (default 1000)\n"
+            "  --seed <n>                    simulation seed (default 1)\n"
+            "  --sim-seconds <n>             simulate n seconds of virtual time instead of steps\n"
+            "  --latency-us <n>              virtual time run: agent <=> book latency (us)\n"
+            "  --flow-agents <n>             add n order flow agents (Poisson arrivals, one book each in turn)\n"
+            "  --flow-rate <r>               order flow agent arrival rate (events per second, default 1000)\n"
+            "  --flow-hawkes <a,b>           Hawkes arrivals: excitation a and decay b (per second, a < b)\n"
+            "  --auction-interval <n>        batch auctions every n steps (ms of virtual time with --sim-seconds)\n"
+            "  --auction-allocation <rule>   auction rationing: time or pro-rata (default time)\n"
+            "  --sweep <file>                run the simulations of a sweep file instead of the server\n"
+            "  --sweep-out <file>            sweep results file (default sweep.csv)\n"
+            "  --workers <n>                 sweep worker threads (default one per hardware thread)\n";
+    }
+}; // config
@@ -0,0 +1,186 @@
+// Global Includes
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+// Project Includes
+#include <LatencyHistogram.hpp>
+
+namespace {
+    constexpr int64_t SUB_BUCKETS = 1LL << LatencyHistogram::SUB_BUCKET_BITS;                    // Sub-buckets per power of two
+    constexpr size_t BUCKET_COUNT = (40 - LatencyHistogram::SUB_BUCKET_BITS + 1) * SUB_BUCKETS; // Buckets up to MAX_VALUE (40 bits)
+
+    /**
+     * @brief Get the position of the highest set bit of a value.
+     *
+     * @param value - value > 0
+     *
+     * @return int - bit position (0-63)
+     */
+    inline int highestBit(uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+        return 63 - __builtin_clzll(value);
+#else
+        int bit = 0;
+        while (value >>= 1) bit++;
+        return bit;
+#endif
+    }
+}
+
+//#########################################################################
+LatencyHistogram::LatencyHistogram() :
+    counts(BUCKET_COUNT, 0),
+    totalCount(0),
+    minValue(0),
+    maxValue(0),
+    sum(0.0) {}
+
+//#########################################################################
+size_t LatencyHistogram::indexOf(int64_t value) {
+    // Exact below 2 * SUB_BUCKETS; SUB_BUCKETS linear steps per power of two above
+    if (value < 2 * SUB_BUCKETS) return static_cast<size_t>(value);
+
+    int shift = highestBit(static_cast<uint64_t>(value)) - SUB_BUCKET_BITS;
+    return static_cast<size_t>(shift) * SUB_BUCKETS + static_cast<size_t>(value >> shift);
+}
+
+//#########################################################################
+int64_t LatencyHistogram::lowestValueAt(size_t index) {
+    if (index < static_cast<size_t>(2 * SUB_BUCKETS)) return static_cast<int64_t>(index);
+
+    int shift = static_cast<int>(index / SUB_BUCKETS) - 1;
+    int64_t subBucket = static_cast<int64_t>(index) - static_cast<int64_t>(shift) * SUB_BUCKETS;
+    return subBucket << shift;
+}
+
+//#########################################################################
+int64_t LatencyHistogram::highestValueAt(size_t index) {
+    if (index < static_cast<size_t>(2 * SUB_BUCKETS)) return static_cast<int64_t>(index);
+
+    int shift = static_cast<int>(index / SUB_BUCKETS) - 1;
+    return lowestValueAt(index) + (1LL << shift) - 1;
+}
+
+//#########################################################################
+void LatencyHistogram::record(int64_t value, uint64_t count) {
+    if (count == 0) return;
+
+    value = std::min(std::max<int64_t>(value, 0), MAX_VALUE);
+    counts[indexOf(value)] += count;
+
+    minValue = (totalCount == 0) ? value : std::min(minValue, value);
+    maxValue = (totalCount == 0) ? value : std::max(maxValue, value);
+    totalCount += count;
+    sum += static_cast<double>(value) * count;
+}
+
+//#########################################################################
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+    if (other.totalCount == 0) return;
+
+    for (size_t index = 0; index < BUCKET_COUNT; index++) {
+        counts[index] += other.counts[index];
+    }
+
+    minValue = (totalCount == 0) ? other.minValue : std::min(minValue, other.minValue);
+    maxValue = (totalCount == 0) ? other.maxValue : std::max(maxValue, other.maxValue);
+    totalCount += other.totalCount;
+    sum += other.sum;
+}
+
+//#########################################################################
+void LatencyHistogram::reset() {
+    std::fill(counts.begin(), counts.end(), 0);
+    totalCount = 0;
+    minValue = 0;
+    maxValue = 0;
+    sum = 0.0;
+}
+
+//#########################################################################
+int64_t LatencyHistogram::valueAtPercentile(double percentile) const {
+    if (totalCount == 0) return 0;
+
+    // Smallest count covering the percentile (at least the first value)
+    double share = std::min(std::max(percentile, 0.0), 100.0) / 100.0;
+    uint64_t target = std::max<uint64_t>(static_cast<uint64_t>(std::ceil(share * totalCount)), 1);
+
+    uint64_t running = 0;
+    for (size_t index = 0; index < BUCKET_COUNT; index++) {
+        running += counts[index];
+        if (running >= target) return std::min(highestValueAt(index), maxValue);
+    }
+
+    return maxValue;
+}
+
+//#########################################################################
+void LatencyHistogram::writePercentiles(std::ostream& out, double unitScale, int ticksPerHalfDistance) const {
+    char line[128];
+
+    out << "       Value     Percentile TotalCount 1/(1-Percentile)\n\n";
+
+    double variance = 0.0;
+    if (totalCount > 0) {
+        double mean = getMean();
+        uint64_t running = 0;
+        double reportTo = 0.0; // Next percentile to report
+
+        for (size_t index = 0; index < BUCKET_COUNT; index++) {
+            if (counts[index] == 0) continue;
+
+            running += counts[index];
+            double midValue = (lowestValueAt(index) + highestValueAt(index)) / 2.0;
+            variance += (midValue - mean) * (midValue - mean) * counts[index];
+
+            // Rows get denser towards 100%: ticksPerHalfDistance per halving of the remaining distance
+            double reached = 100.0 * running / totalCount;
+            while (running < totalCount && reportTo <= reached) {
+                std::snprintf(line, sizeof(line), "%12.3f %2.12f %10llu %14.2f\n",
+                              std::min(highestValueAt(index), maxValue) / unitScale, reportTo / 100.0,
+                              static_cast<unsigned long long>(running), 1.0 / (1.0 - reportTo / 100.0));
+                out << line;
+
+                double halvings = std::floor(std::log2(100.0 / (100.0 - reportTo))) + 1;
+                reportTo += 100.0 / (ticksPerHalfDistance * std::pow(2.0, halvings));
+            }
+        }
+
+        std::snprintf(line, sizeof(line), "%12.3f %2.12f %10llu\n", maxValue / unitScale, 1.0,
+                      static_cast<unsigned long long>(totalCount));
+        out << line;
+
+        variance /= totalCount;
+    }
+
+    std::snprintf(line, sizeof(line), "#[Mean    = %12.3f, StdDeviation   = %12.3f]\n", getMean() / unitScale,
+                  std::sqrt(variance) / unitScale);
+    out << line;
+    std::snprintf(line, sizeof(line), "#[Max     = %12.3f, Total count    = %12llu]\n", maxValue / unitScale,
+                  static_cast<unsigned long long>(totalCount));
+    out << line;
+    std::snprintf(line, sizeof(line), "#[Buckets = %12zu, SubBuckets     = %12lld]\n", BUCKET_COUNT / SUB_BUCKETS,
+                  static_cast<long long>(SUB_BUCKETS));
+    out << line;
+}
+
+//#########################################################################
+uint64_t LatencyHistogram::getCount() const {
+    return totalCount;
+}
+
+//#########################################################################
+int64_t LatencyHistogram::getMin() const {
+    return minValue;
+}
+
+//#########################################################################
+int64_t LatencyHistogram::getMax() const {
+    return maxValue;
+}
+
+//#########################################################################
+double LatencyHistogram::getMean() const {
+    return totalCount > 0 ? sum / totalCount : 0.0;
+}
@@ -0,0 +1,417 @@
+// Global Includes
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+// Project Includes
+#include <MarketDataPublisher.hpp>
+
+//#########################################################################
+MarketDataPublisher::MarketDataPublisher (
+    std::string multicastGroup,
+    int multicastPort,
+    std::string multicastInterface,
+    int snapshotPort,
+    int flushIntervalMs,
+    uint32_t bookCount,
+    bool logging
+) : multicastGroup(multicastGroup),
+    multicastPort(multicastPort),
+    multicastInterface(multicastInterface),
+    snapshotPort(snapshotPort),
+    flushIntervalMs(flushIntervalMs),
+    logging(logging),
+    placement(),
+    multicastSocket(INVALID_SOCKET),
+    snapshotSocket(INVALID_SOCKET),
+    groupAddress(),
+    feeds(),
+    assignmentMutex(),
+    pendingAssignments(),
+    assigning(),
+    images(bookCount),
+    imageIds(),
+    snapshotClients(),
+    pollFds(),
+    datagram(),
+    packetSeq(1),
+    nextSessionId(1),
+    running(false),
+    worker() {
+
+    feeds.reserve(bookCount);
+    for (uint32_t symbolId = 0; symbolId < bookCount; symbolId++) {
+        feeds.push_back(std::make_unique<Feed>());
+    }
+}
+
+MarketDataPublisher::~MarketDataPublisher() {
+    stop();
+}
+
+//#########################################################################
+MarketDataPublisher::Feed::Feed() :
+    events(std::make_unique<PendingEvent[]>(FEED_CAPACITY)),
+    tail(0),
+    cachedHead(0),
+    head(0) {}
+
+//#########################################################################
+void MarketDataPublisher::Feed::push(const PendingEvent& event) {
+    uint64_t position = tail.load(std::memory_order_relaxed);
+
+    // Only read the publisher's position when the ring looks full
+    if (position - cachedHead == FEED_CAPACITY) {
+        cachedHead = head.load(std::memory_order_acquire);
+
+        while (position - cachedHead == FEED_CAPACITY) {
+            std::this_thread::yield();
+            cachedHead = head.load(std::memory_order_acquire);
+        }
+    }
+
+    events[position & (FEED_CAPACITY - 1)] = event;
+    tail.store(position + 1, std::memory_order_release);
+}
+
+//#########################################################################
+void MarketDataPublisher::Feed::onBookUpdate(const BookLevelEvent& event) {
+    push({MarketDataType::BOOK_UPDATE, event.side, event.qty, event.price, event.timestamp});
+}
+
+//#########################################################################
+void MarketDataPublisher::Feed::onTrade(const TradeEvent& event) {
+    push({MarketDataType::TRADE, event.aggressorSide, event.qty, event.price, event.timestamp});
+}
+
+//#########################################################################
+void MarketDataPublisher::addSymbol(uint32_t symbolId, const std::string& symbol) {
+    if (symbolId >= feeds.size()) return;
+
+    // Every event of the previous symbol is in the feed before the ID is reassigned
+    uint64_t position = feeds[symbolId]->tail.load(std::memory_order_acquire);
+
+    std::lock_guard<std::mutex> lock(assignmentMutex);
+    pendingAssignments.push_back({symbolId, symbol, position});
+}
+
+//#########################################################################
+OrderBookListener* MarketDataPublisher::getFeed(uint32_t symbolId) {
+    return (symbolId < feeds.size()) ? feeds[symbolId].get() : nullptr;
+}
+
+//#########################################################################
+bool MarketDataPublisher::start() {
+    if (!createSockets()) {
+        return false;
+    }
+
+    running = true;
+    worker = std::thread(&MarketDataPublisher::run, this);
+
+    logEvent<LogLevel::INFO>(logging,
+                             "MarketDataPublisher::start(): Publishing to {}:{}, snapshots on port={}",
+                             multicastGroup, multicastPort, snapshotPort);
+
+    return true;
+}
+
+//#########################################################################
+void MarketDataPublisher::stop() {
+    running = false;
+
+    if (worker.joinable()) {
+        worker.join();
+    }
+
+    snapshotClients.clear();
+
+    if (multicastSocket != INVALID_SOCKET) {
+        net::closeSocket(multicastSocket);
+        multicastSocket = INVALID_SOCKET;
+    }
+
+    if (snapshotSocket != INVALID_SOCKET) {
+        net::closeSocket(snapshotSocket);
+        snapshotSocket = INVALID_SOCKET;
+    }
+}
+
+//#########################################################################
+void MarketDataPublisher::setThreadPlacement(const threading::ThreadPlacement& t_placement) {
+    placement = t_placement;
+}
+
+//#########################################################################
+void MarketDataPublisher::run() {
+    if (!threading::applyPlacement(placement)) {
+        logEvent<LogLevel::WARN>(logging,
+                                 "MarketDataPublisher::run(): Publisher could not be placed on CPU={}",
+                                 placement.cpu);
+    }
+
+    while (running.load(std::memory_order_relaxed)) {
+        // Listener first, then one descriptor per snapshot client
+        pollFds.resize(snapshotClients.size() + 1);
+        pollFds[0].fd      = snapshotSocket;
+        pollFds[0].events  = POLLIN;
+        pollFds[0].revents = 0;
+
+        for (size_t i = 0; i < snapshotClients.size(); i++) {
+            pollFds[i + 1].fd      = snapshotClients[i]->getSocket();
+            pollFds[i + 1].events  = POLLIN | (snapshotClients[i]->hasPendingOutbound() ? POLLOUT : 0);
+            pollFds[i + 1].revents = 0;
+        }
+
+        // The poll timeout doubles as the batching interval of the update feed
+        net::pollSockets(pollFds.data(), pollFds.size(), flushIntervalMs);
+
+        // Publish before answering snapshot requests so snapshots include every queued event
+        publishPending();
+        serviceSnapshotClients();
+    }
+
+    publishPending();
+}
+
+//#########################################################################
+void MarketDataPublisher::publishPending() {
+    {
+        std::lock_guard<std::mutex> lock(assignmentMutex);
+        assigning.swap(pendingAssignments);
+    }
+
+    protocol::beginDatagram(packetSeq, datagram);
+
+    // A reassigned book's events before the assignment go out under its previous symbol
+    for (const SymbolAssignment& assignment : assigning) {
+        publishFeed(assignment.symbolId, assignment.position);
+        assignSymbol(assignment.symbolId, assignment.symbol);
+    }
+    assigning.clear();
+
+    for (uint32_t symbolId = 0; symbolId < feeds.size(); symbolId++) {
+        publishFeed(symbolId, feeds[symbolId]->tail.load(std::memory_order_acquire));
+    }
+
+    sendDatagram();
+}
+
+//#########################################################################
+void MarketDataPublisher::publishFeed(uint32_t symbolId, uint64_t end) {
+    Feed& feed = *feeds[symbolId];
+    uint64_t position = feed.head.load(std::memory_order_relaxed);
+
+    if (position == end) return;
+
+    BookImage& image = images[symbolId];
+    MarketDataUpdate update{};
+    update.symbol = image.symbol;
+
+    for (; position != end; position++) {
+        const PendingEvent& event = feed.events[position & (FEED_CAPACITY - 1)];
+
+        // Apply the level change to the publisher's image of the book
+        if (event.type == MarketDataType::BOOK_UPDATE) {
+            auto& levels = (event.side == OrderSide::BUY) ? image.bids : image.asks;
+
+            if (event.qty > 0) {
+                levels[event.price] = event.qty;
+            }
+            else {
+                levels.erase(event.price);
+            }
+        }
+
+        update.type      = event.type;
+        update.seq       = ++image.seq;
+        update.side      = event.side;
+        update.price     = event.price;
+        update.qty       = event.qty;
+        update.timestamp = event.timestamp;
+
+        // Datagram full; send it and continue in a new one
+        if (!protocol::appendUpdate(update, datagram)) {
+            sendDatagram();
+            protocol::appendUpdate(update, datagram);
+        }
+    }
+
+    // Hand the slots back to the producer
+    feed.head.store(end, std::memory_order_release);
+}
+
+//#########################################################################
+void MarketDataPublisher::assignSymbol(uint32_t symbolId, const std::string& symbol) {
+    BookImage& image = images[symbolId];
+    if (image.symbol == symbol) return;
+
+    auto previous = imageIds.find(image.symbol);
+    if (previous != imageIds.end() && previous->second == symbolId) {
+        imageIds.erase(previous);
+    }
+
+    image = BookImage();
+    image.symbol = symbol;
+    imageIds[symbol] = symbolId;
+}
+
+//#########################################################################
+void MarketDataPublisher::sendDatagram() {
+    if (datagram.size() > protocol::DATAGRAM_HEADER_SIZE) {
+        sendto(multicastSocket, datagram.data(), static_cast<int>(datagram.size()), 0,
+               reinterpret_cast<const SOCKADDR*>(&groupAddress), sizeof(groupAddress));
+        packetSeq++;
+    }
+
+    protocol::beginDatagram(packetSeq, datagram);
+}
+
+//#########################################################################
+void MarketDataPublisher::serviceSnapshotClients() {
+    size_t polledClients = snapshotClients.size();
+
+    // Accept new snapshot clients
+    if (pollFds[0].revents & POLLIN) {
+        while (true) {
+            SOCKET clientSocket = accept(snapshotSocket, nullptr, nullptr);
+            if (clientSocket == INVALID_SOCKET) break;
+
+            net::setNonBlocking(clientSocket);
+            net::setNoDelay(clientSocket);
+            snapshotClients.push_back(std::make_unique<SocketSession>(clientSocket, nextSessionId++));
+        }
+    }
+
+    for (size_t i = 0; i < polledClients; i++) {
+        SocketSession& session = *snapshotClients[i];
+        short revents = pollFds[i + 1].revents;
+        bool open = !(revents & (POLLERR | POLLNVAL));
+
+        if (open && (revents & (POLLIN | POLLHUP))) {
+            open = (session.readAvailable() >= 0);
+
+            protocol::Frame frame;
+            while (open && session.nextFrame(frame)) {
+                SnapshotRequest request;
+
+                if (protocol::deserialize(frame, request)) {
+                    writeSnapshot(request.symbol, session);
+                }
+                else {
+                    BookSnapshot reply{"", 0, true, ErrorCode::BAD_REQUEST, {}};
+                    protocol::serialize(reply, session.outbound());
+                }
+            }
+            session.compactReceiveBuffer();
+        }
+
+        if (open) {
+            open = session.flush();
+        }
+
+        if (!open || session.hasProtocolError() ||
+            (session.isPeerClosed() && !session.hasPendingOutbound())) {
+            snapshotClients[i].reset();
+        }
+    }
+
+    snapshotClients.erase(
+        std::remove(snapshotClients.begin(), snapshotClients.end(), nullptr),
+        snapshotClients.end()
+    );
+}
+
+//#########################################################################
+void MarketDataPublisher::writeSnapshot(const std::string& symbol, Session& session) {
+    auto imageId = imageIds.find(symbol);
+
+    if (imageId == imageIds.end()) {
+        BookSnapshot reply{symbol, 0, true, ErrorCode::BAD_SYMBOL, {}};
+        protocol::serialize(reply, session.outbound());
+        return;
+    }
+
+    const BookImage& image = images[imageId->second];
+    BookSnapshot part{symbol, image.seq, false, ErrorCode::OK, {}};
+    part.levels.reserve(protocol::MAX_SNAPSHOT_LEVELS);
+
+    // Bids from best (highest) to worst, then asks from best (lowest) to worst
+    auto addLevel = [&](OrderSide side, double price, int qty) {
+        part.levels.push_back({side, price, qty});
+
+        if (part.levels.size() == protocol::MAX_SNAPSHOT_LEVELS) {
+            protocol::serialize(part, session.outbound());
+            part.levels.clear();
+        }
+    };
+
+    for (auto level = image.bids.rbegin(); level != image.bids.rend(); level++) {
+        addLevel(OrderSide::BUY, level->first, level->second);
+    }
+    for (auto level = image.asks.begin(); level != image.asks.end(); level++) {
+        addLevel(OrderSide::SELL, level->first, level->second);
+    }
+
+    part.last = true;
+    protocol::serialize(part, session.outbound());
+}
+
+//#########################################################################
+bool MarketDataPublisher::createSockets() {
+    if (!net::startup()) {
+        return false;
+    }
+
+    // UDP socket for the multicast update feed
+    multicastSocket = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (multicastSocket == INVALID_SOCKET) {
+        logEvent<LogLevel::ERR>(logging,
+                                "MarketDataPublisher::createSockets(): failed to create multicast socket");
+        return false;
+    }
+
+    // Single hop, and looped back so consumers on this host receive the feed
+    unsigned char ttl = 1;
+    unsigned char loop = 1;
+    setsockopt(multicastSocket, IPPROTO_IP, IP_MULTICAST_TTL, reinterpret_cast<const char*>(&ttl), sizeof(ttl));
+    setsockopt(multicastSocket, IPPROTO_IP, IP_MULTICAST_LOOP, reinterpret_cast<const char*>(&loop), sizeof(loop));
+
+    in_addr interfaceAddress;
+    inet_pton(AF_INET, multicastInterface.c_str(), &interfaceAddress);
+    setsockopt(multicastSocket, IPPROTO_IP, IP_MULTICAST_IF, reinterpret_cast<const char*>(&interfaceAddress), sizeof(interfaceAddress));
+
+    std::memset(&groupAddress, 0, sizeof(groupAddress));
+    groupAddress.sin_family = AF_INET;
+    groupAddress.sin_port = htons(static_cast<uint16_t>(multicastPort));
+    inet_pton(AF_INET, multicastGroup.c_str(), &groupAddress.sin_addr);
+
+    // TCP listener for the snapshot service
+    snapshotSocket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (snapshotSocket == INVALID_SOCKET) {
+        logEvent<LogLevel::ERR>(logging,
+                                "MarketDataPublisher::createSockets(): failed to create snapshot socket");
+        return false;
+    }
+
+    int reuse = 1;
+    setsockopt(snapshotSocket, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&reuse), sizeof(reuse));
+
+    sockaddr_in service;
+    std::memset(&service, 0, sizeof(service));
+    service.sin_family = AF_INET;
+    service.sin_addr.s_addr = INADDR_ANY;
+    service.sin_port = htons(static_cast<uint16_t>(snapshotPort));
+
+    if (bind(snapshotSocket, reinterpret_cast<SOCKADDR*>(&service), sizeof(service)) == SOCKET_ERROR ||
+        listen(snapshotSocket, SOMAXCONN) == SOCKET_ERROR) {
+        logEvent<LogLevel::ERR>(logging,
+                                "MarketDataPublisher::createSockets(): snapshot socket bind/listen failed on port={}",
+                                snapshotPort);
+        return false;
+    }
+
+    net::setNonBlocking(snapshotSocket);
+
+    return true;
+}
@@ -0,0 +1,566 @@
+// Global Includes
+#include <algorithm>
+#include <iterator>
+
+// Project Includes
+#include <MatchingEngine.hpp>
+#include <StageTimers.hpp>
+
+thread_local MatchingEngine::BatchContext* MatchingEngine::activeContext = nullptr;
+
+//#########################################################################
+MatchingEngine::MatchingEngine (
+    uint32_t engineId,
+    std::function<void(uint32_t)> releaseSymbol,
+    bool logging
+) : engineId(engineId),
+    releaseSymbol(releaseSymbol),
+    logging(logging),
+    queueMutex(),
+    queueReady(),
+    queued(),
+    executing(),
+    pendingStrategies(),
+    attaching(),
+    commandsPending(false),
+    placement(),
+    busyPoll(false),
+    queueDepth(0),
+    overloaded(false),
+    highWatermark(0),
+    lowWatermark(0),
+    context(),
+    batchWorkers(0),
+    pool(),
+    workerContexts(),
+    partitionOfBook(),
+    partitions(),
+    responseSources(),
+    parallelBatches(0),
+    strategies(),
+    running(false),
+    worker() {}
+
+MatchingEngine::~MatchingEngine() {
+    stop();
+
+    // Detach from the books (the engine thread has stopped)
+    strategies.clear();
+}
+
+//#########################################################################
+void MatchingEngine::start() {
+    if (batchWorkers > 0) {
+        pool = std::make_unique<WorkStealingPool>(batchWorkers);
+        workerContexts.resize(pool->getWorkerCount());
+    }
+
+    running = true;
+    worker = std::thread(&MatchingEngine::run, this);
+}
+
+//#########################################################################
+void MatchingEngine::stop() {
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        running = false;
+        commandsPending.store(true, std::memory_order_release);
+    }
+    queueReady.notify_one();
+
+    if (worker.joinable()) {
+        worker.join();
+    }
+
+    pool.reset();
+}
+
+//#########################################################################
+void MatchingEngine::submit(std::vector<EngineCommand>& commands) {
+    if (commands.empty()) return;
+
+    bool wasEmpty = false;
+
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        wasEmpty = queued.empty();
+
+        for (EngineCommand& command : commands) {
+            queued.push_back(std::move(command));
+        }
+
+        commandsPending.store(true, std::memory_order_release);
+    }
+
+    size_t depth = queueDepth.fetch_add(commands.size(), std::memory_order_relaxed) + commands.size();
+    if (highWatermark != 0 && depth >= highWatermark) {
+        overloaded.store(true, std::memory_order_relaxed);
+    }
+
+    commands.clear();
+
+    // The engine only sleeps on an empty queue; a busy-polling engine never sleeps
+    if (wasEmpty && !busyPoll) {
+        queueReady.notify_one();
+    }
+}
+
+//#########################################################################
+void MatchingEngine::addStrategy(OrderBookSlot* slot, Strategy& strategy) {
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        pendingStrategies.emplace_back(slot, &strategy);
+        commandsPending.store(true, std::memory_order_release);
+    }
+
+    if (!busyPoll) {
+        queueReady.notify_one();
+    }
+}
+
+//#########################################################################
+void MatchingEngine::setWatermarks(size_t t_highWatermark, size_t t_lowWatermark) {
+    highWatermark = t_highWatermark;
+    lowWatermark = std::min(t_lowWatermark, t_highWatermark);
+}
+
+//#########################################################################
+void MatchingEngine::setThreadConfig(const threading::ThreadPlacement& t_placement, bool t_busyPoll) {
+    placement = t_placement;
+    busyPoll = t_busyPoll;
+}
+
+//#########################################################################
+void MatchingEngine::setBatchWorkers(uint32_t workers) {
+    batchWorkers = workers;
+}
+
+//#########################################################################
+uint32_t MatchingEngine::getEngineId() const {
+    return engineId;
+}
+
+//#########################################################################
+size_t MatchingEngine::getQueueDepth() const {
+    return queueDepth.load(std::memory_order_relaxed);
+}
+
+//#########################################################################
+bool MatchingEngine::isOverloaded() const {
+    return overloaded.load(std::memory_order_relaxed);
+}
+
+//#########################################################################
+uint64_t MatchingEngine::getParallelBatches() const {
+    return parallelBatches.load(std::memory_order_relaxed);
+}
+
+//#########################################################################
+void MatchingEngine::run() {
+    stages::setThreadName("engine-" + std::to_string(engineId));
+
+    if (!threading::applyPlacement(placement)) {
+        logEvent<LogLevel::WARN>(logging,
+                                 "MatchingEngine::run(): Engine={} could not be placed on CPU={}, priority={}",
+                                 engineId, placement.cpu, placement.priority);
+    }
+
+    activeContext = &context;
+
+    while (true) {
+        // Spin until commands arrive instead of sleeping on the condition
+        if (busyPoll) {
+            while (!commandsPending.load(std::memory_order_acquire)) {
+                threading::cpuRelax();
+            }
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            queueReady.wait(lock, [this]() { return !running || !queued.empty() || !pendingStrategies.empty(); });
+            commandsPending.store(false, std::memory_order_relaxed);
+
+            // Commands submitted before stop() are still executed
+            if (queued.empty() && pendingStrategies.empty()) break;
+
+            executing.swap(queued);
+            attaching.swap(pendingStrategies);
+        }
+        int64_t dequeued = trace::now();
+
+        for (auto& [slot, strategy] : attaching) {
+            if (slot->state == BookState::FREE) {
+                logEvent<LogLevel::WARN>(logging, "MatchingEngine::run(): Engine={}, strategy for a removed book dropped", engineId);
+                continue;
+            }
+
+            // Orders placed by onStart() run before the batch
+            strategies.emplace_back(slot, std::make_unique<StrategyHost>(slot->book, *strategy));
+            drainStrategies(slot, context);
+        }
+        attaching.clear();
+
+        if (!runParallel(dequeued)) {
+            for (size_t position = 0; position < executing.size(); position++) {
+                executeCommand(executing[position], position, dequeued, context);
+            }
+        }
+
+        // Hosts of books removed by the batch were reset in place
+        strategies.erase(std::remove_if(strategies.begin(), strategies.end(),
+                                        [](const auto& hosted) { return !hosted.second; }),
+                         strategies.end());
+
+        size_t depth = queueDepth.fetch_sub(executing.size(), std::memory_order_relaxed) - executing.size();
+        if (depth <= lowWatermark) {
+            overloaded.store(false, std::memory_order_relaxed);
+        }
+
+        executing.clear();
+        deliverCompletions();
+    }
+}
+
+//#########################################################################
+bool MatchingEngine::runParallel(int64_t dequeued) {
+    if (!pool || executing.size() < PARALLEL_MIN_COMMANDS) return false;
+
+    // One partition per book, holding its commands in batch order
+    partitionOfBook.clear();
+    size_t partitionCount = 0;
+
+    for (size_t position = 0; position < executing.size(); position++) {
+        auto [partition, added] = partitionOfBook.try_emplace(executing[position].slot, partitionCount);
+        if (added) {
+            if (partitions.size() <= partitionCount) partitions.emplace_back();
+            partitions[partitionCount++].clear();
+        }
+
+        partitions[partition->second].push_back(position);
+    }
+
+    if (partitionCount < 2) return false;
+
+    // A partition runs whole on one worker, so each book stays single-threaded
+    pool->run(partitionCount, [this, dequeued](size_t partition, uint32_t workerId) {
+        BatchContext& workerContext = workerContexts[workerId];
+        activeContext = &workerContext;
+
+        for (size_t position : partitions[partition]) {
+            executeCommand(executing[position], position, dequeued, workerContext);
+        }
+
+        activeContext = nullptr;
+    });
+
+    // Merge the responses back into batch order, then the reports
+    responseSources.assign(executing.size(), {UINT32_MAX, 0});
+    for (uint32_t workerId = 0; workerId < workerContexts.size(); workerId++) {
+        const BatchContext& workerContext = workerContexts[workerId];
+
+        for (size_t response = 0; response < workerContext.completed.size(); response++) {
+            responseSources[workerContext.completedPositions[response]] = {workerId, response};
+        }
+    }
+
+    for (const auto& [workerId, response] : responseSources) {
+        if (workerId == UINT32_MAX) continue;
+
+        context.completed.push_back(std::move(workerContexts[workerId].completed[response]));
+        context.completedQueues.push_back(workerContexts[workerId].completedQueues[response]);
+    }
+
+    for (BatchContext& workerContext : workerContexts) {
+        std::move(workerContext.reports.begin(), workerContext.reports.end(), std::back_inserter(context.reports));
+        context.reportQueues.insert(context.reportQueues.end(), workerContext.reportQueues.begin(), workerContext.reportQueues.end());
+
+        workerContext.completed.clear();
+        workerContext.completedQueues.clear();
+        workerContext.completedPositions.clear();
+        workerContext.reports.clear();
+        workerContext.reportQueues.clear();
+    }
+
+    parallelBatches.fetch_add(1, std::memory_order_relaxed);
+
+    return true;
+}
+
+//#########################################################################
+void MatchingEngine::executeCommand(EngineCommand& command, size_t position, int64_t dequeued, BatchContext& output) {
+    trace::RequestTrace& stamps = command.route.trace;
+    if (stamps.buffer) {
+        stamps.dequeue = dequeued;
+        stamps.matchStart = trace::now();
+    }
+
+    OrderResponse response = execute(command, output);
+    if (stamps.buffer) stamps.matchEnd = trace::now();
+
+    routeExecutions(command, response, output);
+    drainStrategies(command.slot, output);
+
+    if (command.route.queue != nullptr) {
+        output.completed.push_back(Completion{command.route.session, command.route.seq, response, std::move(output.queryResult), stamps});
+        output.completedQueues.push_back(command.route.queue);
+        output.completedPositions.push_back(position);
+    }
+
+    output.queryResult.reset();
+}
+
+//#########################################################################
+OrderResponse MatchingEngine::execute(EngineCommand& command, BatchContext& output) {
+    OBM_STAGE(EXECUTE);
+
+    OrderResponse response{"-1", ErrorCode::BAD_REQUEST};
+
+    if (const AdminRequest* admin = std::get_if<AdminRequest>(&command.message)) {
+        return executeAdmin(command, *admin);
+    }
+
+    if (const QueryRequest* query = std::get_if<QueryRequest>(&command.message)) {
+        return executeQuery(command, *query, output);
+    }
+
+    if (const SessionClose* closed = std::get_if<SessionClose>(&command.message)) {
+        return executeSessionClose(command, *closed);
+    }
+
+    OrderBookSlot& slot = *command.slot;
+
+    if (slot.state == BookState::FREE) {
+        response.errCode = ErrorCode::BAD_SYMBOL;
+        return response;
+    }
+
+    if (slot.state == BookState::HALTED) {
+        response.errCode = ErrorCode::SYMBOL_HALTED;
+        return response;
+    }
+
+    if (const OrderRequest* request = std::get_if<OrderRequest>(&command.message)) {
+        response.orderId = slot.book.createOrder(
+            request->qty,
+            request->price,
+            request->orderSide,
+            request->orderType,
+            response.errCode
+        );
+    }
+    else if (const OrderModify* request = std::get_if<OrderModify>(&command.message)) {
+        response.orderId = slot.book.modifyOrder(
+            request->orderId,
+            request->qty,
+            request->price,
+            response.errCode
+        );
+    }
+    else if (const OrderCancel* request = std::get_if<OrderCancel>(&command.message)) {
+        response.orderId = slot.book.cancelOrder(
+            request->orderId,
+            response.errCode
+        );
+    }
+
+    return response;
+}
+
+//#########################################################################
+OrderResponse MatchingEngine::executeAdmin(EngineCommand& command, const AdminRequest& request) {
+    OrderResponse response{request.symbol, ErrorCode::OK};
+    OrderBookSlot& slot = *command.slot;
+
+    switch (request.action) {
+        case AdminAction::ADD_SYMBOL:
+            // Recycle the pooled book for the new symbol
+            slot.book.reset(request.symbol);
+            slot.book.addListener(this);
+            slot.state = BookState::ACTIVE;
+            break;
+        case AdminAction::HALT_SYMBOL:
+            slot.state = BookState::HALTED;
+            break;
+        case AdminAction::RESUME_SYMBOL:
+            slot.state = BookState::ACTIVE;
+            break;
+        case AdminAction::REMOVE_SYMBOL:
+            // Orders for the symbol queued before the removal were executed
+            // first; return the book to the pool and its ID to the manager
+            slot.book.reset("");
+            slot.book.removeListener(this);
+
+            // Strategies of the book are detached with it (erased before the next batch)
+            for (auto& hosted : strategies) {
+                if (hosted.first == &slot) hosted.second.reset();
+            }
+            slot.state = BookState::FREE;
+            releaseSymbol(command.symbolId);
+            break;
+        default:
+            response.errCode = ErrorCode::BAD_REQUEST;
+            return response;
+    }
+
+    logEvent<LogLevel::INFO>(logging,
+                             "MatchingEngine::executeAdmin(): Engine={}, Symbol={}, Action={}",
+                             engineId, request.symbol, request.action);
+
+    return response;
+}
+
+//#########################################################################
+OrderResponse MatchingEngine::executeQuery(EngineCommand& command, const QueryRequest& request, BatchContext& output) {
+    OrderResponse response{request.symbol, ErrorCode::OK};
+    OrderBookSlot& slot = *command.slot;
+
+    // Halted books can still be queried
+    if (slot.state == BookState::FREE) {
+        response.errCode = ErrorCode::BAD_SYMBOL;
+        output.queryResult = std::make_shared<QueryResult>(request, response.errCode);
+        return response;
+    }
+
+    switch (request.type) {
+        case QueryType::OPEN_ORDERS: {
+            // Resting orders change in place; copy them
+            std::vector<QueryOrder> openOrders;
+            slot.book.getOpenOrders(openOrders);
+            output.queryResult = std::make_shared<QueryResult>(request, std::move(openOrders));
+            break;
+        }
+        case QueryType::ORDER_HISTORY:
+            output.queryResult = std::make_shared<QueryResult>(request, slot.book.getOrderHistoryView());
+            break;
+        case QueryType::TRADE_HISTORY:
+            output.queryResult = std::make_shared<QueryResult>(request, slot.book.getTradeHistoryView());
+            break;
+        default:
+            response.errCode = ErrorCode::BAD_REQUEST;
+            output.queryResult = std::make_shared<QueryResult>(request, response.errCode);
+            break;
+    }
+
+    return response;
+}
+
+//#########################################################################
+OrderResponse MatchingEngine::executeSessionClose(EngineCommand& command, const SessionClose& request) {
+    std::unordered_map<std::string, OrderOwner>& owners = command.slot->owners;
+
+    for (auto owner = owners.begin(); owner != owners.end();) {
+        if (owner->second.sessionId == request.sessionId) {
+            owner->second.openOrders->fetch_sub(1, std::memory_order_relaxed);
+            owner = owners.erase(owner);
+        }
+        else {
+            owner++;
+        }
+    }
+
+    return OrderResponse{"-1", ErrorCode::OK};
+}
+
+//#########################################################################
+void MatchingEngine::onExecution(const ExecutionEvent& event) {
+    if (!activeContext) return;
+
+    activeContext->executions.push_back(ExecutionReport{
+        event.symbol,
+        event.orderId,
+        event.type,
+        event.side,
+        event.price,
+        event.qty,
+        event.leavesQty,
+        event.timestamp
+    });
+}
+
+//#########################################################################
+void MatchingEngine::routeExecutions(const EngineCommand& command, const OrderResponse& response, BatchContext& output) {
+    // The new order's own fills were recorded before its ID was known
+    if (response.errCode == ErrorCode::OK && command.route.queue != nullptr && command.route.session != nullptr &&
+        std::holds_alternative<OrderRequest>(command.message)) {
+        const Session& session = *command.route.session;
+
+        command.slot->owners[response.orderId] = OrderOwner{command.route.queue, session.getSessionId(), session.getOpenOrderCount()};
+        session.getOpenOrderCount()->fetch_add(1, std::memory_order_relaxed);
+    }
+
+    routeReports(command.slot, output);
+}
+
+//#########################################################################
+void MatchingEngine::routeReports(OrderBookSlot* slot, BatchContext& output) {
+    for (ExecutionReport& report : output.executions) {
+        auto owner = slot->owners.find(report.orderId);
+        if (owner == slot->owners.end()) continue;
+
+        CompletionQueue* queue = owner->second.queue;
+        uint32_t sessionId = owner->second.sessionId;
+
+        if (report.leavesQty == 0) {
+            owner->second.openOrders->fetch_sub(1, std::memory_order_relaxed);
+            slot->owners.erase(owner);
+        }
+
+        output.reports.push_back(RoutedReport{sessionId, std::move(report)});
+        output.reportQueues.push_back(queue);
+    }
+
+    output.executions.clear();
+}
+
+//#########################################################################
+void MatchingEngine::drainStrategies(OrderBookSlot* slot, BatchContext& output) {
+    if (strategies.empty()) return;
+
+    // Strategies may keep answering each other; bound the rounds per command
+    for (int round = 0; round < 16; round++) {
+        bool executed = false;
+
+        for (auto& [strategySlot, host] : strategies) {
+            if (strategySlot != slot || !host || !host->hasPending()) continue;
+
+            if (slot->state != BookState::ACTIVE) {
+                host->rejectPending(slot->state == BookState::HALTED ? ErrorCode::SYMBOL_HALTED : ErrorCode::BAD_SYMBOL);
+                continue;
+            }
+
+            executed |= host->drain() > 0;
+            routeReports(slot, output);
+        }
+
+        if (!executed) break;
+    }
+}
+
+//#########################################################################
+void MatchingEngine::deliverCompletions() {
+    size_t runStart = 0;
+
+    // Completions for the same transport are pushed (and wake it) together
+    for (size_t i = 1; i <= context.completed.size(); i++) {
+        if (i == context.completed.size() || context.completedQueues[i] != context.completedQueues[runStart]) {
+            context.completedQueues[runStart]->push(context.completed.data() + runStart, i - runStart);
+            runStart = i;
+        }
+    }
+
+    runStart = 0;
+
+    // Reports follow the responses, so an order's ID always arrives first
+    for (size_t i = 1; i <= context.reports.size(); i++) {
+        if (i == context.reports.size() || context.reportQueues[i] != context.reportQueues[runStart]) {
+            context.reportQueues[runStart]->push(context.reports.data() + runStart, i - runStart);
+            runStart = i;
+        }
+    }
+
+    context.completed.clear();
+    context.completedQueues.clear();
+    context.completedPositions.clear();
+    context.reports.clear();
+    context.reportQueues.clear();
+}
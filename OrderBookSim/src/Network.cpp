@@ -0,0 +1,165 @@
+// Project Includes
+#include <Network.hpp>
+
+namespace net {
+    bool startup() {
+#ifdef _WIN32
+        WSADATA wsaData;
+        return WSAStartup(MAKEWORD(2, 2), &wsaData) == 0;
+#else
+        return true;
+#endif
+    }
+
+    void cleanup() {
+#ifdef _WIN32
+        WSACleanup();
+#endif
+    }
+
+    void closeSocket(SOCKET socket) {
+#ifdef _WIN32
+        closesocket(socket);
+#else
+        close(socket);
+#endif
+    }
+
+    bool setNonBlocking(SOCKET socket) {
+#ifdef _WIN32
+        u_long mode = 1;
+        return ioctlsocket(socket, FIONBIO, &mode) == 0;
+#else
+        int flags = fcntl(socket, F_GETFL, 0);
+        return (flags != -1) && (fcntl(socket, F_SETFL, flags | O_NONBLOCK) == 0);
+#endif
+    }
+
+    void setNoDelay(SOCKET socket) {
+        int flag = 1;
+        setsockopt(socket, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&flag), sizeof(flag));
+    }
+
+    void setSlice(IoSlice& slice, const char* data, size_t length) {
+#ifdef _WIN32
+        slice.buf = const_cast<char*>(data);
+        slice.len = static_cast<ULONG>(length);
+#else
+        slice.iov_base = const_cast<char*>(data);
+        slice.iov_len  = length;
+#endif
+    }
+
+    const char* sliceData(const IoSlice& slice) {
+#ifdef _WIN32
+        return slice.buf;
+#else
+        return static_cast<const char*>(slice.iov_base);
+#endif
+    }
+
+    size_t sliceLength(const IoSlice& slice) {
+#ifdef _WIN32
+        return static_cast<size_t>(slice.len);
+#else
+        return slice.iov_len;
+#endif
+    }
+
+    long receive(SOCKET socket, char* buffer, size_t length) {
+#ifdef _WIN32
+        return recv(socket, buffer, static_cast<int>(length), 0);
+#else
+        return static_cast<long>(recv(socket, buffer, length, 0));
+#endif
+    }
+
+    long sendVectored(SOCKET socket, IoSlice* slices, size_t count) {
+#ifdef _WIN32
+        DWORD bytesSent = 0;
+        int result = WSASend(socket, slices, static_cast<DWORD>(count), &bytesSent, 0, nullptr, nullptr);
+
+        return (result == SOCKET_ERROR) ? -1 : static_cast<long>(bytesSent);
+#else
+        // sendmsg() rather than writev() so a closed peer does not raise SIGPIPE
+        msghdr message{};
+        message.msg_iov    = slices;
+        message.msg_iovlen = count;
+
+        return static_cast<long>(sendmsg(socket, &message, MSG_NOSIGNAL));
+#endif
+    }
+
+    int pollSockets(PollFd* fds, size_t count, int timeoutMs) {
+#ifdef _WIN32
+        return WSAPoll(fds, static_cast<ULONG>(count), timeoutMs);
+#else
+        return poll(fds, static_cast<nfds_t>(count), timeoutMs);
+#endif
+    }
+
+    SOCKET connectTo(const std::string& host, int port) {
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(static_cast<uint16_t>(port));
+        if (inet_pton(AF_INET, host.c_str(), &address.sin_addr) != 1) return INVALID_SOCKET;
+
+        SOCKET connection = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+        if (connection == INVALID_SOCKET) return INVALID_SOCKET;
+
+        if (connect(connection, reinterpret_cast<SOCKADDR*>(&address), sizeof(address)) == SOCKET_ERROR) {
+            closeSocket(connection);
+            return INVALID_SOCKET;
+        }
+
+        return connection;
+    }
+
+    SOCKET createWakeupSocket() {
+        SOCKET wakeup = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+        if (wakeup == INVALID_SOCKET) return INVALID_SOCKET;
+
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = 0;
+
+        // Bind to an ephemeral loopback port, then connect the socket to itself
+        socklen_t addressLength = sizeof(address);
+        if (bind(wakeup, reinterpret_cast<SOCKADDR*>(&address), sizeof(address)) == SOCKET_ERROR ||
+            getsockname(wakeup, reinterpret_cast<SOCKADDR*>(&address), &addressLength) == SOCKET_ERROR ||
+            connect(wakeup, reinterpret_cast<SOCKADDR*>(&address), sizeof(address)) == SOCKET_ERROR ||
+            !setNonBlocking(wakeup)) {
+            closeSocket(wakeup);
+            return INVALID_SOCKET;
+        }
+
+        return wakeup;
+    }
+
+    void signalWakeup(SOCKET socket) {
+        char signal = 1;
+        send(socket, &signal, 1, 0);
+    }
+
+    void drainWakeup(SOCKET socket) {
+        char signals[64];
+        while (recv(socket, signals, sizeof(signals), 0) > 0) {}
+    }
+
+    bool wouldBlock() {
+#ifdef _WIN32
+        return WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+        return (errno == EAGAIN) || (errno == EWOULDBLOCK);
+#endif
+    }
+
+    int lastError() {
+#ifdef _WIN32
+        return WSAGetLastError();
+#else
+        return errno;
+#endif
+    }
+};
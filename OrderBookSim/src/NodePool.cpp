@@ -0,0 +1,65 @@
+// Global Includes
+#include <algorithm>
+#include <new>
+
+// Project Includes
+#include <NodePool.hpp>
+
+namespace memory {
+    //#########################################################################
+    NodePool::~NodePool() {
+        for (FreeBlock*& freeList : freeLists) {
+            while (freeList) {
+                FreeBlock* block = freeList;
+                freeList = block->next;
+                ::operator delete(block);
+            }
+        }
+    }
+
+    //#########################################################################
+    void* NodePool::allocate(size_t bytes) {
+        size_t sizeClass = (std::max<size_t>(bytes, 1) + GRANULE - 1) / GRANULE - 1;
+        stats.allocations++;
+
+        // Larger blocks are not pooled
+        if (sizeClass >= SIZE_CLASSES) {
+            stats.heapAllocations++;
+            stats.bytesReserved += bytes;
+            stats.bytesInUse += bytes;
+            stats.peakBytesInUse = std::max(stats.peakBytesInUse, stats.bytesInUse);
+            return ::operator new(bytes);
+        }
+
+        size_t blockSize = (sizeClass + 1) * GRANULE;
+        stats.bytesInUse += blockSize;
+        stats.peakBytesInUse = std::max(stats.peakBytesInUse, stats.bytesInUse);
+
+        if (FreeBlock* block = freeLists[sizeClass]) {
+            freeLists[sizeClass] = block->next;
+            return block;
+        }
+
+        stats.heapAllocations++;
+        stats.bytesReserved += blockSize;
+        return ::operator new(blockSize);
+    }
+
+    //#########################################################################
+    void NodePool::deallocate(void* block, size_t bytes) {
+        size_t sizeClass = (std::max<size_t>(bytes, 1) + GRANULE - 1) / GRANULE - 1;
+
+        if (sizeClass >= SIZE_CLASSES) {
+            stats.bytesReserved -= bytes;
+            stats.bytesInUse -= bytes;
+            ::operator delete(block);
+            return;
+        }
+
+        stats.bytesInUse -= (sizeClass + 1) * GRANULE;
+
+        FreeBlock* freeBlock = static_cast<FreeBlock*>(block);
+        freeBlock->next = freeLists[sizeClass];
+        freeLists[sizeClass] = freeBlock;
+    }
+};
@@ -1,5 +1,5 @@
 // Global Includes
-#include <sstream>
+#include <string>
 
 // Project Includes
 #include <Order.hpp>
@@ -31,13 +31,9 @@ Order::Order (
 
 //#########################################################################
 std::string Order::generateOrderId() {
-    std::stringstream order_oss;
-
-    // Timestamp set in the constructor
-    order_oss << timestamp << "_" << utils::generateRandom_6DigitNum();
-
-    // Return the formed order ID
-    return order_oss.str();
+    // Timestamp set in the constructor; the sequence keeps IDs created in the
+    // same millisecond unique
+    return utils::generateId(timestamp);
 }
 
 //#########################################################################
@@ -79,7 +75,7 @@ void Order::updateFillPrice(double t_price) {
 }
 
 //#########################################################################
-std::string Order::getOrderId() const {
+const std::string& Order::getOrderId() const {
     return orderId;
 }
 
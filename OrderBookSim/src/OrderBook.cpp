@@ -1,13 +1,35 @@
+// Global Includes
+#include <algorithm>
+#include <cstdlib>
+#include <numeric>
+
 // Project Includes
 #include <OrderBook.hpp>
+#include <StageTimers.hpp>
 
 //#########################################################################
 OrderBook::OrderBook (std::string exchangeSymbol) :
     exchangeSymbol(exchangeSymbol),
-    buyOrders(),
-    sellOrders(),
+    levelPool(std::make_shared<memory::NodePool>()),
+    orderPool(std::make_shared<memory::NodePool>()),
+    indexPool(std::make_shared<memory::NodePool>()),
+    buyOrders(std::less<double>(), PriceLevels::allocator_type(levelPool)),
+    sellOrders(std::less<double>(), PriceLevels::allocator_type(levelPool)),
+    orderIndex(0, std::hash<std::string>(), std::equal_to<std::string>(), OrderIndex::allocator_type(indexPool)),
     orderHistory(),
-    tradeHistory() {}
+    tradeHistory(),
+    listeners(),
+    createAllocations(),
+    modifyAllocations(),
+    cancelAllocations(),
+    matchingMode(MatchingMode::CONTINUOUS),
+    auctionAllocation(AuctionAllocation::TIME_PRIORITY),
+    ladderPrices(),
+    ladderDemand(),
+    ladderSupply(),
+    ladderVolume(),
+    buyFills(),
+    sellFills() {}
 
 //#########################################################################
 std::string OrderBook::createOrder(
@@ -18,19 +40,34 @@ std::string OrderBook::createOrder(
     ErrorCode& errCode
 ) {
     std::string orderId = "-1";
+    uint64_t missesBefore = poolMisses();
+    uint64_t chunksBefore = historyChunks();
 
     // Validate order parameters
-    if (qty <= 0) {
-        errCode = ErrorCode::BAD_QTY;
-    }
-    else if (price <= 0.00) {
-        errCode = ErrorCode::BAD_PRICE;
-    }
-    else if (!utils::validOrderSide(side)) {
-        errCode = ErrorCode::BAD_SIDE;
+    ErrorCode validation = ErrorCode::OK;
+    {
+        OBM_STAGE(VALIDATE);
+
+        if (qty <= 0) {
+            validation = ErrorCode::BAD_QTY;
+        }
+        else if (price <= 0.00) {
+            validation = ErrorCode::BAD_PRICE;
+        }
+        else if (!utils::validOrderSide(side)) {
+            validation = ErrorCode::BAD_SIDE;
+        }
+        else if (!utils::validOrderType(type)) {
+            validation = ErrorCode::BAD_TYPE;
+        }
+        // Only LIMIT orders can wait for an auction
+        else if (matchingMode == MatchingMode::AUCTION && type != OrderType::LIMIT) {
+            validation = ErrorCode::BAD_TYPE;
+        }
     }
-    else if (!utils::validOrderType(type)) {
-        errCode = ErrorCode::BAD_TYPE;
+
+    if (validation != ErrorCode::OK) {
+        errCode = validation;
     }
     else {
         // Create the new order
@@ -41,16 +78,26 @@ std::string OrderBook::createOrder(
             side,
             type
         );
-        orderHistory.push_back({OrderStatus::CREATE, newOrder});
+        {
+            OBM_STAGE(HISTORY);
+            orderHistory.push_back({OrderStatus::CREATE, newOrder});
+        }
 
         orderId = newOrder.getOrderId();
 
-        // Run matching event
-        matchOrders(newOrder);
+        // Run matching event; in auction mode the order waits for uncross()
+        if (matchingMode == MatchingMode::AUCTION) {
+            insertOrder(newOrder);
+        }
+        else {
+            matchOrders(newOrder);
+        }
 
         errCode = ErrorCode::OK;
     }
 
+    countOperation(createAllocations, missesBefore, chunksBefore);
+
     return orderId;
 }
 
@@ -62,6 +109,8 @@ std::string OrderBook::modifyOrder(
     ErrorCode& errCode
 ) {
     std::string m_orderId = "-1";
+    uint64_t missesBefore = poolMisses();
+    uint64_t chunksBefore = historyChunks();
 
     // Validate the order exists
     Order* order = findOrder(orderId);
@@ -86,21 +135,32 @@ std::string OrderBook::modifyOrder(
                 // Only update the order price if specific order type
                 //! NOTE: LIMIT, STOP, ICEBERG orders need prices
                 //! NOTE: MARKET, FOK, IOC orders ignore price
-                if (order->getOrderType() == OrderType::LIMIT ||
-                    order->getOrderType() == OrderType::STOP ||
-                    order->getOrderType() == OrderType::ICEBERG) {
+                bool priced = order->getOrderType() == OrderType::LIMIT ||
+                              order->getOrderType() == OrderType::STOP ||
+                              order->getOrderType() == OrderType::ICEBERG;
+                if (priced) {
                     order->updatePrice(price);
+                }
 
-                    // Remove the order from the old price level
-                    removeOrder(*order);
+                {
+                    OBM_STAGE(HISTORY);
+                    orderHistory.push_back({OrderStatus::MODIFY, *order});
                 }
 
-                orderHistory.push_back({OrderStatus::MODIFY, *order});
+                // Remove the order from the old price level (frees *order)
+                if (priced) {
+                    removeOrder(*order);
+                }
 
                 m_orderId = orderCopy.getOrderId();
 
-                // Run matching event
-                matchOrders(orderCopy);
+                // Run matching event; in auction mode the order waits for uncross()
+                if (matchingMode == MatchingMode::AUCTION) {
+                    insertOrder(orderCopy);
+                }
+                else {
+                    matchOrders(orderCopy);
+                }
 
                 errCode = ErrorCode::OK;
             }
@@ -115,6 +175,8 @@ std::string OrderBook::modifyOrder(
         errCode = ErrorCode::BAD_ID;
     }
 
+    countOperation(modifyAllocations, missesBefore, chunksBefore);
+
     return m_orderId;
 }
 
@@ -124,12 +186,21 @@ std::string OrderBook::cancelOrder(
     ErrorCode& errCode
 ) {
     std::string m_orderId = "-1";
+    uint64_t missesBefore = poolMisses();
+    uint64_t chunksBefore = historyChunks();
 
     // Validate the order exists
     Order* order = findOrder(orderId);
-    orderHistory.push_back({OrderStatus::CANCEL, *order});
 
     if (order) {
+        {
+            OBM_STAGE(HISTORY);
+            orderHistory.push_back({OrderStatus::CANCEL, *order});
+        }
+        m_orderId = order->getOrderId();
+
+        publishExecution(*order, ExecutionType::CANCEL, 0, order->getOrderRemainingQty(), 0);
+
         removeOrder(*order);
 
         errCode = ErrorCode::OK;
@@ -139,6 +210,8 @@ std::string OrderBook::cancelOrder(
         errCode = ErrorCode::BAD_ID;
     }
 
+    countOperation(cancelAllocations, missesBefore, chunksBefore);
+
     return m_orderId;
 }
 
@@ -157,6 +230,8 @@ Order* OrderBook::findOrder(std::string orderId) {
 
 //#########################################################################
 void OrderBook::matchOrders(Order& order) {
+    OBM_STAGE(MATCH);
+
     // Average execution price
     int totalShares = order.getOrderQty() - order.getOrderRemainingQty();
     double totalValue = order.getOrderFillPrice();
@@ -166,6 +241,8 @@ void OrderBook::matchOrders(Order& order) {
 
     // Loop through the order book prices (while there is an remaining order quantity)
     for (auto bookItr = oppBook.begin(); bookItr != oppBook.end() && order.getOrderRemainingQty() > 0;) {
+        double levelPrice = bookItr->first;
+
         // Check price crossing conditions
         bool priceCross = (order.getOrderSide() == OrderSide::BUY)
                           ? (order.getOrderPrice() >= bookItr->first)
@@ -202,13 +279,20 @@ void OrderBook::matchOrders(Order& order) {
                 matchQty,
                 restingOrder.getOrderPrice()
             );
-            tradeHistory.push_back(trade);
+            {
+                OBM_STAGE(HISTORY);
+                tradeHistory.push_back(trade);
+            }
+            publishTrade(tradeHistory.back(), order.getOrderSide());
 
             // Execute the trade
             order.updateRemainingQty(matchQty);
             restingOrder.updateRemainingQty(matchQty);
             totalValue += restingOrder.getOrderPrice() * matchQty;
 
+            publishExecution(order, ExecutionType::FILL, restingOrder.getOrderPrice(), matchQty, order.getOrderRemainingQty());
+            publishExecution(restingOrder, ExecutionType::FILL, restingOrder.getOrderPrice(), matchQty, restingOrder.getOrderRemainingQty());
+
             // Fully filled resting order
             if (restingOrder.getOrderRemainingQty() == 0) {
                 orderIndex.erase(restingOrder.getOrderId());
@@ -228,6 +312,8 @@ void OrderBook::matchOrders(Order& order) {
             // Move to the next price level
             bookItr++;
         }
+
+        publishLevel(order.getOrderSide() == OrderSide::BUY ? OrderSide::SELL : OrderSide::BUY, levelPrice);
     }
 
     if (totalShares > 0) {
@@ -240,6 +326,9 @@ void OrderBook::matchOrders(Order& order) {
         if (order.getOrderType() == OrderType::LIMIT) {
             insertOrder(order);
         }
+        else {
+            publishExecution(order, ExecutionType::CANCEL, 0, order.getOrderRemainingQty(), 0);
+        }
 
         order.updateOrderStatus(false);
     }
@@ -249,30 +338,263 @@ void OrderBook::matchOrders(Order& order) {
     }
 }
 
+//#########################################################################
+void OrderBook::setMatchingMode(MatchingMode mode, AuctionAllocation allocation) {
+    // Collected orders would otherwise stay crossed under continuous matching
+    if (matchingMode == MatchingMode::AUCTION && mode == MatchingMode::CONTINUOUS) {
+        uncross();
+    }
+
+    matchingMode = mode;
+    auctionAllocation = allocation;
+}
+
+//#########################################################################
+MatchingMode OrderBook::getMatchingMode() const {
+    return matchingMode;
+}
+
+//#########################################################################
+AuctionResult OrderBook::uncross() {
+    OBM_STAGE(MATCH);
+
+    AuctionResult result;
+
+    if (buyOrders.empty() || sellOrders.empty()) return result;
+
+    double bestBid = buyOrders.rbegin()->first;
+    double bestAsk = sellOrders.begin()->first;
+    if (bestBid < bestAsk) return result;
+
+    // Price ladder of the crossed range: bids below the best ask and asks
+    // above the best bid can not trade, whatever the clearing price
+    ladderPrices.clear();
+    ladderDemand.clear();
+    ladderSupply.clear();
+
+    auto levelQty = [](const OrderList& orders) {
+        int64_t qty = 0;
+        for (const Order& order : orders) qty += order.getOrderRemainingQty();
+        return qty;
+    };
+
+    auto bidLevel = buyOrders.lower_bound(bestAsk);
+    auto askLevel = sellOrders.begin();
+    auto askEnd = sellOrders.upper_bound(bestBid);
+
+    while (bidLevel != buyOrders.end() || askLevel != askEnd) {
+        double price = (askLevel == askEnd || (bidLevel != buyOrders.end() && bidLevel->first < askLevel->first))
+                       ? bidLevel->first
+                       : askLevel->first;
+
+        int64_t bidQty = 0;
+        int64_t askQty = 0;
+        if (bidLevel != buyOrders.end() && bidLevel->first == price) bidQty = levelQty((bidLevel++)->second);
+        if (askLevel != askEnd && askLevel->first == price) askQty = levelQty((askLevel++)->second);
+
+        ladderPrices.push_back(price);
+        ladderDemand.push_back(bidQty);
+        ladderSupply.push_back(askQty);
+    }
+
+    // Aggregated curves: buyers at a price include every higher bid, sellers
+    // every lower ask
+    std::partial_sum(ladderDemand.rbegin(), ladderDemand.rend(), ladderDemand.rbegin());
+    std::partial_sum(ladderSupply.begin(), ladderSupply.end(), ladderSupply.begin());
+
+    size_t ladderSize = ladderPrices.size();
+    ladderVolume.resize(ladderSize);
+    for (size_t i = 0; i < ladderSize; i++) {
+        ladderVolume[i] = std::min(ladderDemand[i], ladderSupply[i]);
+    }
+
+    int64_t volume = *std::max_element(ladderVolume.begin(), ladderVolume.end());
+    if (volume == 0) return result;
+
+    // Most volume, then least imbalance (the prices tied on both are adjacent)
+    size_t first = ladderSize;
+    size_t last = ladderSize;
+    int64_t leastImbalance = INT64_MAX;
+
+    for (size_t i = 0; i < ladderSize; i++) {
+        if (ladderVolume[i] != volume) continue;
+
+        int64_t imbalance = std::abs(ladderDemand[i] - ladderSupply[i]);
+        if (imbalance < leastImbalance) {
+            leastImbalance = imbalance;
+            first = i;
+            last = i;
+        }
+        else if (imbalance == leastImbalance) {
+            last = i;
+        }
+    }
+
+    // Remaining ties lean towards the side left over
+    size_t clearing = first + (last - first) / 2;
+    if (ladderDemand[first] > ladderSupply[first] && ladderDemand[last] > ladderSupply[last]) {
+        clearing = last;
+    }
+    else if (ladderDemand[first] < ladderSupply[first] && ladderDemand[last] < ladderSupply[last]) {
+        clearing = first;
+    }
+
+    double price = ladderPrices[clearing];
+    result.price = price;
+    result.volume = volume;
+    result.imbalance = ladderDemand[clearing] - ladderSupply[clearing];
+
+    // Allocate the volume to each side, best price first
+    buyFills.clear();
+    sellFills.clear();
+
+    int64_t remaining = volume;
+    for (auto level = buyOrders.rbegin(); level != buyOrders.rend() && remaining > 0 && level->first >= price; ++level) {
+        remaining -= allocateLevel(std::prev(level.base()), remaining, buyFills);
+    }
+
+    remaining = volume;
+    for (auto level = sellOrders.begin(); level != sellOrders.end() && remaining > 0 && level->first <= price; ++level) {
+        remaining -= allocateLevel(level, remaining, sellFills);
+    }
+
+    // Pair the fills of both sides into trades at the clearing price
+    OrderSide aggressorSide = (result.imbalance >= 0) ? OrderSide::BUY : OrderSide::SELL;
+    size_t buyIndex = 0;
+    size_t sellIndex = 0;
+
+    while (buyIndex < buyFills.size() && sellIndex < sellFills.size()) {
+        AuctionFill& bid = buyFills[buyIndex];
+        AuctionFill& ask = sellFills[sellIndex];
+        Order& buyOrder = *bid.order;
+        Order& sellOrder = *ask.order;
+
+        int matchQty = std::min(bid.qty, ask.qty);
+
+        Trade trade(
+            exchangeSymbol,
+            buyOrder.getOrderId(),
+            sellOrder.getOrderId(),
+            matchQty,
+            price
+        );
+        {
+            OBM_STAGE(HISTORY);
+            tradeHistory.push_back(trade);
+        }
+        publishTrade(tradeHistory.back(), aggressorSide);
+        result.trades++;
+
+        buyOrder.updateRemainingQty(matchQty);
+        sellOrder.updateRemainingQty(matchQty);
+
+        publishExecution(buyOrder, ExecutionType::FILL, price, matchQty, buyOrder.getOrderRemainingQty());
+        publishExecution(sellOrder, ExecutionType::FILL, price, matchQty, sellOrder.getOrderRemainingQty());
+
+        bid.qty -= matchQty;
+        ask.qty -= matchQty;
+        if (bid.qty == 0) buyIndex++;
+        if (ask.qty == 0) sellIndex++;
+    }
+
+    // Remove the filled orders and publish every level that traded
+    for (OrderSide side : {OrderSide::BUY, OrderSide::SELL}) {
+        auto& book = (side == OrderSide::BUY) ? buyOrders : sellOrders;
+        auto& fills = (side == OrderSide::BUY) ? buyFills : sellFills;
+
+        for (size_t i = 0; i < fills.size(); i++) {
+            auto level = fills[i].level;
+            double levelPrice = level->first;
+
+            if (fills[i].order->getOrderRemainingQty() == 0) {
+                orderIndex.erase(fills[i].order->getOrderId());
+                level->second.erase(fills[i].order);
+            }
+
+            // Last fill of the level
+            if (i + 1 == fills.size() || fills[i + 1].level != level) {
+                if (level->second.empty()) {
+                    book.erase(level);
+                }
+
+                publishLevel(side, levelPrice);
+            }
+        }
+    }
+
+    return result;
+}
+
+//#########################################################################
+int64_t OrderBook::allocateLevel(PriceLevels::iterator level, int64_t qty, std::vector<AuctionFill>& fills) {
+    int64_t levelQty = 0;
+    for (const Order& order : level->second) levelQty += order.getOrderRemainingQty();
+
+    // The whole level fits
+    if (levelQty <= qty) {
+        for (auto order = level->second.begin(); order != level->second.end(); ++order) {
+            fills.push_back(AuctionFill{level, order, order->getOrderRemainingQty()});
+        }
+
+        return levelQty;
+    }
+
+    size_t levelStart = fills.size();
+
+    if (auctionAllocation == AuctionAllocation::PRO_RATA) {
+        int64_t allocated = 0;
+
+        for (auto order = level->second.begin(); order != level->second.end(); ++order) {
+            int share = static_cast<int>(order->getOrderRemainingQty() * qty / levelQty);
+            fills.push_back(AuctionFill{level, order, share});
+            allocated += share;
+        }
+
+        // Rounding down leaves less than one unit per order; the earliest orders take it
+        for (size_t i = levelStart; allocated < qty; i++) {
+            fills[i].qty++;
+            allocated++;
+        }
+
+        fills.erase(std::remove_if(fills.begin() + levelStart, fills.end(),
+                                   [](const AuctionFill& fill) { return fill.qty == 0; }),
+                    fills.end());
+    }
+    else {
+        int64_t left = qty;
+
+        for (auto order = level->second.begin(); order != level->second.end() && left > 0; ++order) {
+            int share = static_cast<int>(std::min<int64_t>(order->getOrderRemainingQty(), left));
+            fills.push_back(AuctionFill{level, order, share});
+            left -= share;
+        }
+    }
+
+    return qty;
+}
+
 //#########################################################################
 void OrderBook::insertOrder(Order& order) {
+    OBM_STAGE(INSERT);
+
     // Get the correct book side
     auto& book = (order.getOrderSide() == OrderSide::BUY) ? buyOrders : sellOrders;
 
     // Get the orders associated with the order price
-    // If no orders, create a new list for the price level
-    if (book.find(order.getOrderPrice()) != book.end()) {
-        auto& priceOrders = book.at(order.getOrderPrice());
-        priceOrders.push_back(order);
-
-        // Save the iterator to the newly inserted order
-        auto iterator = std::prev(priceOrders.end());
-        orderIndex[order.getOrderId()] = {order.getOrderPrice(), iterator};
+    // If no orders, create a new (pooled) list for the price level
+    auto level = book.find(order.getOrderPrice());
+    if (level == book.end()) {
+        level = book.emplace(order.getOrderPrice(), OrderList(OrderList::allocator_type(orderPool))).first;
     }
-    else {
-        // Create the new price level
-        book.insert({order.getOrderPrice(), {order}});
 
-        // Save the iterator to the newly inserted order
-        auto iterator = std::prev(book[order.getOrderPrice()].end());
+    OrderList& priceOrders = level->second;
+    priceOrders.push_back(order);
 
-        orderIndex[order.getOrderId()] = {order.getOrderPrice(), iterator};
-    }
+    // Save the iterator to the newly inserted order
+    auto iterator = std::prev(priceOrders.end());
+    orderIndex[order.getOrderId()] = {order.getOrderPrice(), iterator};
+
+    publishLevel(order.getOrderSide(), order.getOrderPrice());
 }
 
 //#########################################################################
@@ -299,9 +621,95 @@ void OrderBook::removeOrder(Order& order) {
 
         // Remove the order ID
         orderIndex.erase(index);
+
+        publishLevel(order.getOrderSide(), price);
     }
 }
 
+//#########################################################################
+void OrderBook::publishLevel(OrderSide side, double price) {
+    if (listeners.empty()) return;
+
+    BookLevelEvent event{exchangeSymbol.c_str(), side, price, 0, 0, utils::generateMSTimestamp()};
+
+    // Aggregate the resting orders at the level (empty if the level was removed)
+    auto& book = (side == OrderSide::BUY) ? buyOrders : sellOrders;
+    auto levelItr = book.find(price);
+
+    if (levelItr != book.end()) {
+        for (const Order& restingOrder : levelItr->second) {
+            event.qty += restingOrder.getOrderRemainingQty();
+            event.orderCount++;
+        }
+    }
+
+    for (OrderBookListener* listener : listeners) {
+        listener->onBookUpdate(event);
+    }
+}
+
+//#########################################################################
+void OrderBook::publishTrade(Trade& trade, OrderSide aggressorSide) {
+    if (listeners.empty()) return;
+
+    TradeEvent event{exchangeSymbol.c_str(), aggressorSide, trade.getPrice(), trade.getQty(), trade.getTimestamp()};
+
+    for (OrderBookListener* listener : listeners) {
+        listener->onTrade(event);
+    }
+}
+
+//#########################################################################
+void OrderBook::publishExecution(const Order& order, ExecutionType type, double price, int qty, int leavesQty) {
+    if (listeners.empty()) return;
+
+    ExecutionEvent event{
+        exchangeSymbol.c_str(),
+        order.getOrderId().c_str(),
+        type,
+        order.getOrderSide(),
+        price,
+        qty,
+        leavesQty,
+        utils::generateMSTimestamp()
+    };
+
+    for (OrderBookListener* listener : listeners) {
+        listener->onExecution(event);
+    }
+}
+
+//#########################################################################
+void OrderBook::reset(const std::string& t_exchangeSymbol) {
+    std::vector<double> bidPrices;
+    std::vector<double> askPrices;
+
+    for (const auto& level : buyOrders) bidPrices.push_back(level.first);
+    for (const auto& level : sellOrders) askPrices.push_back(level.first);
+
+    // Every resting order is dropped without a fill
+    for (auto* book : {&buyOrders, &sellOrders}) {
+        for (const auto& level : *book) {
+            for (const Order& restingOrder : level.second) {
+                publishExecution(restingOrder, ExecutionType::CANCEL, 0, restingOrder.getOrderRemainingQty(), 0);
+            }
+        }
+    }
+
+    buyOrders.clear();
+    sellOrders.clear();
+    orderIndex.clear();
+    orderHistory.clear();
+    tradeHistory.clear();
+
+    // Publish the removal of every level under the old symbol, so listeners
+    // do not keep the dropped orders in their image of the book
+    for (double price : bidPrices) publishLevel(OrderSide::BUY, price);
+    for (double price : askPrices) publishLevel(OrderSide::SELL, price);
+
+    exchangeSymbol = t_exchangeSymbol;
+}
+
 //#########################################################################
 std::string OrderBook::getOrderBookExchangeSymbol() {
     return exchangeSymbol;
@@ -309,20 +717,131 @@ std::string OrderBook::getOrderBookExchangeSymbol() {
 
 //#########################################################################
 std::vector<Trade> OrderBook::getTradeHistory() {
-    return tradeHistory;
+    return tradeHistory.toVector();
 }
 
 //#########################################################################
 std::vector<std::pair<OrderStatus, Order>> OrderBook::getOrderBookHistory() {
-    return orderHistory;
+    return orderHistory.toVector();
+}
+
+//#########################################################################
+HistoryLog<Trade>::View OrderBook::getTradeHistoryView() const {
+    return tradeHistory.view();
+}
+
+//#########################################################################
+HistoryLog<std::pair<OrderStatus, Order>>::View OrderBook::getOrderHistoryView() const {
+    return orderHistory.view();
+}
+
+//#########################################################################
+void OrderBook::getOpenOrders(std::vector<QueryOrder>& orders) const {
+    orders.clear();
+    orders.reserve(orderIndex.size());
+
+    auto append = [&orders](const Order& order) {
+        orders.push_back(QueryOrder{
+            order.getOrderId(),
+            OrderStatus::CREATE,
+            order.getOrderSide(),
+            order.getOrderType(),
+            order.getOrderPrice(),
+            order.getOrderQty(),
+            order.getOrderRemainingQty(),
+            order.getOrderTimestamp()
+        });
+    };
+
+    // Bids best (highest) to worst, then asks best (lowest) to worst; time priority within a level
+    for (auto level = buyOrders.rbegin(); level != buyOrders.rend(); ++level) {
+        for (const Order& order : level->second) append(order);
+    }
+
+    for (const auto& level : sellOrders) {
+        for (const Order& order : level.second) append(order);
+    }
+}
+
+//#########################################################################
+double OrderBook::getBestBidPrice() const {
+    return buyOrders.empty() ? 0.0 : buyOrders.rbegin()->first;
+}
+
+//#########################################################################
+double OrderBook::getBestAskPrice() const {
+    return sellOrders.empty() ? 0.0 : sellOrders.begin()->first;
 }
 
 //#########################################################################
 std::map<double, std::list<Order>> OrderBook::getActiveBuyOrders() {
-    return buyOrders;
+    std::map<double, std::list<Order>> orders;
+    for (const auto& [price, priceOrders] : buyOrders) {
+        orders.emplace(price, std::list<Order>(priceOrders.begin(), priceOrders.end()));
+    }
+    return orders;
 }
 
 //#########################################################################
 std::map<double, std::list<Order>> OrderBook::getActiveSellOrders() {
-    return sellOrders;
-}
\ No newline at end of file
+    std::map<double, std::list<Order>> orders;
+    for (const auto& [price, priceOrders] : sellOrders) {
+        orders.emplace(price, std::list<Order>(priceOrders.begin(), priceOrders.end()));
+    }
+    return orders;
+}
+
+//#########################################################################
+BookMemoryStats OrderBook::getMemoryStats() const {
+    BookMemoryStats stats;
+
+    stats.levels = levelPool->getStats();
+    stats.orders = orderPool->getStats();
+    stats.index = indexPool->getStats();
+    stats.orderHistoryBytes = orderHistory.capacity() * sizeof(std::pair<OrderStatus, Order>);
+    stats.tradeHistoryBytes = tradeHistory.capacity() * sizeof(Trade);
+    stats.priceLevels = buyOrders.size() + sellOrders.size();
+    stats.restingOrders = orderIndex.size();
+    stats.creates = createAllocations;
+    stats.modifies = modifyAllocations;
+    stats.cancels = cancelAllocations;
+
+    return stats;
+}
+
+//#########################################################################
+void OrderBook::reserveHistory(size_t orders, size_t trades) {
+    orderHistory.reserve(orders);
+    tradeHistory.reserve(trades);
+}
+
+//#########################################################################
+uint64_t OrderBook::poolMisses() const {
+    return levelPool->getStats().heapAllocations + orderPool->getStats().heapAllocations +
+           indexPool->getStats().heapAllocations;
+}
+
+//#########################################################################
+uint64_t OrderBook::historyChunks() const {
+    return (orderHistory.capacity() + tradeHistory.capacity()) / HistoryLog<Trade>::CHUNK_SIZE;
+}
+
+//#########################################################################
+void OrderBook::countOperation(OperationAllocations& counts, uint64_t missesBefore, uint64_t chunksBefore) {
+    counts.operations++;
+    counts.poolMisses += poolMisses() - missesBefore;
+    counts.historyChunks += historyChunks() - chunksBefore;
+}
+
+//#########################################################################
+void OrderBook::addListener(OrderBookListener* listener) {
+    listeners.push_back(listener);
+}
+
+//#########################################################################
+void OrderBook::removeListener(OrderBookListener* listener) {
+    listeners.erase(
+        std::remove(listeners.begin(), listeners.end(), listener),
+        listeners.end()
+    );
+}
@@ -1,110 +1,689 @@
+// Global Includes
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+
 // Project Includes
 #include <OrderBookManager.hpp>
+#include <StageTimers.hpp>
+
+namespace {
+    // Commands routed by the calling transport thread in the current batch,
+    // one vector per engine; submitted together by submitCommands()
+    thread_local std::vector<std::vector<EngineCommand>> engineBatches;
+}
 
 //#########################################################################
 OrderBookManager::OrderBookManager (
     int port,
     std::vector<std::string> symbols,
-    bool logging
+    bool logging,
+    uint32_t engineThreads,
+    uint32_t warmBooks,
+    AdmissionLimits limits,
+    threading::ThreadConfig threads
 ) : logging(logging),
     obmPort(port),
-    BUFFER_SIZE(1024),
-    obmSocket(INVALID_SOCKET) {
+    obmSocket(INVALID_SOCKET),
+    limits(limits),
+    threads(threads),
+    sessions(),
+    pollFds(),
+    nextSessionId(1),
+    wakeupSocket(INVALID_SOCKET),
+    socketCompletions([this]() { if (!this->threads.busyPoll) net::signalWakeup(wakeupSocket); }),
+    completed(),
+    reports(),
+    sessionIndex(),
+    shmTransport(),
+    symbolMutex(),
+    symbolTable(static_cast<uint32_t>(symbols.size() + warmBooks)),
+    orderBooks(symbols.size() + warmBooks),
+    engines(),
+    engineBookCounts(std::max<uint32_t>(engineThreads, 1), 0),
+    marketData(),
+    traces() {
+
+    for (uint32_t engineId = 0; engineId < engineBookCounts.size(); engineId++) {
+        engines.push_back(std::make_unique<MatchingEngine>(
+            engineId,
+            [this](uint32_t symbolId) { releaseSymbol(symbolId); },
+            logging
+        ));
+        engines.back()->setWatermarks(limits.engineHighWatermark, limits.engineLowWatermark);
+        engines.back()->setThreadConfig(threads.placement(threading::ThreadRole::ENGINE, engineId), threads.busyPoll);
+        engines.back()->setBatchWorkers(threads.batchWorkers);
+    }
+
+    if (threads.loggerCpu >= 0) {
+        logger::AsyncLogger::instance().setThreadPlacement(threads.placement(threading::ThreadRole::LOGGER));
+    }
+
+    // Assign each initial symbol a dense ID and recycle the pooled book at that
+    // index; no engine is running yet, so the books are set up directly
+    for (const std::string& symbol : symbols) {
+        if (symbolTable.find(symbol) != SymbolTable::INVALID_ID) continue;
+
+        OrderBookSlot& slot = orderBooks[symbolTable.add(symbol)];
+        slot.book.reset(symbol);
+        slot.state = BookState::ACTIVE;
+        slot.engineId = leastLoadedEngine();
+        engineBookCounts[slot.engineId]++;
+        slot.book.addListener(engines[slot.engineId].get());
+    }
 
-    // Create the Order Book Map
-    for (std::string symbol : symbols) {
-        orderBookMap.emplace(symbol, OrderBook(symbol));
+    for (std::unique_ptr<MatchingEngine>& engine : engines) {
+        engine->start();
     }
 }
 OrderBookManager::~OrderBookManager() {
+    // Finish the queued commands while the transports can still take the
+    // responses, then stop the transports before the engines are destroyed
+    for (std::unique_ptr<MatchingEngine>& engine : engines) {
+        engine->stop();
+    }
+
+    shmTransport.reset();
+    sessions.clear();
     cleanupSocket();
+    engines.clear();
+
+    if (wakeupSocket != INVALID_SOCKET) {
+        net::closeSocket(wakeupSocket);
+    }
+
+    // Detach the publisher's feeds before they are destroyed
+    if (marketData) {
+        for (uint32_t symbolId = 0; symbolId < orderBooks.size(); symbolId++) {
+            orderBooks[symbolId].book.removeListener(marketData->getFeed(symbolId));
+        }
+    }
+    marketData.reset();
 }
 
 //#########################################################################
-OrderResponse OrderBookManager::handleMessage(std::string& buffer) {
-    logMessage(
-        LogLevel::INFO,
-        buffer,
-        true
-    );
+OrderBookSlot* OrderBookManager::findOrderBook(uint32_t symbolId) {
+    if (symbolId < orderBooks.size()) {
+        return &orderBooks[symbolId];
+    }
 
-    return {};
+    return nullptr;
 }
 
 //#########################################################################
-void OrderBookManager::startListener() {
-    logMessage(LogLevel::INFO,
-               "startListener(): Starting OBM listener socket...",
-               logging);
+OrderBookSlot* OrderBookManager::findOrderBook(const std::string& symbol) {
+    return findOrderBook(symbolTable.find(symbol));
+}
 
-    createSocket();
+//#########################################################################
+uint32_t OrderBookManager::leastLoadedEngine() const {
+    auto leastLoaded = std::min_element(engineBookCounts.begin(), engineBookCounts.end());
 
-    while (true) {
-        // Accept client connection
-        SOCKET clientSocket = accept(obmSocket, nullptr, nullptr);
+    return static_cast<uint32_t>(leastLoaded - engineBookCounts.begin());
+}
 
-        if (clientSocket == INVALID_SOCKET) {
-            logMessage(LogLevel::ERR,
-                       "startListener(): failed to accept client connection...",
-                       logging);
+//#########################################################################
+void OrderBookManager::queueCommand(EngineCommand&& command) {
+    if (engineBatches.size() < engines.size()) {
+        engineBatches.resize(engines.size());
+    }
+
+    uint32_t engineId = command.slot->engineId;
+    engineBatches[engineId].push_back(std::move(command));
+}
+
+//#########################################################################
+void OrderBookManager::submitCommands() {
+    for (size_t engineId = 0; engineId < engineBatches.size(); engineId++) {
+        engines[engineId]->submit(engineBatches[engineId]);
+    }
+}
+
+//#########################################################################
+void OrderBookManager::releaseSymbol(uint32_t symbolId) {
+    std::unique_lock<std::shared_mutex> lock(symbolMutex);
+
+    engineBookCounts[orderBooks[symbolId].engineId]--;
+    symbolTable.release(symbolId);
+}
+
+//#########################################################################
+void OrderBookManager::closeSession(uint32_t sessionId) {
+    std::shared_lock<std::shared_mutex> lock(symbolMutex);
+
+    for (uint32_t symbolId = 0; symbolId < symbolTable.size(); symbolId++) {
+        if (symbolTable.getSymbol(symbolId).empty()) continue;
+
+        queueCommand(EngineCommand{symbolId, &orderBooks[symbolId], ResponseRoute{nullptr, nullptr, 0, trace::RequestTrace()},
+                                   SessionClose{sessionId}});
+    }
+
+    submitCommands();
+}
+
+//#########################################################################
+bool OrderBookManager::admitRequest(Session& session, MessageType type, int64_t now) {
+    if (limits.maxOutstanding != 0 && session.getOutstandingRequests() > limits.maxOutstanding) {
+        return false;
+    }
+
+    // Modifies and cancels are still admitted, so a session at the limit can reduce its orders
+    if (type == MessageType::ORDER_REQUEST && limits.maxOpenOrders != 0 &&
+        session.getOpenOrders() >= limits.maxOpenOrders) {
+        return false;
+    }
+
+    return session.getMessageBucket().tryConsume(limits.messageRate, limits.messageBurst, now);
+}
+
+//#########################################################################
+bool OrderBookManager::admitsReads(const Session& session) const {
+    if (limits.maxOutstanding != 0 && session.getOutstandingRequests() >= limits.maxOutstanding) {
+        return false;
+    }
+
+    return !enginesOverloaded();
+}
+
+//#########################################################################
+bool OrderBookManager::enginesOverloaded() const {
+    for (const std::unique_ptr<MatchingEngine>& engine : engines) {
+        if (engine->isOverloaded()) return true;
+    }
+
+    return false;
+}
+
+//#########################################################################
+void OrderBookManager::dispatchMessage(const protocol::Frame& frame, const ResponseRoute& route) {
+    OrderResponse response{"-1", ErrorCode::BAD_REQUEST};
+    EngineCommand command{SymbolTable::INVALID_ID, nullptr, route, OrderRequest{}};
+    const std::string* symbol = nullptr;
+
+    switch (frame.type) {
+        case MessageType::ORDER_REQUEST: {
+            OBM_STAGE(DECODE);
+            OrderRequest request;
+
+            if (protocol::deserialize(frame, request)) {
+                command.message = std::move(request);
+                symbol = &std::get<OrderRequest>(command.message).symbol;
+            }
+            break;
+        }
+        case MessageType::ORDER_MODIFY: {
+            OBM_STAGE(DECODE);
+            OrderModify request;
+
+            if (protocol::deserialize(frame, request)) {
+                command.message = std::move(request);
+                symbol = &std::get<OrderModify>(command.message).symbol;
+            }
+            break;
+        }
+        case MessageType::ORDER_CANCEL: {
+            OBM_STAGE(DECODE);
+            OrderCancel request;
+
+            if (protocol::deserialize(frame, request)) {
+                command.message = std::move(request);
+                symbol = &std::get<OrderCancel>(command.message).symbol;
+            }
+            break;
+        }
+        case MessageType::QUERY_REQUEST: {
+            OBM_STAGE(DECODE);
+            QueryRequest request;
+
+            if (protocol::deserialize(frame, request)) {
+                command.message = std::move(request);
+                symbol = &std::get<QueryRequest>(command.message).symbol;
+            }
+            break;
+        }
+        default:
+            break;
+    }
+
+    if (symbol != nullptr) {
+        OBM_STAGE(ROUTE);
+        command.symbolId = symbolTable.find(*symbol);
+        command.slot = findOrderBook(command.symbolId);
+        command.route.trace.symbolId = command.symbolId;
+
+        if (command.slot && engines[command.slot->engineId]->isOverloaded()) {
+            response.errCode = ErrorCode::THROTTLED;
+        }
+        else if (command.slot) {
+            queueCommand(std::move(command));
+            return;
         }
-        // Client socket connected
         else {
-            logMessage(LogLevel::INFO,
-                       "startListener(): Client socket connected.",
-                       logging);
+            response.errCode = ErrorCode::BAD_SYMBOL;
+        }
+    }
 
-            // Read string from the socket
-            char rcvBuffer[BUFFER_SIZE];
-            int bytesRcv = recv(clientSocket, rcvBuffer, sizeof(rcvBuffer), 0);
+    // Rejected before reaching an engine; answer directly (a query with an empty result)
+    if (const QueryRequest* query = std::get_if<QueryRequest>(&command.message)) {
+        route.session->completeRequest(route.seq, response, std::make_shared<QueryResult>(*query, response.errCode),
+                                       route.trace);
+        return;
+    }
 
-            if (bytesRcv > 0) {
-                std::string buffer(rcvBuffer, bytesRcv);
+    route.session->completeRequest(route.seq, response, nullptr, route.trace);
+}
 
-                // Handle the order request message
-                OrderResponse response = handleMessage(buffer);
+//#########################################################################
+void OrderBookManager::dispatchAdmin(const protocol::Frame& frame, const ResponseRoute& route) {
+    AdminRequest request;
+
+    if (!protocol::deserialize(frame, request) || request.symbol.empty()) {
+        route.session->completeRequest(route.seq, OrderResponse{"-1", ErrorCode::BAD_REQUEST}, nullptr, route.trace);
+        return;
+    }
 
-                // Write the response to the socket
-                std::string responseBuffer = serialize(response);
-                send(clientSocket, responseBuffer.data(), static_cast<int>(responseBuffer.size()), 0);
+    OrderResponse response{request.symbol, ErrorCode::OK};
+    uint32_t symbolId = SymbolTable::INVALID_ID;
 
-                logMessage(LogLevel::INFO,
-                           "startListener(): Sent OrderResponse to client.",
-                           logging);
+    switch (request.action) {
+        case AdminAction::ADD_SYMBOL:
+            if (symbolTable.find(request.symbol) != SymbolTable::INVALID_ID) {
+                response.errCode = ErrorCode::SYMBOL_EXISTS;
+                break;
             }
-            else {
-                logMessage(LogLevel::INFO,
-                           "startListener(): Failed to read buffer from socket...",
-                           logging);
+
+            // Take a book from the warm pool and give it to the least loaded engine
+            symbolId = symbolTable.add(request.symbol);
+            if (symbolId == SymbolTable::INVALID_ID) {
+                response.errCode = ErrorCode::NO_CAPACITY;
+                break;
+            }
+
+            orderBooks[symbolId].engineId = leastLoadedEngine();
+            engineBookCounts[orderBooks[symbolId].engineId]++;
+
+            if (marketData) {
+                marketData->addSymbol(symbolId, request.symbol);
+            }
+            break;
+        case AdminAction::HALT_SYMBOL:
+        case AdminAction::RESUME_SYMBOL:
+            symbolId = symbolTable.find(request.symbol);
+            if (symbolId == SymbolTable::INVALID_ID) {
+                response.errCode = ErrorCode::BAD_SYMBOL;
+            }
+            break;
+        case AdminAction::REMOVE_SYMBOL:
+            // New requests are rejected from now on; the ID is released by the
+            // engine once the requests already queued for the book are done
+            symbolId = symbolTable.remove(request.symbol);
+            if (symbolId == SymbolTable::INVALID_ID) {
+                response.errCode = ErrorCode::BAD_SYMBOL;
+            }
+            break;
+        default:
+            response.errCode = ErrorCode::BAD_REQUEST;
+            break;
+    }
+
+    if (response.errCode != ErrorCode::OK) {
+        route.session->completeRequest(route.seq, response, nullptr, route.trace);
+        return;
+    }
+
+    // The book itself is changed by its engine, in order with its orders
+    queueCommand(EngineCommand{symbolId, &orderBooks[symbolId], route, request});
+}
+
+//#########################################################################
+void OrderBookManager::processFrames(Session& session, CompletionQueue& completions) {
+    protocol::Frame frame;
+    int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+
+    std::shared_lock<std::shared_mutex> lock(symbolMutex);
+
+    // Handle every complete frame in the receive buffer as one batch
+    while (session.nextFrame(frame)) {
+        ResponseRoute route{&completions, &session, session.beginRequest(), trace::RequestTrace()};
+        if (traces.sample()) route.trace = traces.begin(frame.type, now);
+
+        if (frame.type == MessageType::ADMIN_REQUEST) {
+            // Commands routed under the shared lock are submitted before the
+            // symbol table changes, so a released ID never has stale commands
+            submitCommands();
+            lock.unlock();
+
+            {
+                std::unique_lock<std::shared_mutex> adminLock(symbolMutex);
+                dispatchAdmin(frame, route);
+                submitCommands();
+            }
+
+            lock.lock();
+            continue;
+        }
+
+        // Flow control is applied before the request reaches an engine queue
+        if (!admitRequest(session, frame.type, now)) {
+            session.completeRequest(route.seq, OrderResponse{"-1", ErrorCode::THROTTLED}, nullptr, route.trace);
+            continue;
+        }
+
+        dispatchMessage(frame, route);
+    }
+
+    submitCommands();
+    lock.unlock();
+
+    session.compactReceiveBuffer();
+}
+
+//#########################################################################
+void OrderBookManager::drainCompletions() {
+    if (socketCompletions.empty()) return;
+
+    socketCompletions.drain(completed, reports);
+
+    for (Completion& completion : completed) {
+        completion.session->completeRequest(completion.seq, completion.response, std::move(completion.query), completion.trace);
+    }
+
+    // Reports of sessions that disconnected are dropped
+    for (const RoutedReport& routed : reports) {
+        auto session = sessionIndex.find(routed.sessionId);
+
+        if (session != sessionIndex.end()) {
+            session->second->deliverReport(routed.report);
+        }
+    }
+}
+
+//#########################################################################
+void OrderBookManager::acceptClients() {
+    while (true) {
+        SOCKET clientSocket = accept(obmSocket, nullptr, nullptr);
+
+        if (clientSocket == INVALID_SOCKET) {
+            if (!net::wouldBlock()) {
+                logEvent<LogLevel::ERR>(logging,
+                                        "acceptClients(): failed to accept client connection...");
             }
+            return;
+        }
+
+        net::setNonBlocking(clientSocket);
+        net::setNoDelay(clientSocket);
+
+        sessions.push_back(std::make_unique<SocketSession>(clientSocket, nextSessionId++));
+        sessionIndex[sessions.back()->getSessionId()] = sessions.back().get();
+
+        logEvent<LogLevel::INFO>(logging,
+                                 "acceptClients(): Client socket connected. Session={}",
+                                 sessions.back()->getSessionId());
+    }
+}
+
+//#########################################################################
+bool OrderBookManager::startSharedMemoryTransport(
+    const std::string& name,
+    uint32_t slotCount,
+    shm::WaitMode waitMode
+) {
+    constexpr uint64_t ringCapacity = 1 << 20; // 1 MiB per ring
+
+    shmTransport = std::make_unique<ShmTransport>(
+        name,
+        slotCount,
+        ringCapacity,
+        waitMode,
+        [this](Session& session, CompletionQueue& completions) { processFrames(session, completions); },
+        [this](const Session& session) { return admitsReads(session); },
+        [this](uint32_t sessionId) { closeSession(sessionId); },
+        nextSessionId,
+        logging
+    );
+    shmTransport->setThreadPlacement(threads.placement(threading::ThreadRole::SHARED_MEMORY));
+
+    if (!shmTransport->start()) {
+        shmTransport.reset();
+        return false;
+    }
+
+    return true;
+}
+
+//#########################################################################
+void OrderBookManager::startTracing(uint32_t sampleEvery, const std::string& path) {
+    traces.setSampleEvery(sampleEvery);
+    if (sampleEvery > 0) traces.dumpOnSignal(path);
+}
+
+//#########################################################################
+const trace::TraceBuffer& OrderBookManager::getTraces() const {
+    return traces;
+}
+
+//#########################################################################
+bool OrderBookManager::addStrategy(const std::string& symbol, Strategy& strategy) {
+    OrderBookSlot* slot = findOrderBook(symbol);
+    if (!slot || slot->state == BookState::FREE) return false;
+
+    engines[slot->engineId]->addStrategy(slot, strategy);
+
+    return true;
+}
+
+//#########################################################################
+bool OrderBookManager::startMarketDataPublisher(
+    const std::string& multicastGroup,
+    int multicastPort,
+    const std::string& multicastInterface,
+    int snapshotPort
+) {
+    constexpr int flushIntervalMs = 1; // Batching delay of the update feed
+
+    marketData = std::make_unique<MarketDataPublisher>(
+        multicastGroup,
+        multicastPort,
+        multicastInterface,
+        snapshotPort,
+        flushIntervalMs,
+        static_cast<uint32_t>(orderBooks.size()),
+        logging
+    );
+    marketData->setThreadPlacement(threads.placement(threading::ThreadRole::MARKET_DATA));
+
+    for (uint32_t symbolId = 0; symbolId < symbolTable.size(); symbolId++) {
+        if (!symbolTable.getSymbol(symbolId).empty()) {
+            marketData->addSymbol(symbolId, symbolTable.getSymbol(symbolId));
         }
     }
 
+    if (!marketData->start()) {
+        marketData.reset();
+        return false;
+    }
+
+    // Every pooled book publishes to its own feed, so symbols added at runtime are covered
+    for (uint32_t symbolId = 0; symbolId < orderBooks.size(); symbolId++) {
+        orderBooks[symbolId].book.addListener(marketData->getFeed(symbolId));
+    }
+
+    return true;
+}
+
+//#########################################################################
+void OrderBookManager::startListener(net::IoBackend backend) {
+    logEvent<LogLevel::INFO>(logging,
+                             "startListener(): Starting OBM listener socket...");
+
+    createSocket();
+
+    // The event loop runs on the calling thread
+    stages::setThreadName("network");
+    threading::ThreadPlacement placement = threads.placement(threading::ThreadRole::NETWORK);
+    if (!threading::applyPlacement(placement)) {
+        logEvent<LogLevel::WARN>(logging,
+                                 "startListener(): Listener could not be placed on CPU={}, priority={}",
+                                 placement.cpu, placement.priority);
+    }
+
+    if (backend == net::IoBackend::IO_URING) {
+        UringTransport uring(
+            obmSocket,
+            [this](Session& session, CompletionQueue& completions) { processFrames(session, completions); },
+            [this](const Session& session) { return admitsReads(session); },
+            [this](uint32_t sessionId) { closeSession(sessionId); },
+            nextSessionId,
+            logging
+        );
+        uring.setBusyPoll(threads.busyPoll);
+
+        if (uring.start()) {
+            uring.run();
+            cleanupSocket();
+            return;
+        }
+
+        logEvent<LogLevel::WARN>(logging,
+                                 "startListener(): io_uring not available, using the poll backend");
+    }
+
+    runPollLoop();
+
     cleanupSocket();
 }
 
 //#########################################################################
-int OrderBookManager::createSocket() {
-    logMessage(LogLevel::INFO,
-               "createSocket(): Creating OBM lsitener socket...",
-               logging);
+void OrderBookManager::runPollLoop() {
+    // Engines signal the wakeup socket when responses for the sessions complete
+    wakeupSocket = net::createWakeupSocket();
+    if (wakeupSocket == INVALID_SOCKET) {
+        throw std::runtime_error("[ERROR] runPollLoop(): Error creating the wakeup socket...");
+    }
+
+    while (true) {
+        // Listener and wakeup socket first, then one descriptor per session
+        pollFds.resize(sessions.size() + 2);
+        pollFds[0].fd      = obmSocket;
+        pollFds[0].events  = POLLIN;
+        pollFds[0].revents = 0;
+        pollFds[1].fd      = wakeupSocket;
+        pollFds[1].events  = POLLIN;
+        pollFds[1].revents = 0;
+
+        bool readsPaused = false;
+
+        for (size_t i = 0; i < sessions.size(); i++) {
+            const SocketSession& session = *sessions[i];
+
+            // Sessions that are only waiting for responses from the engines are not polled
+            bool readable = !session.hasFailed() && !session.hasProtocolError() && !session.isPeerClosed();
+            bool writable = !session.hasFailed() && session.hasPendingOutbound();
+
+            // Flow control; unread requests stay in the socket and back up to the client
+            if (readable && !admitsReads(session)) {
+                readable = false;
+                readsPaused = true;
+            }
+
+            pollFds[i + 2].fd      = (readable || writable) ? session.getSocket() : INVALID_SOCKET;
+            pollFds[i + 2].events  = (readable ? POLLIN : 0) | (writable ? POLLOUT : 0);
+            pollFds[i + 2].revents = 0;
+        }
+
+        // Engines may drain without answering these sessions; check again shortly.
+        // Busy-poll never sleeps in the poll (engines do not signal the wakeup socket)
+        int timeoutMs = threads.busyPoll ? 0 : (readsPaused ? 1 : -1);
+
+        if (net::pollSockets(pollFds.data(), pollFds.size(), timeoutMs) < 0) {
+            logEvent<LogLevel::ERR>(logging,
+                                    "startListener(): poll failed. Error={}", net::lastError());
+            continue;
+        }
+
+        if (pollFds[1].revents & POLLIN) {
+            net::drainWakeup(wakeupSocket);
+        }
 
-    WSADATA wsaData;
-    int wsResult;
+        // Write the responses completed since the last wakeup
+        drainCompletions();
 
-    // Initialize winsock
-    wsResult = WSAStartup(MAKEWORD(2, 2), &wsaData);
-    if (wsResult != 0) {
-        throw std::runtime_error("[ERROR] createSocket(): WSAStartup Failed: " + std::to_string(wsResult));
+        // Sessions accepted in this wakeup are polled from the next iteration
+        size_t polledSessions = sessions.size();
+
+        if (pollFds[0].revents & POLLIN) {
+            acceptClients();
+        }
+
+        for (size_t i = 0; i < polledSessions; i++) {
+            Session& session = *sessions[i];
+            short revents = pollFds[i + 2].revents;
+
+            if (revents & (POLLERR | POLLNVAL)) {
+                session.markFailed();
+            }
+
+            // Read everything available, then handle all complete frames as a batch
+            if (!session.hasFailed() && !session.isPeerClosed() && (revents & (POLLIN | POLLHUP))) {
+                if (session.readAvailable() >= 0) {
+                    processFrames(session, socketCompletions);
+                }
+                else {
+                    session.markFailed();
+                }
+            }
+
+            // One vectored send per session per wakeup
+            if (!session.hasFailed() && !session.flush()) {
+                session.markFailed();
+            }
+
+            bool finished = session.hasFailed() || session.hasProtocolError() ||
+                            (session.isPeerClosed() && !session.hasPendingOutbound());
+
+            // Engines may still hold requests of the session; keep it until they complete
+            if (finished && !session.hasOutstandingRequests()) {
+                logEvent<LogLevel::INFO>(logging,
+                                         "startListener(): Closing session={}", session.getSessionId());
+
+                sessionIndex.erase(session.getSessionId());
+                closeSession(session.getSessionId());
+                sessions[i].reset();
+            }
+        }
+
+        // Remove the closed sessions
+        sessions.erase(
+            std::remove(sessions.begin(), sessions.end(), nullptr),
+            sessions.end()
+        );
+    }
+}
+
+//#########################################################################
+int OrderBookManager::createSocket() {
+    logEvent<LogLevel::INFO>(logging,
+                             "createSocket(): Creating OBM lsitener socket...");
+
+    // Initialize the socket library
+    if (!net::startup()) {
+        throw std::runtime_error("[ERROR] createSocket(): Socket startup Failed: " + std::to_string(net::lastError()));
     }
 
     // Create the OBM socket
     obmSocket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
     if (obmSocket == INVALID_SOCKET) {
-        WSACleanup();
+        net::cleanup();
         throw std::runtime_error("[ERROR] createSocket(): Error creating OBM Socket...");
     }
 
+    // Allow quick restarts on the same port
+    int reuse = 1;
+    setsockopt(obmSocket, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&reuse), sizeof(reuse));
+
     sockaddr_in service;
     service.sin_family = AF_INET;
     service.sin_addr.s_addr = INADDR_ANY;
@@ -113,10 +692,9 @@ int OrderBookManager::createSocket() {
     // Log socket information (IP address and port)
     std::string ipString = inet_ntoa(service.sin_addr);
 
-    logMessage(LogLevel::DEBUG,
-               "createSocket(): Binding OBM socket to IP=" + ipString +
-               ", Port=" + std::to_string(ntohs(service.sin_port)),
-               logging);
+    logEvent<LogLevel::DEBUG>(logging,
+                              "createSocket(): Binding OBM socket to IP={}, Port={}",
+                              ipString, ntohs(service.sin_port));
 
     // Bind the OBM socket
     if (bind(obmSocket, (SOCKADDR*)&service, sizeof(service)) == SOCKET_ERROR) {
@@ -130,88 +708,34 @@ int OrderBookManager::createSocket() {
         throw std::runtime_error("[ERROR] createSocket(): OBM socket listen failed...");
     }
 
-    logMessage(LogLevel::INFO,
-               "createSocket(): OBM socket created. Listening on port=" + std::to_string(obmPort),
-               logging);
+    // Connections are multiplexed on one thread; the listener must not block
+    net::setNonBlocking(obmSocket);
+
+    logEvent<LogLevel::INFO>(logging,
+                             "createSocket(): OBM socket created. Listening on port={}", obmPort);
 
     return 1; // Socket created
 }
 
 //#########################################################################
 int OrderBookManager::cleanupSocket() {
-    logMessage(LogLevel::INFO,
-               "cleanupSocket(): Closing OBM lsitener socket...",
-               logging);
+    logEvent<LogLevel::INFO>(logging,
+                             "cleanupSocket(): Closing OBM lsitener socket...");
 
     // Close the socket if there is an existing valid socket
     if (obmSocket != INVALID_SOCKET) {
-        closesocket(obmSocket);
-        WSACleanup();
+        net::closeSocket(obmSocket);
+        net::cleanup();
         obmSocket = INVALID_SOCKET;
 
-        logMessage(LogLevel::INFO,
-               "cleanupSocket(): OBM socket closed.",
-               logging);
+        logEvent<LogLevel::INFO>(logging,
+                                 "cleanupSocket(): OBM socket closed.");
 
         return 1; // Socket closed
     }
 
-    logMessage(LogLevel::WARN,
-               "cleanupSocket(): Cannon close INVALID socket...",
-               logging);
+    logEvent<LogLevel::WARN>(logging,
+                             "cleanupSocket(): Cannon close INVALID socket...");
 
     return -1; // No socket to close
 }
-
-//#########################################################################
-std::string OrderBookManager::serialize(const OrderResponse& response) {
-    // Explicitly compute the buffer size
-    constexpr size_t buffSize = sizeof(response.orderId) + sizeof(response.errCode);
-
-    // Create the buffer
-    std::string buffer(buffSize, '\0');
-    size_t offset = 0;
-
-    // Serialize the order response values
-    memcpy(&buffer[offset], &response.orderId, sizeof(response.orderId));
-    offset += sizeof(response.orderId);
-
-    memcpy(&buffer[offset], &response.errCode, sizeof(response.errCode));
-    offset += sizeof(response.errCode);
-
-    return buffer;
-}
-
-//#########################################################################
-OrderRequest OrderBookManager::deserialize(const std::string& buffer) {
-    OrderRequest orderRequest{};
-    size_t offset = 0;
-
-    // Calculate the order request size
-    size_t requestSize = sizeof(orderRequest.symbol) + sizeof(orderRequest.qty) +
-                         sizeof(orderRequest.price) + sizeof(orderRequest.orderSide) +
-                         sizeof(orderRequest.orderType);
-
-    // Check the buffer size
-    if (buffer.size() < requestSize) {
-        throw std::runtime_error("[ERROR] deserialize(): Cannot dezerialize {OrderRequest}...");
-    }
-
-    // Deserialize the buffer into an order request
-    memcpy(&orderRequest.symbol, &buffer[offset], sizeof(orderRequest.symbol));
-    offset += sizeof(orderRequest.symbol);
-
-    memcpy(&orderRequest.qty, &buffer[offset], sizeof(orderRequest.qty));
-    offset += sizeof(orderRequest.qty);
-
-    memcpy(&orderRequest.price, &buffer[offset], sizeof(orderRequest.price));
-    offset += sizeof(orderRequest.price);
-
-    memcpy(&orderRequest.orderSide, &buffer[offset], sizeof(orderRequest.orderSide));
-    offset += sizeof(orderRequest.orderSide);
-
-    memcpy(&orderRequest.orderType, &buffer[offset], sizeof(orderRequest.orderType));
-    offset += sizeof(orderRequest.orderType);
-
-    return orderRequest;
-}
\ No newline at end of file
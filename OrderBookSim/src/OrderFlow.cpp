@@ -0,0 +1,242 @@
+// Global Includes
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+// Project Includes
+#include <OrderFlow.hpp>
+
+namespace {
+    /**
+     * @brief Advance a splitmix64 state and return its next output. Used to
+     * expand a seed into full generator states.
+     *
+     * @param state - splitmix64 state
+     *
+     * @return uint64_t - next output
+     */
+    uint64_t splitMix64(uint64_t& state) {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    /**
+     * @brief Rotate a 64-bit value left.
+     *
+     * @param value - value to rotate
+     * @param bits - number of bits to rotate by (1-63)
+     *
+     * @return uint64_t - rotated value
+     */
+    inline uint64_t rotateLeft(uint64_t value, int bits) {
+        return (value << bits) | (value >> (64 - bits));
+    }
+
+    /**
+     * @brief Turn 64 random bits into a uniform double in [0, 1) by filling
+     * the mantissa of a number in [1, 2).
+     *
+     * @param bits - random bits
+     *
+     * @return double - uniform number (52 random bits)
+     */
+    inline double bitsToUniform(uint64_t bits) {
+        uint64_t mantissa = (bits >> 12) | 0x3FF0000000000000ULL;
+        double value;
+        std::memcpy(&value, &mantissa, sizeof(value));
+        return value - 1.0;
+    }
+}
+
+//#########################################################################
+BlockRandom::BlockRandom(uint64_t seed, uint64_t streamId) {
+    uint64_t mix = seed;
+    uint64_t expand = splitMix64(mix) ^ (streamId * 0xD1342543DE82EF95ULL);
+
+    for (size_t lane = 0; lane < LANES; lane++) {
+        s0[lane] = splitMix64(expand);
+        s1[lane] = splitMix64(expand);
+        s2[lane] = splitMix64(expand);
+        s3[lane] = splitMix64(expand);
+    }
+}
+
+//#########################################################################
+void BlockRandom::fillUniform(double* out, size_t count) {
+    size_t index = 0;
+
+    while (index < count) {
+        double group[LANES];
+
+        // Same steps on every lane; no dependency between lanes
+        for (size_t lane = 0; lane < LANES; lane++) {
+            uint64_t result = rotateLeft(s1[lane] * 5, 7) * 9;
+            uint64_t shifted = s1[lane] << 17;
+
+            s2[lane] ^= s0[lane];
+            s3[lane] ^= s1[lane];
+            s1[lane] ^= s2[lane];
+            s0[lane] ^= s3[lane];
+            s2[lane] ^= shifted;
+            s3[lane] = rotateLeft(s3[lane], 45);
+
+            group[lane] = bitsToUniform(result);
+        }
+
+        size_t take = std::min(LANES, count - index);
+        std::memcpy(out + index, group, take * sizeof(double));
+        index += take;
+    }
+}
+
+//#########################################################################
+OrderFlowGenerator::OrderFlowGenerator (
+    const OrderFlowParams& params,
+    uint64_t seed,
+    uint64_t streamId
+) : params(params),
+    random(seed, streamId),
+    timeSeconds(0.0),
+    intensity(params.arrivals.rate),
+    limitShare(1.0),
+    marketShare(1.0),
+    uniforms(),
+    buffer(),
+    bufferIndex(BLOCK) {
+    double total = std::max(params.limitWeight, 0.0) + std::max(params.marketWeight, 0.0) +
+                   std::max(params.cancelWeight, 0.0);
+    if (total > 0) {
+        limitShare = std::max(params.limitWeight, 0.0) / total;
+        marketShare = limitShare + std::max(params.marketWeight, 0.0) / total;
+    }
+}
+
+//#########################################################################
+void OrderFlowGenerator::generate(OrderFlowEvent* out, size_t count) {
+    // Column per use; every column of a block is filled in one pass
+    double* arrivalA = uniforms;
+    double* arrivalB = uniforms + BLOCK;
+    double* typeDraw = uniforms + 2 * BLOCK;
+    double* sideDraw = uniforms + 3 * BLOCK;
+    double* offsetDraw = uniforms + 4 * BLOCK;
+    double* qtyDraw = uniforms + 5 * BLOCK;
+
+    const ArrivalParams& arrivals = params.arrivals;
+    double rate = arrivals.rate > 0 ? arrivals.rate : 1.0;
+    double qtyRange = static_cast<double>(std::max(params.maxQty - params.minQty, 0) + 1);
+    double offsetRange = static_cast<double>(std::max(params.maxOffsetTicks - params.minOffsetTicks, 0) + 1);
+    int offsetCap = std::max(params.maxOffsetTicks - params.minOffsetTicks, 0);
+
+    // EXPONENTIAL: geometric offsets of the given mean, drawn by inversion
+    double logKeep = params.meanOffsetTicks > 0
+                   ? std::log(params.meanOffsetTicks / (1.0 + params.meanOffsetTicks))
+                   : -std::numeric_limits<double>::infinity();
+
+    while (count > 0) {
+        size_t block = std::min(count, BLOCK);
+        random.fillUniform(uniforms, BLOCK * 6);
+
+        // Arrival times
+        if (arrivals.model == ArrivalModel::HAWKES && arrivals.excitation > 0 && arrivals.decay > 0) {
+            double excitation = arrivals.excitation;
+            double decay = arrivals.decay;
+
+            for (size_t i = 0; i < block; i++) {
+                // Next excited arrival (if the excess intensity ever produces one)
+                double excess = intensity - rate;
+                double gap = std::numeric_limits<double>::infinity();
+                if (excess > 0) {
+                    double d = 1.0 + decay * std::log(1.0 - arrivalA[i]) / excess;
+                    if (d > 0) gap = -std::log(d) / decay;
+                }
+
+                // Next baseline arrival
+                gap = std::min(gap, -std::log(1.0 - arrivalB[i]) / rate);
+
+                timeSeconds += gap;
+                intensity = excess * std::exp(-decay * gap) + rate + excitation;
+                out[i].timeNs = std::llround(timeSeconds * 1e9);
+            }
+        }
+        else {
+            for (size_t i = 0; i < block; i++) {
+                arrivalA[i] = -std::log(1.0 - arrivalA[i]) / rate;
+            }
+            for (size_t i = 0; i < block; i++) {
+                timeSeconds += arrivalA[i];
+                out[i].timeNs = std::llround(timeSeconds * 1e9);
+            }
+        }
+
+        // Event mix, sides, quantities and offsets; no data dependent branches
+        for (size_t i = 0; i < block; i++) {
+            out[i].type = typeDraw[i] < limitShare ? FlowEventType::LIMIT
+                        : typeDraw[i] < marketShare ? FlowEventType::MARKET
+                        : FlowEventType::CANCEL;
+            out[i].side = sideDraw[i] < params.buyProbability ? OrderSide::BUY : OrderSide::SELL;
+            out[i].qty = params.minQty + static_cast<int32_t>(qtyDraw[i] * qtyRange);
+            out[i].pick = offsetDraw[i];
+        }
+
+        if (params.priceDistribution == PriceDistribution::EXPONENTIAL) {
+            for (size_t i = 0; i < block; i++) {
+                double ticks = std::floor(std::log(1.0 - offsetDraw[i]) / logKeep);
+                out[i].offsetTicks = params.minOffsetTicks + static_cast<int32_t>(std::min(ticks, static_cast<double>(offsetCap)));
+            }
+        }
+        else {
+            for (size_t i = 0; i < block; i++) {
+                out[i].offsetTicks = params.minOffsetTicks + static_cast<int32_t>(offsetDraw[i] * offsetRange);
+            }
+        }
+
+        out += block;
+        count -= block;
+    }
+}
+
+//#########################################################################
+const OrderFlowEvent& OrderFlowGenerator::next() {
+    if (bufferIndex == BLOCK) {
+        generate(buffer, BLOCK);
+        bufferIndex = 0;
+    }
+
+    return buffer[bufferIndex++];
+}
+
+//#########################################################################
+double OrderFlowGenerator::resolvePrice(const OrderFlowEvent& event, double bestBid, double bestAsk) const {
+    double tick = params.tickSize;
+    double price = 0;
+
+    // Opposite best price; from the same side (one tick through it) or the reference if empty
+    if (event.side == OrderSide::BUY) {
+        price = bestAsk > 0 ? bestAsk : bestBid > 0 ? bestBid + tick : params.referencePrice;
+        if (event.type == FlowEventType::LIMIT) price -= event.offsetTicks * tick;
+    }
+    else {
+        price = bestBid > 0 ? bestBid : bestAsk > 0 ? bestAsk - tick : params.referencePrice;
+        if (event.type == FlowEventType::LIMIT) price += event.offsetTicks * tick;
+    }
+
+    return std::max<int64_t>(std::llround(price / tick), 1) * tick;
+}
+
+//#########################################################################
+const OrderFlowParams& OrderFlowGenerator::getParams() const {
+    return params;
+}
+
+//#########################################################################
+int64_t OrderFlowGenerator::getTime() const {
+    return std::llround(timeSeconds * 1e9);
+}
+
+//#########################################################################
+double OrderFlowGenerator::getIntensity() const {
+    return intensity;
+}
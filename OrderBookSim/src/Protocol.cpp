@@ -0,0 +1,581 @@
+// Global Includes
+#include <algorithm>
+#include <cstring>
+
+// Project Includes
+#include <Protocol.hpp>
+
+namespace protocol {
+    namespace {
+        /**
+         * @brief Appends a frame to an output buffer. The header is written
+         * first with a zero size and patched once the payload is complete.
+         */
+        class FrameWriter {
+            public:
+                FrameWriter(std::string& out, MessageType type) :
+                    out(out),
+                    start(out.size()) {
+
+                    out.append(HEADER_SIZE, '\0');
+
+                    uint16_t msgType = static_cast<uint16_t>(type);
+                    std::memcpy(&out[start + 4], &msgType, sizeof(msgType));
+                }
+
+                ~FrameWriter() {
+                    uint32_t payloadSize = static_cast<uint32_t>(out.size() - start - HEADER_SIZE);
+                    std::memcpy(&out[start], &payloadSize, sizeof(payloadSize));
+                }
+
+                template <typename T>
+                void write(T value) {
+                    out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+                }
+
+                void writeString(const std::string& value) {
+                    uint16_t length = static_cast<uint16_t>(std::min(value.size(), MAX_STRING_LENGTH));
+                    write(length);
+                    out.append(value.data(), length);
+                }
+
+            private:
+                std::string& out; // Buffer the frame is appended to
+                size_t start;     // Offset of the frame header in the buffer
+        };
+
+        /**
+         * @brief Append a raw value to a buffer (no framing).
+         */
+        template <typename T>
+        void appendValue(std::string& out, T value) {
+            out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+        }
+
+        /**
+         * @brief Reads fields from a frame payload. Any read past the end of
+         * the payload marks the reader as failed.
+         */
+        class PayloadReader {
+            public:
+                explicit PayloadReader(const Frame& frame) :
+                    PayloadReader(frame.payload, frame.payloadSize) {}
+
+                PayloadReader(const char* data, size_t size) :
+                    data(data),
+                    remaining(size),
+                    valid(true) {}
+
+                template <typename T>
+                void read(T& value) {
+                    if (remaining < sizeof(T)) {
+                        valid = false;
+                        return;
+                    }
+
+                    std::memcpy(&value, data, sizeof(T));
+                    data += sizeof(T);
+                    remaining -= sizeof(T);
+                }
+
+                void readString(std::string& value) {
+                    uint16_t length = 0;
+                    read(length);
+
+                    if (!valid || length > remaining || length > MAX_STRING_LENGTH) {
+                        valid = false;
+                        return;
+                    }
+
+                    value.assign(data, length);
+                    data += length;
+                    remaining -= length;
+                }
+
+                /**
+                 * @return bool - true if every field was read and the payload was consumed
+                 */
+                bool complete() const {
+                    return valid && remaining == 0;
+                }
+
+                /**
+                 * @return bool - true if no read has overrun the payload
+                 */
+                bool ok() const {
+                    return valid;
+                }
+
+            private:
+                const char* data; // Next unread payload byte
+                size_t remaining; // Unread payload bytes
+                bool valid;       // False once a read overruns the payload
+        };
+    }
+
+    DecodeStatus decodeFrame(const char* data, size_t size, Frame& frame, size_t& frameSize) {
+        if (size < HEADER_SIZE) {
+            return DecodeStatus::INCOMPLETE;
+        }
+
+        uint32_t payloadSize;
+        uint16_t msgType;
+        uint16_t flags;
+        std::memcpy(&payloadSize, data, sizeof(payloadSize));
+        std::memcpy(&msgType, data + 4, sizeof(msgType));
+        std::memcpy(&flags, data + 6, sizeof(flags));
+
+        if (payloadSize > MAX_PAYLOAD_SIZE) {
+            return DecodeStatus::INVALID;
+        }
+
+        if (size < HEADER_SIZE + payloadSize) {
+            return DecodeStatus::INCOMPLETE;
+        }
+
+        frame.type        = static_cast<MessageType>(msgType);
+        frame.flags       = flags;
+        frame.payload     = data + HEADER_SIZE;
+        frame.payloadSize = payloadSize;
+        frameSize         = HEADER_SIZE + payloadSize;
+
+        return DecodeStatus::COMPLETE;
+    }
+
+    void serialize(const OrderRequest& message, std::string& out) {
+        FrameWriter writer(out, MessageType::ORDER_REQUEST);
+        writer.writeString(message.symbol);
+        writer.write<int32_t>(message.qty);
+        writer.write<double>(message.price);
+        writer.write<uint8_t>(static_cast<uint8_t>(message.orderSide));
+        writer.write<uint8_t>(static_cast<uint8_t>(message.orderType));
+    }
+
+    void serialize(const OrderModify& message, std::string& out) {
+        FrameWriter writer(out, MessageType::ORDER_MODIFY);
+        writer.writeString(message.symbol);
+        writer.writeString(message.orderId);
+        writer.write<int32_t>(message.qty);
+        writer.write<double>(message.price);
+    }
+
+    void serialize(const OrderCancel& message, std::string& out) {
+        FrameWriter writer(out, MessageType::ORDER_CANCEL);
+        writer.writeString(message.symbol);
+        writer.writeString(message.orderId);
+    }
+
+    void serialize(const OrderResponse& message, std::string& out) {
+        FrameWriter writer(out, MessageType::ORDER_RESPONSE);
+        writer.writeString(message.orderId);
+        writer.write<uint8_t>(static_cast<uint8_t>(message.errCode));
+    }
+
+    bool deserialize(const Frame& frame, OrderRequest& message) {
+        if (frame.type != MessageType::ORDER_REQUEST) return false;
+
+        int32_t qty = 0;
+        uint8_t side = 0;
+        uint8_t type = 0;
+
+        PayloadReader reader(frame);
+        reader.readString(message.symbol);
+        reader.read(qty);
+        reader.read(message.price);
+        reader.read(side);
+        reader.read(type);
+
+        message.qty       = qty;
+        message.orderSide = static_cast<OrderSide>(side);
+        message.orderType = static_cast<OrderType>(type);
+
+        return reader.complete();
+    }
+
+    bool deserialize(const Frame& frame, OrderModify& message) {
+        if (frame.type != MessageType::ORDER_MODIFY) return false;
+
+        int32_t qty = 0;
+
+        PayloadReader reader(frame);
+        reader.readString(message.symbol);
+        reader.readString(message.orderId);
+        reader.read(qty);
+        reader.read(message.price);
+
+        message.qty = qty;
+
+        return reader.complete();
+    }
+
+    bool deserialize(const Frame& frame, OrderCancel& message) {
+        if (frame.type != MessageType::ORDER_CANCEL) return false;
+
+        PayloadReader reader(frame);
+        reader.readString(message.symbol);
+        reader.readString(message.orderId);
+
+        return reader.complete();
+    }
+
+    bool deserialize(const Frame& frame, OrderResponse& message) {
+        if (frame.type != MessageType::ORDER_RESPONSE) return false;
+
+        uint8_t errCode = 0;
+
+        PayloadReader reader(frame);
+        reader.readString(message.orderId);
+        reader.read(errCode);
+
+        message.errCode = static_cast<ErrorCode>(errCode);
+
+        return reader.complete();
+    }
+
+    void serialize(const SnapshotRequest& message, std::string& out) {
+        FrameWriter writer(out, MessageType::SNAPSHOT_REQUEST);
+        writer.writeString(message.symbol);
+    }
+
+    void serialize(const BookSnapshot& message, std::string& out) {
+        size_t count = std::min(message.levels.size(), MAX_SNAPSHOT_LEVELS);
+
+        FrameWriter writer(out, MessageType::BOOK_SNAPSHOT);
+        writer.writeString(message.symbol);
+        writer.write<uint64_t>(message.seq);
+        writer.write<uint8_t>(message.last ? 1 : 0);
+        writer.write<uint8_t>(static_cast<uint8_t>(message.errCode));
+        writer.write<uint16_t>(static_cast<uint16_t>(count));
+
+        for (size_t i = 0; i < count; i++) {
+            writer.write<uint8_t>(static_cast<uint8_t>(message.levels[i].side));
+            writer.write<double>(message.levels[i].price);
+            writer.write<int32_t>(message.levels[i].qty);
+        }
+    }
+
+    bool deserialize(const Frame& frame, SnapshotRequest& message) {
+        if (frame.type != MessageType::SNAPSHOT_REQUEST) return false;
+
+        PayloadReader reader(frame);
+        reader.readString(message.symbol);
+
+        return reader.complete();
+    }
+
+    bool deserialize(const Frame& frame, BookSnapshot& message) {
+        if (frame.type != MessageType::BOOK_SNAPSHOT) return false;
+
+        uint8_t last = 0;
+        uint8_t errCode = 0;
+        uint16_t count = 0;
+
+        PayloadReader reader(frame);
+        reader.readString(message.symbol);
+        reader.read(message.seq);
+        reader.read(last);
+        reader.read(errCode);
+        reader.read(count);
+
+        message.last = (last != 0);
+        message.errCode = static_cast<ErrorCode>(errCode);
+        message.levels.clear();
+
+        for (uint16_t i = 0; i < count && reader.ok(); i++) {
+            uint8_t side = 0;
+            int32_t qty = 0;
+            SnapshotLevel level{};
+
+            reader.read(side);
+            reader.read(level.price);
+            reader.read(qty);
+
+            level.side = static_cast<OrderSide>(side);
+            level.qty = qty;
+            message.levels.push_back(level);
+        }
+
+        return reader.complete();
+    }
+
+    void serialize(const AdminRequest& message, std::string& out) {
+        FrameWriter writer(out, MessageType::ADMIN_REQUEST);
+        writer.write<uint8_t>(static_cast<uint8_t>(message.action));
+        writer.writeString(message.symbol);
+    }
+
+    bool deserialize(const Frame& frame, AdminRequest& message) {
+        if (frame.type != MessageType::ADMIN_REQUEST) return false;
+
+        uint8_t action = 0;
+
+        PayloadReader reader(frame);
+        reader.read(action);
+        reader.readString(message.symbol);
+
+        message.action = static_cast<AdminAction>(action);
+
+        return reader.complete();
+    }
+
+    void serialize(const ExecutionReport& message, std::string& out) {
+        FrameWriter writer(out, MessageType::EXECUTION_REPORT);
+        writer.writeString(message.symbol);
+        writer.writeString(message.orderId);
+        writer.write<uint8_t>(static_cast<uint8_t>(message.type));
+        writer.write<uint8_t>(static_cast<uint8_t>(message.side));
+        writer.write<double>(message.price);
+        writer.write<int32_t>(message.qty);
+        writer.write<int32_t>(message.leavesQty);
+        writer.write<int64_t>(message.timestamp);
+    }
+
+    bool deserialize(const Frame& frame, ExecutionReport& message) {
+        if (frame.type != MessageType::EXECUTION_REPORT) return false;
+
+        uint8_t type = 0;
+        uint8_t side = 0;
+        int32_t qty = 0;
+        int32_t leavesQty = 0;
+        int64_t timestamp = 0;
+
+        PayloadReader reader(frame);
+        reader.readString(message.symbol);
+        reader.readString(message.orderId);
+        reader.read(type);
+        reader.read(side);
+        reader.read(message.price);
+        reader.read(qty);
+        reader.read(leavesQty);
+        reader.read(timestamp);
+
+        message.type      = static_cast<ExecutionType>(type);
+        message.side      = static_cast<OrderSide>(side);
+        message.qty       = qty;
+        message.leavesQty = leavesQty;
+        message.timestamp = timestamp;
+
+        return reader.complete();
+    }
+
+    void serialize(const QueryRequest& message, std::string& out) {
+        FrameWriter writer(out, MessageType::QUERY_REQUEST);
+        writer.writeString(message.symbol);
+        writer.write<uint8_t>(static_cast<uint8_t>(message.type));
+        writer.write<uint64_t>(message.cursor);
+        writer.write<uint32_t>(message.maxItems);
+    }
+
+    void serialize(const QueryPage& message, std::string& out) {
+        bool trades = (message.type == QueryType::TRADE_HISTORY);
+        size_t count = trades ? message.trades.size() : message.orders.size();
+
+        FrameWriter writer(out, MessageType::QUERY_PAGE);
+        writer.writeString(message.symbol);
+        writer.write<uint8_t>(static_cast<uint8_t>(message.type));
+        writer.write<uint8_t>(static_cast<uint8_t>(message.errCode));
+        writer.write<uint64_t>(message.cursor);
+        writer.write<uint64_t>(message.nextCursor);
+        writer.write<uint8_t>(message.last ? 1 : 0);
+        writer.write<uint16_t>(static_cast<uint16_t>(count));
+
+        for (size_t i = 0; i < count; i++) {
+            if (trades) {
+                const QueryTrade& trade = message.trades[i];
+                writer.writeString(trade.tradeId);
+                writer.writeString(trade.buyOrderId);
+                writer.writeString(trade.sellOrderId);
+                writer.write<double>(trade.price);
+                writer.write<int32_t>(trade.qty);
+                writer.write<int64_t>(trade.timestamp);
+            }
+            else {
+                const QueryOrder& order = message.orders[i];
+                writer.writeString(order.orderId);
+                writer.write<uint8_t>(static_cast<uint8_t>(order.status));
+                writer.write<uint8_t>(static_cast<uint8_t>(order.side));
+                writer.write<uint8_t>(static_cast<uint8_t>(order.type));
+                writer.write<double>(order.price);
+                writer.write<int32_t>(order.qty);
+                writer.write<int32_t>(order.remainingQty);
+                writer.write<int64_t>(order.timestamp);
+            }
+        }
+    }
+
+    bool deserialize(const Frame& frame, QueryRequest& message) {
+        if (frame.type != MessageType::QUERY_REQUEST) return false;
+
+        uint8_t type = 0;
+
+        PayloadReader reader(frame);
+        reader.readString(message.symbol);
+        reader.read(type);
+        reader.read(message.cursor);
+        reader.read(message.maxItems);
+
+        message.type = static_cast<QueryType>(type);
+
+        return reader.complete();
+    }
+
+    bool deserialize(const Frame& frame, QueryPage& message) {
+        if (frame.type != MessageType::QUERY_PAGE) return false;
+
+        uint8_t type = 0;
+        uint8_t errCode = 0;
+        uint8_t last = 0;
+        uint16_t count = 0;
+
+        PayloadReader reader(frame);
+        reader.readString(message.symbol);
+        reader.read(type);
+        reader.read(errCode);
+        reader.read(message.cursor);
+        reader.read(message.nextCursor);
+        reader.read(last);
+        reader.read(count);
+
+        message.type    = static_cast<QueryType>(type);
+        message.errCode = static_cast<ErrorCode>(errCode);
+        message.last    = (last != 0);
+        message.orders.clear();
+        message.trades.clear();
+
+        for (uint16_t i = 0; i < count && reader.ok(); i++) {
+            int32_t qty = 0;
+            int64_t timestamp = 0;
+
+            if (message.type == QueryType::TRADE_HISTORY) {
+                QueryTrade trade{};
+                reader.readString(trade.tradeId);
+                reader.readString(trade.buyOrderId);
+                reader.readString(trade.sellOrderId);
+                reader.read(trade.price);
+                reader.read(qty);
+                reader.read(timestamp);
+
+                trade.qty       = qty;
+                trade.timestamp = timestamp;
+                message.trades.push_back(std::move(trade));
+            }
+            else {
+                uint8_t status = 0;
+                uint8_t side = 0;
+                uint8_t orderType = 0;
+                int32_t remainingQty = 0;
+
+                QueryOrder order{};
+                reader.readString(order.orderId);
+                reader.read(status);
+                reader.read(side);
+                reader.read(orderType);
+                reader.read(order.price);
+                reader.read(qty);
+                reader.read(remainingQty);
+                reader.read(timestamp);
+
+                order.status       = static_cast<OrderStatus>(status);
+                order.side         = static_cast<OrderSide>(side);
+                order.type         = static_cast<OrderType>(orderType);
+                order.qty          = qty;
+                order.remainingQty = remainingQty;
+                order.timestamp    = timestamp;
+                message.orders.push_back(std::move(order));
+            }
+        }
+
+        return reader.complete();
+    }
+
+    size_t encodedPageHeaderSize(const std::string& symbol) {
+        return sizeof(uint16_t) + std::min(symbol.size(), MAX_STRING_LENGTH) + 2 * sizeof(uint8_t) +
+               2 * sizeof(uint64_t) + sizeof(uint8_t) + sizeof(uint16_t);
+    }
+
+    size_t encodedSize(const QueryOrder& item) {
+        return sizeof(uint16_t) + std::min(item.orderId.size(), MAX_STRING_LENGTH) + 3 * sizeof(uint8_t) +
+               sizeof(double) + 2 * sizeof(int32_t) + sizeof(int64_t);
+    }
+
+    size_t encodedSize(const QueryTrade& item) {
+        return 3 * sizeof(uint16_t) + std::min(item.tradeId.size(), MAX_STRING_LENGTH) +
+               std::min(item.buyOrderId.size(), MAX_STRING_LENGTH) + std::min(item.sellOrderId.size(), MAX_STRING_LENGTH) +
+               sizeof(double) + sizeof(int32_t) + sizeof(int64_t);
+    }
+
+    void beginDatagram(uint64_t packetSeq, std::string& datagram) {
+        datagram.clear();
+        appendValue<uint32_t>(datagram, DATAGRAM_MAGIC);
+        appendValue<uint64_t>(datagram, packetSeq);
+        appendValue<uint16_t>(datagram, 0); // Update count; incremented per update
+        appendValue<uint16_t>(datagram, 0); // Reserved
+    }
+
+    bool appendUpdate(const MarketDataUpdate& update, std::string& datagram) {
+        size_t symbolLength = std::min(update.symbol.size(), MAX_STRING_LENGTH);
+        size_t updateSize = sizeof(uint8_t) + sizeof(uint16_t) + symbolLength + sizeof(uint64_t) +
+                            sizeof(uint8_t) + sizeof(double) + sizeof(int32_t) + sizeof(int64_t);
+
+        if (datagram.size() + updateSize > MAX_DATAGRAM_SIZE) {
+            return false;
+        }
+
+        appendValue<uint8_t>(datagram, static_cast<uint8_t>(update.type));
+        appendValue<uint16_t>(datagram, static_cast<uint16_t>(symbolLength));
+        datagram.append(update.symbol.data(), symbolLength);
+        appendValue<uint64_t>(datagram, update.seq);
+        appendValue<uint8_t>(datagram, static_cast<uint8_t>(update.side));
+        appendValue<double>(datagram, update.price);
+        appendValue<int32_t>(datagram, update.qty);
+        appendValue<int64_t>(datagram, update.timestamp);
+
+        // Increment the update count in the header
+        uint16_t count;
+        std::memcpy(&count, &datagram[12], sizeof(count));
+        count++;
+        std::memcpy(&datagram[12], &count, sizeof(count));
+
+        return true;
+    }
+
+    bool decodeDatagram(const char* data, size_t size, uint64_t& packetSeq, std::vector<MarketDataUpdate>& updates) {
+        uint32_t magic = 0;
+        uint16_t count = 0;
+        uint16_t reserved = 0;
+
+        PayloadReader reader(data, size);
+        reader.read(magic);
+        reader.read(packetSeq);
+        reader.read(count);
+        reader.read(reserved);
+
+        if (!reader.ok() || magic != DATAGRAM_MAGIC) {
+            return false;
+        }
+
+        for (uint16_t i = 0; i < count && reader.ok(); i++) {
+            uint8_t type = 0;
+            uint8_t side = 0;
+            int32_t qty = 0;
+            int64_t timestamp = 0;
+            MarketDataUpdate update{};
+
+            reader.read(type);
+            reader.readString(update.symbol);
+            reader.read(update.seq);
+            reader.read(side);
+            reader.read(update.price);
+            reader.read(qty);
+            reader.read(timestamp);
+
+            update.type = static_cast<MarketDataType>(type);
+            update.side = static_cast<OrderSide>(side);
+            update.qty = qty;
+            update.timestamp = timestamp;
+            updates.push_back(update);
+        }
+
+        return reader.complete();
+    }
+};
@@ -0,0 +1,132 @@
+// Global Includes
+#include <algorithm>
+#include <limits>
+
+// Project Includes
+#include <Protocol.hpp>
+#include <QueryResult.hpp>
+
+//#########################################################################
+QueryResult::QueryResult (
+    const QueryRequest& request,
+    ErrorCode errCode
+) : page{request.symbol, request.type, errCode, request.cursor, request.cursor, false, {}, {}},
+    position(request.cursor),
+    end(request.cursor),
+    complete(false),
+    openOrders(),
+    orderHistory(),
+    tradeHistory() {}
+
+//#########################################################################
+QueryResult::QueryResult (
+    const QueryRequest& request,
+    std::vector<QueryOrder> openOrders
+) : QueryResult(request, ErrorCode::OK) {
+
+    this->openOrders = std::move(openOrders);
+    selectItems(request, this->openOrders.size());
+}
+
+//#########################################################################
+QueryResult::QueryResult (
+    const QueryRequest& request,
+    HistoryLog<std::pair<OrderStatus, Order>>::View orderHistory
+) : QueryResult(request, ErrorCode::OK) {
+
+    this->orderHistory = std::move(orderHistory);
+    selectItems(request, this->orderHistory.size());
+}
+
+//#########################################################################
+QueryResult::QueryResult (
+    const QueryRequest& request,
+    HistoryLog<Trade>::View tradeHistory
+) : QueryResult(request, ErrorCode::OK) {
+
+    this->tradeHistory = std::move(tradeHistory);
+    selectItems(request, this->tradeHistory.size());
+}
+
+//#########################################################################
+void QueryResult::writePage(std::string& out) {
+    if (complete) return;
+
+    page.cursor = position;
+    page.orders.clear();
+    page.trades.clear();
+
+    size_t pageSize = protocol::encodedPageHeaderSize(page.symbol);
+    size_t count = 0;
+
+    // Fill the page up to the frame size limit; a page always holds one item
+    while (position < end && count < std::numeric_limits<uint16_t>::max()) {
+        size_t itemSize = 0;
+
+        if (page.type == QueryType::TRADE_HISTORY) {
+            const Trade& trade = tradeHistory[static_cast<size_t>(position)];
+            page.trades.push_back(QueryTrade{
+                trade.getTradeId(),
+                trade.getBuyOrderId(),
+                trade.getSellOrderId(),
+                trade.getPrice(),
+                trade.getQty(),
+                trade.getTimestamp()
+            });
+            itemSize = protocol::encodedSize(page.trades.back());
+        }
+        else if (page.type == QueryType::ORDER_HISTORY) {
+            const std::pair<OrderStatus, Order>& event = orderHistory[static_cast<size_t>(position)];
+            page.orders.push_back(QueryOrder{
+                event.second.getOrderId(),
+                event.first,
+                event.second.getOrderSide(),
+                event.second.getOrderType(),
+                event.second.getOrderPrice(),
+                event.second.getOrderQty(),
+                event.second.getOrderRemainingQty(),
+                event.second.getOrderTimestamp()
+            });
+            itemSize = protocol::encodedSize(page.orders.back());
+        }
+        else {
+            page.orders.push_back(openOrders[static_cast<size_t>(position)]);
+            itemSize = protocol::encodedSize(page.orders.back());
+        }
+
+        // Item starts the next page instead
+        if (count > 0 && pageSize + itemSize > protocol::MAX_PAYLOAD_SIZE) {
+            if (page.type == QueryType::TRADE_HISTORY) page.trades.pop_back();
+            else page.orders.pop_back();
+            break;
+        }
+
+        pageSize += itemSize;
+        position++;
+        count++;
+    }
+
+    page.nextCursor = position;
+    page.last = (position == end);
+    complete = page.last;
+
+    protocol::serialize(page, out);
+}
+
+//#########################################################################
+bool QueryResult::isComplete() const {
+    return complete;
+}
+
+//#########################################################################
+void QueryResult::selectItems(const QueryRequest& request, size_t size) {
+    position = std::min<uint64_t>(request.cursor, size);
+    end = size;
+
+    if (request.maxItems != 0) {
+        end = std::min<uint64_t>(end, position + request.maxItems);
+    }
+
+    page.cursor = position;
+    page.nextCursor = position;
+}
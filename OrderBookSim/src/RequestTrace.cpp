@@ -0,0 +1,221 @@
+// Global Includes
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <thread>
+
+#if !defined(_WIN32)
+#include <signal.h>
+#endif
+
+// Project Includes
+#include <RequestTrace.hpp>
+
+namespace {
+    std::atomic<bool> dumpRequested{false}; // Set by the SIGUSR2 handler
+
+#if !defined(_WIN32)
+    /**
+     * @brief SIGUSR2 handler: only flags the dump (async-signal-safe).
+     */
+    void onDumpSignal(int) {
+        dumpRequested.store(true, std::memory_order_relaxed);
+    }
+#endif
+
+    /**
+     * @brief Get the name of a request type.
+     *
+     * @param type - message type of the request
+     *
+     * @return const char* - name
+     */
+    const char* typeName(MessageType type) {
+        switch (type) {
+            case MessageType::ORDER_REQUEST: return "order";
+            case MessageType::ORDER_MODIFY:  return "modify";
+            case MessageType::ORDER_CANCEL:  return "cancel";
+            case MessageType::ADMIN_REQUEST: return "admin";
+            case MessageType::QUERY_REQUEST: return "query";
+            default:                         return "other";
+        }
+    }
+
+    /**
+     * @brief Write the begin and end events of one async slice.
+     *
+     * @param out - stream to write to
+     * @param name - slice name
+     * @param id - request ID (slices of one request share it)
+     * @param origin - time of the first record (ns)
+     * @param start - slice start (ns)
+     * @param end - slice end (ns)
+     * @param args - JSON object of the begin event's arguments (or empty)
+     */
+    void writeSlice(std::ostream& out, const char* name, uint64_t id, int64_t origin, int64_t start, int64_t end,
+                    const std::string& args) {
+        char line[512];
+        std::snprintf(line, sizeof(line),
+                      ",\n{\"name\":\"%s\",\"cat\":\"request\",\"ph\":\"b\",\"id\":%llu,\"pid\":1,\"tid\":1,\"ts\":%.3f%s%s}"
+                      ",\n{\"name\":\"%s\",\"cat\":\"request\",\"ph\":\"e\",\"id\":%llu,\"pid\":1,\"tid\":1,\"ts\":%.3f}",
+                      name, static_cast<unsigned long long>(id), (start - origin) / 1000.0, args.empty() ? "" : ",\"args\":",
+                      args.c_str(), name, static_cast<unsigned long long>(id), (std::max(end, start) - origin) / 1000.0);
+        out << line;
+    }
+}
+
+namespace trace {
+    //#########################################################################
+    TraceBuffer::TraceBuffer(size_t capacity) :
+        slots(new Slot[std::max<size_t>(capacity, 1)]),
+        capacity(std::max<size_t>(capacity, 1)),
+        next(0),
+        sampleEvery(0) {}
+
+    //#########################################################################
+    void TraceBuffer::setSampleEvery(uint32_t every) {
+        sampleEvery.store(every, std::memory_order_relaxed);
+    }
+
+    //#########################################################################
+    bool TraceBuffer::sample() {
+        thread_local uint32_t count = 0;
+
+        uint32_t every = sampleEvery.load(std::memory_order_relaxed);
+        if (every == 0 || ++count < every) return false;
+
+        count = 0;
+        return true;
+    }
+
+    //#########################################################################
+    RequestTrace TraceBuffer::begin(MessageType type, int64_t arrival) {
+        RequestTrace trace;
+        trace.buffer = this;
+        trace.type = type;
+        trace.arrival = arrival;
+
+        return trace;
+    }
+
+    //#########################################################################
+    void TraceBuffer::record(const TraceRecord& record) {
+        uint64_t index = next.fetch_add(1, std::memory_order_relaxed);
+        Slot& slot = slots[index % capacity];
+
+        uint64_t words[RECORD_WORDS] = {};
+        std::memcpy(words, &record, sizeof(TraceRecord));
+
+        // Odd while the words are written; the even version publishes them
+        slot.version.store(2 * index + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        for (size_t word = 0; word < RECORD_WORDS; word++) {
+            slot.words[word].store(words[word], std::memory_order_relaxed);
+        }
+
+        slot.version.store(2 * index + 2, std::memory_order_release);
+    }
+
+    //#########################################################################
+    std::vector<TraceRecord> TraceBuffer::snapshot() const {
+        std::vector<std::pair<uint64_t, TraceRecord>> records;
+        records.reserve(capacity);
+
+        for (size_t index = 0; index < capacity; index++) {
+            const Slot& slot = slots[index];
+
+            uint64_t version = slot.version.load(std::memory_order_acquire);
+            if (version == 0 || (version & 1)) continue;
+
+            uint64_t words[RECORD_WORDS];
+            for (size_t word = 0; word < RECORD_WORDS; word++) {
+                words[word] = slot.words[word].load(std::memory_order_relaxed);
+            }
+
+            // Skip a record overwritten while it was read
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.version.load(std::memory_order_relaxed) != version) continue;
+
+            TraceRecord record;
+            std::memcpy(&record, words, sizeof(TraceRecord));
+            records.emplace_back(version, record);
+        }
+
+        std::sort(records.begin(), records.end(),
+                  [](const auto& left, const auto& right) { return left.first < right.first; });
+
+        std::vector<TraceRecord> ordered;
+        ordered.reserve(records.size());
+        for (const auto& [version, record] : records) {
+            ordered.push_back(record);
+        }
+
+        return ordered;
+    }
+
+    //#########################################################################
+    void TraceBuffer::writeChromeTrace(std::ostream& out) const {
+        std::vector<TraceRecord> records = snapshot();
+
+        int64_t origin = 0;
+        for (const TraceRecord& record : records) {
+            if (origin == 0 || record.stamps.arrival < origin) origin = record.stamps.arrival;
+        }
+
+        out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n"
+            << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"orderBook requests\"}}";
+
+        uint64_t id = 0;
+        for (const TraceRecord& record : records) {
+            const RequestTrace& stamps = record.stamps;
+            id++;
+
+            char args[160];
+            std::snprintf(args, sizeof(args), "{\"type\":\"%s\",\"session\":%u,\"seq\":%llu,\"symbol_id\":%lld}",
+                          typeName(stamps.type), record.sessionId, static_cast<unsigned long long>(record.seq),
+                          stamps.symbolId == UINT32_MAX ? -1LL : static_cast<long long>(stamps.symbolId));
+
+            writeSlice(out, "request", id, origin, stamps.arrival, record.send, args);
+
+            // Requests rejected before an engine only have the request slice
+            if (stamps.dequeue == 0) continue;
+
+            writeSlice(out, "queue", id, origin, stamps.arrival, stamps.dequeue, "");
+            writeSlice(out, "engine wait", id, origin, stamps.dequeue, stamps.matchStart, "");
+            writeSlice(out, "match", id, origin, stamps.matchStart, stamps.matchEnd, "");
+            writeSlice(out, "response", id, origin, stamps.matchEnd, record.send, "");
+        }
+
+        out << "\n]}\n";
+    }
+
+    //#########################################################################
+    void TraceBuffer::dumpOnSignal(const std::string& path) {
+#if !defined(_WIN32)
+        struct sigaction action = {};
+        action.sa_handler = onDumpSignal;
+        sigemptyset(&action.sa_mask);
+        action.sa_flags = SA_RESTART;
+        sigaction(SIGUSR2, &action, nullptr);
+
+        std::thread([this, path]() {
+            while (true) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                if (!dumpRequested.exchange(false, std::memory_order_relaxed)) continue;
+
+                std::ofstream file(path);
+                writeChromeTrace(file);
+            }
+        }).detach();
+#else
+        (void)path;
+#endif
+    }
+
+    //#########################################################################
+    uint64_t TraceBuffer::getRecorded() const {
+        return next.load(std::memory_order_relaxed);
+    }
+};
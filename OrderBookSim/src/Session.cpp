@@ -0,0 +1,325 @@
+// Global Includes
+#include <algorithm>
+#include <cstring>
+
+// Project Includes
+#include <Session.hpp>
+#include <StageTimers.hpp>
+
+//#########################################################################
+Session::Session (
+    uint32_t sessionId
+) : sessionId(sessionId),
+    rxBuffer(RECEIVE_BUFFER_SIZE),
+    rxSize(0),
+    rxOffset(0),
+    protocolError(false),
+    peerClosed(false),
+    failed(false),
+    nextResponseSeq(0),
+    pendingResponses(),
+    incompleteRequests(0),
+    heldReports(),
+    messageBucket(),
+    openOrders(std::make_shared<std::atomic<uint32_t>>(0)),
+    txBlocks(),
+    txFree(),
+    txOffset(0),
+    sendTraces() {}
+
+
+//#########################################################################
+long Session::readAvailable() {
+    long totalBytes = 0;
+
+    // Drain the transport until it has no more data or the buffer is full
+    while (rxSize < rxBuffer.size()) {
+        long bytesRcv = receiveBytes(rxBuffer.data() + rxSize, rxBuffer.size() - rxSize);
+
+        if (bytesRcv > 0) {
+            rxSize += static_cast<size_t>(bytesRcv);
+            totalBytes += bytesRcv;
+        }
+        else if (bytesRcv == 0) {
+            break;
+        }
+        else {
+            return -1;
+        }
+    }
+
+    return totalBytes;
+}
+
+//#########################################################################
+bool Session::nextFrame(protocol::Frame& frame) {
+    if (protocolError) return false;
+
+    size_t frameSize = 0;
+    protocol::DecodeStatus status = protocol::decodeFrame(
+        rxBuffer.data() + rxOffset,
+        rxSize - rxOffset,
+        frame,
+        frameSize
+    );
+
+    if (status == protocol::DecodeStatus::COMPLETE) {
+        rxOffset += frameSize;
+        return true;
+    }
+
+    if (status == protocol::DecodeStatus::INVALID) {
+        protocolError = true;
+    }
+
+    return false;
+}
+
+//#########################################################################
+void Session::compactReceiveBuffer() {
+    if (rxOffset == 0) return;
+
+    // Move the partial frame (if any) to the front of the buffer
+    size_t remaining = rxSize - rxOffset;
+    if (remaining > 0) {
+        std::memmove(rxBuffer.data(), rxBuffer.data() + rxOffset, remaining);
+    }
+
+    rxSize = remaining;
+    rxOffset = 0;
+}
+
+//#########################################################################
+std::string& Session::outbound() {
+    // Start a new block once the current one is full
+    if (txBlocks.empty() || txBlocks.back().size() >= OUTBOUND_BLOCK_SIZE) {
+        if (!txFree.empty()) {
+            txBlocks.push_back(std::move(txFree.back()));
+            txFree.pop_back();
+        }
+        else {
+            txBlocks.emplace_back();
+            txBlocks.back().reserve(OUTBOUND_BLOCK_SIZE + protocol::HEADER_SIZE + protocol::MAX_PAYLOAD_SIZE);
+        }
+    }
+
+    return txBlocks.back();
+}
+
+//#########################################################################
+bool Session::flush() {
+    // Refill the buffer from a query being streamed
+    writeCompleted();
+
+    if (txBlocks.empty()) return true;
+
+    // Gather every queued block into one vectored send
+    size_t sliceCount = std::min(txBlocks.size(), net::MAX_IO_SLICES);
+    net::IoSlice slices[net::MAX_IO_SLICES];
+
+    net::setSlice(slices[0], txBlocks[0].data() + txOffset, txBlocks[0].size() - txOffset);
+    for (size_t i = 1; i < sliceCount; i++) {
+        net::setSlice(slices[i], txBlocks[i].data(), txBlocks[i].size());
+    }
+
+    long bytesSent = 0;
+    {
+        OBM_STAGE(SEND);
+        bytesSent = sendSlices(slices, sliceCount);
+    }
+
+    if (bytesSent < 0) {
+        return false;
+    }
+
+    // Release the blocks that were fully written
+    size_t sent = static_cast<size_t>(bytesSent);
+    size_t released = 0;
+
+    while (released < txBlocks.size()) {
+        size_t blockRemaining = txBlocks[released].size() - txOffset;
+
+        if (sent < blockRemaining) {
+            txOffset += sent;
+            break;
+        }
+
+        sent -= blockRemaining;
+        txOffset = 0;
+
+        txBlocks[released].clear();
+        txFree.push_back(std::move(txBlocks[released]));
+        released++;
+    }
+
+    txBlocks.erase(txBlocks.begin(), txBlocks.begin() + released);
+
+    // Every response written so far has been handed to the transport
+    if (txBlocks.empty() && !sendTraces.empty()) {
+        int64_t sendTime = trace::now();
+        for (trace::TraceRecord& record : sendTraces) {
+            record.send = sendTime;
+            record.stamps.buffer->record(record);
+        }
+        sendTraces.clear();
+    }
+
+    return true;
+}
+
+//#########################################################################
+uint64_t Session::beginRequest() {
+    pendingResponses.push_back(PendingResponse{false, OrderResponse{}, nullptr, trace::RequestTrace()});
+    incompleteRequests++;
+
+    return nextResponseSeq + pendingResponses.size() - 1;
+}
+
+//#########################################################################
+void Session::completeRequest(uint64_t seq, const OrderResponse& response, std::shared_ptr<QueryResult> query,
+                              const trace::RequestTrace& trace) {
+    PendingResponse& pending = pendingResponses[static_cast<size_t>(seq - nextResponseSeq)];
+    pending.complete = true;
+    pending.response = response;
+    pending.query = std::move(query);
+    pending.trace = trace;
+    incompleteRequests--;
+
+    writeCompleted();
+}
+
+//#########################################################################
+void Session::writeCompleted() {
+    // Write every response that no longer waits for an earlier request
+    while (!pendingResponses.empty() && pendingResponses.front().complete) {
+        PendingResponse& front = pendingResponses.front();
+
+        if (front.query) {
+            // Stream the pages as the transport drains them
+            while (!front.query->isComplete() && txBlocks.size() < MAX_STREAM_BLOCKS) {
+                front.query->writePage(outbound());
+            }
+
+            if (!front.query->isComplete()) return;
+        }
+        else {
+            OBM_STAGE(SERIALIZE);
+            protocol::serialize(front.response, outbound());
+        }
+
+        // Sampled requests are recorded when their response is sent
+        if (front.trace.buffer) {
+            sendTraces.push_back(trace::TraceRecord{front.trace, 0, sessionId, nextResponseSeq});
+        }
+
+        pendingResponses.pop_front();
+
+        // Reports held for this response follow it
+        while (!heldReports.empty() && heldReports.front().afterSeq == nextResponseSeq) {
+            OBM_STAGE(SERIALIZE);
+            protocol::serialize(heldReports.front().report, outbound());
+            heldReports.pop_front();
+        }
+
+        nextResponseSeq++;
+    }
+}
+
+//#########################################################################
+void Session::deliverReport(const ExecutionReport& report) {
+    if (pendingResponses.empty()) {
+        OBM_STAGE(SERIALIZE);
+        protocol::serialize(report, outbound());
+        return;
+    }
+
+    // Hold the report behind the newest outstanding request
+    heldReports.push_back(HeldReport{nextResponseSeq + pendingResponses.size() - 1, report});
+}
+
+//#########################################################################
+void Session::markFailed() {
+    failed = true;
+}
+
+//#########################################################################
+void Session::reset(uint32_t t_sessionId) {
+    sessionId = t_sessionId;
+    rxSize = 0;
+    rxOffset = 0;
+    protocolError = false;
+    peerClosed = false;
+    failed = false;
+    nextResponseSeq = 0;
+    pendingResponses.clear();
+    incompleteRequests = 0;
+    heldReports.clear();
+    messageBucket.reset();
+
+    // Orders of the previous client keep counting against its own counter
+    openOrders = std::make_shared<std::atomic<uint32_t>>(0);
+
+    for (std::string& block : txBlocks) {
+        block.clear();
+        txFree.push_back(std::move(block));
+    }
+    txBlocks.clear();
+    txOffset = 0;
+    sendTraces.clear();
+}
+
+//#########################################################################
+void Session::markPeerClosed() {
+    peerClosed = true;
+}
+
+//#########################################################################
+uint32_t Session::getSessionId() const {
+    return sessionId;
+}
+
+//#########################################################################
+bool Session::hasPendingOutbound() const {
+    // A query being streamed has pages left to write
+    return !txBlocks.empty() || (!pendingResponses.empty() && pendingResponses.front().complete);
+}
+
+//#########################################################################
+bool Session::hasProtocolError() const {
+    return protocolError;
+}
+
+//#########################################################################
+bool Session::isPeerClosed() const {
+    return peerClosed;
+}
+
+//#########################################################################
+bool Session::hasFailed() const {
+    return failed;
+}
+
+//#########################################################################
+bool Session::hasOutstandingRequests() const {
+    return incompleteRequests != 0;
+}
+
+//#########################################################################
+size_t Session::getOutstandingRequests() const {
+    return pendingResponses.size();
+}
+
+//#########################################################################
+uint32_t Session::getOpenOrders() const {
+    return openOrders->load(std::memory_order_relaxed);
+}
+
+//#########################################################################
+const std::shared_ptr<std::atomic<uint32_t>>& Session::getOpenOrderCount() const {
+    return openOrders;
+}
+
+//#########################################################################
+TokenBucket& Session::getMessageBucket() {
+    return messageBucket;
+}
@@ -0,0 +1,122 @@
+// Global Includes
+#include <thread>
+
+// Project Includes
+#include <ShmClient.hpp>
+
+//#########################################################################
+ShmClient::ShmClient (
+    shm::WaitMode waitMode
+) : waitMode(waitMode),
+    mapping(),
+    slot(nullptr),
+    requestData(nullptr),
+    responseData(nullptr),
+    ringCapacity(0) {}
+
+ShmClient::~ShmClient() {
+    disconnect();
+}
+
+//#########################################################################
+bool ShmClient::connect(const std::string& name) {
+    if (!shm::mapRegion(name, 0, false, mapping)) {
+        return false;
+    }
+
+    shm::ShmRegionHeader* header = shm::regionHeader(mapping.address);
+
+    if (header->magic.load(std::memory_order_acquire) != shm::REGION_MAGIC) {
+        shm::unmapRegion(mapping);
+        return false;
+    }
+
+    // Claim the first free slot
+    for (uint32_t i = 0; i < header->slotCount; i++) {
+        shm::ShmSlot* candidate = shm::regionSlot(mapping.address, i);
+        uint32_t expected = static_cast<uint32_t>(shm::SlotState::FREE);
+
+        if (candidate->state.compare_exchange_strong(expected, static_cast<uint32_t>(shm::SlotState::CLAIMED))) {
+            slot = candidate;
+            requestData = shm::requestData(mapping.address, i);
+            responseData = shm::responseData(mapping.address, i);
+            ringCapacity = header->ringCapacity;
+
+            slot->generation++;
+            shm::resetRing(slot->request);
+            shm::resetRing(slot->response);
+            slot->state.store(static_cast<uint32_t>(shm::SlotState::CONNECTED), std::memory_order_release);
+
+            // Let a sleeping server pick up the new slot
+            header->doorbell.fetch_add(1, std::memory_order_release);
+            shm::futexWake(header->doorbell);
+
+            return true;
+        }
+    }
+
+    shm::unmapRegion(mapping);
+
+    return false;
+}
+
+//#########################################################################
+void ShmClient::disconnect() {
+    if (slot != nullptr) {
+        shm::ShmRegionHeader* header = shm::regionHeader(mapping.address);
+
+        slot->state.store(static_cast<uint32_t>(shm::SlotState::CLOSED), std::memory_order_release);
+        header->doorbell.fetch_add(1, std::memory_order_release);
+        shm::futexWake(header->doorbell);
+
+        slot = nullptr;
+    }
+
+    shm::unmapRegion(mapping);
+}
+
+//#########################################################################
+bool ShmClient::send(const std::string& frames) {
+    if (slot == nullptr) return false;
+
+    size_t written = 0;
+
+    while (true) {
+        written += shm::ringWrite(slot->request, requestData, ringCapacity,
+                                  frames.data() + written, frames.size() - written);
+        notifyServer();
+
+        if (written == frames.size()) break;
+
+        // Request ring full; give the server time to drain it
+        std::this_thread::yield();
+    }
+
+    return true;
+}
+
+//#########################################################################
+void ShmClient::notifyServer() {
+    shm::ShmRegionHeader* header = shm::regionHeader(mapping.address);
+
+    // Ring the doorbell only if the server is asleep
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (header->serverWaiting.load(std::memory_order_relaxed)) {
+        header->doorbell.fetch_add(1, std::memory_order_release);
+        shm::futexWake(header->doorbell);
+    }
+}
+
+//#########################################################################
+size_t ShmClient::receive(char* buffer, size_t length, int timeoutMs) {
+    if (slot == nullptr) return 0;
+
+    size_t bytesRcv = shm::ringRead(slot->response, responseData, ringCapacity, buffer, length);
+
+    if (bytesRcv == 0) {
+        shm::waitForData(slot->response, waitMode, timeoutMs);
+        bytesRcv = shm::ringRead(slot->response, responseData, ringCapacity, buffer, length);
+    }
+
+    return bytesRcv;
+}
@@ -0,0 +1,275 @@
+// Global Includes
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <climits>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+#endif
+
+// Project Includes
+#include <ShmRing.hpp>
+
+namespace shm {
+    namespace {
+        /**
+         * @brief Round a size up to a whole number of cache lines.
+         */
+        constexpr size_t cacheAligned(size_t size) {
+            return (size + CACHE_LINE_SIZE - 1) & ~(CACHE_LINE_SIZE - 1);
+        }
+
+        constexpr size_t HEADER_STRIDE = cacheAligned(sizeof(ShmRegionHeader));
+        constexpr size_t SLOT_HEADER   = cacheAligned(sizeof(ShmSlot));
+
+        /**
+         * @brief Bytes occupied by one slot and its two rings.
+         */
+        size_t slotStride(uint64_t ringCapacity) {
+            return SLOT_HEADER + 2 * static_cast<size_t>(ringCapacity);
+        }
+
+        char* slotBase(void* region, uint32_t slot) {
+            ShmRegionHeader* header = regionHeader(region);
+            return static_cast<char*>(region) + HEADER_STRIDE + slot * slotStride(header->ringCapacity);
+        }
+    }
+
+    size_t regionSize(uint32_t slotCount, uint64_t ringCapacity) {
+        return HEADER_STRIDE + slotCount * slotStride(ringCapacity);
+    }
+
+    bool mapRegion(const std::string& name, size_t size, bool create, ShmMapping& mapping) {
+        mapping = ShmMapping();
+        mapping.name = name;
+        mapping.owner = create;
+
+#ifdef _WIN32
+        std::string mappingName = "Local\\" + name;
+        HANDLE handle = nullptr;
+
+        if (create) {
+            handle = CreateFileMappingA(
+                INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+                static_cast<DWORD>(static_cast<uint64_t>(size) >> 32),
+                static_cast<DWORD>(size & 0xFFFFFFFF),
+                mappingName.c_str()
+            );
+        }
+        else {
+            handle = OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, mappingName.c_str());
+        }
+
+        if (handle == nullptr) return false;
+
+        // Opening an existing region maps the whole view, then reads the size
+        void* address = MapViewOfFile(handle, FILE_MAP_ALL_ACCESS, 0, 0, create ? size : 0);
+        if (address == nullptr) {
+            CloseHandle(handle);
+            return false;
+        }
+
+        if (!create) {
+            MEMORY_BASIC_INFORMATION info;
+            VirtualQuery(address, &info, sizeof(info));
+            size = info.RegionSize;
+        }
+
+        mapping.handle = reinterpret_cast<intptr_t>(handle);
+#else
+        std::string shmName = "/" + name;
+        int fd = create ? shm_open(shmName.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0600)
+                        : shm_open(shmName.c_str(), O_RDWR, 0600);
+
+        if (fd < 0) return false;
+
+        if (create) {
+            if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+                close(fd);
+                shm_unlink(shmName.c_str());
+                return false;
+            }
+        }
+        else {
+            struct stat info;
+            if (fstat(fd, &info) != 0) {
+                close(fd);
+                return false;
+            }
+            size = static_cast<size_t>(info.st_size);
+        }
+
+        void* address = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (address == MAP_FAILED) {
+            close(fd);
+            if (create) shm_unlink(shmName.c_str());
+            return false;
+        }
+
+        mapping.handle = fd;
+#endif
+
+        mapping.address = address;
+        mapping.size = size;
+
+        return true;
+    }
+
+    void unmapRegion(ShmMapping& mapping) {
+        if (mapping.address == nullptr) return;
+
+#ifdef _WIN32
+        UnmapViewOfFile(mapping.address);
+        CloseHandle(reinterpret_cast<HANDLE>(mapping.handle));
+#else
+        munmap(mapping.address, mapping.size);
+        close(static_cast<int>(mapping.handle));
+
+        if (mapping.owner) {
+            shm_unlink(("/" + mapping.name).c_str());
+        }
+#endif
+
+        mapping = ShmMapping();
+    }
+
+    ShmRegionHeader* regionHeader(void* region) {
+        return static_cast<ShmRegionHeader*>(region);
+    }
+
+    ShmSlot* regionSlot(void* region, uint32_t slot) {
+        return reinterpret_cast<ShmSlot*>(slotBase(region, slot));
+    }
+
+    char* requestData(void* region, uint32_t slot) {
+        return slotBase(region, slot) + SLOT_HEADER;
+    }
+
+    char* responseData(void* region, uint32_t slot) {
+        return requestData(region, slot) + regionHeader(region)->ringCapacity;
+    }
+
+    void resetRing(ShmRing& ring) {
+        ring.head.store(0, std::memory_order_relaxed);
+        ring.tail.store(0, std::memory_order_relaxed);
+        ring.consumerWaiting.store(0, std::memory_order_relaxed);
+        ring.signal.fetch_add(1, std::memory_order_release);
+    }
+
+    size_t ringWrite(ShmRing& ring, char* data, uint64_t capacity, const char* source, size_t length) {
+        uint64_t head = ring.head.load(std::memory_order_relaxed);
+        uint64_t tail = ring.tail.load(std::memory_order_acquire);
+
+        size_t space = static_cast<size_t>(capacity - (head - tail));
+        size_t count = std::min(space, length);
+        if (count == 0) return 0;
+
+        // Copy in up to two pieces when the write wraps around the end
+        size_t offset = static_cast<size_t>(head & (capacity - 1));
+        size_t first = std::min(count, static_cast<size_t>(capacity) - offset);
+
+        std::memcpy(data + offset, source, first);
+        std::memcpy(data, source + first, count - first);
+
+        ring.head.store(head + count, std::memory_order_release);
+
+        return count;
+    }
+
+    size_t ringFree(const ShmRing& ring, uint64_t capacity) {
+        uint64_t head = ring.head.load(std::memory_order_relaxed);
+        uint64_t tail = ring.tail.load(std::memory_order_acquire);
+
+        return static_cast<size_t>(capacity - (head - tail));
+    }
+
+    size_t ringRead(ShmRing& ring, const char* data, uint64_t capacity, char* destination, size_t length) {
+        uint64_t tail = ring.tail.load(std::memory_order_relaxed);
+        uint64_t head = ring.head.load(std::memory_order_acquire);
+
+        size_t available = static_cast<size_t>(head - tail);
+        size_t count = std::min(available, length);
+        if (count == 0) return 0;
+
+        size_t offset = static_cast<size_t>(tail & (capacity - 1));
+        size_t first = std::min(count, static_cast<size_t>(capacity) - offset);
+
+        std::memcpy(destination, data + offset, first);
+        std::memcpy(destination + first, data, count - first);
+
+        ring.tail.store(tail + count, std::memory_order_release);
+
+        return count;
+    }
+
+    bool ringEmpty(const ShmRing& ring) {
+        return ring.head.load(std::memory_order_acquire) == ring.tail.load(std::memory_order_relaxed);
+    }
+
+    void futexWait(std::atomic<uint32_t>& word, uint32_t expected, int timeoutMs) {
+#ifdef __linux__
+        timespec timeout;
+        timeout.tv_sec  = timeoutMs / 1000;
+        timeout.tv_nsec = (timeoutMs % 1000) * 1000000L;
+
+        // Shared (non-private) futex; the word lives in memory mapped by several processes
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT, expected, &timeout, nullptr, 0);
+#else
+        (void)timeoutMs;
+        if (word.load(std::memory_order_acquire) == expected) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+#endif
+    }
+
+    void futexWake(std::atomic<uint32_t>& word) {
+#ifdef __linux__
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+#else
+        (void)word;
+#endif
+    }
+
+    void notifyConsumer(ShmRing& ring) {
+        // Pairs with the fence in waitForData; either the producer sees the
+        // waiting flag or the consumer sees the new data before sleeping
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (ring.consumerWaiting.load(std::memory_order_relaxed)) {
+            ring.signal.fetch_add(1, std::memory_order_release);
+            futexWake(ring.signal);
+        }
+    }
+
+    void waitForData(ShmRing& ring, WaitMode mode, int timeoutMs) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+
+        if (mode == WaitMode::BUSY_POLL) {
+            while (ringEmpty(ring)) {
+                if (std::chrono::steady_clock::now() >= deadline) return;
+            }
+            return;
+        }
+
+        uint32_t expected = ring.signal.load(std::memory_order_acquire);
+        ring.consumerWaiting.store(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (ringEmpty(ring)) {
+            futexWait(ring.signal, expected, timeoutMs);
+        }
+
+        ring.consumerWaiting.store(0, std::memory_order_relaxed);
+    }
+};
@@ -0,0 +1,292 @@
+// Project Includes
+#include <ShmTransport.hpp>
+#include <StageTimers.hpp>
+
+//#########################################################################
+ShmSession::ShmSession (
+    void* region,
+    uint32_t slot,
+    uint32_t sessionId
+) : Session(sessionId),
+    slot(shm::regionSlot(region, slot)),
+    requestData(shm::requestData(region, slot)),
+    responseData(shm::responseData(region, slot)),
+    ringCapacity(shm::regionHeader(region)->ringCapacity) {}
+
+//#########################################################################
+long ShmSession::receiveBytes(char* buffer, size_t length) {
+    size_t bytesRcv = shm::ringRead(slot->request, requestData, ringCapacity, buffer, length);
+
+    // Agent disconnected and every request it sent has been read
+    if (bytesRcv == 0 &&
+        slot->state.load(std::memory_order_acquire) == static_cast<uint32_t>(shm::SlotState::CLOSED)) {
+        markPeerClosed();
+    }
+
+    return static_cast<long>(bytesRcv);
+}
+
+//#########################################################################
+long ShmSession::sendSlices(net::IoSlice* slices, size_t count) {
+    size_t bytesSent = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        size_t length = net::sliceLength(slices[i]);
+        size_t written = shm::ringWrite(slot->response, responseData, ringCapacity, net::sliceData(slices[i]), length);
+        bytesSent += written;
+
+        // Response ring is full; the remainder stays queued
+        if (written < length) break;
+    }
+
+    if (bytesSent > 0) {
+        shm::notifyConsumer(slot->response);
+    }
+
+    return static_cast<long>(bytesSent);
+}
+
+//#########################################################################
+ShmTransport::ShmTransport (
+    std::string name,
+    uint32_t slotCount,
+    uint64_t ringCapacity,
+    shm::WaitMode waitMode,
+    FrameHandler handler,
+    ReadGate readGate,
+    CloseHandler onClose,
+    std::atomic<uint32_t>& sessionIds,
+    bool logging
+) : name(name),
+    slotCount(slotCount),
+    ringCapacity(ringCapacity),
+    waitMode(waitMode),
+    handler(handler),
+    readGate(readGate),
+    onClose(onClose),
+    readsPaused(false),
+    sessionIds(sessionIds),
+    logging(logging),
+    placement(),
+    mapping(),
+    slots(slotCount),
+    completions([this]() { ringDoorbell(); }),
+    completed(),
+    reports(),
+    sessionSlots(),
+    running(false),
+    worker() {}
+
+ShmTransport::~ShmTransport() {
+    stop();
+}
+
+//#########################################################################
+bool ShmTransport::start() {
+    // Ring positions are masked; the capacity must be a power of two
+    if (ringCapacity == 0 || (ringCapacity & (ringCapacity - 1)) != 0) {
+        logEvent<LogLevel::ERR>(logging,
+                                "ShmTransport::start(): ring capacity must be a power of two");
+        return false;
+    }
+
+    if (!shm::mapRegion(name, shm::regionSize(slotCount, ringCapacity), true, mapping)) {
+        logEvent<LogLevel::ERR>(logging,
+                                "ShmTransport::start(): failed to create shared memory region={}", name);
+        return false;
+    }
+
+    // Initialize the region; the magic value is published last
+    shm::ShmRegionHeader* header = shm::regionHeader(mapping.address);
+    header->slotCount = slotCount;
+    header->ringCapacity = ringCapacity;
+    header->doorbell.store(0, std::memory_order_relaxed);
+    header->serverWaiting.store(0, std::memory_order_relaxed);
+
+    for (uint32_t i = 0; i < slotCount; i++) {
+        shm::ShmSlot* slot = shm::regionSlot(mapping.address, i);
+        slot->generation = 0;
+        shm::resetRing(slot->request);
+        shm::resetRing(slot->response);
+        slot->state.store(static_cast<uint32_t>(shm::SlotState::FREE), std::memory_order_relaxed);
+    }
+
+    header->magic.store(shm::REGION_MAGIC, std::memory_order_release);
+
+    running = true;
+    worker = std::thread(&ShmTransport::run, this);
+
+    logEvent<LogLevel::INFO>(logging,
+                             "ShmTransport::start(): Shared memory transport listening on region={}, slots={}",
+                             name, slotCount);
+
+    return true;
+}
+
+//#########################################################################
+void ShmTransport::stop() {
+    if (running.exchange(false)) {
+        shm::futexWake(shm::regionHeader(mapping.address)->doorbell);
+    }
+
+    if (worker.joinable()) {
+        worker.join();
+    }
+
+    if (mapping.address != nullptr) {
+        shm::regionHeader(mapping.address)->magic.store(0, std::memory_order_release);
+        shm::unmapRegion(mapping);
+    }
+}
+
+//#########################################################################
+void ShmTransport::setThreadPlacement(const threading::ThreadPlacement& t_placement) {
+    placement = t_placement;
+}
+
+//#########################################################################
+void ShmTransport::run() {
+    shm::ShmRegionHeader* header = shm::regionHeader(mapping.address);
+    stages::setThreadName("shm");
+
+    if (!threading::applyPlacement(placement)) {
+        logEvent<LogLevel::WARN>(logging,
+                                 "ShmTransport::run(): Transport could not be placed on CPU={}, priority={}",
+                                 placement.cpu, placement.priority);
+    }
+
+    while (running.load(std::memory_order_relaxed)) {
+        if (serviceSlots() || waitMode == shm::WaitMode::BUSY_POLL) {
+            continue;
+        }
+
+        // No work; sleep on the doorbell until an agent rings it
+        uint32_t expected = header->doorbell.load(std::memory_order_acquire);
+        header->serverWaiting.store(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        // Paused reads resume when the engines drain, which may not ring the doorbell
+        if (!slotsPending()) {
+            shm::futexWait(header->doorbell, expected, readsPaused ? 1 : shm::WAIT_TIMEOUT_MS);
+        }
+
+        header->serverWaiting.store(0, std::memory_order_relaxed);
+    }
+
+    slots.clear();
+}
+
+//#########################################################################
+bool ShmTransport::serviceSlots() {
+    bool work = false;
+    readsPaused = false;
+
+    // Write the responses completed by the engines since the last pass
+    if (!completions.empty()) {
+        completions.drain(completed, reports);
+
+        for (Completion& completion : completed) {
+            completion.session->completeRequest(completion.seq, completion.response, std::move(completion.query), completion.trace);
+        }
+
+        // Reports of agents that disconnected are dropped
+        for (const RoutedReport& routed : reports) {
+            auto slot = sessionSlots.find(routed.sessionId);
+
+            if (slot != sessionSlots.end()) {
+                slots[slot->second]->deliverReport(routed.report);
+            }
+        }
+        work = true;
+    }
+
+    for (uint32_t i = 0; i < slotCount; i++) {
+        shm::ShmSlot* slot = shm::regionSlot(mapping.address, i);
+        uint32_t state = slot->state.load(std::memory_order_acquire);
+
+        // Agent connected to a new slot
+        if (!slots[i] && state == static_cast<uint32_t>(shm::SlotState::CONNECTED)) {
+            slots[i] = std::make_unique<ShmSession>(mapping.address, i, sessionIds++);
+            sessionSlots[slots[i]->getSessionId()] = i;
+            work = true;
+
+            logEvent<LogLevel::INFO>(logging,
+                                     "ShmTransport::serviceSlots(): Agent connected. Slot={}, Session={}",
+                                     i, slots[i]->getSessionId());
+        }
+
+        // Agent connected and disconnected before it was serviced
+        if (!slots[i] && state == static_cast<uint32_t>(shm::SlotState::CLOSED)) {
+            shm::resetRing(slot->request);
+            shm::resetRing(slot->response);
+            slot->state.store(static_cast<uint32_t>(shm::SlotState::FREE), std::memory_order_release);
+            continue;
+        }
+
+        if (!slots[i]) continue;
+
+        ShmSession& session = *slots[i];
+
+        bool requestsPending = !shm::ringEmpty(slot->request);
+        bool readable = !requestsPending || readGate(session);
+        readsPaused |= !readable;
+
+        if ((requestsPending && readable) || state == static_cast<uint32_t>(shm::SlotState::CLOSED)) {
+            session.readAvailable();
+            handler(session, completions);
+            work = true;
+        }
+
+        if (session.hasPendingOutbound()) {
+            session.flush();
+            work = true;
+        }
+
+        // Release the slot once the agent disconnected and its requests were handled
+        if ((session.isPeerClosed() || session.hasProtocolError()) && !session.hasOutstandingRequests()) {
+            logEvent<LogLevel::INFO>(logging,
+                                     "ShmTransport::serviceSlots(): Agent disconnected. Slot={}", i);
+
+            sessionSlots.erase(session.getSessionId());
+            onClose(session.getSessionId());
+            slots[i].reset();
+            shm::resetRing(slot->request);
+            shm::resetRing(slot->response);
+            slot->state.store(static_cast<uint32_t>(shm::SlotState::FREE), std::memory_order_release);
+        }
+    }
+
+    return work;
+}
+
+//#########################################################################
+bool ShmTransport::slotsPending() {
+    if (!completions.empty()) return true;
+
+    for (uint32_t i = 0; i < slotCount; i++) {
+        shm::ShmSlot* slot = shm::regionSlot(mapping.address, i);
+        uint32_t state = slot->state.load(std::memory_order_acquire);
+
+        bool connected = (state == static_cast<uint32_t>(shm::SlotState::CONNECTED));
+        bool closed    = (state == static_cast<uint32_t>(shm::SlotState::CLOSED));
+
+        if (closed || (connected && (!slots[i] || (!shm::ringEmpty(slot->request) && readGate(*slots[i]))))) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//#########################################################################
+void ShmTransport::ringDoorbell() {
+    shm::ShmRegionHeader* header = shm::regionHeader(mapping.address);
+
+    // Pairs with the fence in run(); either the engine sees the waiting flag
+    // or the transport sees the completions before sleeping
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (header->serverWaiting.load(std::memory_order_relaxed)) {
+        header->doorbell.fetch_add(1, std::memory_order_release);
+        shm::futexWake(header->doorbell);
+    }
+}
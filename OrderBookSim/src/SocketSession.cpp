@@ -0,0 +1,48 @@
+// Project Includes
+#include <SocketSession.hpp>
+
+//#########################################################################
+SocketSession::SocketSession (
+    SOCKET socket,
+    uint32_t sessionId
+) : Session(sessionId),
+    socket(socket) {}
+
+SocketSession::~SocketSession() {
+    if (socket != INVALID_SOCKET) {
+        net::closeSocket(socket);
+    }
+}
+
+//#########################################################################
+SOCKET SocketSession::getSocket() const {
+    return socket;
+}
+
+//#########################################################################
+long SocketSession::receiveBytes(char* buffer, size_t length) {
+    long bytesRcv = net::receive(socket, buffer, length);
+
+    if (bytesRcv > 0) {
+        return bytesRcv;
+    }
+
+    // Peer closed the connection; frames already read are still processed
+    if (bytesRcv == 0) {
+        markPeerClosed();
+        return 0;
+    }
+
+    return net::wouldBlock() ? 0 : -1;
+}
+
+//#########################################################################
+long SocketSession::sendSlices(net::IoSlice* slices, size_t count) {
+    long bytesSent = net::sendVectored(socket, slices, count);
+
+    if (bytesSent < 0) {
+        return net::wouldBlock() ? 0 : -1;
+    }
+
+    return bytesSent;
+}
@@ -0,0 +1,178 @@
+// Global Includes
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <signal.h>
+#endif
+
+// Project Includes
+#include <LatencyHistogram.hpp>
+#include <StageTimers.hpp>
+
+namespace {
+    constexpr size_t STAGE_COUNT = static_cast<size_t>(stages::Stage::COUNT); // Stages per thread
+    constexpr const char* STAGE_NAMES[STAGE_COUNT] = {
+        "decode", "route", "execute", "validate", "match", "insert", "history", "serialize", "send"
+    };
+
+    std::mutex registryMutex;                                    // Guards the registry
+    std::vector<std::unique_ptr<stages::ThreadStages>> registry; // Histograms of every thread that recorded
+    std::atomic<bool> dumpRequested{false};                      // Set by the SIGUSR1 handler
+
+    /**
+     * @brief Measure the timestamp counter rate against the steady clock
+     * (once, on the first dump).
+     *
+     * @return double - ticks per nanosecond
+     */
+    double ticksPerNs() {
+        static const double rate = []() {
+            auto clockStart = std::chrono::steady_clock::now();
+            uint64_t tickStart = stages::readTicks();
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            uint64_t tickEnd = stages::readTicks();
+            auto clockEnd = std::chrono::steady_clock::now();
+
+            double ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(clockEnd - clockStart).count());
+            return (ns > 0 && tickEnd > tickStart) ? (tickEnd - tickStart) / ns : 1.0;
+        }();
+        return rate;
+    }
+
+    /**
+     * @brief Convert a stage histogram to nanoseconds.
+     *
+     * @param histogram - stage histogram (ticks)
+     * @param rate - ticks per nanosecond
+     * @param out - histogram to add the durations to (ns)
+     */
+    void addNs(const stages::StageHistogram& histogram, double rate, LatencyHistogram& out) {
+        for (size_t index = 0; index < stages::StageHistogram::BUCKETS; index++) {
+            uint64_t count = histogram.counts[index].load(std::memory_order_relaxed);
+            if (count > 0) out.record(static_cast<int64_t>(stages::StageHistogram::midpointOf(index) / rate), count);
+        }
+    }
+
+    /**
+     * @brief Write one dump line.
+     *
+     * @param out - stream to write to
+     * @param thread - thread name (or "all")
+     * @param stage - stage name
+     * @param histogram - durations of the stage (ns)
+     * @param maxNs - longest duration (exact, ns)
+     */
+    void writeLine(std::ostream& out, const char* thread, const char* stage, const LatencyHistogram& histogram, int64_t maxNs) {
+        char line[160];
+        std::snprintf(line, sizeof(line), "%-12s %-10s %12llu %10.1f %8lld %8lld %8lld %10lld\n", thread, stage,
+                      static_cast<unsigned long long>(histogram.getCount()), histogram.getMean(),
+                      static_cast<long long>(histogram.valueAtPercentile(50)),
+                      static_cast<long long>(histogram.valueAtPercentile(99)),
+                      static_cast<long long>(histogram.valueAtPercentile(99.9)), static_cast<long long>(maxNs));
+        out << line;
+    }
+
+#if !defined(_WIN32)
+    /**
+     * @brief SIGUSR1 handler: only flags the dump (async-signal-safe).
+     */
+    void onDumpSignal(int) {
+        dumpRequested.store(true, std::memory_order_relaxed);
+    }
+#endif
+}
+
+namespace stages {
+    //#########################################################################
+    double StageHistogram::midpointOf(size_t index) {
+        constexpr size_t subBuckets = size_t(1) << SUB_BUCKET_BITS;
+        if (index < 2 * subBuckets) return static_cast<double>(index);
+
+        int shift = static_cast<int>(index / subBuckets) - 1;
+        double lowest = static_cast<double>(index - static_cast<size_t>(shift) * subBuckets) * static_cast<double>(1ULL << shift);
+        return lowest + (static_cast<double>(1ULL << shift) - 1) / 2.0;
+    }
+
+    //#########################################################################
+    ThreadStages& threadStages() {
+        thread_local ThreadStages* stages = nullptr;
+
+        if (!stages) {
+            std::lock_guard<std::mutex> lock(registryMutex);
+            registry.push_back(std::make_unique<ThreadStages>());
+            stages = registry.back().get();
+        }
+
+        return *stages;
+    }
+
+    //#########################################################################
+    void setThreadName(const std::string& name) {
+        if constexpr (ENABLED) {
+            ThreadStages& stages = threadStages();
+
+            std::lock_guard<std::mutex> lock(registryMutex);
+            std::snprintf(stages.name, sizeof(stages.name), "%s", name.c_str());
+        }
+    }
+
+    //#########################################################################
+    void dump(std::ostream& out) {
+        double rate = ticksPerNs();
+        char header[160];
+        std::snprintf(header, sizeof(header), "%-12s %-10s %12s %10s %8s %8s %8s %10s\n", "thread", "stage", "count",
+                      "mean ns", "p50", "p99", "p99.9", "max");
+        out << "Stage timers (" << rate << " ticks/ns)\n" << header;
+
+        std::vector<LatencyHistogram> totals(STAGE_COUNT);
+        std::vector<int64_t> totalMaxNs(STAGE_COUNT, 0);
+
+        std::lock_guard<std::mutex> lock(registryMutex);
+        for (const std::unique_ptr<ThreadStages>& thread : registry) {
+            for (size_t stage = 0; stage < STAGE_COUNT; stage++) {
+                const StageHistogram& histogram = thread->histograms[stage];
+                if (histogram.total.load(std::memory_order_relaxed) == 0) continue;
+
+                LatencyHistogram ns;
+                addNs(histogram, rate, ns);
+                int64_t maxNs = static_cast<int64_t>(histogram.maxTicks.load(std::memory_order_relaxed) / rate);
+
+                writeLine(out, thread->name, STAGE_NAMES[stage], ns, maxNs);
+                totals[stage].merge(ns);
+                totalMaxNs[stage] = std::max(totalMaxNs[stage], maxNs);
+            }
+        }
+
+        for (size_t stage = 0; stage < STAGE_COUNT; stage++) {
+            if (totals[stage].getCount() > 0) writeLine(out, "all", STAGE_NAMES[stage], totals[stage], totalMaxNs[stage]);
+        }
+        out.flush();
+    }
+
+    //#########################################################################
+    void dumpOnSignal() {
+#if !defined(_WIN32)
+        static std::once_flag started;
+        std::call_once(started, []() {
+            struct sigaction action = {};
+            action.sa_handler = onDumpSignal;
+            sigemptyset(&action.sa_mask);
+            action.sa_flags = SA_RESTART;
+            sigaction(SIGUSR1, &action, nullptr);
+
+            std::thread([]() {
+                while (true) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                    if (dumpRequested.exchange(false, std::memory_order_relaxed)) dump(std::cerr);
+                }
+            }).detach();
+        });
+#endif
+    }
+};
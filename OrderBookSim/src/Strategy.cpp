@@ -0,0 +1,349 @@
+// Global Includes
+#include <cmath>
+#include <cstring>
+#include <string>
+
+// Project Includes
+#include <Strategy.hpp>
+
+//#########################################################################
+bool OrderGateway::submitOrder(uint64_t clientTag, int qty, double price, OrderSide side, OrderType type) {
+    if (count == CAPACITY) return false;
+
+    requests[(head + count) % CAPACITY] = GatewayRequest{clientTag, false, side, type, qty, price};
+    count++;
+
+    return true;
+}
+
+//#########################################################################
+bool OrderGateway::cancelOrder(uint64_t clientTag) {
+    if (count == CAPACITY) return false;
+
+    requests[(head + count) % CAPACITY] = GatewayRequest{clientTag, true, OrderSide::BUY, OrderType::LIMIT, 0, 0.0};
+    count++;
+
+    return true;
+}
+
+//#########################################################################
+bool OrderGateway::pop(GatewayRequest& request) {
+    if (count == 0) return false;
+
+    request = requests[head];
+    head = (head + 1) % CAPACITY;
+    count--;
+
+    return true;
+}
+
+//#########################################################################
+double OrderGateway::getBestBid() const {
+    return book.getBestBidPrice();
+}
+
+//#########################################################################
+double OrderGateway::getBestAsk() const {
+    return book.getBestAskPrice();
+}
+
+//#########################################################################
+size_t OrderGateway::getPendingCount() const {
+    return count;
+}
+
+//#########################################################################
+StrategyHost::StrategyHost (
+    OrderBook& book,
+    Strategy& strategy
+) : book(book),
+    strategy(strategy),
+    orderGateway(book),
+    stats(),
+    openOrders(),
+    openOrderCount(0),
+    submitting(nullptr),
+    submittingLeavesQty(0),
+    submittingExecuted(false) {
+    book.addListener(this);
+
+    strategy.orderGateway = &orderGateway;
+    strategy.onStart();
+}
+
+//#########################################################################
+StrategyHost::~StrategyHost() {
+    book.removeListener(this);
+    strategy.orderGateway = nullptr;
+}
+
+//#########################################################################
+size_t StrategyHost::drain() {
+    size_t executed = 0;
+    GatewayRequest request;
+
+    // Callbacks of executed requests may queue more; those run in the same drain
+    while (executed < MAX_DRAIN && orderGateway.pop(request)) {
+        execute(request);
+        executed++;
+    }
+
+    return executed;
+}
+
+//#########################################################################
+void StrategyHost::rejectPending(ErrorCode errCode) {
+    GatewayRequest request;
+
+    while (orderGateway.pop(request)) {
+        stats.rejects++;
+        strategy.onReject(request.clientTag, errCode);
+    }
+}
+
+//#########################################################################
+void StrategyHost::execute(const GatewayRequest& request) {
+    ErrorCode errCode = ErrorCode::OK;
+
+    if (request.cancel) {
+        OpenOrder* order = findByTag(request.clientTag);
+        if (!order) {
+            stats.rejects++;
+            strategy.onReject(request.clientTag, ErrorCode::BAD_ID);
+            return;
+        }
+
+        // Copied; the cancel's execution removes the order from the table
+        book.cancelOrder(std::string(order->orderId), errCode);
+
+        if (errCode == ErrorCode::OK) {
+            stats.cancels++;
+        }
+        else {
+            stats.rejects++;
+            strategy.onReject(request.clientTag, errCode);
+        }
+        return;
+    }
+
+    if (openOrderCount == OrderGateway::CAPACITY) {
+        stats.rejects++;
+        strategy.onReject(request.clientTag, ErrorCode::THROTTLED);
+        return;
+    }
+
+    // The new order's executions are reported before the book returns its ID
+    submitting = &request;
+    submittingExecuted = false;
+    submittingLeavesQty = request.qty;
+
+    std::string orderId = book.createOrder(request.qty, request.price, request.side, request.type, errCode);
+
+    submitting = nullptr;
+
+    if (errCode != ErrorCode::OK) {
+        stats.rejects++;
+        strategy.onReject(request.clientTag, errCode);
+        return;
+    }
+
+    stats.orders++;
+
+    // Only LIMIT remainders rest; other types are canceled by the book
+    if (request.type != OrderType::LIMIT || submittingLeavesQty == 0) return;
+
+    if (orderId.size() >= ID_SIZE) {
+        book.cancelOrder(orderId, errCode);
+        stats.rejects++;
+        strategy.onReject(request.clientTag, ErrorCode::FATAL);
+        return;
+    }
+
+    OpenOrder& order = openOrders[openOrderCount++];
+    order.clientTag = request.clientTag;
+    std::memcpy(order.orderId, orderId.c_str(), orderId.size() + 1);
+}
+
+//#########################################################################
+StrategyHost::OpenOrder* StrategyHost::findById(const char* orderId) {
+    for (size_t index = 0; index < openOrderCount; index++) {
+        if (std::strcmp(openOrders[index].orderId, orderId) == 0) return &openOrders[index];
+    }
+
+    return nullptr;
+}
+
+//#########################################################################
+StrategyHost::OpenOrder* StrategyHost::findByTag(uint64_t clientTag) {
+    for (size_t index = 0; index < openOrderCount; index++) {
+        if (openOrders[index].clientTag == clientTag) return &openOrders[index];
+    }
+
+    return nullptr;
+}
+
+//#########################################################################
+void StrategyHost::removeOpenOrder(OpenOrder* order) {
+    *order = openOrders[--openOrderCount];
+}
+
+//#########################################################################
+void StrategyHost::onBookUpdate(const BookLevelEvent& event) {
+    strategy.onBookUpdate(event);
+}
+
+//#########################################################################
+void StrategyHost::onTrade(const TradeEvent& event) {
+    strategy.onTrade(event);
+}
+
+//#########################################################################
+void StrategyHost::onExecution(const ExecutionEvent& event) {
+    uint64_t clientTag = 0;
+    OpenOrder* order = findById(event.orderId);
+
+    if (order) {
+        clientTag = order->clientTag;
+        if (event.leavesQty == 0) removeOpenOrder(order);
+    }
+    // Only the incoming order executes on its own side while it is matched
+    else if (submitting && event.side == submitting->side) {
+        clientTag = submitting->clientTag;
+        submittingExecuted = true;
+        submittingLeavesQty = event.leavesQty;
+    }
+    else {
+        return;
+    }
+
+    if (event.type == ExecutionType::FILL) stats.fills++;
+
+    FillEvent fill{clientTag, event.type, event.side, event.price, event.qty, event.leavesQty, event.timestamp};
+    strategy.onFill(fill);
+}
+
+//#########################################################################
+OrderBook& StrategyHost::getBook() {
+    return book;
+}
+
+//#########################################################################
+Strategy& StrategyHost::getStrategy() {
+    return strategy;
+}
+
+//#########################################################################
+bool StrategyHost::hasPending() const {
+    return orderGateway.getPendingCount() > 0;
+}
+
+//#########################################################################
+size_t StrategyHost::getOpenOrderCount() const {
+    return openOrderCount;
+}
+
+//#########################################################################
+const StrategyStats& StrategyHost::getStats() const {
+    return stats;
+}
+
+//#########################################################################
+QuotingStrategy::QuotingStrategy (
+    const QuotingParams& params
+) : params(params),
+    center(params.referencePrice),
+    position(0),
+    cash(0.0),
+    bid{0, 0.0},
+    ask{0, 0.0},
+    nextTag(1) {}
+
+//#########################################################################
+void QuotingStrategy::onStart() {
+    requote();
+}
+
+//#########################################################################
+void QuotingStrategy::onTrade(const TradeEvent& event) {
+    center = event.price;
+    requote();
+}
+
+//#########################################################################
+void QuotingStrategy::onFill(const FillEvent& event) {
+    if (event.type == ExecutionType::FILL) {
+        if (event.side == OrderSide::BUY) {
+            position += event.qty;
+            cash -= event.price * event.qty;
+        }
+        else {
+            position -= event.qty;
+            cash += event.price * event.qty;
+        }
+    }
+
+    if (event.leavesQty == 0) {
+        if (bid.tag == event.clientTag) bid = Quote{0, 0.0};
+        if (ask.tag == event.clientTag) ask = Quote{0, 0.0};
+    }
+
+    requote();
+}
+
+//#########################################################################
+void QuotingStrategy::onReject(uint64_t clientTag, ErrorCode errCode) {
+    (void)errCode;
+
+    if (bid.tag == clientTag) bid = Quote{0, 0.0};
+    if (ask.tag == clientTag) ask = Quote{0, 0.0};
+}
+
+//#########################################################################
+void QuotingStrategy::requote() {
+    double tick = params.tickSize;
+    double skewed = center - position * params.skewTicksPerUnit * tick;
+
+    double bidTarget = std::llround(skewed / tick - params.halfSpreadTicks) * tick;
+    double askTarget = std::llround(skewed / tick + params.halfSpreadTicks) * tick;
+
+    // Only quote the sides that keep the position within the limit
+    moveQuote(bid, OrderSide::BUY, position + params.quoteQty <= params.maxPosition && bidTarget >= tick ? bidTarget : 0.0);
+    moveQuote(ask, OrderSide::SELL, position - params.quoteQty >= -params.maxPosition ? askTarget : 0.0);
+}
+
+//#########################################################################
+void QuotingStrategy::moveQuote(Quote& quote, OrderSide side, double target) {
+    if (quote.tag != 0 && std::llround(quote.price / params.tickSize) == std::llround(target / params.tickSize)) return;
+
+    if (quote.tag != 0) {
+        gateway().cancelOrder(quote.tag);
+        quote = Quote{0, 0.0};
+    }
+
+    if (target <= 0) return;
+
+    uint64_t tag = nextTag++;
+    if (gateway().submitOrder(tag, params.quoteQty, target, side, OrderType::LIMIT)) {
+        quote = Quote{tag, target};
+    }
+}
+
+//#########################################################################
+int64_t QuotingStrategy::getPosition() const {
+    return position;
+}
+
+//#########################################################################
+double QuotingStrategy::getCash() const {
+    return cash;
+}
+
+//#########################################################################
+double QuotingStrategy::getBidPrice() const {
+    return bid.tag != 0 ? bid.price : 0.0;
+}
+
+//#########################################################################
+double QuotingStrategy::getAskPrice() const {
+    return ask.tag != 0 ? ask.price : 0.0;
+}
@@ -0,0 +1,314 @@
+// Global Includes
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <memory>
+#include <sstream>
+
+// Project Includes
+#include <SweepRunner.hpp>
+#include <utils.hpp>
+
+namespace {
+    /**
+     * @brief Parse a whole decimal integer within a range.
+     *
+     * @param text - text to parse
+     * @param min - smallest accepted value
+     * @param max - largest accepted value
+     * @param value - populated with the parsed value
+     *
+     * @return bool - true if the text is an integer in [min, max]; false otherwise
+     */
+    bool parseInt(const std::string& text, long long min, long long max, long long& value) {
+        if (text.empty()) return false;
+
+        char* end = nullptr;
+        errno = 0;
+        long long parsed = std::strtoll(text.c_str(), &end, 10);
+
+        if (errno != 0 || *end != '\0' || parsed < min || parsed > max) return false;
+
+        value = parsed;
+        return true;
+    }
+
+    /**
+     * @brief Parse a decimal number within a range.
+     *
+     * @param text - text to parse
+     * @param min - smallest accepted value
+     * @param max - largest accepted value
+     * @param value - populated with the parsed value
+     *
+     * @return bool - true if the text is a number in [min, max]; false otherwise
+     */
+    bool parseReal(const std::string& text, double min, double max, double& value) {
+        if (text.empty()) return false;
+
+        char* end = nullptr;
+        errno = 0;
+        double parsed = std::strtod(text.c_str(), &end);
+
+        if (errno != 0 || *end != '\0' || !(parsed >= min && parsed <= max)) return false;
+
+        value = parsed;
+        return true;
+    }
+
+    /**
+     * @brief Quote a text column if it holds a separator or quote.
+     *
+     * @param text - column value
+     *
+     * @return std::string - value safe to write as one column
+     */
+    std::string quoteColumn(const std::string& text) {
+        if (text.find_first_of(",\"\n") == std::string::npos) return text;
+
+        std::string quoted = "\"";
+        for (char c : text) {
+            if (c == '"') quoted += '"';
+            quoted += c;
+        }
+        return quoted + "\"";
+    }
+}
+
+//#########################################################################
+SweepRunner::SweepRunner (
+    const std::vector<std::string>& symbols,
+    uint32_t workers
+) : symbols(symbols),
+    pool(workers) {}
+
+//#########################################################################
+std::vector<SweepResult> SweepRunner::run(const std::vector<SweepRun>& runs) {
+    std::vector<SweepResult> results(runs.size());
+
+    // Every run writes only its own result
+    pool.run(runs.size(), [&](size_t index, uint32_t worker) {
+        SweepResult& result = results[index];
+        result.runIndex = static_cast<uint32_t>(index);
+        result.worker = worker;
+        runOne(runs[index], result);
+    });
+
+    return results;
+}
+
+//#########################################################################
+void SweepRunner::runOne(const SweepRun& run, SweepResult& result) const {
+    result.run = run;
+
+    try {
+        auto start = std::chrono::steady_clock::now();
+
+        AgentManager manager(symbols, run.seed);
+        for (uint32_t agentId = 0; agentId < run.agents; agentId++) {
+            manager.addAgent(std::make_unique<ZeroIntelligenceAgent>(agentId, run.seed, run.params));
+        }
+
+        if (run.simSeconds > 0) {
+            manager.setLatency(AgentLatency{run.latencyNs, run.latencyNs});
+            manager.runUntil(static_cast<int64_t>(run.simSeconds) * 1000000000);
+        }
+        else {
+            // Step runs take their IDs from a clock of their own, so runs share no counter
+            utils::VirtualClock clock;
+            utils::setThreadClock(&clock);
+            manager.run(run.steps);
+            utils::setThreadClock(nullptr);
+        }
+
+        result.stats = manager.getStats();
+        for (uint32_t bookIndex = 0; bookIndex < manager.getBookCount(); bookIndex++) {
+            result.lastTradePrices.push_back(manager.getLastTradePrice(bookIndex));
+        }
+
+        result.elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+    catch (const std::exception& e) {
+        utils::setThreadClock(nullptr);
+        result.error = e.what();
+    }
+}
+
+//#########################################################################
+void SweepRunner::writeColumns(std::ostream& out, const std::vector<std::string>& symbols,
+                               const std::vector<SweepResult>& results) {
+    out << "run,seed,agents,steps,sim_seconds,latency_us,initial_price,tick_size,max_offset_ticks,max_qty,"
+           "activity,cancel_rate,market_rate,max_open_orders,mean_wakeup_us,ttl_us,"
+           "wakeups,orders,cancels,expiries,rejects,trades,fills,events,elapsed_s,worker";
+    for (const std::string& symbol : symbols) {
+        out << ",last_" << symbol;
+    }
+    out << ",error\n";
+
+    std::ostringstream row;
+    row.precision(10);
+
+    for (const SweepResult& result : results) {
+        const SweepRun& run = result.run;
+        const AgentManagerStats& stats = result.stats;
+
+        row.str("");
+        row << result.runIndex << ',' << run.seed << ',' << run.agents << ',' << run.steps << ','
+            << run.simSeconds << ',' << run.latencyNs / 1000 << ','
+            << run.params.initialPrice << ',' << run.params.tickSize << ',' << run.params.maxOffsetTicks << ','
+            << run.params.maxQty << ',' << run.params.activity << ',' << run.params.cancelRate << ','
+            << run.params.marketRate << ',' << run.params.maxOpenOrders << ','
+            << run.params.meanWakeupIntervalNs / 1000 << ',' << run.params.orderTimeToLiveNs / 1000 << ','
+            << stats.wakeups << ',' << stats.orders << ',' << stats.cancels << ',' << stats.expiries << ','
+            << stats.rejects << ',' << stats.trades << ',' << stats.fills << ',' << stats.events() << ','
+            << result.elapsedSeconds << ',' << result.worker;
+        for (size_t bookIndex = 0; bookIndex < symbols.size(); bookIndex++) {
+            row << ',' << (bookIndex < result.lastTradePrices.size() ? result.lastTradePrices[bookIndex] : 0.0);
+        }
+        row << ',' << quoteColumn(result.error) << '\n';
+
+        out << row.str();
+    }
+}
+
+//#########################################################################
+bool SweepRunner::parseSweepLine(const std::string& line, const SweepRun& base,
+                                 std::vector<SweepRun>& runs, std::string& error) {
+    std::string text = line.substr(0, line.find('#'));
+    std::istringstream tokens(text);
+    std::string token;
+
+    SweepRun run = base;
+    long long repeat = 1;
+    bool empty = true;
+
+    while (tokens >> token) {
+        empty = false;
+
+        size_t separator = token.find('=');
+        if (separator == std::string::npos) {
+            error = "expected 'key=value', got '" + token + "'";
+            return false;
+        }
+
+        std::string key = token.substr(0, separator);
+        std::string value = token.substr(separator + 1);
+        long long number = 0;
+        double real = 0;
+        bool valid = true;
+
+        if (key == "seed") {
+            valid = parseInt(value, 0, LLONG_MAX, number);
+            run.seed = static_cast<uint64_t>(number);
+        }
+        else if (key == "agents") {
+            valid = parseInt(value, 0, 10000000, number);
+            run.agents = static_cast<uint32_t>(number);
+        }
+        else if (key == "steps") {
+            valid = parseInt(value, 1, LLONG_MAX, number);
+            run.steps = static_cast<uint64_t>(number);
+        }
+        else if (key == "sim-seconds") {
+            valid = parseInt(value, 0, 10000000, number);
+            run.simSeconds = static_cast<uint64_t>(number);
+        }
+        else if (key == "latency-us") {
+            valid = parseInt(value, 0, 10000000, number);
+            run.latencyNs = number * 1000;
+        }
+        else if (key == "initial-price") {
+            valid = parseReal(value, 0.0001, 1e9, real);
+            run.params.initialPrice = real;
+        }
+        else if (key == "tick-size") {
+            valid = parseReal(value, 0.0001, 1e6, real);
+            run.params.tickSize = real;
+        }
+        else if (key == "max-offset-ticks") {
+            valid = parseInt(value, 0, 1000000, number);
+            run.params.maxOffsetTicks = static_cast<int>(number);
+        }
+        else if (key == "max-qty") {
+            valid = parseInt(value, 1, 1000000000, number);
+            run.params.maxQty = static_cast<int>(number);
+        }
+        else if (key == "activity" || key == "cancel-rate" || key == "market-rate") {
+            valid = parseReal(value, 0.0, 1.0, real);
+            if (key == "activity") run.params.activity = real;
+            else if (key == "cancel-rate") run.params.cancelRate = real;
+            else run.params.marketRate = real;
+        }
+        else if (key == "max-open-orders") {
+            valid = parseInt(value, 1, 1000000, number);
+            run.params.maxOpenOrders = static_cast<uint32_t>(number);
+        }
+        else if (key == "mean-wakeup-us") {
+            valid = parseInt(value, 1, 1000000000000LL, number);
+            run.params.meanWakeupIntervalNs = number * 1000;
+        }
+        else if (key == "ttl-us") {
+            valid = parseInt(value, 0, 1000000000000LL, number);
+            run.params.orderTimeToLiveNs = number * 1000;
+        }
+        else if (key == "repeat") {
+            valid = parseInt(value, 1, 1000000, number);
+            repeat = number;
+        }
+        else {
+            error = "unknown sweep key '" + key + "'";
+            return false;
+        }
+
+        if (!valid) {
+            error = "invalid value '" + value + "' for " + key;
+            return false;
+        }
+    }
+
+    if (empty) return true;
+
+    for (long long copy = 0; copy < repeat; copy++) {
+        runs.push_back(run);
+        run.seed++;
+    }
+
+    return true;
+}
+
+//#########################################################################
+bool SweepRunner::parseSweepFile(const std::string& path, const SweepRun& base,
+                                 std::vector<SweepRun>& runs, std::string& error) {
+    std::ifstream file(path);
+    if (!file) {
+        error = "unable to open sweep file '" + path + "'";
+        return false;
+    }
+
+    std::string line;
+    int lineNumber = 0;
+
+    while (std::getline(file, line)) {
+        lineNumber++;
+
+        if (!parseSweepLine(line, base, runs, error)) {
+            error = path + ":" + std::to_string(lineNumber) + ": " + error;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//#########################################################################
+uint32_t SweepRunner::getWorkerCount() const {
+    return pool.getWorkerCount();
+}
+
+//#########################################################################
+uint64_t SweepRunner::getSteals() const {
+    return pool.getSteals();
+}
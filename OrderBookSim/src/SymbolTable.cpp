@@ -0,0 +1,164 @@
+// Global Includes
+#include <cstring>
+
+// Project Includes
+#include <SymbolTable.hpp>
+
+//#########################################################################
+SymbolTable::SymbolTable(uint32_t capacity) :
+    capacity(capacity),
+    symbols(),
+    releasedIds(),
+    slots(),
+    slotMask(0),
+    usedSlots(0),
+    symbolCount(0) {
+
+    rehash(16);
+}
+
+//#########################################################################
+uint32_t SymbolTable::add(const std::string& symbol) {
+    uint32_t id = find(symbol);
+    if (id != INVALID_ID) return id;
+
+    // Reuse a released ID, otherwise hand out the next one
+    if (!releasedIds.empty()) {
+        id = releasedIds.back();
+        releasedIds.pop_back();
+        symbols[id] = symbol;
+    }
+    else if (symbols.size() < capacity) {
+        id = static_cast<uint32_t>(symbols.size());
+        symbols.push_back(symbol);
+    }
+    else {
+        return INVALID_ID;
+    }
+
+    // Keep the table (including removed markers) at most half full; grow it
+    // only if the live symbols need the space, otherwise just drop the markers
+    if ((usedSlots + 1) * 2 > slots.size()) {
+        rehash((symbolCount + 1) * 4 > slots.size() ? slots.size() * 2 : slots.size());
+    }
+
+    insertSlot(id);
+    symbolCount++;
+
+    return id;
+}
+
+//#########################################################################
+uint32_t SymbolTable::remove(const std::string& symbol) {
+    uint32_t symbolHash = hash(symbol.data(), symbol.size());
+    size_t index = symbolHash & slotMask;
+
+    while (slots[index].id != INVALID_ID) {
+        Slot& slot = slots[index];
+
+        if (slot.id != REMOVED_ID && slot.hash == symbolHash && symbols[slot.id] == symbol) {
+            uint32_t id = slot.id;
+
+            // Keep the slot occupied so probes for other symbols continue past it
+            slot.id = REMOVED_ID;
+            symbolCount--;
+
+            return id;
+        }
+
+        index = (index + 1) & slotMask;
+    }
+
+    return INVALID_ID;
+}
+
+//#########################################################################
+void SymbolTable::release(uint32_t id) {
+    symbols[id].clear();
+    releasedIds.push_back(id);
+}
+
+//#########################################################################
+uint32_t SymbolTable::find(const char* symbol, size_t length) const {
+    uint32_t symbolHash = hash(symbol, length);
+    size_t index = symbolHash & slotMask;
+
+    // Probe until the symbol or an empty slot is found
+    while (slots[index].id != INVALID_ID) {
+        const Slot& slot = slots[index];
+
+        if (slot.id != REMOVED_ID && slot.hash == symbolHash) {
+            const std::string& candidate = symbols[slot.id];
+
+            if (candidate.size() == length && std::memcmp(candidate.data(), symbol, length) == 0) {
+                return slot.id;
+            }
+        }
+
+        index = (index + 1) & slotMask;
+    }
+
+    return INVALID_ID;
+}
+
+//#########################################################################
+uint32_t SymbolTable::find(const std::string& symbol) const {
+    return find(symbol.data(), symbol.size());
+}
+
+//#########################################################################
+const std::string& SymbolTable::getSymbol(uint32_t id) const {
+    return symbols[id];
+}
+
+//#########################################################################
+size_t SymbolTable::size() const {
+    return symbols.size();
+}
+
+//#########################################################################
+size_t SymbolTable::count() const {
+    return symbolCount;
+}
+
+//#########################################################################
+uint32_t SymbolTable::hash(const char* symbol, size_t length) {
+    uint32_t value = 2166136261u;
+
+    for (size_t i = 0; i < length; i++) {
+        value ^= static_cast<unsigned char>(symbol[i]);
+        value *= 16777619u;
+    }
+
+    return value;
+}
+
+//#########################################################################
+void SymbolTable::insertSlot(uint32_t id) {
+    uint32_t symbolHash = hash(symbols[id].data(), symbols[id].size());
+    size_t index = symbolHash & slotMask;
+
+    while (slots[index].id != INVALID_ID) {
+        index = (index + 1) & slotMask;
+    }
+
+    slots[index] = {symbolHash, id};
+    usedSlots++;
+}
+
+//#########################################################################
+void SymbolTable::rehash(size_t slotCount) {
+    std::vector<Slot> previous;
+    previous.swap(slots);
+
+    slots.assign(slotCount, Slot{0, INVALID_ID});
+    slotMask = slotCount - 1;
+    usedSlots = 0;
+
+    // Removed markers are dropped; only live symbols are re-inserted
+    for (const Slot& slot : previous) {
+        if (slot.id != INVALID_ID && slot.id != REMOVED_ID) {
+            insertSlot(slot.id);
+        }
+    }
+}
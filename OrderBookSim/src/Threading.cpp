@@ -0,0 +1,94 @@
+// Global Includes
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+// Project Includes
+#include <Threading.hpp>
+
+namespace threading {
+    namespace {
+        /**
+         * @brief Apply a placement to a native thread handle.
+         */
+#ifdef _WIN32
+        bool applyNative(HANDLE thread, const ThreadPlacement& placement) {
+            bool applied = true;
+
+            if (placement.cpu >= 0) {
+                applied &= (SetThreadAffinityMask(thread, DWORD_PTR(1) << placement.cpu) != 0);
+            }
+
+            if (placement.priority > 0) {
+                applied &= (SetThreadPriority(thread, THREAD_PRIORITY_TIME_CRITICAL) != 0);
+            }
+
+            return applied;
+        }
+#else
+        bool applyNative(pthread_t thread, const ThreadPlacement& placement) {
+            bool applied = true;
+
+#ifdef __linux__
+            if (placement.cpu >= 0) {
+                cpu_set_t cpus;
+                CPU_ZERO(&cpus);
+                CPU_SET(placement.cpu, &cpus);
+                applied &= (pthread_setaffinity_np(thread, sizeof(cpus), &cpus) == 0);
+            }
+#else
+            // Affinity is not available on this platform
+            applied &= (placement.cpu < 0);
+#endif
+
+            if (placement.priority > 0) {
+                sched_param param{};
+                param.sched_priority = placement.priority;
+                applied &= (pthread_setschedparam(thread, SCHED_FIFO, &param) == 0);
+            }
+
+            return applied;
+        }
+#endif
+    }
+
+    //#########################################################################
+    ThreadPlacement ThreadConfig::placement(ThreadRole role, uint32_t index) const {
+        ThreadPlacement result;
+
+        switch (role) {
+            case ThreadRole::ENGINE:
+                if (!engineCpus.empty()) result.cpu = engineCpus[index % engineCpus.size()];
+                result.priority = realtimePriority;
+                break;
+            case ThreadRole::NETWORK:
+                result.cpu = networkCpu;
+                result.priority = realtimePriority;
+                break;
+            case ThreadRole::SHARED_MEMORY:
+                result.cpu = sharedMemoryCpu;
+                result.priority = realtimePriority;
+                break;
+            case ThreadRole::MARKET_DATA:
+                result.cpu = marketDataCpu;
+                break;
+            case ThreadRole::LOGGER:
+                result.cpu = loggerCpu;
+                break;
+        }
+
+        return result;
+    }
+
+    //#########################################################################
+    bool applyPlacement(const ThreadPlacement& placement) {
+#ifdef _WIN32
+        return applyNative(GetCurrentThread(), placement);
+#else
+        return applyNative(pthread_self(), placement);
+#endif
+    }
+};
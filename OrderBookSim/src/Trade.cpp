@@ -1,5 +1,5 @@
 // Global Includes
-#include <sstream>
+#include <string>
 
 // Project Includes
 #include <Trade.hpp>
@@ -28,46 +28,42 @@ Trade::Trade (
 
 //#########################################################################
 std::string Trade::generateTradeId() {
-    std::stringstream trade_oss;
-
-    // Timestamp set in the constructor
-    trade_oss << timestamp << "_" << utils::generateRandom_6DigitNum();
-
-    // Return the formed order ID
-    return trade_oss.str();
+    // Timestamp set in the constructor; the sequence keeps IDs created in the
+    // same millisecond unique
+    return utils::generateId(timestamp);
 }
 
 //#########################################################################
-std::string Trade::getTradeId() {
+std::string Trade::getTradeId() const {
     return tradeId;
 }
 
 //#########################################################################
-std::string Trade::getBuyOrderId() {
+std::string Trade::getBuyOrderId() const {
     return buyOrderId;
 }
 
 //#########################################################################
-std::string Trade::getSellOrderId() {
+std::string Trade::getSellOrderId() const {
     return sellOrderId;
 }
 
 //#########################################################################
-std::string Trade::getSymbol() {
+std::string Trade::getSymbol() const {
     return symbol;
 }
 
 //#########################################################################
-int Trade::getQty() {
+int Trade::getQty() const {
     return qty;
 }
 
 //#########################################################################
-long long Trade::getTimestamp() {
+long long Trade::getTimestamp() const {
     return timestamp;
 }
 
 //#########################################################################
-double Trade::getPrice() {
+double Trade::getPrice() const {
     return price;
 }
\ No newline at end of file
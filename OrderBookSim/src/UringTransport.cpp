@@ -0,0 +1,796 @@
+// Global Includes
+#include <algorithm>
+#include <cstring>
+
+#ifdef __linux__
+#include <linux/io_uring.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
+// Project Includes
+#include <UringTransport.hpp>
+
+//#########################################################################
+UringSession::UringSession (
+    SOCKET socket,
+    uint32_t slot,
+    uint32_t sessionId
+) : Session(sessionId),
+    socket(socket),
+    slot(slot),
+    rxData(nullptr),
+    rxLength(0),
+    txStage(),
+    txSent(0),
+    txInFlight(false) {}
+
+UringSession::~UringSession() {
+    if (socket != INVALID_SOCKET) {
+        net::closeSocket(socket);
+    }
+}
+
+//#########################################################################
+void UringSession::deliver(const char* data, size_t length) {
+    rxData = data;
+    rxLength = length;
+}
+
+//#########################################################################
+void UringSession::endOfStream() {
+    markPeerClosed();
+}
+
+//#########################################################################
+bool UringSession::nextSend(const char*& data, size_t& length) {
+    if (txInFlight || txSent == txStage.size()) return false;
+
+    data = txStage.data() + txSent;
+    length = txStage.size() - txSent;
+    txInFlight = true;
+
+    return true;
+}
+
+//#########################################################################
+void UringSession::sendCompleted(size_t bytesSent) {
+    txInFlight = false;
+    txSent += bytesSent;
+
+    // Stage fully sent; it can take the next flush
+    if (txSent == txStage.size()) {
+        txStage.clear();
+        txSent = 0;
+    }
+}
+
+//#########################################################################
+long UringSession::receiveBytes(char* buffer, size_t length) {
+    size_t count = std::min(length, rxLength);
+    if (count == 0) return 0;
+
+    std::memcpy(buffer, rxData, count);
+    rxData += count;
+    rxLength -= count;
+
+    return static_cast<long>(count);
+}
+
+//#########################################################################
+long UringSession::sendSlices(net::IoSlice* slices, size_t count) {
+    // One send in progress at a time; the session keeps the rest queued
+    if (!txStage.empty()) return 0;
+
+    for (size_t i = 0; i < count; i++) {
+        txStage.append(net::sliceData(slices[i]), net::sliceLength(slices[i]));
+    }
+
+    return static_cast<long>(txStage.size());
+}
+
+//#########################################################################
+SOCKET UringSession::getSocket() const {
+    return socket;
+}
+
+//#########################################################################
+uint32_t UringSession::getSlot() const {
+    return slot;
+}
+
+//#########################################################################
+bool UringSession::hasUndelivered() const {
+    return rxLength > 0;
+}
+
+//#########################################################################
+bool UringSession::hasSendInProgress() const {
+    return !txStage.empty();
+}
+
+//#########################################################################
+UringTransport::UringTransport (
+    SOCKET listenSocket,
+    FrameHandler handler,
+    ReadGate readGate,
+    CloseHandler onClose,
+    std::atomic<uint32_t>& sessionIds,
+    bool logging
+) : listenSocket(listenSocket),
+    handler(handler),
+    readGate(readGate),
+    onClose(onClose),
+    sessionIds(sessionIds),
+    logging(logging),
+    busyPoll(false),
+    ringFd(-1),
+    sqRing(nullptr),
+    sqRingSize(0),
+    cqRing(nullptr),
+    cqRingSize(0),
+    sqes(nullptr),
+    sqesSize(0),
+    sqHead(nullptr),
+    sqTail(nullptr),
+    sqArray(nullptr),
+    sqMask(0),
+    sqEntries(0),
+    sqLocalTail(0),
+    sqPending(0),
+    cqHead(nullptr),
+    cqTail(nullptr),
+    cqMask(0),
+    cqes(nullptr),
+    wakeupFd(-1),
+    completions([this]() { wake(); }),
+    completed(),
+    reports(),
+    bufferRing(nullptr),
+    bufferRingSize(0),
+    buffers(),
+    bufferTail(0),
+    connections(),
+    sessionSlots(),
+    freeSlots(),
+    activeSlots(),
+    pausedSlots(),
+    pauseCheck{0, PAUSE_CHECK_NS},
+    pauseCheckArmed(false) {}
+
+UringTransport::~UringTransport() {
+    connections.clear();
+    destroyRing();
+}
+
+#ifdef __linux__
+
+namespace {
+    constexpr uint64_t SLOT_MASK       = 0xFFFFFFFF;
+    constexpr int GENERATION_SHIFT     = 32;
+    constexpr int OPERATION_SHIFT      = 56;
+
+    int uringSetup(unsigned entries, io_uring_params* params) {
+        return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+    }
+
+    int uringEnter(int fd, unsigned toSubmit, unsigned minComplete, unsigned flags) {
+        return static_cast<int>(syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, nullptr, 0));
+    }
+
+    int uringRegister(int fd, unsigned opcode, void* arg, unsigned count) {
+        return static_cast<int>(syscall(__NR_io_uring_register, fd, opcode, arg, count));
+    }
+
+    static_assert(sizeof(__kernel_timespec) == 2 * sizeof(int64_t), "Unexpected __kernel_timespec layout");
+}
+
+//#########################################################################
+bool UringTransport::start() {
+    io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+
+    ringFd = uringSetup(QUEUE_DEPTH, &params);
+    if (ringFd < 0) {
+        logEvent<LogLevel::ERR>(logging,
+                                "UringTransport::start(): io_uring_setup failed. Error={}", errno);
+        return false;
+    }
+
+    // Map the submission ring, completion ring and submission entries
+    sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+    bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (singleMap) {
+        sqRingSize = cqRingSize = std::max(sqRingSize, cqRingSize);
+    }
+
+    sqRing = mmap(nullptr, sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQ_RING);
+    if (sqRing == MAP_FAILED) {
+        sqRing = nullptr;
+        destroyRing();
+        return false;
+    }
+
+    if (singleMap) {
+        cqRing = sqRing;
+    }
+    else {
+        cqRing = mmap(nullptr, cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_CQ_RING);
+        if (cqRing == MAP_FAILED) {
+            cqRing = nullptr;
+            destroyRing();
+            return false;
+        }
+    }
+
+    sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+    sqes = mmap(nullptr, sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED) {
+        sqes = nullptr;
+        destroyRing();
+        return false;
+    }
+
+    char* sq = static_cast<char*>(sqRing);
+    sqHead      = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+    sqTail      = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+    sqArray     = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+    sqMask      = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+    sqEntries   = params.sq_entries;
+    sqLocalTail = *sqTail;
+
+    char* cq = static_cast<char*>(cqRing);
+    cqHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+    cqTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+    cqMask = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+    cqes   = cq + params.cq_off.cqes;
+
+    // Register the receive buffers as a provided buffer ring; multishot recv
+    // completions carry the ID of the buffer the kernel filled
+    bufferRingSize = BUFFER_COUNT * sizeof(io_uring_buf);
+    bufferRing = mmap(nullptr, bufferRingSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (bufferRing == MAP_FAILED) {
+        bufferRing = nullptr;
+        destroyRing();
+        return false;
+    }
+
+    io_uring_buf_reg registration;
+    std::memset(&registration, 0, sizeof(registration));
+    registration.ring_addr    = reinterpret_cast<uint64_t>(bufferRing);
+    registration.ring_entries = BUFFER_COUNT;
+    registration.bgid         = BUFFER_GROUP;
+
+    if (uringRegister(ringFd, IORING_REGISTER_PBUF_RING, &registration, 1) < 0) {
+        logEvent<LogLevel::ERR>(logging,
+                                "UringTransport::start(): buffer ring registration failed. Error={}", errno);
+        destroyRing();
+        return false;
+    }
+
+    buffers.resize(BUFFER_COUNT * BUFFER_SIZE);
+    for (unsigned i = 0; i < BUFFER_COUNT; i++) {
+        recycleBuffer(static_cast<uint16_t>(i));
+    }
+
+    // Engines signal the eventfd when responses complete; a multishot poll on
+    // it wakes the event loop
+    wakeupFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (wakeupFd < 0) {
+        destroyRing();
+        return false;
+    }
+
+    armWakeup();
+
+    // io_uring waits for readiness itself; the listener must block
+    int socketFlags = fcntl(listenSocket, F_GETFL, 0);
+    fcntl(listenSocket, F_SETFL, socketFlags & ~O_NONBLOCK);
+
+    armAccept();
+
+    logEvent<LogLevel::INFO>(logging,
+                             "UringTransport::start(): io_uring backend started. Queue depth={}", sqEntries);
+
+    return true;
+}
+
+//#########################################################################
+void UringTransport::run() {
+    while (true) {
+        // Submit everything prepared in the last batch and wait for the next
+        // (busy-poll: only submit; the loop spins on the completion queue)
+        if (!submit(!busyPoll)) {
+            logEvent<LogLevel::ERR>(logging,
+                                    "UringTransport::run(): io_uring_enter failed. Error={}", errno);
+            return;
+        }
+
+        // Handle every available completion as one batch
+        unsigned head = *cqHead;
+        unsigned tail = __atomic_load_n(cqTail, __ATOMIC_ACQUIRE);
+
+        while (head != tail) {
+            const io_uring_cqe& cqe = static_cast<io_uring_cqe*>(cqes)[head & cqMask];
+            handleCompletion(cqe.user_data, cqe.res, cqe.flags);
+            head++;
+
+            if (head == tail) {
+                // Release the handled entries and pick up completions that arrived meanwhile
+                __atomic_store_n(cqHead, head, __ATOMIC_RELEASE);
+                tail = __atomic_load_n(cqTail, __ATOMIC_ACQUIRE);
+            }
+        }
+
+        __atomic_store_n(cqHead, head, __ATOMIC_RELEASE);
+
+        drainCompletions();
+        serviceActive();
+    }
+}
+
+//#########################################################################
+void* UringTransport::nextSqe() {
+    // Queue full; hand the prepared entries to the kernel first
+    if (sqLocalTail - __atomic_load_n(sqHead, __ATOMIC_ACQUIRE) >= sqEntries) {
+        submit(false);
+    }
+
+    unsigned index = sqLocalTail & sqMask;
+    io_uring_sqe* sqe = static_cast<io_uring_sqe*>(sqes) + index;
+    std::memset(sqe, 0, sizeof(io_uring_sqe));
+
+    sqArray[index] = index;
+    sqLocalTail++;
+    sqPending++;
+
+    return sqe;
+}
+
+//#########################################################################
+bool UringTransport::submit(bool waitForCompletion) {
+    __atomic_store_n(sqTail, sqLocalTail, __ATOMIC_RELEASE);
+
+    // Nothing to submit or wait for; spare the system call
+    if (!waitForCompletion && sqPending == 0) return true;
+
+    unsigned flags = waitForCompletion ? IORING_ENTER_GETEVENTS : 0;
+    unsigned minComplete = waitForCompletion ? 1 : 0;
+
+    while (true) {
+        int submitted = uringEnter(ringFd, sqPending, minComplete, flags);
+
+        if (submitted >= 0) {
+            sqPending -= std::min(sqPending, static_cast<unsigned>(submitted));
+            return true;
+        }
+
+        if (errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+            return false;
+        }
+    }
+}
+
+//#########################################################################
+void UringTransport::armAccept() {
+    io_uring_sqe* sqe = static_cast<io_uring_sqe*>(nextSqe());
+    sqe->opcode       = IORING_OP_ACCEPT;
+    sqe->fd           = listenSocket;
+    sqe->ioprio       = IORING_ACCEPT_MULTISHOT;
+    sqe->accept_flags = SOCK_CLOEXEC;
+    sqe->user_data    = static_cast<uint64_t>(Operation::ACCEPT) << OPERATION_SHIFT;
+}
+
+//#########################################################################
+void UringTransport::armRecv(uint32_t slot) {
+    Connection& connection = connections[slot];
+
+    io_uring_sqe* sqe = static_cast<io_uring_sqe*>(nextSqe());
+    sqe->opcode    = IORING_OP_RECV;
+    sqe->fd        = connection.session->getSocket();
+    sqe->ioprio    = IORING_RECV_MULTISHOT;
+    sqe->flags     = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = BUFFER_GROUP;
+    sqe->user_data = (static_cast<uint64_t>(Operation::RECV) << OPERATION_SHIFT) |
+                     (static_cast<uint64_t>(connection.generation) << GENERATION_SHIFT) | slot;
+
+    connection.recvArmed = true;
+}
+
+//#########################################################################
+void UringTransport::armWakeup() {
+    io_uring_sqe* sqe = static_cast<io_uring_sqe*>(nextSqe());
+    sqe->opcode        = IORING_OP_POLL_ADD;
+    sqe->fd            = wakeupFd;
+    sqe->len           = IORING_POLL_ADD_MULTI;
+    sqe->poll32_events = POLLIN;
+    sqe->user_data     = static_cast<uint64_t>(Operation::WAKEUP) << OPERATION_SHIFT;
+}
+
+//#########################################################################
+void UringTransport::armTimeout() {
+    io_uring_sqe* sqe = static_cast<io_uring_sqe*>(nextSqe());
+    sqe->opcode    = IORING_OP_TIMEOUT;
+    sqe->fd        = -1;
+    sqe->addr      = reinterpret_cast<uint64_t>(pauseCheck);
+    sqe->len       = 1;
+    sqe->user_data = static_cast<uint64_t>(Operation::TIMEOUT) << OPERATION_SHIFT;
+
+    pauseCheckArmed = true;
+}
+
+//#########################################################################
+void UringTransport::cancelRecv(uint32_t slot) {
+    Connection& connection = connections[slot];
+    if (connection.recvCanceled) return;
+
+    // Match the armed recv by its user data; it completes with -ECANCELED
+    io_uring_sqe* sqe = static_cast<io_uring_sqe*>(nextSqe());
+    sqe->opcode    = IORING_OP_ASYNC_CANCEL;
+    sqe->fd        = -1;
+    sqe->addr      = (static_cast<uint64_t>(Operation::RECV) << OPERATION_SHIFT) |
+                     (static_cast<uint64_t>(connection.generation) << GENERATION_SHIFT) | slot;
+    sqe->user_data = static_cast<uint64_t>(Operation::CANCEL) << OPERATION_SHIFT;
+
+    connection.recvCanceled = true;
+}
+
+//#########################################################################
+void UringTransport::submitSend(uint32_t slot) {
+    Connection& connection = connections[slot];
+    const char* data = nullptr;
+    size_t length = 0;
+
+    if (!connection.session->nextSend(data, length)) return;
+
+    io_uring_sqe* sqe = static_cast<io_uring_sqe*>(nextSqe());
+    sqe->opcode    = IORING_OP_SEND;
+    sqe->fd        = connection.session->getSocket();
+    sqe->addr      = reinterpret_cast<uint64_t>(data);
+    sqe->len       = static_cast<uint32_t>(length);
+    sqe->msg_flags = MSG_NOSIGNAL;
+    sqe->user_data = (static_cast<uint64_t>(Operation::SEND) << OPERATION_SHIFT) |
+                     (static_cast<uint64_t>(connection.generation) << GENERATION_SHIFT) | slot;
+
+    connection.sendArmed = true;
+}
+
+//#########################################################################
+void UringTransport::handleCompletion(uint64_t userData, int32_t result, uint32_t flags) {
+    Operation operation = static_cast<Operation>(userData >> OPERATION_SHIFT);
+
+    if (operation == Operation::ACCEPT) {
+        onAccept(result);
+
+        // The multishot accept was terminated; re-arm it
+        if (!(flags & IORING_CQE_F_MORE)) {
+            armAccept();
+        }
+        return;
+    }
+
+    if (operation == Operation::WAKEUP) {
+        // Reset the eventfd; the completions are drained after this batch
+        uint64_t count = 0;
+        ssize_t bytesRead = read(wakeupFd, &count, sizeof(count));
+        (void)bytesRead;
+
+        if (!(flags & IORING_CQE_F_MORE)) {
+            armWakeup();
+        }
+        return;
+    }
+
+    if (operation == Operation::TIMEOUT) {
+        // Paused sessions are checked again when this batch is serviced
+        pauseCheckArmed = false;
+        return;
+    }
+
+    // The canceled recv reports its own completion
+    if (operation == Operation::CANCEL) return;
+
+    uint32_t slot = static_cast<uint32_t>(userData & SLOT_MASK);
+    uint16_t generation = static_cast<uint16_t>(userData >> GENERATION_SHIFT);
+
+    // Completion for a connection that no longer exists; only recycle its buffer
+    if (slot >= connections.size() || !connections[slot].session ||
+        connections[slot].generation != generation) {
+        if (flags & IORING_CQE_F_BUFFER) {
+            recycleBuffer(static_cast<uint16_t>(flags >> IORING_CQE_BUFFER_SHIFT));
+        }
+        return;
+    }
+
+    if (operation == Operation::RECV) {
+        onRecv(slot, result, flags);
+    }
+    else {
+        onSend(slot, result);
+    }
+}
+
+//#########################################################################
+void UringTransport::onAccept(int32_t result) {
+    if (result < 0) {
+        logEvent<LogLevel::ERR>(logging,
+                                "UringTransport::onAccept(): accept failed. Error={}", -result);
+        return;
+    }
+
+    SOCKET clientSocket = result;
+    net::setNoDelay(clientSocket);
+
+    uint32_t slot;
+    if (!freeSlots.empty()) {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+    }
+    else {
+        slot = static_cast<uint32_t>(connections.size());
+        connections.emplace_back();
+    }
+
+    Connection& connection = connections[slot];
+    connection.session = std::make_unique<UringSession>(clientSocket, slot, sessionIds++);
+    sessionSlots[connection.session->getSessionId()] = slot;
+    connection.recvArmed = false;
+    connection.recvCanceled = false;
+    connection.sendArmed = false;
+    connection.closing = false;
+    connection.active = false;
+
+    // The recv is armed when the connection is serviced, if its read gate is open
+    markActive(slot);
+
+    logEvent<LogLevel::INFO>(logging,
+                             "UringTransport::onAccept(): Client socket connected. Session={}",
+                             connection.session->getSessionId());
+}
+
+//#########################################################################
+void UringTransport::onRecv(uint32_t slot, int32_t result, uint32_t flags) {
+    Connection& connection = connections[slot];
+    UringSession& session = *connection.session;
+
+    if (!(flags & IORING_CQE_F_MORE)) {
+        connection.recvArmed = false;
+        connection.recvCanceled = false;
+    }
+
+    if (result > 0 && (flags & IORING_CQE_F_BUFFER)) {
+        uint16_t bufferId = static_cast<uint16_t>(flags >> IORING_CQE_BUFFER_SHIFT);
+
+        // Hand the buffer to the session and handle every complete frame; the
+        // frame handler compacts the receive buffer so the loop always progresses
+        session.deliver(buffers.data() + bufferId * BUFFER_SIZE, static_cast<size_t>(result));
+
+        while (session.hasUndelivered() && !session.hasProtocolError()) {
+            if (session.readAvailable() <= 0) break;
+            handler(session, completions);
+        }
+
+        // The data was copied into the session; the buffer can be reused
+        session.deliver(nullptr, 0);
+        recycleBuffer(bufferId);
+    }
+    else if (result == 0) {
+        session.endOfStream();
+    }
+    else if (result == -ENOBUFS || result == -ECANCELED) {
+        // Every buffer was in use, or the read gate closed; the recv is re-armed
+        // when the connection is serviced
+    }
+    else if (result < 0) {
+        closeConnection(slot);
+    }
+
+    markActive(slot);
+}
+
+//#########################################################################
+void UringTransport::onSend(uint32_t slot, int32_t result) {
+    UringSession& session = *connections[slot].session;
+    connections[slot].sendArmed = false;
+
+    if (result < 0) {
+        closeConnection(slot);
+    }
+    else {
+        session.sendCompleted(static_cast<size_t>(result));
+    }
+
+    markActive(slot);
+}
+
+//#########################################################################
+void UringTransport::markActive(uint32_t slot) {
+    if (!connections[slot].active) {
+        connections[slot].active = true;
+        activeSlots.push_back(slot);
+    }
+}
+
+//#########################################################################
+void UringTransport::drainCompletions() {
+    if (completions.empty()) return;
+
+    completions.drain(completed, reports);
+
+    for (Completion& completion : completed) {
+        completion.session->completeRequest(completion.seq, completion.response, std::move(completion.query), completion.trace);
+        markActive(static_cast<UringSession*>(completion.session)->getSlot());
+    }
+
+    // Reports of sessions that disconnected are dropped
+    for (const RoutedReport& routed : reports) {
+        auto slot = sessionSlots.find(routed.sessionId);
+
+        if (slot != sessionSlots.end()) {
+            connections[slot->second].session->deliverReport(routed.report);
+            markActive(slot->second);
+        }
+    }
+}
+
+//#########################################################################
+void UringTransport::wake() {
+    // The busy-polling loop checks the completions on every pass
+    if (busyPoll) return;
+
+    uint64_t one = 1;
+    ssize_t bytesWritten = write(wakeupFd, &one, sizeof(one));
+    (void)bytesWritten;
+}
+
+//#########################################################################
+void UringTransport::serviceActive() {
+    // Sessions paused in the last batch are checked against their read gate again
+    for (uint32_t slot : pausedSlots) {
+        markActive(slot);
+    }
+    pausedSlots.clear();
+
+    for (uint32_t slot : activeSlots) {
+        Connection& connection = connections[slot];
+        connection.active = false;
+
+        if (!connection.session) continue;
+        UringSession& session = *connection.session;
+
+        if (!connection.closing) {
+            // Stage the queued responses (if no send is in progress) and submit them
+            session.flush();
+            submitSend(slot);
+
+            if (session.hasProtocolError() ||
+                (session.isPeerClosed() && !session.hasOutstandingRequests() &&
+                 !session.hasPendingOutbound() && !session.hasSendInProgress())) {
+                closeConnection(slot);
+            }
+        }
+
+        // Flow control; while the read gate is closed the requests stay in the
+        // socket and back up to the client
+        if (!connection.closing && !session.isPeerClosed()) {
+            if (readGate(session)) {
+                if (!connection.recvArmed) armRecv(slot);
+            }
+            else {
+                if (connection.recvArmed) cancelRecv(slot);
+                pausedSlots.push_back(slot);
+            }
+        }
+
+        // Release the slot once the kernel holds no operation on the socket and
+        // no engine holds a request of the session
+        if (connection.closing && !connection.recvArmed && !connection.sendArmed &&
+            !session.hasOutstandingRequests()) {
+            logEvent<LogLevel::INFO>(logging,
+                                     "UringTransport::serviceActive(): Closing session={}", session.getSessionId());
+
+            sessionSlots.erase(session.getSessionId());
+            onClose(session.getSessionId());
+            connection.session.reset();
+            connection.generation++;
+            freeSlots.push_back(slot);
+        }
+    }
+
+    activeSlots.clear();
+
+    // Engines may drain without answering the paused sessions; wake up shortly
+    // to check their read gates again (a busy-polling loop checks every pass)
+    if (!pausedSlots.empty() && !pauseCheckArmed && !busyPoll) {
+        armTimeout();
+    }
+}
+
+//#########################################################################
+void UringTransport::closeConnection(uint32_t slot) {
+    Connection& connection = connections[slot];
+    if (connection.closing) return;
+
+    // Shutting down terminates the armed recv and any send in progress
+    connection.closing = true;
+    shutdown(connection.session->getSocket(), SHUT_RDWR);
+
+    markActive(slot);
+}
+
+//#########################################################################
+void UringTransport::recycleBuffer(uint16_t bufferId) {
+    // Index the ring as a plain array of io_uring_buf; in C++ the header's
+    // flexible array member is not at offset 0. The ring tail overlays the
+    // reserved field of the first entry.
+    io_uring_buf* ring = static_cast<io_uring_buf*>(bufferRing);
+    io_uring_buf& entry = ring[bufferTail & (BUFFER_COUNT - 1)];
+
+    entry.addr = reinterpret_cast<uint64_t>(buffers.data() + bufferId * BUFFER_SIZE);
+    entry.len  = static_cast<uint32_t>(BUFFER_SIZE);
+    entry.bid  = bufferId;
+
+    bufferTail++;
+    __atomic_store_n(&ring[0].resv, bufferTail, __ATOMIC_RELEASE);
+}
+
+//#########################################################################
+void UringTransport::destroyRing() {
+    if (bufferRing != nullptr) {
+        munmap(bufferRing, bufferRingSize);
+        bufferRing = nullptr;
+    }
+
+    if (sqes != nullptr) {
+        munmap(sqes, sqesSize);
+        sqes = nullptr;
+    }
+
+    if (cqRing != nullptr && cqRing != sqRing) {
+        munmap(cqRing, cqRingSize);
+    }
+    cqRing = nullptr;
+
+    if (sqRing != nullptr) {
+        munmap(sqRing, sqRingSize);
+        sqRing = nullptr;
+    }
+
+    if (ringFd >= 0) {
+        close(ringFd);
+        ringFd = -1;
+    }
+
+    if (wakeupFd >= 0) {
+        close(wakeupFd);
+        wakeupFd = -1;
+    }
+}
+
+#else
+
+//#########################################################################
+bool UringTransport::start() {
+    logEvent<LogLevel::ERR>(logging,
+                            "UringTransport::start(): io_uring is only available on Linux");
+    return false;
+}
+
+//#########################################################################
+void UringTransport::run() {}
+
+//#########################################################################
+void UringTransport::wake() {}
+
+//#########################################################################
+void UringTransport::destroyRing() {}
+
+#endif
+
+//#########################################################################
+void UringTransport::setBusyPoll(bool t_busyPoll) {
+    busyPoll = t_busyPoll;
+}
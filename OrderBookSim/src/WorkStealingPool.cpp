@@ -0,0 +1,136 @@
+// Global Includes
+#include <algorithm>
+
+// Project Includes
+#include <WorkStealingPool.hpp>
+
+//#########################################################################
+WorkStealingPool::WorkStealingPool (
+    uint32_t workers
+) : batchTask(nullptr),
+    batchId(0),
+    busyWorkers(0),
+    batchError(),
+    stopping(false),
+    steals(0) {
+    if (workers == 0) workers = std::max(1u, std::thread::hardware_concurrency());
+
+    for (uint32_t worker = 0; worker < workers; worker++) {
+        queues.push_back(std::make_unique<WorkerQueue>());
+    }
+
+    for (uint32_t worker = 0; worker < workers; worker++) {
+        threads.emplace_back(&WorkStealingPool::workerLoop, this, worker);
+    }
+}
+
+//#########################################################################
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    batchReady.notify_all();
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+//#########################################################################
+void WorkStealingPool::run(size_t taskCount, const Task& task) {
+    if (taskCount == 0) return;
+
+    // Contiguous range per worker; stealing evens out the rest
+    size_t workers = queues.size();
+    for (size_t worker = 0; worker < workers; worker++) {
+        std::lock_guard<std::mutex> lock(queues[worker]->mutex);
+        for (size_t index = worker * taskCount / workers; index < (worker + 1) * taskCount / workers; index++) {
+            queues[worker]->tasks.push_back(index);
+        }
+    }
+
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        batchTask = &task;
+        batchError = nullptr;
+        busyWorkers = static_cast<uint32_t>(workers);
+        batchId++;
+        batchReady.notify_all();
+
+        batchDone.wait(lock, [this] { return busyWorkers == 0; });
+        batchTask = nullptr;
+        error = batchError;
+    }
+
+    if (error) std::rethrow_exception(error);
+}
+
+//#########################################################################
+void WorkStealingPool::workerLoop(uint32_t worker) {
+    uint64_t lastBatch = 0;
+
+    while (true) {
+        const Task* task = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            batchReady.wait(lock, [this, lastBatch] { return stopping || batchId != lastBatch; });
+            if (stopping) return;
+
+            lastBatch = batchId;
+            task = batchTask;
+        }
+
+        size_t index = 0;
+        while (takeTask(worker, index)) {
+            try {
+                (*task)(index, worker);
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!batchError) batchError = std::current_exception();
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--busyWorkers == 0) batchDone.notify_one();
+    }
+}
+
+//#########################################################################
+bool WorkStealingPool::takeTask(uint32_t worker, size_t& task) {
+    {
+        WorkerQueue& own = *queues[worker];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = own.tasks.back();
+            own.tasks.pop_back();
+            return true;
+        }
+    }
+
+    // Steal the oldest task of the next worker that has one
+    for (size_t offset = 1; offset < queues.size(); offset++) {
+        WorkerQueue& victim = *queues[(worker + offset) % queues.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = victim.tasks.front();
+            victim.tasks.pop_front();
+            steals.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//#########################################################################
+uint32_t WorkStealingPool::getWorkerCount() const {
+    return static_cast<uint32_t>(threads.size());
+}
+
+//#########################################################################
+uint64_t WorkStealingPool::getSteals() const {
+    return steals.load(std::memory_order_relaxed);
+}
@@ -1,10 +1,162 @@
 // Global Includes
+#include <chrono>
+#include <fstream>
 #include <iostream>
+#include <memory>
 #include <string>
 #include <vector>
 
 // Project Includes
+#include <AgentManager.hpp>
+#include <Config.hpp>
 #include <OrderBookManager.hpp>
+#include <StageTimers.hpp>
+#include <SweepRunner.hpp>
+
+/**
+ * @brief Run an in-process simulation of zero-intelligence and order flow
+ * agents and print its counters.
+ *
+ * @param serverConfig - symbols, agent counts, steps and seed of the simulation
+ *
+ * @return int - status code
+ */
+int runSimulation(const ServerConfig& serverConfig) {
+    std::vector<std::string> symbols = serverConfig.symbols;
+    if (symbols.empty()) symbols.push_back("TEMP");
+
+    std::vector<std::unique_ptr<QuotingStrategy>> makers; // Outlive the manager running them
+    AgentManager manager(symbols, serverConfig.seed);
+    for (uint32_t agentId = 0; agentId < serverConfig.agents; agentId++) {
+        manager.addAgent(std::make_unique<ZeroIntelligenceAgent>(agentId, serverConfig.seed));
+    }
+
+    OrderFlowParams flowParams;
+    flowParams.arrivals = serverConfig.flowArrivals;
+    for (uint32_t flow = 0; flow < serverConfig.flowAgents; flow++) {
+        uint32_t agentId = serverConfig.agents + flow;
+        manager.addAgent(std::make_unique<OrderFlowAgent>(agentId, serverConfig.seed, flowParams,
+                                                          flow % static_cast<uint32_t>(symbols.size())));
+    }
+
+    // Example market maker on every book, quoting around the agents' reference price
+    if (serverConfig.marketMaker) {
+        for (uint32_t bookIndex = 0; bookIndex < symbols.size(); bookIndex++) {
+            makers.push_back(std::make_unique<QuotingStrategy>());
+            manager.addStrategy(bookIndex, *makers.back());
+        }
+    }
+
+    // Frequent batch auctions instead of continuous matching
+    if (serverConfig.auctionInterval > 0) {
+        AuctionSchedule auctions;
+        auctions.allocation = serverConfig.auctionAllocation;
+
+        if (serverConfig.simSeconds > 0) {
+            auctions.intervalNs = static_cast<int64_t>(serverConfig.auctionInterval) * 1000000;
+        }
+        else {
+            auctions.intervalSteps = serverConfig.auctionInterval;
+        }
+        manager.setAuctions(auctions);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    if (serverConfig.simSeconds > 0) {
+        manager.setLatency(AgentLatency{serverConfig.latencyNs, serverConfig.latencyNs});
+        manager.runUntil(static_cast<int64_t>(serverConfig.simSeconds) * 1000000000);
+    }
+    else {
+        manager.run(serverConfig.agentSteps);
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    const AgentManagerStats& stats = manager.getStats();
+    std::cout << "agents=" << serverConfig.agents << " flow-agents=" << serverConfig.flowAgents << " books=" << symbols.size()
+              << " steps=" << stats.steps << " wakeups=" << stats.wakeups << " simulated=" << serverConfig.simSeconds << "s"
+              << " seed=" << serverConfig.seed << "\n"
+              << "orders=" << stats.orders << " cancels=" << stats.cancels << " rejects=" << stats.rejects
+              << " expiries=" << stats.expiries << " trades=" << stats.trades << " fills=" << stats.fills
+              << " auctions=" << stats.auctions << "\n"
+              << "elapsed=" << seconds << "s events/s=" << (seconds > 0 ? stats.events() / seconds : 0) << "\n";
+
+    // Memory held by every book; pool misses (node allocations that went to the heap) per book operation
+    for (uint32_t bookIndex = 0; bookIndex < manager.getBookCount(); bookIndex++) {
+        BookMemoryStats memory = manager.getOrderBook(bookIndex).getMemoryStats();
+        uint64_t operations = memory.creates.operations + memory.modifies.operations + memory.cancels.operations;
+        uint64_t poolMisses = memory.creates.poolMisses + memory.modifies.poolMisses + memory.cancels.poolMisses;
+
+        std::cout << "memory " << symbols[bookIndex] << ": total=" << memory.totalBytes() / 1024 << "KB"
+                  << " levels=" << memory.levels.bytesReserved / 1024 << "KB orders=" << memory.orders.bytesReserved / 1024
+                  << "KB index=" << memory.index.bytesReserved / 1024 << "KB history="
+                  << (memory.orderHistoryBytes + memory.tradeHistoryBytes) / 1024 << "KB resting=" << memory.restingOrders
+                  << " pool-misses/op=" << (operations > 0 ? static_cast<double>(poolMisses) / operations : 0) << "\n";
+    }
+
+    for (size_t bookIndex = 0; bookIndex < makers.size(); bookIndex++) {
+        std::cout << "market-maker " << symbols[bookIndex] << ": position=" << makers[bookIndex]->getPosition()
+                  << " cash=" << makers[bookIndex]->getCash() << "\n";
+    }
+
+    if constexpr (stages::ENABLED) stages::dump(std::cerr);
+
+    return 0;
+}
+
+/**
+ * @brief Run the simulations of a sweep file on every core and write their
+ * results.
+ *
+ * @param serverConfig - symbols, sweep file, results file, workers, and the
+ *                       base run every sweep line is applied over
+ *
+ * @return int - status code
+ */
+int runSweep(const ServerConfig& serverConfig) {
+    std::vector<std::string> symbols = serverConfig.symbols;
+    if (symbols.empty()) symbols.push_back("TEMP");
+
+    SweepRun base;
+    base.seed = serverConfig.seed;
+    if (serverConfig.agents > 0) base.agents = serverConfig.agents;
+    base.steps = serverConfig.agentSteps;
+    base.simSeconds = serverConfig.simSeconds;
+    base.latencyNs = serverConfig.latencyNs;
+
+    std::vector<SweepRun> runs;
+    std::string error;
+    if (!SweepRunner::parseSweepFile(serverConfig.sweepFile, base, runs, error)) {
+        std::cerr << "orderBook: " << error << "\n";
+        return 1;
+    }
+
+    std::ofstream output(serverConfig.sweepOutput);
+    if (!output) {
+        std::cerr << "orderBook: unable to write '" << serverConfig.sweepOutput << "'\n";
+        return 1;
+    }
+
+    SweepRunner runner(symbols, serverConfig.sweepWorkers);
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<SweepResult> results = runner.run(runs);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    SweepRunner::writeColumns(output, symbols, results);
+
+    uint64_t events = 0;
+    size_t failed = 0;
+    for (const SweepResult& result : results) {
+        events += result.stats.events();
+        if (!result.error.empty()) failed++;
+    }
+
+    std::cout << "runs=" << results.size() << " failed=" << failed << " workers=" << runner.getWorkerCount()
+              << " steals=" << runner.getSteals() << " output=" << serverConfig.sweepOutput << "\n"
+              << "elapsed=" << seconds << "s events/s=" << (seconds > 0 ? events / seconds : 0) << "\n";
+
+    return failed == 0 ? 0 : 1;
+}
 
 /**
  * @brief Runs the order book simulation engine
@@ -12,29 +164,99 @@
  * @param argc - number of command line arguements
  * @param argv - command line arguements
  *
- * Command line arguements
+ * Command line arguements (@see config::usage() for the full list)
  * -p (port) : port for the order book simulator
  * -s (symbols) : symbols for the order books (will
  * create one for each symbol)
  * -l : for order book manager console logging
+ * -c (file) : config file with the same options
+ * --busy-poll : spin-poll the engine and transport threads
+ * --cpu-* / --rt-priority : CPU affinity and real-time
+ * priority per thread role
+ * --max-* / --msg-burst / --engine-*-watermark : flow
+ * control limits
+ * --agents (n) : run n in-process agents against the
+ * symbols' books instead of the server (--steps, --seed,
+ * or --sim-seconds and --latency-us for virtual time;
+ * --flow-agents adds Poisson/Hawkes order flow;
+ * --auction-interval runs frequent batch auctions)
+ * --market-maker : quote every book with the example
+ * market making strategy (server and simulation)
+ * --sweep (file) : run the simulations of a sweep file on
+ * every core instead of the server (--sweep-out, --workers)
  *
  * @return int - engine status code
  */
 int main(int argc, char* argv[]) {
-    // Default parameters
-    int port = 8080;
-    bool consoleLog = true; // TEST => will be set to false
-    std::vector<std::string> exchangeSymbols = {"TEMP"}; // TEST => will be empty
+    ServerConfig serverConfig;
+    std::string error;
+
+    if (!config::parseArguments(argc, argv, serverConfig, error)) {
+        std::cerr << "orderBook: " << error << "\n" << config::usage();
+        return 1;
+    }
+
+    // Parameter sweep of in-process simulations; no network
+    if (!serverConfig.sweepFile.empty()) {
+        return runSweep(serverConfig);
+    }
+
+    // In-process simulation; no network
+    if (serverConfig.agents > 0 || serverConfig.flowAgents > 0) {
+        return runSimulation(serverConfig);
+    }
+
+    // Stage timer builds (-DOBM_STAGE_TIMERS=1) dump the stage histograms on SIGUSR1
+    if constexpr (stages::ENABLED) stages::dumpOnSignal();
+
+    std::vector<std::unique_ptr<QuotingStrategy>> makers; // Outlive the manager running them
 
     // Create the new order book manager
     OrderBookManager obManager = OrderBookManager(
-        port,
-        exchangeSymbols,
-        consoleLog
+        serverConfig.port,
+        serverConfig.symbols,
+        serverConfig.logging,
+        serverConfig.engineThreads,
+        serverConfig.warmBooks,
+        serverConfig.limits,
+        serverConfig.threads
     );
 
+    // Market data is multicast on port + 1; snapshots are served on port + 2
+    if (!obManager.startMarketDataPublisher(
+            serverConfig.marketDataGroup,
+            serverConfig.port + 1,
+            serverConfig.marketDataInterface,
+            serverConfig.port + 2)) {
+        std::cerr << "orderBook: failed to start the market data publisher on ports "
+                  << serverConfig.port + 1 << " and " << serverConfig.port + 2 << "\n";
+        return 1;
+    }
+
+    // Sampled request traces are written on SIGUSR2
+    if (serverConfig.traceSample > 0) {
+        obManager.startTracing(serverConfig.traceSample, serverConfig.traceOutput);
+    }
+
+    // Co-located agents connect through shared memory (region "obm_<port>")
+    std::string shmName = "obm_" + std::to_string(serverConfig.port);
+    shm::WaitMode shmWaitMode = serverConfig.threads.busyPoll ? shm::WaitMode::BUSY_POLL : shm::WaitMode::FUTEX;
+
+    if (serverConfig.shmSlots > 0 && !obManager.startSharedMemoryTransport(shmName, serverConfig.shmSlots, shmWaitMode)) {
+        std::cerr << "orderBook: failed to create the shared memory region " << shmName << "\n";
+        return 1;
+    }
+
+    // Example market maker on every initial book, run with the book's commands
+    if (serverConfig.marketMaker) {
+        for (const std::string& symbol : serverConfig.symbols) {
+            makers.push_back(std::make_unique<QuotingStrategy>());
+            obManager.addStrategy(symbol, *makers.back());
+        }
+    }
+
     // Run the order book manager
-    obManager.startListener();
+    obManager.startListener(serverConfig.ioBackend);
 
     return 0;
-}
\ No newline at end of file
+}
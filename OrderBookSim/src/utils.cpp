@@ -1,4 +1,5 @@
 // Global Includes
+#include <atomic>
 #include <chrono>
 #include <random>
 
@@ -20,7 +21,46 @@ namespace utils {
         return t_dist(t_gen);
     }
 
+    // Virtual clock of the calling thread; nullptr for the system clock
+    static thread_local VirtualClock* t_threadClock = nullptr;
+
+    void setThreadClock(VirtualClock* clock) {
+        t_threadClock = clock;
+    }
+
+    uint64_t generateSequenceNum() {
+        if (t_threadClock) return t_threadClock->sequence++;
+
+        static std::atomic<uint64_t> t_sequence(sixDigitLower);
+
+        return t_sequence.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::string generateId(long long timestamp) {
+        static constexpr char digits[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+        char id[ID_LENGTH];
+        uint64_t time = static_cast<uint64_t>(timestamp);
+        uint64_t sequence = generateSequenceNum();
+
+        for (int i = 7; i >= 0; i--) {
+            id[i] = digits[time % 36];
+            time /= 36;
+        }
+
+        id[8] = '_';
+
+        for (int i = 14; i >= 9; i--) {
+            id[i] = digits[sequence % 36];
+            sequence /= 36;
+        }
+
+        return std::string(id, ID_LENGTH);
+    }
+
     long long generateMSTimestamp() {
+        if (t_threadClock) return t_threadClock->nowNs / 1000000;
+
         // Generate the number of milliseconds since the last epoch
         return std::chrono::duration_cast<std::chrono::milliseconds>(
                     std::chrono::system_clock::now().time_since_epoch()
@@ -16,6 +16,10 @@ set "INCLUDE_DIR=..\include"
 
 set "BUILD_DIR=build"
 set "OUTPUT_EXE=%BUILD_DIR%\test.exe"
+set "BENCH_DIR=%BUILD_DIR%\benchmark"
+set "BENCH_EXE=%BUILD_DIR%\benchmark.exe"
+set "FUZZ_DIR=%BUILD_DIR%\fuzz"
+set "FUZZ_EXE=%BUILD_DIR%\fuzz.exe"
 
 REM ===============================
 REM Creating /build
@@ -55,13 +59,20 @@ REM ===============================
 echo ===============================
 echo Compiling test source files...
 echo ===============================
+REM benchmark_main.cpp and fuzz_main.cpp are separate executables (built below)
 for %%f in (%TEST_SRC_DIR%\*.cpp) do (
     set "FILENAME=%%~nf"
-    echo Compiling %%f ...
-    g++ -std=c++17 -Wall -Wextra -I "%INCLUDE_DIR%" -I "%TEST_INCLUDE_DIR%" -c "%%f" -o "%BUILD_DIR%\!FILENAME!.o"
-    if errorlevel 1 (
-        echo Compilation failed for %%f
-        exit /b 1
+    if /I "%%~nxf"=="benchmark_main.cpp" (
+        echo Skipping %%f
+    ) else if /I "%%~nxf"=="fuzz_main.cpp" (
+        echo Skipping %%f
+    ) else (
+        echo Compiling %%f ...
+        g++ -std=c++17 -Wall -Wextra -I "%INCLUDE_DIR%" -I "%TEST_INCLUDE_DIR%" -c "%%f" -o "%BUILD_DIR%\!FILENAME!.o"
+        if errorlevel 1 (
+            echo Compilation failed for %%f
+            exit /b 1
+        )
     )
 )
 
@@ -77,5 +88,65 @@ if errorlevel 1 (
     exit /b 1
 )
 
-echo Build succeeded. Output: %OUTPUT_EXE%
+REM ===============================
+REM Building the benchmark (optimized objects in /build/benchmark)
+REM ===============================
+echo ===============================
+echo Building the benchmark...
+echo ===============================
+if not exist "%BENCH_DIR%" (
+    echo Creating %BENCH_DIR%
+    mkdir "%BENCH_DIR%"
+)
+
+for %%f in (%SRC_DIR%\*.cpp %TEST_SRC_DIR%\benchmark_main.cpp) do (
+    set "FILENAME=%%~nf"
+    if /I "%%~nxf"=="main.cpp" (
+        echo Skipping %%f
+    ) else (
+        echo Compiling %%f ...
+        g++ -std=c++17 -O2 -Wall -Wextra -I "%INCLUDE_DIR%" -I "%TEST_INCLUDE_DIR%" -c "%%f" -o "%BENCH_DIR%\!FILENAME!.o"
+        if errorlevel 1 (
+            echo Compilation failed for %%f
+            exit /b 1
+        )
+    )
+)
+
+g++ %BENCH_DIR%\*.o -o "%BENCH_EXE%" -lws2_32
+if errorlevel 1 (
+    echo Linking the benchmark failed.
+    exit /b 1
+)
+
+REM ===============================
+REM Building the fuzzer (reuses the optimized objects in /build/benchmark)
+REM ===============================
+echo ===============================
+echo Building the fuzzer...
+echo ===============================
+if not exist "%FUZZ_DIR%" (
+    echo Creating %FUZZ_DIR%
+    mkdir "%FUZZ_DIR%"
+)
+
+echo Compiling %TEST_SRC_DIR%\fuzz_main.cpp ...
+g++ -std=c++17 -O2 -Wall -Wextra -I "%INCLUDE_DIR%" -I "%TEST_INCLUDE_DIR%" -c "%TEST_SRC_DIR%\fuzz_main.cpp" -o "%FUZZ_DIR%\fuzz_main.o"
+if errorlevel 1 (
+    echo Compilation failed for %TEST_SRC_DIR%\fuzz_main.cpp
+    exit /b 1
+)
+
+set "FUZZ_OBJS=%FUZZ_DIR%\fuzz_main.o"
+for %%f in (%BENCH_DIR%\*.o) do (
+    if /I not "%%~nxf"=="benchmark_main.o" set "FUZZ_OBJS=!FUZZ_OBJS! %%f"
+)
+
+g++ !FUZZ_OBJS! -o "%FUZZ_EXE%" -lws2_32
+if errorlevel 1 (
+    echo Linking the fuzzer failed.
+    exit /b 1
+)
+
+echo Build succeeded. Output: %OUTPUT_EXE%, %BENCH_EXE%, %FUZZ_EXE%
 endlocal
@@ -0,0 +1,97 @@
+// Global Includes
+#include <string>
+
+// Project Includes
+#include <Admission.hpp>
+#include <UnitTest.hpp>
+
+class Admission_UT : public UnitTest {
+    public:
+        /**
+         * @brief Create the admission unit test object.
+         */
+        Admission_UT() {
+            logTestHeader(testName);
+        }
+
+        /**
+         * @brief Runs all Admission unit tests.
+         *
+         * @return true if all unit tests pass; false otherwise
+         */
+        bool runTests() {
+            bool testResult = true;
+
+            // Run admission unit tests
+            testResult &= testTokenBucket();
+            testResult &= testUnlimited();
+
+            logTestResults(testName);
+
+            return testResult;
+        }
+
+    private:
+        // ========== UT Functions ==========
+        /**
+         * @brief Test the burst and refill of a token bucket.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testTokenBucket() {
+            bool testResult = true;
+
+            TokenBucket bucket;
+            const double rate = 1000;  // 1 token per ms
+            const double burst = 5;
+            const int64_t ms = 1000000;
+
+            // A full bucket admits the burst, then nothing until it refills
+            for (int i = 0; i < 5; i++) {
+                testResult &= bucket.tryConsume(rate, burst, 0);
+            }
+            testResult &= !bucket.tryConsume(rate, burst, 0);
+            logStatusUpdate("Burst admitted", testResult);
+
+            testResult &= bucket.tryConsume(rate, burst, 2 * ms);
+            testResult &= bucket.tryConsume(rate, burst, 2 * ms);
+            testResult &= !bucket.tryConsume(rate, burst, 2 * ms);
+            logStatusUpdate("Refilled at the rate", testResult);
+
+            // Refill is capped at the burst
+            int admitted = 0;
+            while (bucket.tryConsume(rate, burst, 1000 * ms)) admitted++;
+            testResult &= (admitted == 5);
+            logStatusUpdate("Refill capped at the burst", testResult);
+
+            bucket.reset();
+            testResult &= bucket.tryConsume(rate, burst, 1000 * ms);
+            logStatusUpdate("Reset refills the bucket", testResult);
+
+            processTestResult("Admission_UT::testTokenBucket()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test that a rate of 0 disables the limit.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testUnlimited() {
+            bool testResult = true;
+
+            TokenBucket bucket;
+            for (int i = 0; i < 1000; i++) {
+                testResult &= bucket.tryConsume(0, 0, 0);
+            }
+            logStatusUpdate("No limit", testResult);
+
+            processTestResult("Admission_UT::testUnlimited()", testResult);
+
+            return testResult;
+        }
+
+        // ========== UT Variables ==========
+        std::string testName = "Admission_UT";
+};
@@ -0,0 +1,406 @@
+// Global Includes
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Project Includes
+#include <Agent.hpp>
+#include <AgentManager.hpp>
+#include <EventQueue.hpp>
+#include <UnitTest.hpp>
+
+class AgentManager_UT : public UnitTest {
+    public:
+        /**
+         * @brief Create the agent manager unit test object.
+         */
+        AgentManager_UT() {
+            logTestHeader(testName);
+        }
+
+        /**
+         * @brief Runs all Agent Manager unit tests.
+         *
+         * @return true if all unit tests pass; false otherwise
+         */
+        bool runTests() {
+            bool testResult = true;
+
+            // Run agent manager unit tests
+            testResult &= testAgentRandom();
+            testResult &= testExecutionRouting();
+            testResult &= testDeterministicRun();
+            testResult &= testEventQueue();
+            testResult &= testVirtualTime();
+            testResult &= testVirtualTimeReplay();
+            testResult &= testBatchAuctions();
+
+            logTestResults(testName);
+
+            return testResult;
+        }
+
+    private:
+        /**
+         * @brief Agent that runs a callback on every wakeup and records its executions.
+         */
+        class ScriptedAgent : public Agent {
+            public:
+                ScriptedAgent(uint32_t agentId, std::function<void(AgentContext&)> script) :
+                    Agent(agentId, 0), script(script) {}
+
+                void onWakeup(AgentContext& context) override { script(context); }
+                void onExecution(const ExecutionEvent& event) override { executions.push_back(event); }
+
+                std::vector<ExecutionEvent> executions; // Executions delivered to the agent
+
+            private:
+                std::function<void(AgentContext&)> script; // Actions of each wakeup
+        };
+
+        // ========== UT Functions ==========
+        /**
+         * @brief Test the per-agent random streams.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testAgentRandom() {
+            bool testResult = true;
+
+            AgentRandom first(42, 7);
+            AgentRandom repeat(42, 7);
+            AgentRandom other(42, 8);
+
+            bool same = true;
+            bool differs = false;
+            for (int i = 0; i < 100; i++) {
+                uint64_t value = first();
+                same &= (value == repeat());
+                differs |= (value != other());
+            }
+            testResult &= same;
+            testResult &= differs;
+            logStatusUpdate("Streams repeat per seed and agent", testResult);
+
+            bool inRange = true;
+            for (int i = 0; i < 1000; i++) {
+                int64_t value = first.uniformInt(-3, 3);
+                double real = first.uniformReal();
+                inRange &= (value >= -3 && value <= 3);
+                inRange &= (real >= 0.0 && real < 1.0);
+            }
+            testResult &= inRange;
+            testResult &= !first.chance(0.0);
+            testResult &= first.chance(1.0);
+            logStatusUpdate("Draws within range", testResult);
+
+            processTestResult("AgentManager_UT::testAgentRandom()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test routing fills and cancels to the agents that own the orders.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testExecutionRouting() {
+            bool testResult = true;
+
+            AgentManager manager({"TEMP"}, 1);
+            std::string restingId;
+
+            // The seller rests 10 @ 100 in step 0; the buyer takes 4 in step 1 and
+            // tries to cancel the seller's order in step 2
+            ErrorCode foreignCancel = ErrorCode::OK;
+            ScriptedAgent& seller = static_cast<ScriptedAgent&>(manager.addAgent(std::make_unique<ScriptedAgent>(0,
+                [&restingId](AgentContext& context) {
+                    if (context.getStep() == 0) context.submitOrder(0, 10, 100.0, OrderSide::SELL, OrderType::LIMIT, &restingId);
+                })));
+
+            ScriptedAgent& buyer = static_cast<ScriptedAgent&>(manager.addAgent(std::make_unique<ScriptedAgent>(1,
+                [&restingId, &foreignCancel](AgentContext& context) {
+                    if (context.getStep() == 1) context.submitOrder(0, 4, 100.0, OrderSide::BUY, OrderType::LIMIT);
+                    if (context.getStep() == 2) foreignCancel = context.cancelOrder(0, restingId);
+                })));
+
+            manager.run(3);
+
+            testResult &= (seller.executions.size() == 1 && seller.executions[0].leavesQty == 6);
+            testResult &= (buyer.executions.size() == 1 && buyer.executions[0].leavesQty == 0);
+            testResult &= (seller.getPosition(0) == -4 && buyer.getPosition(0) == 4);
+            testResult &= (seller.getCash() == 400.0 && buyer.getCash() == -400.0);
+            logStatusUpdate("Fills routed to both sides", testResult);
+
+            testResult &= (seller.getOpenOrders().size() == 1 && seller.getOpenOrders()[0].leavesQty == 6);
+            testResult &= buyer.getOpenOrders().empty();
+            testResult &= (manager.getLastTradePrice(0) == 100.0);
+            testResult &= (manager.getBestAsk(0) == 100.0 && manager.getBestBid(0) == 0.0);
+            logStatusUpdate("Resting orders and market state", testResult);
+
+            testResult &= (foreignCancel == ErrorCode::BAD_ID);
+            logStatusUpdate("Order canceled only by its owner", testResult);
+
+            AgentManager cancelManager({"TEMP"}, 1);
+            ScriptedAgent& canceler = static_cast<ScriptedAgent&>(cancelManager.addAgent(std::make_unique<ScriptedAgent>(0,
+                [](AgentContext& context) {
+                    std::string orderId;
+                    context.submitOrder(0, 5, 99.0, OrderSide::BUY, OrderType::LIMIT, &orderId);
+                    context.cancelOrder(0, orderId);
+                })));
+
+            cancelManager.run(1);
+            testResult &= (canceler.executions.size() == 1);
+            testResult &= (!canceler.executions.empty() && canceler.executions[0].type == ExecutionType::CANCEL);
+            testResult &= canceler.getOpenOrders().empty();
+            testResult &= (cancelManager.getStats().orders == 1 && cancelManager.getStats().cancels == 1);
+            logStatusUpdate("Cancel routed to the owner", testResult);
+
+            processTestResult("AgentManager_UT::testExecutionRouting()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test that two runs with the same seed produce the same trades.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testDeterministicRun() {
+            bool testResult = true;
+
+            std::vector<Trade> trades[2];
+            AgentManagerStats stats[2];
+
+            for (int run = 0; run < 2; run++) {
+                AgentManager manager({"AAPL", "MSFT"}, 2024);
+                for (uint32_t agentId = 0; agentId < 500; agentId++) {
+                    manager.addAgent(std::make_unique<ZeroIntelligenceAgent>(agentId, manager.getSeed()));
+                }
+
+                manager.run(40);
+                trades[run] = manager.getOrderBook(1).getTradeHistory();
+                stats[run] = manager.getStats();
+            }
+
+            testResult &= (stats[0].wakeups == 500 * 40);
+            testResult &= (stats[0].orders > 0 && stats[0].cancels > 0 && stats[0].trades > 0);
+            testResult &= (stats[0].fills == 2 * stats[0].trades);
+            logStatusUpdate("Agents placed, canceled and traded", testResult);
+
+            bool same = (trades[0].size() == trades[1].size());
+            for (size_t i = 0; same && i < trades[0].size(); i++) {
+                same &= (trades[0][i].getPrice() == trades[1][i].getPrice());
+                same &= (trades[0][i].getQty() == trades[1][i].getQty());
+            }
+            testResult &= same;
+            testResult &= (stats[0].orders == stats[1].orders && stats[0].cancels == stats[1].cancels);
+            logStatusUpdate("Same seed, same trades", testResult);
+
+            processTestResult("AgentManager_UT::testDeterministicRun()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test the ordering of the event queue.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testEventQueue() {
+            bool testResult = true;
+
+            EventQueue<int> queue;
+            queue.push(30, 1);
+            queue.push(10, 2);
+            queue.push(20, 3);
+            queue.push(10, 4);
+            queue.push(10, 5);
+
+            std::vector<int> popped;
+            while (!queue.empty()) {
+                popped.push_back(queue.pop().event);
+            }
+
+            testResult &= (popped == std::vector<int>{2, 4, 5, 3, 1});
+            logStatusUpdate("Time order, FIFO between equal times", testResult);
+
+            processTestResult("AgentManager_UT::testEventQueue()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test latency, expiry and virtual timestamps of a virtual time run.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testVirtualTime() {
+            bool testResult = true;
+            const int64_t ms = 1000000;
+
+            AgentManager manager({"TEMP"}, 1);
+            manager.setLatency(AgentLatency{2 * ms, 3 * ms});
+
+            // t=0: the seller rests 10 @ 100 and 5 @ 101 (expires after 10 ms); t=20: the buyer takes 4
+            ScriptedAgent& seller = static_cast<ScriptedAgent&>(manager.addAgent(std::make_unique<ScriptedAgent>(0,
+                [](AgentContext& context) {
+                    context.submitOrder(0, 10, 100.0, OrderSide::SELL, OrderType::LIMIT);
+                    context.submitOrder(0, 5, 101.0, OrderSide::SELL, OrderType::LIMIT, nullptr, 10 * ms);
+                })));
+
+            ScriptedAgent& buyer = static_cast<ScriptedAgent&>(manager.addAgent(std::make_unique<ScriptedAgent>(1,
+                [](AgentContext& context) {
+                    if (context.getTime() == 0) {
+                        context.scheduleWakeup(20 * ms);
+                        return;
+                    }
+                    context.submitOrder(0, 4, 100.0, OrderSide::BUY, OrderType::LIMIT);
+                })));
+
+            // Orders reach the book at 2 ms; their acks reach the seller at 5 ms
+            manager.runUntil(4 * ms);
+            testResult &= (manager.getBestAsk(0) == 100.0);
+            testResult &= seller.getOpenOrders().empty();
+            manager.runUntil(5 * ms);
+            testResult &= (seller.getOpenOrders().size() == 2);
+            testResult &= (manager.getOrderBook(0).getOrderBookHistory()[0].second.getOrderTimestamp() == 2);
+            logStatusUpdate("Orders and acks delayed; books stamped with virtual time", testResult);
+
+            // Expires at 12 ms; the cancel reaches the seller at 15 ms
+            manager.runUntil(14 * ms);
+            testResult &= (manager.getStats().expiries == 1);
+            testResult &= (seller.getOpenOrders().size() == 2);
+            manager.runUntil(15 * ms);
+            testResult &= (seller.getOpenOrders().size() == 1);
+            testResult &= (seller.executions.size() == 1 && seller.executions[0].type == ExecutionType::CANCEL);
+            logStatusUpdate("Resting order expired", testResult);
+
+            // The buy reaches the book at 22 ms; both fills are reported at 25 ms
+            manager.runUntil(24 * ms);
+            testResult &= (manager.getStats().trades == 1);
+            testResult &= buyer.executions.empty();
+            manager.runUntil(25 * ms);
+            testResult &= (buyer.executions.size() == 1 && buyer.executions[0].timestamp == 22);
+            testResult &= (seller.getPosition(0) == -4 && buyer.getPosition(0) == 4);
+            testResult &= (manager.getTime() == 25 * ms);
+            logStatusUpdate("Fills delivered after the report latency", testResult);
+
+            processTestResult("AgentManager_UT::testVirtualTime()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test that a virtual time run replays exactly, including IDs and timestamps.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testVirtualTimeReplay() {
+            bool testResult = true;
+
+            std::vector<Trade> trades[2];
+            AgentManagerStats stats[2];
+
+            ZeroIntelligenceParams params;
+            params.meanWakeupIntervalNs = 50000000; // 50 ms
+            params.orderTimeToLiveNs = 500000000;   // 500 ms
+
+            for (int run = 0; run < 2; run++) {
+                AgentManager manager({"AAPL"}, 99);
+                manager.setLatency(AgentLatency{100000, 150000});
+                for (uint32_t agentId = 0; agentId < 200; agentId++) {
+                    manager.addAgent(std::make_unique<ZeroIntelligenceAgent>(agentId, manager.getSeed(), params));
+                }
+
+                // One simulated minute, in two slices
+                manager.runUntil(30000000000LL);
+                manager.runUntil(60000000000LL);
+                trades[run] = manager.getOrderBook(0).getTradeHistory();
+                stats[run] = manager.getStats();
+            }
+
+            testResult &= (stats[0].trades > 0 && stats[0].expiries > 0);
+            testResult &= (stats[0].wakeups > 200 * 1000); // ~1200 wakeups per agent
+            logStatusUpdate("Agents woke, traded and expired orders", testResult);
+
+            bool same = (trades[0].size() == trades[1].size());
+            for (size_t i = 0; same && i < trades[0].size(); i++) {
+                same &= (trades[0][i].getTradeId() == trades[1][i].getTradeId());
+                same &= (trades[0][i].getBuyOrderId() == trades[1][i].getBuyOrderId());
+                same &= (trades[0][i].getTimestamp() == trades[1][i].getTimestamp());
+                same &= (trades[0][i].getPrice() == trades[1][i].getPrice());
+            }
+            testResult &= same;
+            testResult &= (stats[0].scheduledEvents == stats[1].scheduledEvents);
+            logStatusUpdate("Same seed, same IDs, timestamps and trades", testResult);
+
+            processTestResult("AgentManager_UT::testVirtualTimeReplay()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test frequent batch auctions in step and virtual time runs.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testBatchAuctions() {
+            bool testResult = true;
+
+            AuctionSchedule schedule;
+            schedule.intervalSteps = 2;
+
+            AgentManager manager({"TEMP"}, 1);
+            manager.setAuctions(schedule);
+
+            // Both orders of step 0 cross, but wait for the auction after step 1
+            ErrorCode marketOrder = ErrorCode::OK;
+            ScriptedAgent& seller = static_cast<ScriptedAgent&>(manager.addAgent(std::make_unique<ScriptedAgent>(0,
+                [](AgentContext& context) {
+                    if (context.getStep() == 0) context.submitOrder(0, 10, 100.0, OrderSide::SELL, OrderType::LIMIT);
+                })));
+
+            ScriptedAgent& buyer = static_cast<ScriptedAgent&>(manager.addAgent(std::make_unique<ScriptedAgent>(1,
+                [&marketOrder](AgentContext& context) {
+                    if (context.getStep() == 0) context.submitOrder(0, 10, 101.0, OrderSide::BUY, OrderType::LIMIT);
+                    if (context.getStep() == 1) marketOrder = context.submitOrder(0, 5, 0.01, OrderSide::SELL, OrderType::MARKET);
+                })));
+
+            manager.run(1);
+            testResult &= (manager.getStats().trades == 0 && manager.getStats().auctions == 0);
+            testResult &= (seller.getOpenOrders().size() == 1 && buyer.getOpenOrders().size() == 1);
+            logStatusUpdate("Orders collected between auctions", testResult);
+
+            manager.run(1);
+            testResult &= (marketOrder == ErrorCode::BAD_TYPE);
+            testResult &= (manager.getStats().auctions == 1 && manager.getStats().trades == 1);
+            testResult &= (seller.executions.size() == 1 && buyer.executions.size() == 1);
+            testResult &= (seller.getPosition(0) == -10 && buyer.getPosition(0) == 10);
+            testResult &= (seller.getOpenOrders().empty() && buyer.getOpenOrders().empty());
+            logStatusUpdate("Auction fills routed to the agents", testResult);
+
+            // One auction per book every interval of virtual time
+            AuctionSchedule timedSchedule;
+            timedSchedule.intervalNs = 1000000;
+            timedSchedule.allocation = AuctionAllocation::PRO_RATA;
+
+            AgentManager timedManager({"AAPL", "MSFT"}, 1);
+            timedManager.setAuctions(timedSchedule);
+            timedManager.runUntil(10000000);
+            testResult &= (timedManager.getStats().auctions == 2 * 10);
+            testResult &= (timedManager.getOrderBook(1).getMatchingMode() == MatchingMode::AUCTION);
+
+            timedManager.setAuctions(AuctionSchedule{});
+            testResult &= (timedManager.getOrderBook(1).getMatchingMode() == MatchingMode::CONTINUOUS);
+            logStatusUpdate("Auctions on the virtual time interval", testResult);
+
+            processTestResult("AgentManager_UT::testBatchAuctions()", testResult);
+
+            return testResult;
+        }
+
+        // ========== UT Variables ==========
+        std::string testName = "AgentManager_UT";
+};
@@ -0,0 +1,19 @@
+// Global Includes
+#include <cstdint>
+
+#ifndef ALLOCATIONCOUNTER_H
+#define ALLOCATIONCOUNTER_H
+
+/**
+ * Count of heap allocations made through the global operator new. The test
+ * build replaces operator new and delete (tests/src/test_main.cpp) to keep it,
+ * so a test can check that a code path does not allocate at all.
+ */
+namespace allocations {
+    /**
+     * @return uint64_t - allocations made by the calling thread so far
+     */
+    uint64_t threadAllocations();
+}
+
+#endif // ALLOCATIONCOUNTER_H
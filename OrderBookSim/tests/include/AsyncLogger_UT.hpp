@@ -0,0 +1,123 @@
+// Global Includes
+#include <string>
+#include <thread>
+#include <vector>
+
+// Project Includes
+#include <AsyncLogger.hpp>
+#include <Logger.h>
+#include <UnitTest.hpp>
+
+class AsyncLogger_UT : public UnitTest {
+    public:
+        /**
+         * @brief Create the async logger unit test object.
+         */
+        AsyncLogger_UT() {
+            logTestHeader(testName);
+        }
+
+        /**
+         * @brief Runs all Async Logger unit tests.
+         *
+         * @return true if all unit tests pass; false otherwise
+         */
+        bool runTests() {
+            bool testResult = true;
+
+            // Run async logger unit tests
+            testResult &= testEncodeRecord();
+            testResult &= testLogLevels();
+            testResult &= testLogFromThreads();
+
+            logTestResults(testName);
+
+            return testResult;
+        }
+
+    private:
+        // ========== UT Functions ==========
+        /**
+         * @brief Test encoding arguments into a record.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testEncodeRecord() {
+            bool testResult = true;
+
+            logger::Record record(0, "Order={}, Price={}, Symbol={}");
+            testResult &= (record.size() == sizeof(logger::RecordHeader));
+
+            record.append(42);
+            record.append(101.5);
+            record.append(std::string("AAPL"));
+
+            // Type byte + raw value per argument; strings carry a uint16 length
+            size_t expected = sizeof(logger::RecordHeader) + (1 + 8) + (1 + 8) + (1 + 2 + 4);
+            testResult &= (record.size() == expected);
+            logStatusUpdate("Encode raw arguments", testResult);
+
+            // Strings are truncated to fit the record
+            logger::Record longRecord(0, "{}");
+            longRecord.append(std::string(2 * logger::MAX_RECORD_SIZE, 'x'));
+            testResult &= (longRecord.size() == logger::MAX_RECORD_SIZE);
+            logStatusUpdate("Truncate long string", testResult);
+
+            processTestResult("AsyncLogger_UT::testEncodeRecord()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test the compile-time level filter.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testLogLevels() {
+            bool testResult = true;
+
+            // Errors are always compiled in; OBM_LOG_LEVEL decides the rest
+            testResult &= isLogLevelEnabled(LogLevel::ERR);
+            testResult &= (isLogLevelEnabled(LogLevel::DEBUG) == (OBM_LOG_LEVEL <= 0));
+            testResult &= (isLogLevelEnabled(LogLevel::INFO) == (OBM_LOG_LEVEL <= 1));
+            logStatusUpdate("Compiled levels", testResult);
+
+            processTestResult("AsyncLogger_UT::testLogLevels()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test logging from threads that exit before their records are written.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testLogFromThreads() {
+            bool testResult = true;
+
+            std::vector<std::thread> threads;
+            for (int t = 0; t < 2; t++) {
+                threads.emplace_back([t]() {
+                    logEvent<LogLevel::INFO>(true, "AsyncLogger_UT: Thread={}, Value={}", t, 0.25 * t);
+
+                    // Disabled at runtime; nothing is queued
+                    logEvent<LogLevel::INFO>(false, "AsyncLogger_UT: not logged");
+                });
+            }
+
+            for (std::thread& thread : threads) {
+                thread.join();
+            }
+
+            logger::AsyncLogger::instance().flush();
+            testResult &= (logger::AsyncLogger::instance().getDroppedRecords() == 0);
+            logStatusUpdate("Records of exited threads written", testResult);
+
+            processTestResult("AsyncLogger_UT::testLogFromThreads()", testResult);
+
+            return testResult;
+        }
+
+        // ========== UT Variables ==========
+        std::string testName = "AsyncLogger_UT";
+};
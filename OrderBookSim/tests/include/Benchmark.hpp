@@ -0,0 +1,220 @@
+// Global Includes
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Project Includes
+#include <LatencyHistogram.hpp>
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+/**
+ * @brief Measurements of one benchmark case.
+ */
+struct BenchmarkResult {
+    std::string name;      // Unique name (profile/operation)
+    std::string profile;   // Book profile the case ran on
+    std::string operation; // Operation measured
+    uint64_t ops;          // Operations timed
+    uint64_t errors;       // Operations that returned an error
+    double opsPerSecond;   // Throughput over the timed operations
+    double meanNs;         // Mean latency per operation
+    int64_t p50Ns;         // Latency percentiles per operation
+    int64_t p99Ns;
+    int64_t p999Ns;
+    int64_t maxNs;
+};
+
+/**
+ * Base of the micro-benchmark suites. A suite times single operations (each
+ * one between two steady clock reads, so results include the clock overhead
+ * reported in the context), keeps their latencies in a LatencyHistogram per
+ * case, and writes every case as JSON for comparison against a baseline.
+ */
+class Benchmark {
+    public:
+        /**
+         * @brief Constructor for a benchmark suite.
+         *
+         * @param suiteName - name of the suite
+         * @param ops - operations timed per case
+         * @param filter - only cases whose name contains this run (empty for all)
+         */
+        Benchmark(const std::string& suiteName, uint64_t ops, const std::string& filter) :
+            suiteName(suiteName),
+            ops(ops),
+            filter(filter),
+            results(),
+            timerOverheadNs(measureTimerOverhead()) {}
+
+        /**
+         * @brief Log one line per case.
+         *
+         * @param out - stream to write to
+         */
+        void logResults(std::ostream& out) const {
+            char line[256];
+            std::snprintf(line, sizeof(line), "%-34s %12s %10s %8s %8s %8s %10s\n", suiteName.c_str(), "ops/s", "mean ns",
+                          "p50", "p99", "p99.9", "max");
+            out << line;
+
+            for (const BenchmarkResult& result : results) {
+                std::snprintf(line, sizeof(line), "%-34s %12.0f %10.1f %8lld %8lld %8lld %10lld\n", result.name.c_str(),
+                              result.opsPerSecond, result.meanNs, static_cast<long long>(result.p50Ns),
+                              static_cast<long long>(result.p99Ns), static_cast<long long>(result.p999Ns),
+                              static_cast<long long>(result.maxNs));
+                out << line;
+            }
+        }
+
+        /**
+         * @brief Write the context and every case as a JSON document.
+         *
+         * @param out - stream to write to
+         */
+        void writeJson(std::ostream& out) const {
+            char timestamp[32];
+            std::time_t now = std::time(nullptr);
+            std::strftime(timestamp, sizeof(timestamp), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+            out << "{\n"
+                << "  \"suite\": \"" << suiteName << "\",\n"
+                << "  \"context\": {\n"
+                << "    \"date\": \"" << timestamp << "\",\n"
+                << "    \"compiler\": \"" << compilerName() << "\",\n"
+                << "    \"optimized\": " << (optimizedBuild() ? "true" : "false") << ",\n"
+                << "    \"ops_per_case\": " << ops << ",\n"
+                << "    \"timer_overhead_ns\": " << timerOverheadNs << "\n"
+                << "  },\n"
+                << "  \"results\": [";
+
+            for (size_t index = 0; index < results.size(); index++) {
+                const BenchmarkResult& result = results[index];
+                out << (index == 0 ? "\n" : ",\n")
+                    << "    {\"name\": \"" << result.name << "\", \"profile\": \"" << result.profile
+                    << "\", \"operation\": \"" << result.operation << "\", \"ops\": " << result.ops
+                    << ", \"errors\": " << result.errors << ", \"ops_per_sec\": " << static_cast<uint64_t>(result.opsPerSecond)
+                    << ", \"mean_ns\": " << static_cast<uint64_t>(result.meanNs) << ", \"p50_ns\": " << result.p50Ns
+                    << ", \"p99_ns\": " << result.p99Ns << ", \"p999_ns\": " << result.p999Ns
+                    << ", \"max_ns\": " << result.maxNs << "}";
+            }
+
+            out << "\n  ]\n}\n";
+        }
+
+        /**
+         * @return const std::vector<BenchmarkResult>& - results of the cases run so far
+         */
+        const std::vector<BenchmarkResult>& getResults() const { return results; }
+
+    protected:
+        /**
+         * @brief Check whether a case was selected by the filter.
+         *
+         * @param name - name of the case
+         *
+         * @return true if the case should run; false otherwise
+         */
+        bool selected(const std::string& name) const {
+            return filter.empty() || name.find(filter) != std::string::npos;
+        }
+
+        /**
+         * @brief Time one operation and record its latency.
+         *
+         * @param histogram - histogram of the case
+         * @param operation - operation to time
+         */
+        template <typename Operation>
+        void timeOperation(LatencyHistogram& histogram, Operation&& operation) {
+            auto start = std::chrono::steady_clock::now();
+            operation();
+            auto end = std::chrono::steady_clock::now();
+
+            histogram.record(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+        }
+
+        /**
+         * @brief Add the result of a case from the latencies of its operations.
+         *
+         * @param profile - book profile of the case
+         * @param operation - operation measured
+         * @param histogram - latencies of the timed operations
+         * @param errors - operations that returned an error
+         */
+        void addResult(const std::string& profile, const std::string& operation, const LatencyHistogram& histogram,
+                       uint64_t errors) {
+            double totalNs = histogram.getMean() * histogram.getCount();
+
+            BenchmarkResult result;
+            result.name = profile + "/" + operation;
+            result.profile = profile;
+            result.operation = operation;
+            result.ops = histogram.getCount();
+            result.errors = errors;
+            result.opsPerSecond = totalNs > 0 ? histogram.getCount() * 1e9 / totalNs : 0.0;
+            result.meanNs = histogram.getMean();
+            result.p50Ns = histogram.valueAtPercentile(50);
+            result.p99Ns = histogram.valueAtPercentile(99);
+            result.p999Ns = histogram.valueAtPercentile(99.9);
+            result.maxNs = histogram.getMax();
+
+            results.push_back(result);
+        }
+
+        std::string suiteName;                // Name of the suite
+        uint64_t ops;                         // Operations timed per case
+        std::string filter;                   // Case name filter
+
+    private:
+        /**
+         * @brief Measure the cost of the two clock reads around an operation.
+         *
+         * @return int64_t - median cost (ns)
+         */
+        static int64_t measureTimerOverhead() {
+            LatencyHistogram histogram;
+            for (int sample = 0; sample < 100000; sample++) {
+                auto start = std::chrono::steady_clock::now();
+                auto end = std::chrono::steady_clock::now();
+                histogram.record(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+            }
+            return histogram.valueAtPercentile(50);
+        }
+
+        /**
+         * @return std::string - compiler and version the suite was built with
+         */
+        static std::string compilerName() {
+#if defined(__clang__)
+            return std::string("clang ") + __clang_version__;
+#elif defined(__GNUC__)
+            return std::string("gcc ") + __VERSION__;
+#elif defined(_MSC_VER)
+            return "msvc " + std::to_string(_MSC_VER);
+#else
+            return "unknown";
+#endif
+        }
+
+        /**
+         * @return bool - true if the suite was built with optimizations
+         */
+        static bool optimizedBuild() {
+#if defined(__OPTIMIZE__) || (defined(_MSC_VER) && !defined(_DEBUG))
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        std::vector<BenchmarkResult> results; // Results of the cases run so far
+        int64_t timerOverheadNs;              // Median cost of the clock reads around an operation
+}; // Benchmark
+
+#endif // BENCHMARK_H
@@ -0,0 +1,181 @@
+// Global Includes
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Project Includes
+#include <Config.hpp>
+#include <UnitTest.hpp>
+
+class Config_UT : public UnitTest {
+    public:
+        /**
+         * @brief Create the config unit test object.
+         */
+        Config_UT() {
+            logTestHeader(testName);
+        }
+
+        /**
+         * @brief Runs all Config unit tests.
+         *
+         * @return true if all unit tests pass; false otherwise
+         */
+        bool runTests() {
+            bool testResult = true;
+
+            // Run config unit tests
+            testResult &= testParseArguments();
+            testResult &= testParseConfigFile();
+            testResult &= testInvalidOptions();
+
+            logTestResults(testName);
+
+            return testResult;
+        }
+
+    private:
+        // ========== UT Functions ==========
+        /**
+         * @brief Test parsing the command line arguments.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testParseArguments() {
+            bool testResult = true;
+            std::string error;
+
+            ServerConfig defaults;
+            const char* noArgs[] = {"orderBook"};
+            testResult &= config::parseArguments(1, noArgs, defaults, error);
+            testResult &= (defaults.port == 8080);
+            testResult &= defaults.symbols.empty();
+            testResult &= !defaults.logging;
+            testResult &= !defaults.threads.busyPoll;
+            logStatusUpdate("Defaults without arguments", testResult);
+
+            ServerConfig serverConfig;
+            const char* args[] = {"orderBook", "-p", "9000", "-s", "AAPL,MSFT", "TSLA", "-l"};
+            testResult &= config::parseArguments(7, args, serverConfig, error);
+            testResult &= (serverConfig.port == 9000);
+            testResult &= (serverConfig.symbols == std::vector<std::string>{"AAPL", "MSFT", "TSLA"});
+            testResult &= serverConfig.logging;
+            logStatusUpdate("Port, symbols and logging", testResult);
+
+            ServerConfig threadConfig;
+            const char* threadArgs[] = {"orderBook", "--busy-poll", "--engines", "2", "--cpu-engines", "2,3", "--cpu-network=1", "--rt-priority", "50", "--io-backend", "io_uring"};
+            testResult &= config::parseArguments(11, threadArgs, threadConfig, error);
+            testResult &= threadConfig.threads.busyPoll;
+            testResult &= (threadConfig.engineThreads == 2);
+            testResult &= (threadConfig.ioBackend == net::IoBackend::IO_URING);
+            testResult &= (threadConfig.threads.placement(threading::ThreadRole::ENGINE, 1).cpu == 3);
+            testResult &= (threadConfig.threads.placement(threading::ThreadRole::ENGINE, 2).cpu == 2);
+            testResult &= (threadConfig.threads.placement(threading::ThreadRole::NETWORK).cpu == 1);
+            testResult &= (threadConfig.threads.placement(threading::ThreadRole::NETWORK).priority == 50);
+            testResult &= (threadConfig.threads.placement(threading::ThreadRole::MARKET_DATA).priority == 0);
+            logStatusUpdate("Busy-poll and thread placement", testResult);
+
+            ServerConfig limitConfig;
+            const char* limitArgs[] = {"orderBook", "--max-msg-rate", "5000", "--msg-burst=250", "--max-outstanding", "0",
+                                       "--max-open-orders", "100", "--engine-high-watermark", "1024", "--engine-low-watermark", "256"};
+            testResult &= config::parseArguments(12, limitArgs, limitConfig, error);
+            testResult &= (limitConfig.limits.messageRate == 5000 && limitConfig.limits.messageBurst == 250);
+            testResult &= (limitConfig.limits.maxOutstanding == 0 && limitConfig.limits.maxOpenOrders == 100);
+            testResult &= (limitConfig.limits.engineHighWatermark == 1024 && limitConfig.limits.engineLowWatermark == 256);
+            logStatusUpdate("Admission limits", testResult);
+
+            processTestResult("Config_UT::testParseArguments()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test applying a config file, then overriding it on the command line.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testParseConfigFile() {
+            bool testResult = true;
+            std::string error;
+            std::string path = "Config_UT.conf";
+
+            {
+                std::ofstream file(path);
+                file << "# Order book simulator\n"
+                     << "port = 9100\n"
+                     << "symbols = AAPL, MSFT   # two books\n"
+                     << "\n"
+                     << "busy-poll = true\n"
+                     << "cpu-logger = 5\n";
+            }
+
+            ServerConfig serverConfig;
+            const char* args[] = {"orderBook", "-c", path.c_str(), "-p", "9200"};
+            testResult &= config::parseArguments(5, args, serverConfig, error);
+            testResult &= (serverConfig.port == 9200);
+            testResult &= (serverConfig.symbols == std::vector<std::string>{"AAPL", "MSFT"});
+            testResult &= serverConfig.threads.busyPoll;
+            testResult &= (serverConfig.threads.loggerCpu == 5);
+            logStatusUpdate("Config file applied, later arguments override", testResult);
+
+            {
+                std::ofstream file(path);
+                file << "port = 9100\n"
+                     << "engines\n";
+            }
+
+            ServerConfig badConfig;
+            testResult &= !config::parseConfigFile(path, badConfig, error);
+            testResult &= (error.find(":2:") != std::string::npos);
+            logStatusUpdate("Malformed line reported with its line number", testResult);
+
+            std::remove(path.c_str());
+
+            processTestResult("Config_UT::testParseConfigFile()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test rejecting invalid options.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testInvalidOptions() {
+            bool testResult = true;
+            std::string error;
+            ServerConfig serverConfig;
+
+            const char* badPort[] = {"orderBook", "-p", "http"};
+            testResult &= !config::parseArguments(3, badPort, serverConfig, error);
+
+            const char* missingValue[] = {"orderBook", "-p"};
+            testResult &= !config::parseArguments(2, missingValue, serverConfig, error);
+
+            const char* unknown[] = {"orderBook", "--turbo"};
+            testResult &= !config::parseArguments(2, unknown, serverConfig, error);
+
+            const char* badCpu[] = {"orderBook", "--cpu-engines", "1,x"};
+            testResult &= !config::parseArguments(3, badCpu, serverConfig, error);
+
+            const char* badPriority[] = {"orderBook", "--rt-priority", "120"};
+            testResult &= !config::parseArguments(3, badPriority, serverConfig, error);
+
+            const char* badRate[] = {"orderBook", "--max-msg-rate", "-5"};
+            testResult &= !config::parseArguments(3, badRate, serverConfig, error);
+
+            const char* badAllocation[] = {"orderBook", "--auction-allocation", "random"};
+            testResult &= !config::parseArguments(3, badAllocation, serverConfig, error);
+
+            testResult &= !config::parseConfigFile("Config_UT.missing", serverConfig, error);
+            logStatusUpdate("Invalid options rejected", testResult);
+
+            processTestResult("Config_UT::testInvalidOptions()", testResult);
+
+            return testResult;
+        }
+
+        // ========== UT Variables ==========
+        std::string testName = "Config_UT";
+};
@@ -0,0 +1,425 @@
+// Global Includes
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Project Includes
+#include <BookEvents.hpp>
+#include <OrderBook.hpp>
+#include <Types.hpp>
+
+#ifndef DIFFERENTIALFUZZER_H
+#define DIFFERENTIALFUZZER_H
+
+namespace fuzz {
+    /**
+     * @brief Operations of a fuzz sequence.
+     */
+    enum class OpKind {
+        CREATE,
+        MODIFY,
+        CANCEL
+    };
+
+    /**
+     * @brief One operation of a fuzz sequence. Orders are referred to by the
+     * position of their create in the sequence, since each book generates its
+     * own order IDs; a target with no matching create uses an unknown ID.
+     */
+    struct FuzzOp {
+        OpKind kind;     // Operation
+        OrderSide side;  // CREATE: side of the order
+        OrderType type;  // CREATE: type of the order
+        int qty;         // CREATE / MODIFY: quantity
+        double price;    // CREATE / MODIFY: price
+        size_t target;   // MODIFY / CANCEL: index of the create the order came from
+    };
+
+    /**
+     * @brief Outcome of running a sequence through both books.
+     */
+    struct FuzzResult {
+        bool passed = true; // True if the books agreed after every step
+        size_t step = 0;    // First step the books disagreed on
+        std::string reason; // What differed, reference first
+    };
+
+    /**
+     * @brief Generate a random sequence of operations. The sequence only
+     * depends on the seed, so a seed reproduces a failure exactly.
+     *
+     * Creates use every OrderType, both sides and prices on a 0.5 grid around
+     * 100 (exact in binary, so both books see identical price levels); a few
+     * carry an invalid quantity or price. Modifies and cancels mostly target
+     * recent creates, and sometimes an order that does not exist.
+     *
+     * @param seed - seed of the sequence
+     * @param count - operations to generate
+     *
+     * @return std::vector<FuzzOp> - operations
+     */
+    inline std::vector<FuzzOp> generateOps(uint64_t seed, size_t count) {
+        static const OrderType TYPES[] = {OrderType::LIMIT, OrderType::LIMIT, OrderType::LIMIT, OrderType::MARKET,
+                                          OrderType::STOP, OrderType::FOK, OrderType::IOC, OrderType::ICEBERG};
+
+        std::mt19937_64 generator(seed);
+        auto uniform = [&generator](int low, int high) {
+            return std::uniform_int_distribution<int>(low, high)(generator);
+        };
+
+        std::vector<FuzzOp> ops;
+        ops.reserve(count);
+        size_t creates = 0;
+
+        for (size_t index = 0; index < count; index++) {
+            FuzzOp op{OpKind::CREATE, OrderSide::BUY, OrderType::LIMIT, 0, 0.0, 0};
+
+            int roll = uniform(0, 99);
+            if (creates > 0 && roll < 20) op.kind = OpKind::MODIFY;
+            else if (creates > 0 && roll < 35) op.kind = OpKind::CANCEL;
+
+            op.side = uniform(0, 1) ? OrderSide::BUY : OrderSide::SELL;
+            op.type = TYPES[uniform(0, 7)];
+            op.qty = uniform(1, 4) == 1 ? uniform(1, 200) : uniform(1, 20);
+            op.price = 100.0 + 0.5 * uniform(-10, 10);
+
+            // Invalid parameters (rejected by validation)
+            int invalid = uniform(0, 99);
+            if (invalid == 0) op.qty = -uniform(0, 5);
+            else if (invalid == 1) op.price = 0.0;
+
+            if (op.kind == OpKind::CREATE) {
+                creates++;
+            }
+            else {
+                // Mostly recent orders (likely still resting); 5% unknown
+                size_t window = std::min<size_t>(creates, 32);
+                op.target = (uniform(0, 19) == 0) ? creates + uniform(0, 9) : creates - 1 - uniform(0, static_cast<int>(window) - 1);
+            }
+
+            ops.push_back(op);
+        }
+
+        return ops;
+    }
+
+    /**
+     * @brief Write a sequence one operation per line (for reproducing a failure).
+     *
+     * @param ops - operations
+     *
+     * @return std::string - listing
+     */
+    inline std::string describe(const std::vector<FuzzOp>& ops) {
+        static const char* TYPE_NAMES[] = {"MARKET", "LIMIT", "STOP", "FOK", "IOC", "ICEBERG"};
+
+        std::ostringstream out;
+        for (size_t index = 0; index < ops.size(); index++) {
+            const FuzzOp& op = ops[index];
+            char line[128];
+
+            if (op.kind == OpKind::CREATE) {
+                std::snprintf(line, sizeof(line), "%4zu create %-4s %-7s qty=%d price=%.2f\n", index,
+                              op.side == OrderSide::BUY ? "BUY" : "SELL", TYPE_NAMES[static_cast<int>(op.type)], op.qty, op.price);
+            }
+            else if (op.kind == OpKind::MODIFY) {
+                std::snprintf(line, sizeof(line), "%4zu modify #%zu qty=%d price=%.2f\n", index, op.target, op.qty, op.price);
+            }
+            else {
+                std::snprintf(line, sizeof(line), "%4zu cancel #%zu\n", index, op.target);
+            }
+            out << line;
+        }
+
+        return out.str();
+    }
+
+    /**
+     * Runs operation sequences through the reference OrderBook and a candidate
+     * book and compares them after every step: the result of the operation,
+     * the trades it produced, the fills and cancels of every order, and both
+     * sides of the book (levels, order priority and remaining quantities).
+     *
+     * The candidate needs the OrderBook interface used here: a constructor
+     * from the symbol, createOrder, modifyOrder, cancelOrder, addListener,
+     * getTradeHistoryView and getActiveBuyOrders / getActiveSellOrders.
+     */
+    template <typename Candidate>
+    class DifferentialFuzzer {
+        public:
+            /**
+             * @brief Run a sequence through a new reference and candidate book.
+             *
+             * @param ops - operations
+             *
+             * @return FuzzResult - first difference, if any
+             */
+            FuzzResult run(const std::vector<FuzzOp>& ops) {
+                OrderBook reference(SYMBOL);
+                Candidate candidate(SYMBOL);
+
+                BookState<OrderBook> referenceState(reference);
+                BookState<Candidate> candidateState(candidate);
+
+                FuzzResult result;
+                for (size_t step = 0; step < ops.size(); step++) {
+                    std::string referenceStep = referenceState.apply(ops[step]);
+                    std::string candidateStep = candidateState.apply(ops[step]);
+
+                    if (referenceStep != candidateStep) {
+                        result.passed = false;
+                        result.step = step;
+                        result.reason = "reference:\n" + referenceStep + "candidate:\n" + candidateStep;
+                        break;
+                    }
+                }
+
+                return result;
+            }
+
+            /**
+             * @brief Shrink a failing sequence to one that still fails, so that
+             * removing any single operation makes it pass (delta debugging:
+             * drop chunks of halving size, then single operations), and
+             * reduce the quantities where the failure allows it.
+             *
+             * @param ops - failing operations
+             *
+             * @return std::vector<FuzzOp> - minimized operations (ops if it passes)
+             */
+            std::vector<FuzzOp> minimize(const std::vector<FuzzOp>& ops) {
+                std::vector<FuzzOp> current = ops;
+                if (run(current).passed) return current;
+
+                // The operations after the first difference never matter
+                current.resize(run(current).step + 1);
+
+                for (size_t chunk = std::max<size_t>(current.size() / 2, 1); chunk > 0; chunk /= 2) {
+                    bool removed = true;
+                    while (removed) {
+                        removed = false;
+                        for (size_t start = 0; start < current.size() && current.size() > 1;) {
+                            std::vector<FuzzOp> candidateOps = withoutChunk(current, start, chunk);
+
+                            if (!candidateOps.empty() && !run(candidateOps).passed) {
+                                current = candidateOps;
+                                removed = true;
+                            }
+                            else {
+                                start += chunk;
+                            }
+                        }
+                    }
+                }
+
+                for (FuzzOp& op : current) {
+                    if (op.kind == OpKind::CANCEL || op.qty <= 1) continue;
+
+                    int original = op.qty;
+                    op.qty = 1;
+                    if (run(current).passed) op.qty = original;
+                }
+
+                return current;
+            }
+
+        private:
+            static constexpr const char* SYMBOL = "FUZZ"; // Symbol of both books
+
+            /**
+             * @brief Remove operations from a sequence, renumbering the targets
+             * of the later modifies and cancels so they still refer to the same
+             * creates (a target of a removed create becomes unknown).
+             *
+             * @param ops - operations
+             * @param start - first operation to remove
+             * @param count - operations to remove
+             *
+             * @return std::vector<FuzzOp> - remaining operations
+             */
+            static std::vector<FuzzOp> withoutChunk(const std::vector<FuzzOp>& ops, size_t start, size_t count) {
+                size_t end = std::min(start + count, ops.size());
+
+                // Creates before the chunk, and removed by it
+                size_t createsBefore = 0;
+                size_t createsRemoved = 0;
+                for (size_t index = 0; index < end; index++) {
+                    if (ops[index].kind != OpKind::CREATE) continue;
+                    (index < start ? createsBefore : createsRemoved)++;
+                }
+
+                size_t totalCreates = 0;
+                for (const FuzzOp& op : ops) {
+                    totalCreates += (op.kind == OpKind::CREATE) ? 1 : 0;
+                }
+
+                std::vector<FuzzOp> remaining(ops.begin(), ops.begin() + start);
+                for (size_t index = end; index < ops.size(); index++) {
+                    FuzzOp op = ops[index];
+
+                    if (op.kind != OpKind::CREATE && op.target >= createsBefore) {
+                        if (op.target >= createsBefore + createsRemoved) op.target -= createsRemoved;
+                        else op.target = totalCreates; // Unknown in the shorter sequence
+                    }
+                    remaining.push_back(op);
+                }
+
+                return remaining;
+            }
+
+            /**
+             * Drives one book and writes what each step did as text, with the
+             * book's order IDs replaced by the index of their create so both
+             * books produce identical text when they behave the same.
+             */
+            template <typename Book>
+            class BookState : public OrderBookListener {
+                public:
+                    /**
+                     * @brief Attach to a book.
+                     *
+                     * @param book - book to drive
+                     */
+                    explicit BookState(Book& book) : book(book), ids(), indices(), executions(), tradesSeen(0) {
+                        book.addListener(this);
+                    }
+
+                    /**
+                     * @brief Apply an operation.
+                     *
+                     * @param op - operation
+                     *
+                     * @return std::string - result, trades, executions and depth after the step
+                     */
+                    std::string apply(const FuzzOp& op) {
+                        ErrorCode errCode = ErrorCode::OK;
+                        std::string orderId;
+                        executions.clear();
+
+                        if (op.kind == OpKind::CREATE) {
+                            orderId = book.createOrder(op.qty, op.price, op.side, op.type, errCode);
+
+                            indices[orderId] = ids.size();
+                            ids.push_back(orderId);
+                        }
+                        else if (op.kind == OpKind::MODIFY) {
+                            orderId = book.modifyOrder(targetId(op.target), op.qty, op.price, errCode);
+                        }
+                        else {
+                            orderId = book.cancelOrder(targetId(op.target), errCode);
+                        }
+
+                        std::ostringstream out;
+                        out << "  result " << static_cast<int>(errCode) << " " << orderName(orderId) << "\n";
+
+                        auto trades = book.getTradeHistoryView();
+                        for (; tradesSeen < trades.size(); tradesSeen++) {
+                            const Trade& trade = trades[tradesSeen];
+                            out << "  trade buy=" << orderName(trade.getBuyOrderId()) << " sell="
+                                << orderName(trade.getSellOrderId()) << " qty=" << trade.getQty() << " price="
+                                << trade.getPrice() << "\n";
+                        }
+
+                        for (const RawExecution& execution : executions) {
+                            out << "  " << (execution.type == ExecutionType::FILL ? "fill " : "cancel ")
+                                << orderName(execution.orderId) << " qty=" << execution.qty << " price="
+                                << execution.price << " leaves=" << execution.leavesQty << "\n";
+                        }
+
+                        writeSide(out, "bid", book.getActiveBuyOrders());
+                        writeSide(out, "ask", book.getActiveSellOrders());
+
+                        return out.str();
+                    }
+
+                    /**
+                     * @brief Record the fills and cancels of the current step.
+                     *
+                     * @param event - execution
+                     */
+                    void onExecution(const ExecutionEvent& event) override {
+                        executions.push_back(RawExecution{event.orderId, event.type, event.price, event.qty, event.leavesQty});
+                    }
+
+                private:
+                    /**
+                     * @brief An execution event with its order ID copied (the
+                     * event's ID only lives as long as the callback).
+                     */
+                    struct RawExecution {
+                        std::string orderId; // Book's ID of the order
+                        ExecutionType type;  // FILL or CANCEL
+                        double price;        // Execution price
+                        int qty;             // Executed / canceled quantity
+                        int leavesQty;       // Quantity left after the event
+                    };
+
+                    /**
+                     * @brief Get the book's ID of the order of a create.
+                     *
+                     * @param target - index of the create
+                     *
+                     * @return std::string - order ID (an unknown ID if there is no such create)
+                     */
+                    std::string targetId(size_t target) const {
+                        return target < ids.size() ? ids[target] : "unknown_" + std::to_string(target);
+                    }
+
+                    /**
+                     * @brief Get the book independent name of an order ID.
+                     *
+                     * @param orderId - book's ID of the order
+                     *
+                     * @return std::string - "#<create index>", or "-1" for no order
+                     */
+                    std::string orderName(const std::string& orderId) const {
+                        if (orderId == "-1") return "-1";
+
+                        auto index = indices.find(orderId);
+                        return index != indices.end() ? "#" + std::to_string(index->second) : "?" + orderId;
+                    }
+
+                    /**
+                     * @brief Write every level of one side, best first, with its
+                     * orders in priority order.
+                     *
+                     * @param out - stream to write to
+                     * @param name - name of the side
+                     * @param levels - levels of the side (ascending prices)
+                     */
+                    template <typename Levels>
+                    void writeSide(std::ostringstream& out, const char* name, const Levels& levels) const {
+                        out << "  " << name << ":";
+
+                        auto writeLevel = [&](const auto& level) {
+                            out << " " << level.first << "[";
+                            for (const Order& order : level.second) {
+                                out << " " << orderName(order.getOrderId()) << "x" << order.getOrderRemainingQty();
+                            }
+                            out << " ]";
+                        };
+
+                        if (std::string(name) == "bid") {
+                            for (auto level = levels.rbegin(); level != levels.rend(); ++level) writeLevel(*level);
+                        }
+                        else {
+                            for (const auto& level : levels) writeLevel(level);
+                        }
+                        out << "\n";
+                    }
+
+                    Book& book;                                      // Book driven
+                    std::vector<std::string> ids;                    // Book's order ID per create ("-1" if rejected)
+                    std::unordered_map<std::string, size_t> indices; // Create index per order ID
+                    std::vector<RawExecution> executions;            // Executions of the current step
+                    size_t tradesSeen;                               // Trades already written
+            }; // BookState
+    }; // DifferentialFuzzer
+};
+
+#endif // DIFFERENTIALFUZZER_H
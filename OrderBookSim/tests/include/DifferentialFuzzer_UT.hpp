@@ -0,0 +1,137 @@
+// Global Includes
+#include <string>
+#include <vector>
+
+// Project Includes
+#include <DifferentialFuzzer.hpp>
+#include <OrderBook.hpp>
+#include <UnitTest.hpp>
+
+class DifferentialFuzzer_UT : public UnitTest {
+    public:
+        /**
+         * @brief Create the differential fuzzer unit test object.
+         */
+        DifferentialFuzzer_UT() {
+            logTestHeader(testName);
+        }
+
+        /**
+         * @brief Runs all Differential Fuzzer unit tests.
+         *
+         * @return true if all unit tests pass; false otherwise
+         */
+        bool runTests() {
+            bool testResult = true;
+
+            // Run differential fuzzer unit tests
+            testResult &= testGenerateOps();
+            testResult &= testReferenceAgainstItself();
+            testResult &= testDetectAndMinimize();
+
+            logTestResults(testName);
+
+            return testResult;
+        }
+
+    private:
+        /**
+         * Candidate with a planted bug: IOC orders rest like LIMIT orders.
+         */
+        class RestingIocBook : public OrderBook {
+            public:
+                explicit RestingIocBook(std::string symbol) : OrderBook(symbol) {}
+
+                std::string createOrder(int qty, double price, OrderSide side, OrderType type, ErrorCode& errCode) {
+                    return OrderBook::createOrder(qty, price, side, type == OrderType::IOC ? OrderType::LIMIT : type, errCode);
+                }
+        }; // RestingIocBook
+
+        // ========== UT Functions ==========
+        /**
+         * @brief Test that a seed always generates the same sequence, and that
+         * the sequences cover every order type and operation.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testGenerateOps() {
+            bool testResult = true;
+
+            std::vector<fuzz::FuzzOp> first = fuzz::generateOps(7, 500);
+            std::vector<fuzz::FuzzOp> second = fuzz::generateOps(7, 500);
+            testResult &= (first.size() == 500);
+            testResult &= (fuzz::describe(first) == fuzz::describe(second));
+            testResult &= (fuzz::describe(first) != fuzz::describe(fuzz::generateOps(8, 500)));
+            logStatusUpdate("Sequence reproduced from its seed", testResult);
+
+            bool types[6] = {};
+            int modifies = 0;
+            int cancels = 0;
+            for (const fuzz::FuzzOp& op : first) {
+                if (op.kind == fuzz::OpKind::CREATE) types[static_cast<int>(op.type)] = true;
+                modifies += (op.kind == fuzz::OpKind::MODIFY) ? 1 : 0;
+                cancels += (op.kind == fuzz::OpKind::CANCEL) ? 1 : 0;
+            }
+            for (bool seen : types) {
+                testResult &= seen;
+            }
+            testResult &= (modifies > 0 && cancels > 0);
+            logStatusUpdate("Every order type, modifies and cancels", testResult);
+
+            processTestResult("DifferentialFuzzer_UT::testGenerateOps()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test that the reference book agrees with itself on random
+         * sequences (order IDs differ between books and must not matter).
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testReferenceAgainstItself() {
+            bool testResult = true;
+
+            fuzz::DifferentialFuzzer<OrderBook> fuzzer;
+            for (uint64_t seed = 1; seed <= 5; seed++) {
+                testResult &= fuzzer.run(fuzz::generateOps(seed, 400)).passed;
+            }
+            logStatusUpdate("OrderBook matches OrderBook", testResult);
+
+            processTestResult("DifferentialFuzzer_UT::testReferenceAgainstItself()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test that a candidate with a bug is caught and its failing
+         * sequence is minimized to the single operation that shows the bug.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testDetectAndMinimize() {
+            bool testResult = true;
+
+            fuzz::DifferentialFuzzer<RestingIocBook> fuzzer;
+            std::vector<fuzz::FuzzOp> sequence = fuzz::generateOps(3, 400);
+
+            fuzz::FuzzResult result = fuzzer.run(sequence);
+            testResult &= !result.passed;
+            testResult &= (sequence[result.step].kind == fuzz::OpKind::CREATE && sequence[result.step].type == OrderType::IOC);
+            testResult &= (result.reason.find("reference:\n") == 0 && result.reason.find("candidate:\n") != std::string::npos);
+            logStatusUpdate("Bug caught at the first resting IOC", testResult);
+
+            std::vector<fuzz::FuzzOp> minimized = fuzzer.minimize(sequence);
+            testResult &= (minimized.size() == 1);
+            testResult &= (minimized[0].type == OrderType::IOC && minimized[0].qty == 1);
+            testResult &= !fuzzer.run(minimized).passed;
+            logStatusUpdate("Minimized to one IOC of quantity 1", testResult);
+
+            processTestResult("DifferentialFuzzer_UT::testDetectAndMinimize()", testResult);
+
+            return testResult;
+        }
+
+        // ========== UT Variables ==========
+        std::string testName = "DifferentialFuzzer_UT";
+};
@@ -0,0 +1,132 @@
+// Global Includes
+#include <cmath>
+#include <sstream>
+#include <string>
+
+// Project Includes
+#include <LatencyHistogram.hpp>
+#include <UnitTest.hpp>
+
+class LatencyHistogram_UT : public UnitTest {
+    public:
+        /**
+         * @brief Create the latency histogram unit test object.
+         */
+        LatencyHistogram_UT() {
+            logTestHeader(testName);
+        }
+
+        /**
+         * @brief Runs all Latency Histogram unit tests.
+         *
+         * @return true if all unit tests pass; false otherwise
+         */
+        bool runTests() {
+            bool testResult = true;
+
+            // Run latency histogram unit tests
+            testResult &= testPercentiles();
+            testResult &= testMergeAndOutput();
+
+            logTestResults(testName);
+
+            return testResult;
+        }
+
+    private:
+        // ========== UT Functions ==========
+        /**
+         * @brief Test recording values and reading percentiles within the
+         * histogram's precision.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testPercentiles() {
+            bool testResult = true;
+
+            LatencyHistogram histogram;
+            testResult &= (histogram.getCount() == 0 && histogram.valueAtPercentile(50) == 0);
+
+            // 1..1000 us in ns
+            for (int64_t value = 1; value <= 1000; value++) {
+                histogram.record(value * 1000);
+            }
+            testResult &= (histogram.getCount() == 1000);
+            testResult &= (histogram.getMin() == 1000 && histogram.getMax() == 1000000);
+            testResult &= (std::fabs(histogram.getMean() - 500500.0) < 1e-6);
+            testResult &= withinPrecision(histogram.valueAtPercentile(50), 500000);
+            testResult &= withinPrecision(histogram.valueAtPercentile(99), 990000);
+            testResult &= withinPrecision(histogram.valueAtPercentile(99.9), 999000);
+            testResult &= (histogram.valueAtPercentile(100) == 1000000);
+            testResult &= withinPrecision(histogram.valueAtPercentile(0), 1000);
+            logStatusUpdate("Percentiles within 0.1%", testResult);
+
+            // Small values are exact; out of range values are clamped
+            LatencyHistogram exact;
+            exact.record(7);
+            exact.record(2047, 3);
+            exact.record(-5);
+            exact.record(LatencyHistogram::MAX_VALUE + 10);
+            testResult &= (exact.getCount() == 6 && exact.getMin() == 0);
+            testResult &= (exact.valueAtPercentile(30) == 7 && exact.valueAtPercentile(50) == 2047);
+            testResult &= (exact.getMax() == LatencyHistogram::MAX_VALUE && exact.valueAtPercentile(100) == LatencyHistogram::MAX_VALUE);
+            logStatusUpdate("Exact small values, clamped large values", testResult);
+
+            processTestResult("LatencyHistogram_UT::testPercentiles()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test merging histograms and writing the percentile distribution.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testMergeAndOutput() {
+            bool testResult = true;
+
+            LatencyHistogram fast;
+            LatencyHistogram slow;
+            fast.record(10000, 990);
+            slow.record(5000000, 10);
+
+            LatencyHistogram total;
+            total.merge(fast);
+            total.merge(slow);
+            testResult &= (total.getCount() == 1000 && total.getMin() == 10000 && total.getMax() == 5000000);
+            testResult &= withinPrecision(total.valueAtPercentile(99), 10000);
+            testResult &= withinPrecision(total.valueAtPercentile(99.9), 5000000);
+            logStatusUpdate("Merged histogram keeps both tails", testResult);
+
+            std::ostringstream out;
+            total.writePercentiles(out, 1000.0);
+            std::string text = out.str();
+            testResult &= (text.compare(0, 12, "       Value") == 0);
+            testResult &= (text.find("    5000.000 1.000000000000       1000\n") != std::string::npos);
+            testResult &= (text.find("#[Max     =     5000.000, Total count    =         1000]") != std::string::npos);
+            logStatusUpdate("Percentile distribution written", testResult);
+
+            total.reset();
+            testResult &= (total.getCount() == 0 && total.getMax() == 0 && total.valueAtPercentile(99) == 0);
+            logStatusUpdate("Reset", testResult);
+
+            processTestResult("LatencyHistogram_UT::testMergeAndOutput()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Check a histogram value against the exact value.
+         *
+         * @param value - value read from the histogram
+         * @param expected - exact value
+         *
+         * @return true if within the histogram's precision; false otherwise
+         */
+        bool withinPrecision(int64_t value, int64_t expected) {
+            return value >= expected && value <= expected + expected / 1000 + 1;
+        }
+
+        // ========== UT Variables ==========
+        std::string testName = "LatencyHistogram_UT";
+};
@@ -0,0 +1,695 @@
+// Global Includes
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Project Includes
+#include <CompletionQueue.hpp>
+#include <MatchingEngine.hpp>
+#include <Protocol.hpp>
+#include <Session.hpp>
+#include <UnitTest.hpp>
+
+class MatchingEngine_UT : public UnitTest {
+    public:
+        /**
+         * @brief Create the matching engine unit test object.
+         */
+        MatchingEngine_UT() {
+            logTestHeader(testName);
+        }
+
+        /**
+         * @brief Runs all Matching Engine unit tests.
+         *
+         * @return true if all unit tests pass; false otherwise
+         */
+        bool runTests() {
+            bool testResult = true;
+
+            // Run matching engine unit tests
+            testResult &= testSymbolLifecycle();
+            testResult &= testResponseOrder();
+            testResult &= testQueueWatermarks();
+            testResult &= testExecutionReports();
+            testResult &= testOpenOrderCount();
+            testResult &= testSessionClose();
+            testResult &= testQueryPages();
+            testResult &= testBusyPoll();
+            testResult &= testParallelBatches();
+
+            logTestResults(testName);
+
+            return testResult;
+        }
+
+    private:
+        /**
+         * @brief Session that records its outbound bytes instead of sending them.
+         */
+        class RecordingSession : public Session {
+            public:
+                explicit RecordingSession(uint32_t sessionId = 1) : Session(sessionId) {}
+
+                std::string sent; // Bytes written by flush()
+
+            protected:
+                long receiveBytes(char* buffer, size_t length) override {
+                    (void)buffer;
+                    (void)length;
+                    return 0;
+                }
+
+                long sendSlices(net::IoSlice* slices, size_t count) override {
+                    size_t before = sent.size();
+                    for (size_t i = 0; i < count; i++) {
+                        sent.append(net::sliceData(slices[i]), net::sliceLength(slices[i]));
+                    }
+                    return static_cast<long>(sent.size() - before);
+                }
+        };
+
+        /**
+         * @brief Wait for the engine to complete a number of commands.
+         *
+         * @param completions - completion queue of the commands
+         * @param count - number of completions expected
+         *
+         * @return std::vector<Completion> - completions in the order they were delivered
+         */
+        std::vector<Completion> waitForCompletions(CompletionQueue& completions, size_t count) {
+            std::vector<RoutedReport> reports;
+            return waitForCompletions(completions, count, reports);
+        }
+
+        /**
+         * @brief Wait for the engine to complete a number of commands, keeping
+         * the execution reports delivered alongside them.
+         *
+         * @param completions - completion queue of the commands
+         * @param count - number of completions expected
+         * @param reports - populated with the reports, in the order they were delivered
+         *
+         * @return std::vector<Completion> - completions in the order they were delivered
+         */
+        std::vector<Completion> waitForCompletions(CompletionQueue& completions, size_t count, std::vector<RoutedReport>& reports) {
+            std::vector<Completion> delivered;
+            std::vector<Completion> drained;
+            std::vector<RoutedReport> drainedReports;
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+
+            while (delivered.size() < count && std::chrono::steady_clock::now() < deadline) {
+                completions.drain(drained, drainedReports);
+                delivered.insert(delivered.end(), drained.begin(), drained.end());
+                reports.insert(reports.end(), drainedReports.begin(), drainedReports.end());
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+
+            return delivered;
+        }
+
+        // ========== UT Functions ==========
+        /**
+         * @brief Test adding, halting, resuming and removing a symbol on an engine.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testSymbolLifecycle() {
+            bool testResult = true;
+
+            std::atomic<uint32_t> wakeups(0);
+            std::atomic<uint32_t> releasedId(0);
+            CompletionQueue completions([&wakeups]() { wakeups++; });
+            MatchingEngine engine(0, [&releasedId](uint32_t symbolId) { releasedId = symbolId; }, false);
+            OrderBookSlot slot;
+
+            OrderRequest order{symbol, 10, 100.0, OrderSide::BUY, OrderType::LIMIT};
+            std::vector<EngineCommand> commands;
+            commands.push_back(EngineCommand{symbolId, &slot, ResponseRoute{&completions, nullptr, 0, {}}, order});
+            commands.push_back(EngineCommand{symbolId, &slot, ResponseRoute{&completions, nullptr, 1, {}}, AdminRequest{AdminAction::ADD_SYMBOL, symbol}});
+            commands.push_back(EngineCommand{symbolId, &slot, ResponseRoute{&completions, nullptr, 2, {}}, order});
+            commands.push_back(EngineCommand{symbolId, &slot, ResponseRoute{&completions, nullptr, 3, {}}, AdminRequest{AdminAction::HALT_SYMBOL, symbol}});
+            commands.push_back(EngineCommand{symbolId, &slot, ResponseRoute{&completions, nullptr, 4, {}}, order});
+            commands.push_back(EngineCommand{symbolId, &slot, ResponseRoute{&completions, nullptr, 5, {}}, AdminRequest{AdminAction::RESUME_SYMBOL, symbol}});
+            commands.push_back(EngineCommand{symbolId, &slot, ResponseRoute{&completions, nullptr, 6, {}}, order});
+            commands.push_back(EngineCommand{symbolId, &slot, ResponseRoute{&completions, nullptr, 7, {}}, AdminRequest{AdminAction::REMOVE_SYMBOL, symbol}});
+
+            engine.start();
+            engine.submit(commands);
+            std::vector<Completion> delivered = waitForCompletions(completions, 8);
+            engine.stop();
+
+            testResult &= commands.empty();
+            testResult &= (delivered.size() == 8);
+            testResult &= (wakeups > 0);
+            logStatusUpdate("Every command completed", testResult);
+
+            if (delivered.size() != 8) {
+                processTestResult("MatchingEngine_UT::testSymbolLifecycle()", testResult);
+                return testResult;
+            }
+
+            // Completions keep the submission order of one engine
+            for (uint64_t seq = 0; seq < 8; seq++) {
+                testResult &= (delivered[seq].seq == seq);
+            }
+
+            testResult &= (delivered[0].response.errCode == ErrorCode::BAD_SYMBOL);
+            testResult &= (delivered[1].response.errCode == ErrorCode::OK);
+            testResult &= (delivered[2].response.errCode == ErrorCode::OK);
+            logStatusUpdate("Orders accepted once the symbol is added", testResult);
+
+            testResult &= (delivered[4].response.errCode == ErrorCode::SYMBOL_HALTED);
+            testResult &= (delivered[6].response.errCode == ErrorCode::OK);
+            logStatusUpdate("Orders rejected while halted", testResult);
+
+            testResult &= (delivered[7].response.errCode == ErrorCode::OK);
+            testResult &= (slot.state == BookState::FREE);
+            testResult &= (releasedId == symbolId);
+            testResult &= (slot.book.getOrderBookExchangeSymbol().empty());
+            logStatusUpdate("Removed book returned to the pool", testResult);
+
+            processTestResult("MatchingEngine_UT::testSymbolLifecycle()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test that responses completed out of order are written in request order.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testResponseOrder() {
+            bool testResult = true;
+
+            RecordingSession session;
+            uint64_t first = session.beginRequest();
+            uint64_t second = session.beginRequest();
+            uint64_t third = session.beginRequest();
+
+            // Later requests wait for the first
+            session.completeRequest(third, OrderResponse{"third", ErrorCode::OK});
+            session.completeRequest(second, OrderResponse{"second", ErrorCode::OK});
+            testResult &= !session.hasPendingOutbound();
+            testResult &= session.hasOutstandingRequests();
+            logStatusUpdate("Responses held for an earlier request", testResult);
+
+            session.completeRequest(first, OrderResponse{"first", ErrorCode::BAD_QTY});
+            testResult &= !session.hasOutstandingRequests();
+            testResult &= session.flush();
+
+            // Decode the written responses
+            std::vector<std::string> orderIds;
+            protocol::Frame frame;
+            size_t frameSize = 0;
+            size_t offset = 0;
+
+            while (protocol::decodeFrame(session.sent.data() + offset, session.sent.size() - offset, frame, frameSize) ==
+                   protocol::DecodeStatus::COMPLETE) {
+                OrderResponse response;
+                testResult &= protocol::deserialize(frame, response);
+                orderIds.push_back(response.orderId);
+                offset += frameSize;
+            }
+
+            testResult &= (orderIds == std::vector<std::string>{"first", "second", "third"});
+            logStatusUpdate("Responses written in request order", testResult);
+
+            processTestResult("MatchingEngine_UT::testResponseOrder()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test the overload flag between the queue watermarks.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testQueueWatermarks() {
+            bool testResult = true;
+
+            CompletionQueue completions([]() {});
+            MatchingEngine engine(0, [](uint32_t symbolId) { (void)symbolId; }, false);
+            OrderBookSlot slot;
+            engine.setWatermarks(4, 1);
+
+            OrderRequest order{symbol, 10, 100.0, OrderSide::BUY, OrderType::LIMIT};
+            std::vector<EngineCommand> commands;
+
+            // Not started; commands stay queued
+            for (uint64_t seq = 0; seq < 3; seq++) {
+                commands.push_back(EngineCommand{symbolId, &slot, ResponseRoute{&completions, nullptr, seq, {}}, order});
+            }
+            engine.submit(commands);
+            testResult &= (engine.getQueueDepth() == 3);
+            testResult &= !engine.isOverloaded();
+            logStatusUpdate("Below the high watermark", testResult);
+
+            for (uint64_t seq = 3; seq < 5; seq++) {
+                commands.push_back(EngineCommand{symbolId, &slot, ResponseRoute{&completions, nullptr, seq, {}}, order});
+            }
+            engine.submit(commands);
+            testResult &= (engine.getQueueDepth() == 5);
+            testResult &= engine.isOverloaded();
+            logStatusUpdate("Overloaded at the high watermark", testResult);
+
+            engine.start();
+            std::vector<Completion> delivered = waitForCompletions(completions, 5);
+            engine.stop();
+
+            testResult &= (delivered.size() == 5);
+            testResult &= (engine.getQueueDepth() == 0);
+            testResult &= !engine.isOverloaded();
+            logStatusUpdate("Overload cleared once drained", testResult);
+
+            processTestResult("MatchingEngine_UT::testQueueWatermarks()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test that fills and cancels are reported to the session that owns the order.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testExecutionReports() {
+            bool testResult = true;
+
+            CompletionQueue completions([]() {});
+            MatchingEngine engine(0, [](uint32_t symbolId) { (void)symbolId; }, false);
+            OrderBookSlot slot;
+            RecordingSession maker(7);
+            RecordingSession taker(8);
+
+            // The maker rests an ask; the taker lifts part of it
+            std::vector<EngineCommand> commands;
+            commands.push_back(EngineCommand{symbolId, &slot, ResponseRoute{&completions, &maker, maker.beginRequest(), {}}, AdminRequest{AdminAction::ADD_SYMBOL, symbol}});
+            commands.push_back(EngineCommand{symbolId, &slot, ResponseRoute{&completions, &maker, maker.beginRequest(), {}}, OrderRequest{symbol, 10, 100.0, OrderSide::SELL, OrderType::LIMIT}});
+            commands.push_back(EngineCommand{symbolId, &slot, ResponseRoute{&completions, &taker, taker.beginRequest(), {}}, OrderRequest{symbol, 4, 100.0, OrderSide::BUY, OrderType::MARKET}});
+            commands.push_back(EngineCommand{symbolId, &slot, ResponseRoute{&completions, &maker, maker.beginRequest(), {}}, AdminRequest{AdminAction::REMOVE_SYMBOL, symbol}});
+
+            std::vector<RoutedReport> reports;
+            engine.start();
+            engine.submit(commands);
+            std::vector<Completion> delivered = waitForCompletions(completions, 4, reports);
+            engine.stop();
+
+            testResult &= (delivered.size() == 4);
+            testResult &= (reports.size() == 3);
+            logStatusUpdate("Reports delivered with the responses", testResult);
+
+            if (delivered.size() != 4 || reports.size() != 3) {
+                processTestResult("MatchingEngine_UT::testExecutionReports()", testResult);
+                return testResult;
+            }
+
+            std::string askId = delivered[1].response.orderId;
+            std::string bidId = delivered[2].response.orderId;
+
+            // Both sides of the trade are told, each on its own session
+            testResult &= (reports[0].sessionId == 8 && reports[0].report.orderId == bidId);
+            testResult &= (reports[0].report.type == ExecutionType::FILL && reports[0].report.leavesQty == 0);
+            testResult &= (reports[1].sessionId == 7 && reports[1].report.orderId == askId);
+            testResult &= (reports[1].report.qty == 4 && reports[1].report.leavesQty == 6);
+            logStatusUpdate("Fill reported to the resting order's owner", testResult);
+
+            // Removing the symbol cancels the rest of the ask
+            testResult &= (reports[2].sessionId == 7 && reports[2].report.type == ExecutionType::CANCEL);
+            testResult &= (reports[2].report.qty == 6);
+            logStatusUpdate("Unsolicited cancel reported", testResult);
+
+            // A report is held until the responses the session is waiting for are written
+            RecordingSession session;
+            uint64_t seq = session.beginRequest();
+            session.deliverReport(reports[1].report);
+            testResult &= !session.hasPendingOutbound();
+            session.completeRequest(seq, OrderResponse{askId, ErrorCode::OK});
+            testResult &= session.flush();
+
+            protocol::Frame frame;
+            size_t frameSize = 0;
+            protocol::decodeFrame(session.sent.data(), session.sent.size(), frame, frameSize);
+            testResult &= (frame.type == MessageType::ORDER_RESPONSE);
+            protocol::decodeFrame(session.sent.data() + frameSize, session.sent.size() - frameSize, frame, frameSize);
+            testResult &= (frame.type == MessageType::EXECUTION_REPORT);
+            logStatusUpdate("Report written after the pending response", testResult);
+
+            processTestResult("MatchingEngine_UT::testExecutionReports()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test counting each session's resting orders as they rest,
+         * fill and are canceled.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testOpenOrderCount() {
+            bool testResult = true;
+
+            CompletionQueue completions([]() {});
+            MatchingEngine engine(0, [](uint32_t symbolId) { (void)symbolId; }, false);
+            OrderBookSlot slot;
+            RecordingSession maker(7);
+            RecordingSession taker(8);
+
+            // Three orders rest; the taker's order fills one of them in full
+            std::vector<EngineCommand> commands;
+            commands.push_back(EngineCommand{symbolId, &slot, ResponseRoute{&completions, &maker, maker.beginRequest(), {}}, AdminRequest{AdminAction::ADD_SYMBOL, symbol}});
+            commands.push_back(EngineCommand{symbolId, &slot, ResponseRoute{&completions, &maker, maker.beginRequest(), {}}, OrderRequest{symbol, 10, 100.0, OrderSide::SELL, OrderType::LIMIT}});
+            commands.push_back(EngineCommand{symbolId, &slot, ResponseRoute{&completions, &maker, maker.beginRequest(), {}}, OrderRequest{symbol, 10, 101.0, OrderSide::SELL, OrderType::LIMIT}});
+            commands.push_back(EngineCommand{symbolId, &slot, ResponseRoute{&completions, &maker, maker.beginRequest(), {}}, OrderRequest{symbol, 5, 90.0, OrderSide::BUY, OrderType::LIMIT}});
+            commands.push_back(EngineCommand{symbolId, &slot, ResponseRoute{&completions, &taker, taker.beginRequest(), {}}, OrderRequest{symbol, 10, 100.0, OrderSide::BUY, OrderType::LIMIT}});
+
+            engine.start();
+            engine.submit(commands);
+            std::vector<Completion> delivered = waitForCompletions(completions, 5);
+
+            testResult &= (delivered.size() == 5);
+            testResult &= (maker.getOpenOrders() == 2 && taker.getOpenOrders() == 0);
+            logStatusUpdate("Resting orders counted, filled orders released", testResult);
+
+            if (delivered.size() != 5) {
+                engine.stop();
+                processTestResult("MatchingEngine_UT::testOpenOrderCount()", testResult);
+                return testResult;
+            }
+
+            // A cancel and a partial fill; the taker rests a bid
+            commands.push_back(EngineCommand{symbolId, &slot, ResponseRoute{&completions, &maker, maker.beginRequest(), {}}, OrderCancel{symbol, delivered[3].response.orderId}});
+            commands.push_back(EngineCommand{symbolId, &slot, ResponseRoute{&completions, &taker, taker.beginRequest(), {}}, OrderRequest{symbol, 4, 0.0, OrderSide::BUY, OrderType::MARKET}});
+            commands.push_back(EngineCommand{symbolId, &slot, ResponseRoute{&completions, &taker, taker.beginRequest(), {}}, OrderRequest{symbol, 3, 95.0, OrderSide::BUY, OrderType::LIMIT}});
+
+            engine.submit(commands);
+            delivered = waitForCompletions(completions, 3);
+
+            testResult &= (delivered.size() == 3);
+            testResult &= (maker.getOpenOrders() == 1 && taker.getOpenOrders() == 1);
+            logStatusUpdate("Cancel releases, partial fill keeps counting", testResult);
+
+            // Removing the symbol cancels every resting order
+            commands.push_back(EngineCommand{symbolId, &slot, ResponseRoute{&completions, &maker, maker.beginRequest(), {}}, AdminRequest{AdminAction::REMOVE_SYMBOL, symbol}});
+            engine.submit(commands);
+            delivered = waitForCompletions(completions, 1);
+            engine.stop();
+
+            testResult &= (delivered.size() == 1);
+            testResult &= (maker.getOpenOrders() == 0 && taker.getOpenOrders() == 0);
+            testResult &= slot.owners.empty();
+            logStatusUpdate("Orders canceled by a removal released", testResult);
+
+            processTestResult("MatchingEngine_UT::testOpenOrderCount()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test that the orders of a disconnected session are forgotten,
+         * so the owners of a book do not grow with reconnecting agents.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testSessionClose() {
+            bool testResult = true;
+
+            CompletionQueue completions([]() {});
+            MatchingEngine engine(0, [](uint32_t symbolId) { (void)symbolId; }, false);
+            OrderBookSlot slot;
+            RecordingSession maker(7);
+            RecordingSession taker(8);
+
+            // Both sessions rest orders, then the maker disconnects
+            std::vector<EngineCommand> commands;
+            commands.push_back(EngineCommand{symbolId, &slot, ResponseRoute{&completions, &maker, maker.beginRequest(), {}}, AdminRequest{AdminAction::ADD_SYMBOL, symbol}});
+            commands.push_back(EngineCommand{symbolId, &slot, ResponseRoute{&completions, &maker, maker.beginRequest(), {}}, OrderRequest{symbol, 10, 100.0, OrderSide::SELL, OrderType::LIMIT}});
+            commands.push_back(EngineCommand{symbolId, &slot, ResponseRoute{&completions, &maker, maker.beginRequest(), {}}, OrderRequest{symbol, 10, 90.0, OrderSide::BUY, OrderType::LIMIT}});
+            commands.push_back(EngineCommand{symbolId, &slot, ResponseRoute{&completions, &taker, taker.beginRequest(), {}}, OrderRequest{symbol, 5, 95.0, OrderSide::BUY, OrderType::LIMIT}});
+            commands.push_back(EngineCommand{symbolId, &slot, ResponseRoute{nullptr, nullptr, 0, {}}, SessionClose{7}});
+
+            // The maker's ask still trades, but nothing is reported to the closed session
+            commands.push_back(EngineCommand{symbolId, &slot, ResponseRoute{&completions, &taker, taker.beginRequest(), {}}, OrderRequest{symbol, 4, 0.0, OrderSide::BUY, OrderType::MARKET}});
+
+            std::vector<RoutedReport> reports;
+            engine.start();
+            engine.submit(commands);
+            std::vector<Completion> delivered = waitForCompletions(completions, 5, reports);
+
+            testResult &= (delivered.size() == 5);
+            testResult &= (slot.owners.size() == 1);
+            testResult &= (maker.getOpenOrders() == 0 && taker.getOpenOrders() == 1);
+            logStatusUpdate("Closed session's orders forgotten", testResult);
+
+            testResult &= (slot.book.getActiveSellOrders().size() == 1 && slot.book.getActiveBuyOrders().size() == 2);
+            testResult &= std::none_of(reports.begin(), reports.end(), [](const RoutedReport& routed) { return routed.sessionId == 7; });
+            logStatusUpdate("Orders keep resting without reports", testResult);
+
+            // The last session disconnects; nothing is left to track
+            commands.push_back(EngineCommand{symbolId, &slot, ResponseRoute{nullptr, nullptr, 0, {}}, SessionClose{8}});
+            commands.push_back(EngineCommand{symbolId, &slot, ResponseRoute{&completions, &taker, taker.beginRequest(), {}}, OrderCancel{symbol, "-1"}});
+            engine.submit(commands);
+            delivered = waitForCompletions(completions, 1);
+            engine.stop();
+
+            testResult &= (delivered.size() == 1);
+            testResult &= slot.owners.empty();
+            testResult &= (taker.getOpenOrders() == 0);
+            logStatusUpdate("Owners empty once every session closed", testResult);
+
+            processTestResult("MatchingEngine_UT::testSessionClose()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test answering queries with pages streamed behind the responses.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testQueryPages() {
+            bool testResult = true;
+
+            constexpr int orderCount = 300;
+
+            CompletionQueue completions([]() {});
+            MatchingEngine engine(0, [](uint32_t symbolId) { (void)symbolId; }, false);
+            OrderBookSlot slot;
+            RecordingSession session;
+
+            // Enough resting orders to need several pages, then queries of the book
+            std::vector<EngineCommand> commands;
+            commands.push_back(EngineCommand{symbolId, &slot, ResponseRoute{&completions, &session, session.beginRequest(), {}}, AdminRequest{AdminAction::ADD_SYMBOL, symbol}});
+            for (int i = 0; i < orderCount; i++) {
+                commands.push_back(EngineCommand{symbolId, &slot, ResponseRoute{&completions, &session, session.beginRequest(), {}}, OrderRequest{symbol, 1, 100.0 - i * 0.01, OrderSide::BUY, OrderType::LIMIT}});
+            }
+            commands.push_back(EngineCommand{symbolId, &slot, ResponseRoute{&completions, &session, session.beginRequest(), {}}, QueryRequest{symbol, QueryType::OPEN_ORDERS, 0, 0}});
+            commands.push_back(EngineCommand{symbolId, &slot, ResponseRoute{&completions, &session, session.beginRequest(), {}}, QueryRequest{symbol, QueryType::ORDER_HISTORY, 250, 20}});
+            commands.push_back(EngineCommand{symbolId, &slot, ResponseRoute{&completions, &session, session.beginRequest(), {}}, OrderRequest{symbol, 5, 100.0, OrderSide::SELL, OrderType::LIMIT}});
+
+            engine.start();
+            engine.submit(commands);
+            std::vector<Completion> delivered = waitForCompletions(completions, orderCount + 4);
+            engine.stop();
+
+            testResult &= (delivered.size() == static_cast<size_t>(orderCount + 4));
+            logStatusUpdate("Queries completed by the engine", testResult);
+
+            for (Completion& completion : delivered) {
+                session.completeRequest(completion.seq, completion.response, std::move(completion.query));
+            }
+
+            // Decode everything the session writes
+            std::vector<QueryPage> pages;
+            std::vector<MessageType> frameTypes;
+            size_t offset = 0;
+
+            while (session.hasPendingOutbound() && session.flush()) {
+                protocol::Frame frame;
+                size_t frameSize = 0;
+
+                while (protocol::decodeFrame(session.sent.data() + offset, session.sent.size() - offset, frame, frameSize) ==
+                       protocol::DecodeStatus::COMPLETE) {
+                    frameTypes.push_back(frame.type);
+                    offset += frameSize;
+
+                    if (frame.type == MessageType::QUERY_PAGE) {
+                        pages.emplace_back();
+                        testResult &= protocol::deserialize(frame, pages.back());
+                    }
+                }
+            }
+
+            // The open orders are split over several pages with contiguous cursors
+            size_t openPages = 0;
+            uint64_t nextCursor = 0;
+            int openOrders = 0;
+
+            while (openPages < pages.size() && pages[openPages].type == QueryType::OPEN_ORDERS) {
+                testResult &= (pages[openPages].cursor == nextCursor);
+                testResult &= (pages[openPages].last == (openPages + 1 < pages.size() && pages[openPages + 1].type != QueryType::OPEN_ORDERS));
+                nextCursor = pages[openPages].nextCursor;
+                openOrders += static_cast<int>(pages[openPages].orders.size());
+                openPages++;
+            }
+
+            testResult &= (openPages > 1 && openOrders == orderCount && nextCursor == static_cast<uint64_t>(orderCount));
+            testResult &= (pages.size() > openPages && pages[0].orders[0].price == 100.0);
+            logStatusUpdate("Open orders streamed in pages", testResult);
+
+            // The history query returns the requested window
+            if (pages.size() == openPages + 1) {
+                const QueryPage& history = pages.back();
+                testResult &= (history.type == QueryType::ORDER_HISTORY && history.last);
+                testResult &= (history.cursor == 250 && history.nextCursor == 270 && history.orders.size() == 20);
+            }
+            else {
+                testResult = false;
+            }
+            logStatusUpdate("History window from a cursor", testResult);
+
+            // The order after the queries is answered after their pages
+            testResult &= (frameTypes.size() == static_cast<size_t>(orderCount + 1) + pages.size() + 1);
+            testResult &= (frameTypes.back() == MessageType::ORDER_RESPONSE);
+            testResult &= !session.hasPendingOutbound();
+            logStatusUpdate("Responses kept in request order", testResult);
+
+            processTestResult("MatchingEngine_UT::testQueryPages()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test that a busy-polling engine picks up commands without being notified.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testBusyPoll() {
+            bool testResult = true;
+
+            CompletionQueue completions([]() {});
+            MatchingEngine engine(0, [](uint32_t) {}, false);
+            engine.setThreadConfig(threading::ThreadPlacement(), true);
+            OrderBookSlot slot;
+
+            engine.start();
+
+            // Submit in two rounds so the second one lands while the engine spins
+            for (uint64_t round = 0; round < 2; round++) {
+                std::vector<EngineCommand> commands;
+                commands.push_back(EngineCommand{symbolId, &slot, ResponseRoute{&completions, nullptr, round, {}}, AdminRequest{round == 0 ? AdminAction::ADD_SYMBOL : AdminAction::REMOVE_SYMBOL, symbol}});
+                engine.submit(commands);
+
+                std::vector<Completion> delivered = waitForCompletions(completions, 1);
+                testResult &= (delivered.size() == 1);
+                testResult &= (!delivered.empty() && delivered[0].response.errCode == ErrorCode::OK);
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            }
+            logStatusUpdate("Commands executed while spinning", testResult);
+
+            engine.stop();
+            testResult &= (engine.getQueueDepth() == 0);
+            logStatusUpdate("Spinning engine stopped", testResult);
+
+            processTestResult("MatchingEngine_UT::testBusyPoll()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test that a batch spanning several books executed by batch
+         * workers matches the same batch executed serially: responses in batch
+         * order, the same results, reports and books.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testParallelBatches() {
+            bool testResult = true;
+
+            const size_t books = 8;
+            const size_t orders = 400;
+
+            std::vector<Completion> delivered[2];
+            std::vector<RoutedReport> reports[2];
+            std::vector<std::string> depth[2];
+            uint64_t parallelBatches[2] = {};
+
+            for (int run = 0; run < 2; run++) {
+                CompletionQueue completions([]() {});
+                MatchingEngine engine(0, [](uint32_t) {}, false);
+                engine.setBatchWorkers(run == 0 ? 0 : 3);
+                RecordingSession session;
+                OrderBookSlot slots[books];
+
+                // One batch: the books are added, then random orders across them
+                std::vector<EngineCommand> commands;
+                for (uint32_t book = 0; book < books; book++) {
+                    commands.push_back(EngineCommand{book, &slots[book], ResponseRoute{&completions, &session, session.beginRequest(), {}},
+                                                     AdminRequest{AdminAction::ADD_SYMBOL, "BOOK" + std::to_string(book)}});
+                }
+
+                std::mt19937 generator(11);
+                for (size_t order = 0; order < orders; order++) {
+                    uint32_t book = generator() % books;
+                    OrderType type = (generator() % 5 == 0) ? OrderType::IOC : OrderType::LIMIT;
+                    OrderSide side = (generator() % 2 == 0) ? OrderSide::BUY : OrderSide::SELL;
+                    OrderRequest request{"BOOK" + std::to_string(book), static_cast<int>(1 + generator() % 20),
+                                         100.0 + static_cast<int>(generator() % 9) - 4, side, type};
+
+                    commands.push_back(EngineCommand{book, &slots[book], ResponseRoute{&completions, &session, session.beginRequest(), {}}, request});
+                }
+
+                // Queued before the engine starts, so they form one batch
+                engine.submit(commands);
+                engine.start();
+                delivered[run] = waitForCompletions(completions, books + orders, reports[run]);
+                engine.stop();
+                parallelBatches[run] = engine.getParallelBatches();
+
+                // Reports are pushed after the responses; collect any still queued
+                std::vector<Completion> remaining;
+                std::vector<RoutedReport> remainingReports;
+                completions.drain(remaining, remainingReports);
+                reports[run].insert(reports[run].end(), remainingReports.begin(), remainingReports.end());
+
+                for (OrderBookSlot& slot : slots) {
+                    std::string levels;
+                    for (const auto& [price, restingOrders] : slot.book.getActiveBuyOrders()) {
+                        levels += "b" + std::to_string(price) + "x" + std::to_string(restingOrders.size()) + " ";
+                    }
+                    for (const auto& [price, restingOrders] : slot.book.getActiveSellOrders()) {
+                        levels += "a" + std::to_string(price) + "x" + std::to_string(restingOrders.size()) + " ";
+                    }
+                    depth[run].push_back(levels);
+                }
+            }
+
+            testResult &= (parallelBatches[0] == 0 && parallelBatches[1] == 1);
+            testResult &= (delivered[1].size() == books + orders);
+            for (uint64_t seq = 0; seq < delivered[1].size(); seq++) {
+                testResult &= (delivered[1][seq].seq == seq);
+            }
+            logStatusUpdate("Batch run by the workers, responses in batch order", testResult);
+
+            testResult &= (delivered[0].size() == delivered[1].size());
+            for (size_t index = 0; index < delivered[0].size() && index < delivered[1].size(); index++) {
+                testResult &= (delivered[0][index].response.errCode == delivered[1][index].response.errCode);
+            }
+            testResult &= (reports[0].size() == reports[1].size() && !reports[1].empty());
+            testResult &= (depth[0] == depth[1]);
+            logStatusUpdate("Same results, reports and books as a serial batch", testResult);
+
+            processTestResult("MatchingEngine_UT::testParallelBatches()", testResult);
+
+            return testResult;
+        }
+
+        // ========== UT Variables ==========
+        const std::string symbol = "TEST_ME";
+        const uint32_t symbolId = 7;
+
+        const std::string testName = "MatchingEngine_UT";
+};
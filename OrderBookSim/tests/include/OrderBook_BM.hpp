@@ -0,0 +1,353 @@
+// Global Includes
+#include <algorithm>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Project Includes
+#include <Benchmark.hpp>
+#include <LatencyHistogram.hpp>
+#include <OrderBook.hpp>
+#include <Types.hpp>
+
+class OrderBook_BM : public Benchmark {
+    public:
+        /**
+         * @brief Create the order book benchmark suite.
+         *
+         * @param ops - operations timed per case
+         * @param filter - only cases whose name contains this run (empty for all)
+         */
+        OrderBook_BM(uint64_t ops, const std::string& filter) : Benchmark("OrderBook", ops, filter) {}
+
+        /**
+         * @brief Runs every selected Order Book benchmark case: each operation,
+         * each order mix and each auction allocation on every book profile.
+         */
+        void runBenchmarks() {
+            const BookProfile profiles[] = {
+                // name,    bids,  asks,  per level, at best bid, passive range
+                {"empty",   0,     0,     0,         0,           10},
+                {"shallow", 10,    10,    10,        0,           10},
+                {"deep",    10000, 10000, 1,         0,           10000},
+                {"skewed",  100,   10,    1,         1000,        10}
+            };
+
+            for (const BookProfile& profile : profiles) {
+                benchCreatePassive(profile);
+                benchCancel(profile);
+                benchModify(profile);
+                benchMatch(profile);
+
+                for (int aggressivePercent : {10, 50, 90}) {
+                    benchMix(profile, aggressivePercent, TypeMix::LIMIT);
+                    benchMix(profile, aggressivePercent, TypeMix::MARKET);
+                    benchMix(profile, aggressivePercent, TypeMix::IOC_FOK);
+                }
+
+                benchUncross(profile, AuctionAllocation::TIME_PRIORITY);
+                benchUncross(profile, AuctionAllocation::PRO_RATA);
+            }
+        }
+
+    private:
+        /**
+         * @brief Resting orders a book is filled with before a case is timed.
+         * Bids rest below and asks above the reference price, one tick apart.
+         */
+        struct BookProfile {
+            const char* name;   // Name of the profile
+            int bidLevels;      // Bid price levels
+            int askLevels;      // Ask price levels
+            int ordersPerLevel; // Orders per level
+            int bestBidOrders;  // Extra orders queued at the best bid (skew)
+            int passiveRange;   // New passive orders rest within this many levels of the reference
+        };
+
+        /**
+         * @brief Order types of the aggressive orders of a mix.
+         */
+        enum class TypeMix {
+            LIMIT,  // LIMIT at the opposite best price
+            MARKET, // MARKET
+            IOC_FOK // IOC and FOK, alternating
+        };
+
+        static constexpr int REFERENCE_TICKS = 100000; // Reference price (1000.00) in ticks
+        static constexpr int AUCTION_ORDERS = 20;      // Orders collected per batch auction
+        static constexpr int AUCTION_RANGE = 5;        // Auction orders are priced within this many ticks of the reference
+
+        /**
+         * @brief Get the price of a tick count (0.01 per tick).
+         *
+         * @param ticks - price in ticks
+         *
+         * @return double - price
+         */
+        static double priceAt(int ticks) {
+            return ticks / 100.0;
+        }
+
+        /**
+         * @brief Fill a book with the resting orders of a profile.
+         *
+         * @param book - empty book
+         * @param profile - orders to rest
+         */
+        void populate(OrderBook& book, const BookProfile& profile) {
+            ErrorCode errCode = ErrorCode::OK;
+
+            for (int level = 1; level <= std::max(profile.bidLevels, profile.askLevels); level++) {
+                for (int order = 0; order < profile.ordersPerLevel; order++) {
+                    if (level <= profile.bidLevels) book.createOrder(50, priceAt(REFERENCE_TICKS - level), OrderSide::BUY, OrderType::LIMIT, errCode);
+                    if (level <= profile.askLevels) book.createOrder(50, priceAt(REFERENCE_TICKS + level), OrderSide::SELL, OrderType::LIMIT, errCode);
+                }
+            }
+
+            for (int order = 0; order < profile.bestBidOrders; order++) {
+                book.createOrder(50, priceAt(REFERENCE_TICKS - 1), OrderSide::BUY, OrderType::LIMIT, errCode);
+            }
+        }
+
+        /**
+         * @brief Place a LIMIT order that rests without matching, on a random side.
+         *
+         * @param book - book to place it in
+         * @param profile - profile giving the price range
+         * @param random - random stream of the case
+         * @param side - populated with the side of the order
+         * @param errCode - result status
+         *
+         * @return std::string - order ID
+         */
+        std::string placePassive(OrderBook& book, const BookProfile& profile, std::mt19937_64& random, OrderSide& side, ErrorCode& errCode) {
+            int qty = 1 + static_cast<int>(random() % 100);
+            side = (random() & 1) ? OrderSide::BUY : OrderSide::SELL;
+
+            return book.createOrder(qty, passivePrice(profile, random, side), side, OrderType::LIMIT, errCode);
+        }
+
+        /**
+         * @brief Get a random price within a profile's passive range.
+         *
+         * @param profile - profile giving the price range
+         * @param random - random stream of the case
+         * @param side - side of the order
+         *
+         * @return double - price below (buy) or above (sell) the reference
+         */
+        double passivePrice(const BookProfile& profile, std::mt19937_64& random, OrderSide side) {
+            int level = 1 + static_cast<int>(random() % profile.passiveRange);
+            return priceAt(side == OrderSide::BUY ? REFERENCE_TICKS - level : REFERENCE_TICKS + level);
+        }
+
+        // ========== BM Functions ==========
+        /**
+         * @brief Benchmark new orders that rest without matching.
+         *
+         * @param profile - book profile
+         */
+        void benchCreatePassive(const BookProfile& profile) {
+            if (!selected(std::string(profile.name) + "/create_passive")) return;
+
+            OrderBook book("BENCH");
+            populate(book, profile);
+            std::mt19937_64 random(1);
+            LatencyHistogram histogram;
+            uint64_t errors = 0;
+
+            for (uint64_t op = 0; op < ops; op++) {
+                ErrorCode errCode = ErrorCode::OK;
+                OrderSide side = OrderSide::BUY;
+                timeOperation(histogram, [&]() { placePassive(book, profile, random, side, errCode); });
+                errors += (errCode != ErrorCode::OK);
+            }
+
+            addResult(profile.name, "create_passive", histogram, errors);
+        }
+
+        /**
+         * @brief Benchmark canceling resting orders in random order.
+         *
+         * @param profile - book profile
+         */
+        void benchCancel(const BookProfile& profile) {
+            if (!selected(std::string(profile.name) + "/cancel")) return;
+
+            OrderBook book("BENCH");
+            populate(book, profile);
+            std::mt19937_64 random(2);
+            LatencyHistogram histogram;
+            uint64_t errors = 0;
+            ErrorCode errCode = ErrorCode::OK;
+
+            std::vector<std::string> orderIds;
+            for (uint64_t op = 0; op < ops; op++) {
+                OrderSide side = OrderSide::BUY;
+                orderIds.push_back(placePassive(book, profile, random, side, errCode));
+            }
+            std::shuffle(orderIds.begin(), orderIds.end(), random);
+
+            for (const std::string& orderId : orderIds) {
+                timeOperation(histogram, [&]() { book.cancelOrder(orderId, errCode); });
+                errors += (errCode != ErrorCode::OK);
+            }
+
+            addResult(profile.name, "cancel", histogram, errors);
+        }
+
+        /**
+         * @brief Benchmark moving resting orders to a new price and quantity
+         * (without crossing).
+         *
+         * @param profile - book profile
+         */
+        void benchModify(const BookProfile& profile) {
+            if (!selected(std::string(profile.name) + "/modify")) return;
+
+            OrderBook book("BENCH");
+            populate(book, profile);
+            std::mt19937_64 random(3);
+            LatencyHistogram histogram;
+            uint64_t errors = 0;
+            ErrorCode errCode = ErrorCode::OK;
+
+            std::vector<std::pair<std::string, OrderSide>> orders;
+            for (uint64_t op = 0; op < ops; op++) {
+                OrderSide side = OrderSide::BUY;
+                std::string orderId = placePassive(book, profile, random, side, errCode);
+                orders.emplace_back(orderId, side);
+            }
+            std::shuffle(orders.begin(), orders.end(), random);
+
+            for (const auto& [orderId, side] : orders) {
+                int qty = 1 + static_cast<int>(random() % 100);
+                double price = passivePrice(profile, random, side);
+
+                timeOperation(histogram, [&]() { book.modifyOrder(orderId, qty, price, errCode); });
+                errors += (errCode != ErrorCode::OK);
+            }
+
+            addResult(profile.name, "modify", histogram, errors);
+        }
+
+        /**
+         * @brief Benchmark aggressive orders that fully match at the best ask.
+         * Before each timed order the consumed quantity is added back at the
+         * same level (untimed), so the depth stays the same throughout.
+         *
+         * @param profile - book profile
+         */
+        void benchMatch(const BookProfile& profile) {
+            if (!selected(std::string(profile.name) + "/match")) return;
+
+            OrderBook book("BENCH");
+            populate(book, profile);
+            std::mt19937_64 random(4);
+            LatencyHistogram histogram;
+            uint64_t errors = 0;
+            ErrorCode errCode = ErrorCode::OK;
+            double bestAsk = priceAt(REFERENCE_TICKS + 1);
+
+            for (uint64_t op = 0; op < ops; op++) {
+                int qty = 1 + static_cast<int>(random() % 100);
+                book.createOrder(qty, bestAsk, OrderSide::SELL, OrderType::LIMIT, errCode);
+
+                timeOperation(histogram, [&]() { book.createOrder(qty, bestAsk, OrderSide::BUY, OrderType::LIMIT, errCode); });
+                errors += (errCode != ErrorCode::OK);
+            }
+
+            addResult(profile.name, "match", histogram, errors);
+        }
+
+        /**
+         * @brief Benchmark a stream of passive LIMIT orders and aggressive
+         * orders (random sides and sizes) priced at the opposite best price.
+         *
+         * @param profile - book profile
+         * @param aggressivePercent - share of aggressive orders (%)
+         * @param mix - order types of the aggressive orders
+         */
+        void benchMix(const BookProfile& profile, int aggressivePercent, TypeMix mix) {
+            const char* mixName = mix == TypeMix::LIMIT ? "limit" : mix == TypeMix::MARKET ? "market" : "ioc_fok";
+            std::string operation = "mix_" + std::to_string(aggressivePercent) + "_" + mixName;
+            if (!selected(std::string(profile.name) + "/" + operation)) return;
+
+            OrderBook book("BENCH");
+            populate(book, profile);
+            std::mt19937_64 random(5);
+            LatencyHistogram histogram;
+            uint64_t errors = 0;
+            ErrorCode errCode = ErrorCode::OK;
+
+            for (uint64_t op = 0; op < ops; op++) {
+                OrderSide side = OrderSide::BUY;
+
+                if (static_cast<int>(random() % 100) >= aggressivePercent) {
+                    timeOperation(histogram, [&]() { placePassive(book, profile, random, side, errCode); });
+                    errors += (errCode != ErrorCode::OK);
+                    continue;
+                }
+
+                side = (random() & 1) ? OrderSide::BUY : OrderSide::SELL;
+                OrderType type = mix == TypeMix::LIMIT ? OrderType::LIMIT
+                               : mix == TypeMix::MARKET ? OrderType::MARKET
+                               : (op & 1) ? OrderType::IOC : OrderType::FOK;
+                int qty = 1 + static_cast<int>(random() % 100);
+
+                double price = (side == OrderSide::BUY) ? book.getBestAskPrice() : book.getBestBidPrice();
+                if (price <= 0) price = priceAt(REFERENCE_TICKS);
+
+                timeOperation(histogram, [&]() { book.createOrder(qty, price, side, type, errCode); });
+                errors += (errCode != ErrorCode::OK);
+            }
+
+            addResult(profile.name, operation, histogram, errors);
+        }
+
+        /**
+         * @brief Benchmark batch auctions. Before each timed uncross() a batch
+         * of LIMIT orders is collected (untimed), with random sides, sizes and
+         * prices around the reference, so the book crosses by a few levels
+         * whatever its depth. What is left of the batch is canceled after the
+         * auction (untimed), so the depth stays the same throughout.
+         *
+         * @param profile - book profile
+         * @param allocation - rationing at the clearing price
+         */
+        void benchUncross(const BookProfile& profile, AuctionAllocation allocation) {
+            std::string operation = allocation == AuctionAllocation::PRO_RATA ? "uncross_pro_rata" : "uncross_time";
+            if (!selected(std::string(profile.name) + "/" + operation)) return;
+
+            OrderBook book("BENCH");
+            populate(book, profile);
+            book.setMatchingMode(MatchingMode::AUCTION, allocation);
+            std::mt19937_64 random(6);
+            LatencyHistogram histogram;
+            uint64_t errors = 0;
+            ErrorCode errCode = ErrorCode::OK;
+            std::vector<std::string> batch;
+
+            for (uint64_t op = 0; op < ops; op++) {
+                batch.clear();
+                for (int order = 0; order < AUCTION_ORDERS; order++) {
+                    OrderSide side = (random() & 1) ? OrderSide::BUY : OrderSide::SELL;
+                    int qty = 1 + static_cast<int>(random() % 100);
+                    int ticks = REFERENCE_TICKS + static_cast<int>(random() % (2 * AUCTION_RANGE + 1)) - AUCTION_RANGE;
+
+                    batch.push_back(book.createOrder(qty, priceAt(ticks), side, OrderType::LIMIT, errCode));
+                    errors += (errCode != ErrorCode::OK);
+                }
+
+                timeOperation(histogram, [&]() { book.uncross(); });
+
+                // Filled orders are already gone (BAD_ID)
+                for (const std::string& orderId : batch) {
+                    book.cancelOrder(orderId, errCode);
+                }
+            }
+
+            addResult(profile.name, operation, histogram, errors);
+        }
+};
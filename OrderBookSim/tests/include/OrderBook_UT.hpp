@@ -1,11 +1,16 @@
 // Global Includes
+#include <cstdint>
 #include <stdexcept>
+#include <vector>
 
 // Project Includes
+#include <AllocationCounter.hpp>
+#include <BookEvents.hpp>
 #include <Order.hpp>
 #include <OrderBook.hpp>
 #include <Types.hpp>
 #include <UnitTest.hpp>
+#include <utils.hpp>
 
 class OrderBook_UT : public UnitTest {
     public:
@@ -30,6 +35,13 @@ class OrderBook_UT : public UnitTest {
             testResult &= testCreateOrder();
             testResult &= testModifyOrder();
             testResult &= testCancelOrder();
+            testResult &= testBookListener();
+            testResult &= testResetBook();
+            testResult &= testExecutionEvents();
+            testResult &= testHistoryViews();
+            testResult &= testMemoryAccounting();
+            testResult &= testBatchAuction();
+            testResult &= testAuctionAllocation();
 
             logTestResults(testName);
 
@@ -220,6 +232,431 @@ class OrderBook_UT : public UnitTest {
             return testResult;
         }
 
+        /**
+         * @brief Test the level update and trade events delivered to listeners.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testBookListener() {
+            bool testResult = true;
+
+            // Records every event delivered by the book
+            struct RecordingListener : public OrderBookListener {
+                void onBookUpdate(const BookLevelEvent& event) override { updates.push_back(event); }
+                void onTrade(const TradeEvent& event) override { trades.push_back(event); }
+
+                std::vector<BookLevelEvent> updates;
+                std::vector<TradeEvent> trades;
+            };
+
+            OrderBook listenedBook(exchangeSymbol);
+            RecordingListener listener;
+            listenedBook.addListener(&listener);
+
+            // Resting bid creates a level
+            ErrorCode errCode;
+            listenedBook.createOrder(100, 10.0, OrderSide::BUY, OrderType::LIMIT, errCode);
+            testResult &= (listener.updates.size() == 1);
+            testResult &= (listener.updates.back().side == OrderSide::BUY);
+            testResult &= (listener.updates.back().price == 10.0);
+            testResult &= (listener.updates.back().qty == 100);
+            logStatusUpdate("Level update for resting order", testResult);
+
+            // Crossing sell trades against the bid and reduces the level
+            listenedBook.createOrder(40, 10.0, OrderSide::SELL, OrderType::LIMIT, errCode);
+            testResult &= (listener.trades.size() == 1);
+            testResult &= (listener.trades.back().aggressorSide == OrderSide::SELL);
+            testResult &= (listener.trades.back().qty == 40);
+            testResult &= (listener.updates.back().side == OrderSide::BUY);
+            testResult &= (listener.updates.back().qty == 60);
+            logStatusUpdate("Trade and level update for crossing order", testResult);
+
+            // Removed listener receives no further events
+            listenedBook.removeListener(&listener);
+            size_t updateCount = listener.updates.size();
+            listenedBook.createOrder(10, 9.0, OrderSide::BUY, OrderType::LIMIT, errCode);
+            testResult &= (listener.updates.size() == updateCount);
+            logStatusUpdate("No events after listener removed", testResult);
+
+            processTestResult("OrderBook_UT::testBookListener()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test recycling a book for a new symbol.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testResetBook() {
+            bool testResult = true;
+
+            struct LevelListener : public OrderBookListener {
+                void onBookUpdate(const BookLevelEvent& event) override {
+                    symbols.push_back(event.symbol);
+                    quantities.push_back(event.qty);
+                }
+
+                std::vector<std::string> symbols;
+                std::vector<int> quantities;
+            };
+
+            OrderBook pooledBook(exchangeSymbol);
+            LevelListener listener;
+            pooledBook.addListener(&listener);
+
+            ErrorCode errCode;
+            std::string orderId = pooledBook.createOrder(100, 10.0, OrderSide::BUY, OrderType::LIMIT, errCode);
+            pooledBook.createOrder(50, 11.0, OrderSide::SELL, OrderType::LIMIT, errCode);
+
+            // Every level is removed under the old symbol
+            pooledBook.reset("NEW_OB");
+            testResult &= (pooledBook.getOrderBookExchangeSymbol() == "NEW_OB");
+            testResult &= (listener.quantities.size() == 4);
+            testResult &= (listener.quantities[2] == 0 && listener.quantities[3] == 0);
+            testResult &= (listener.symbols[2] == exchangeSymbol && listener.symbols[3] == exchangeSymbol);
+            logStatusUpdate("Reset publishes level removals", testResult);
+
+            // Orders of the old symbol are gone; the listener is kept
+            pooledBook.cancelOrder(orderId, errCode);
+            testResult &= (errCode == ErrorCode::BAD_ID);
+            pooledBook.createOrder(10, 9.0, OrderSide::BUY, OrderType::LIMIT, errCode);
+            testResult &= (errCode == ErrorCode::OK);
+            testResult &= (listener.symbols.back() == "NEW_OB");
+            logStatusUpdate("Reset book accepts orders", testResult);
+
+            processTestResult("OrderBook_UT::testResetBook()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test the per-order fill and cancel events delivered to listeners.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testExecutionEvents() {
+            bool testResult = true;
+
+            struct ExecutionListener : public OrderBookListener {
+                void onExecution(const ExecutionEvent& event) override {
+                    orderIds.push_back(event.orderId);
+                    types.push_back(event.type);
+                    quantities.push_back(event.qty);
+                    leaves.push_back(event.leavesQty);
+                }
+
+                std::vector<std::string> orderIds;
+                std::vector<ExecutionType> types;
+                std::vector<int> quantities;
+                std::vector<int> leaves;
+            };
+
+            OrderBook executionBook(exchangeSymbol);
+            ExecutionListener listener;
+            executionBook.addListener(&listener);
+
+            // Crossing order fills both sides; the aggressor rests with the remainder
+            ErrorCode errCode;
+            std::string askId = executionBook.createOrder(10, 10.0, OrderSide::SELL, OrderType::LIMIT, errCode);
+            std::string bidId = executionBook.createOrder(15, 10.0, OrderSide::BUY, OrderType::LIMIT, errCode);
+            testResult &= (listener.orderIds == std::vector<std::string>{bidId, askId});
+            testResult &= (listener.types[0] == ExecutionType::FILL && listener.types[1] == ExecutionType::FILL);
+            testResult &= (listener.quantities[0] == 10 && listener.quantities[1] == 10);
+            testResult &= (listener.leaves[0] == 5 && listener.leaves[1] == 0);
+            logStatusUpdate("Fill for both sides of a trade", testResult);
+
+            // Unfilled remainder of a market order is canceled
+            executionBook.createOrder(8, 10.0, OrderSide::SELL, OrderType::MARKET, errCode);
+            testResult &= (listener.types.size() == 5);
+            testResult &= (listener.types[4] == ExecutionType::CANCEL);
+            testResult &= (listener.quantities[4] == 3 && listener.leaves[4] == 0);
+            logStatusUpdate("Cancel for a discarded remainder", testResult);
+
+            // Explicit cancel and reset drop resting orders
+            std::string restingId = executionBook.createOrder(20, 9.0, OrderSide::BUY, OrderType::LIMIT, errCode);
+            std::string canceledId = executionBook.createOrder(30, 8.0, OrderSide::BUY, OrderType::LIMIT, errCode);
+            executionBook.cancelOrder(canceledId, errCode);
+            testResult &= (listener.orderIds.back() == canceledId && listener.types.back() == ExecutionType::CANCEL);
+
+            executionBook.reset("NEW_OB");
+            testResult &= (listener.orderIds.back() == restingId && listener.types.back() == ExecutionType::CANCEL);
+            testResult &= (listener.quantities.back() == 20);
+            logStatusUpdate("Cancel for canceled and dropped orders", testResult);
+
+            processTestResult("OrderBook_UT::testExecutionEvents()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test the read views used to answer queries.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testHistoryViews() {
+            bool testResult = true;
+
+            OrderBook queryBook(exchangeSymbol);
+            ErrorCode errCode;
+
+            std::string bidLow = queryBook.createOrder(10, 9.0, OrderSide::BUY, OrderType::LIMIT, errCode);
+            std::string bidHigh = queryBook.createOrder(10, 9.5, OrderSide::BUY, OrderType::LIMIT, errCode);
+            std::string askLow = queryBook.createOrder(10, 10.0, OrderSide::SELL, OrderType::LIMIT, errCode);
+            std::string askHigh = queryBook.createOrder(10, 10.5, OrderSide::SELL, OrderType::LIMIT, errCode);
+
+            // Bids best to worst, then asks best to worst
+            std::vector<QueryOrder> openOrders;
+            queryBook.getOpenOrders(openOrders);
+            testResult &= (openOrders.size() == 4);
+            testResult &= (openOrders[0].orderId == bidHigh && openOrders[1].orderId == bidLow);
+            testResult &= (openOrders[2].orderId == askLow && openOrders[3].orderId == askHigh);
+            logStatusUpdate("Open orders in priority order", testResult);
+
+            // A view only covers the entries recorded when it was taken
+            HistoryLog<std::pair<OrderStatus, Order>>::View orderView = queryBook.getOrderHistoryView();
+            queryBook.createOrder(5, 10.0, OrderSide::BUY, OrderType::LIMIT, errCode);
+            HistoryLog<Trade>::View tradeView = queryBook.getTradeHistoryView();
+
+            testResult &= (orderView.size() == 4);
+            testResult &= (orderView[0].second.getOrderId() == bidLow && orderView[3].second.getOrderId() == askHigh);
+            testResult &= (queryBook.getOrderBookHistory().size() == 5);
+            testResult &= (tradeView.size() == 1 && tradeView[0].getSellOrderId() == askLow);
+            logStatusUpdate("Views fixed when taken", testResult);
+
+            // Entries span several chunks, and outlive a reset of the book
+            for (size_t i = 0; i < HistoryLog<Trade>::CHUNK_SIZE; i++) {
+                queryBook.createOrder(1, 8.0, OrderSide::BUY, OrderType::LIMIT, errCode);
+            }
+
+            HistoryLog<std::pair<OrderStatus, Order>>::View fullView = queryBook.getOrderHistoryView();
+            queryBook.reset("NEW_OB");
+
+            testResult &= (fullView.size() == HistoryLog<Trade>::CHUNK_SIZE + 5);
+            testResult &= (fullView[0].second.getOrderId() == bidLow);
+            testResult &= (fullView[fullView.size() - 1].second.getOrderPrice() == 8.0);
+            testResult &= (orderView.size() == 4 && queryBook.getOrderHistoryView().size() == 0);
+            logStatusUpdate("Views kept after reset", testResult);
+
+            processTestResult("OrderBook_UT::testHistoryViews()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test the memory accounting per component, and that the
+         * steady-state matching path makes no heap allocation at all (counted
+         * by the test build's operator new) once the book's node pools are
+         * warm and its history is reserved.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testMemoryAccounting() {
+            bool testResult = true;
+            ErrorCode errCode = ErrorCode::OK;
+
+            OrderBook memoryBook("MEM_OB");
+            BookMemoryStats stats = memoryBook.getMemoryStats();
+            testResult &= (stats.totalBytes() == 0 && stats.restingOrders == 0 && stats.creates.operations == 0);
+
+            // 10 orders on each of 5 bid and 5 ask levels
+            std::vector<std::string> orderIds;
+            uint64_t warmupAllocations = allocations::threadAllocations();
+            for (int level = 1; level <= 5; level++) {
+                for (int order = 0; order < 10; order++) {
+                    orderIds.push_back(memoryBook.createOrder(10, 100.0 - level, OrderSide::BUY, OrderType::LIMIT, errCode));
+                    orderIds.push_back(memoryBook.createOrder(10, 100.0 + level, OrderSide::SELL, OrderType::LIMIT, errCode));
+                }
+            }
+
+            stats = memoryBook.getMemoryStats();
+            testResult &= (stats.restingOrders == 100 && stats.priceLevels == 10);
+            testResult &= (stats.orders.allocations == 100 && stats.orders.bytesInUse >= 100 * sizeof(Order));
+            testResult &= (stats.levels.allocations == 10 && stats.index.bytesInUse > 0);
+            testResult &= (stats.orderHistoryBytes == HistoryLog<Trade>::CHUNK_SIZE * sizeof(std::pair<OrderStatus, Order>));
+            testResult &= (stats.tradeHistoryBytes == 0);
+            testResult &= (stats.creates.operations == 100 && stats.creates.poolMisses >= 110);
+            testResult &= (stats.creates.historyChunks == 1);
+            testResult &= (allocations::threadAllocations() > warmupAllocations);
+            testResult &= (orderIds.front().size() == utils::ID_LENGTH);
+            logStatusUpdate("Memory by component", testResult);
+
+            // Canceled nodes go back to the pools; nothing is returned to the heap
+            for (const std::string& orderId : orderIds) {
+                memoryBook.cancelOrder(orderId, errCode);
+            }
+
+            BookMemoryStats canceled = memoryBook.getMemoryStats();
+            testResult &= (canceled.restingOrders == 0 && canceled.priceLevels == 0);
+            testResult &= (canceled.orders.bytesInUse == 0 && canceled.levels.bytesInUse == 0);
+            testResult &= (canceled.orders.bytesReserved == stats.orders.bytesReserved);
+            testResult &= (canceled.orders.peakBytesInUse == stats.orders.bytesInUse);
+            testResult &= (canceled.cancels.operations == 100 && canceled.cancels.poolMisses == 0);
+            logStatusUpdate("Nodes recycled on cancel", testResult);
+
+            // Steady state: rest, match, modify and cancel orders within the book's peak depth
+            auto cycle = [&memoryBook, &errCode]() {
+                memoryBook.createOrder(10, 101.0, OrderSide::SELL, OrderType::LIMIT, errCode);
+                memoryBook.createOrder(10, 101.0, OrderSide::BUY, OrderType::LIMIT, errCode);
+                std::string restingId = memoryBook.createOrder(10, 99.0, OrderSide::BUY, OrderType::LIMIT, errCode);
+                memoryBook.modifyOrder(restingId, 20, 98.0, errCode);
+                memoryBook.cancelOrder(restingId, errCode);
+            };
+
+            // History is reserved ahead; it is the only storage that grows with the run
+            memoryBook.reserveHistory(HistoryLog<Trade>::CHUNK_SIZE * 8, HistoryLog<Trade>::CHUNK_SIZE * 2);
+
+            cycle();
+            BookMemoryStats before = memoryBook.getMemoryStats();
+            uint64_t allocationsBefore = allocations::threadAllocations();
+            for (int run = 0; run < 1000; run++) cycle();
+            uint64_t allocationsAfter = allocations::threadAllocations();
+            BookMemoryStats after = memoryBook.getMemoryStats();
+
+            testResult &= (allocationsAfter == allocationsBefore);
+            testResult &= (after.creates.operations - before.creates.operations == 3000);
+            testResult &= (after.creates.poolMisses == before.creates.poolMisses);
+            testResult &= (after.modifies.poolMisses == before.modifies.poolMisses);
+            testResult &= (after.cancels.poolMisses == before.cancels.poolMisses);
+            testResult &= (after.creates.historyChunks == before.creates.historyChunks);
+            testResult &= (after.tradeHistoryBytes > 0 && after.restingOrders == 0);
+            logStatusUpdate("Zero heap allocations in steady state", testResult);
+
+            processTestResult("OrderBook_UT::testMemoryAccounting()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test collecting orders in auction mode and uncrossing them at
+         * one clearing price.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testBatchAuction() {
+            bool testResult = true;
+            ErrorCode errCode = ErrorCode::OK;
+
+            struct TradeListener : public OrderBookListener {
+                void onTrade(const TradeEvent& event) override { trades.push_back(event); }
+
+                std::vector<TradeEvent> trades;
+            };
+
+            OrderBook auctionBook(exchangeSymbol);
+            TradeListener listener;
+            auctionBook.addListener(&listener);
+            auctionBook.setMatchingMode(MatchingMode::AUCTION);
+
+            // Crossing orders rest without matching; orders that need liquidity are rejected
+            auctionBook.createOrder(10, 102.0, OrderSide::BUY, OrderType::LIMIT, errCode);
+            auctionBook.createOrder(20, 101.0, OrderSide::BUY, OrderType::LIMIT, errCode);
+            auctionBook.createOrder(15, 100.0, OrderSide::BUY, OrderType::LIMIT, errCode);
+            auctionBook.createOrder(15, 99.0, OrderSide::SELL, OrderType::LIMIT, errCode);
+            auctionBook.createOrder(10, 100.0, OrderSide::SELL, OrderType::LIMIT, errCode);
+            std::string marginalId = auctionBook.createOrder(20, 101.0, OrderSide::SELL, OrderType::LIMIT, errCode);
+            testResult &= (errCode == ErrorCode::OK);
+            testResult &= (auctionBook.getBestBidPrice() == 102.0 && auctionBook.getBestAskPrice() == 99.0);
+            testResult &= auctionBook.getTradeHistory().empty();
+
+            auctionBook.createOrder(5, 0.01, OrderSide::SELL, OrderType::MARKET, errCode);
+            testResult &= (errCode == ErrorCode::BAD_TYPE);
+            logStatusUpdate("Orders collected until the auction", testResult);
+
+            // Executable quantity per price: 99 => 15, 100 => 25, 101 => 30, 102 => 10
+            AuctionResult result = auctionBook.uncross();
+            testResult &= (result.price == 101.0 && result.volume == 30 && result.imbalance == -15);
+            testResult &= (result.trades == 4 && listener.trades.size() == 4);
+
+            int tradedQty = 0;
+            for (const Trade& trade : auctionBook.getTradeHistory()) {
+                testResult &= (trade.getPrice() == 101.0);
+                tradedQty += trade.getQty();
+            }
+            testResult &= (tradedQty == 30);
+            testResult &= (listener.trades.back().aggressorSide == OrderSide::SELL);
+            logStatusUpdate("Most volume executed at one clearing price", testResult);
+
+            // The ask at the clearing price was rationed; the bid below it never traded
+            std::vector<QueryOrder> openOrders;
+            auctionBook.getOpenOrders(openOrders);
+            testResult &= (openOrders.size() == 2);
+            testResult &= (openOrders.size() == 2 && openOrders[0].price == 100.0 && openOrders[0].remainingQty == 15);
+            testResult &= (openOrders.size() == 2 && openOrders[1].orderId == marginalId && openOrders[1].remainingQty == 15);
+            testResult &= (auctionBook.uncross().volume == 0);
+            logStatusUpdate("Book uncrossed", testResult);
+
+            // Ties on volume and imbalance go to the highest price while buyers are left over
+            OrderBook tieBook(exchangeSymbol);
+            tieBook.setMatchingMode(MatchingMode::AUCTION);
+            tieBook.createOrder(10, 101.0, OrderSide::BUY, OrderType::LIMIT, errCode);
+            tieBook.createOrder(5, 101.0, OrderSide::BUY, OrderType::LIMIT, errCode);
+            tieBook.createOrder(10, 100.0, OrderSide::SELL, OrderType::LIMIT, errCode);
+            result = tieBook.uncross();
+            testResult &= (result.price == 101.0 && result.volume == 10 && result.imbalance == 5);
+            logStatusUpdate("Tie broken towards the side left over", testResult);
+
+            // Returning to continuous matching runs a final auction
+            tieBook.createOrder(5, 102.0, OrderSide::SELL, OrderType::LIMIT, errCode);
+            tieBook.createOrder(5, 103.0, OrderSide::BUY, OrderType::LIMIT, errCode);
+            tieBook.setMatchingMode(MatchingMode::CONTINUOUS);
+            testResult &= (tieBook.getMatchingMode() == MatchingMode::CONTINUOUS);
+            testResult &= (tieBook.getBestAskPrice() == 0.0 && tieBook.getBestBidPrice() == 101.0);
+            tieBook.createOrder(5, 100.0, OrderSide::SELL, OrderType::MARKET, errCode);
+            testResult &= (errCode == ErrorCode::OK && tieBook.getBestBidPrice() == 0.0);
+            logStatusUpdate("Continuous matching resumed", testResult);
+
+            auctionBook.removeListener(&listener);
+
+            processTestResult("OrderBook_UT::testBatchAuction()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test rationing the longer side at the clearing price, by time
+         * priority and pro-rata.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testAuctionAllocation() {
+            bool testResult = true;
+            ErrorCode errCode = ErrorCode::OK;
+            std::vector<QueryOrder> openOrders[2];
+
+            // Asks of 30, 10 and 60 (in time order) against a bid of 51
+            const AuctionAllocation allocations[2] = {AuctionAllocation::TIME_PRIORITY, AuctionAllocation::PRO_RATA};
+            for (int run = 0; run < 2; run++) {
+                OrderBook allocationBook(exchangeSymbol);
+                allocationBook.setMatchingMode(MatchingMode::AUCTION, allocations[run]);
+
+                allocationBook.createOrder(30, 100.0, OrderSide::SELL, OrderType::LIMIT, errCode);
+                allocationBook.createOrder(10, 100.0, OrderSide::SELL, OrderType::LIMIT, errCode);
+                allocationBook.createOrder(60, 100.0, OrderSide::SELL, OrderType::LIMIT, errCode);
+                allocationBook.createOrder(51, 100.0, OrderSide::BUY, OrderType::LIMIT, errCode);
+
+                AuctionResult result = allocationBook.uncross();
+                testResult &= (result.price == 100.0 && result.volume == 51 && result.imbalance == -49);
+                allocationBook.getOpenOrders(openOrders[run]);
+            }
+
+            // Earliest orders fill first
+            testResult &= (openOrders[0].size() == 1);
+            testResult &= (openOrders[0].size() == 1 && openOrders[0][0].qty == 60 && openOrders[0][0].remainingQty == 49);
+            logStatusUpdate("Time priority at the clearing price", testResult);
+
+            // 51 split 15.3 / 5.1 / 30.6: rounded down, the remaining unit to the earliest order
+            testResult &= (openOrders[1].size() == 3);
+            testResult &= (openOrders[1].size() == 3 && openOrders[1][0].remainingQty == 30 - 16);
+            testResult &= (openOrders[1].size() == 3 && openOrders[1][1].remainingQty == 10 - 5);
+            testResult &= (openOrders[1].size() == 3 && openOrders[1][2].remainingQty == 60 - 30);
+            logStatusUpdate("Pro-rata at the clearing price", testResult);
+
+            processTestResult("OrderBook_UT::testAuctionAllocation()", testResult);
+
+            return testResult;
+        }
+
         // ========== UT Variables ==========
         const std::string exchangeSymbol = "TEST_OB";
 
@@ -0,0 +1,285 @@
+// Global Includes
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Project Includes
+#include <Agent.hpp>
+#include <AgentManager.hpp>
+#include <OrderFlow.hpp>
+#include <UnitTest.hpp>
+
+class OrderFlow_UT : public UnitTest {
+    public:
+        /**
+         * @brief Create the order flow unit test object.
+         */
+        OrderFlow_UT() {
+            logTestHeader(testName);
+        }
+
+        /**
+         * @brief Runs all Order Flow unit tests.
+         *
+         * @return true if all unit tests pass; false otherwise
+         */
+        bool runTests() {
+            bool testResult = true;
+
+            // Run order flow unit tests
+            testResult &= testBlockRandom();
+            testResult &= testPoissonArrivals();
+            testResult &= testHawkesArrivals();
+            testResult &= testEventMix();
+            testResult &= testResolvePrice();
+            testResult &= testOrderFlowAgent();
+
+            logTestResults(testName);
+
+            return testResult;
+        }
+
+    private:
+        // ========== UT Functions ==========
+        /**
+         * @brief Test the block random stream.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testBlockRandom() {
+            bool testResult = true;
+
+            BlockRandom first(42, 3);
+            BlockRandom repeat(42, 3);
+            BlockRandom other(42, 4);
+
+            std::vector<double> a(1001), b(1001), c(1001);
+            first.fillUniform(a.data(), a.size());
+            repeat.fillUniform(b.data(), 500);
+            repeat.fillUniform(b.data() + 500, 501);
+            other.fillUniform(c.data(), c.size());
+
+            testResult &= (a == b);
+            testResult &= (a != c);
+            logStatusUpdate("Streams repeat per seed and stream", testResult);
+
+            double sum = 0;
+            bool inRange = true;
+            for (double value : a) {
+                inRange &= (value >= 0.0 && value < 1.0);
+                sum += value;
+            }
+            testResult &= inRange;
+            testResult &= (std::fabs(sum / a.size() - 0.5) < 0.03);
+            logStatusUpdate("Uniform in [0, 1)", testResult);
+
+            processTestResult("OrderFlow_UT::testBlockRandom()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test Poisson arrival times.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testPoissonArrivals() {
+            bool testResult = true;
+
+            OrderFlowParams params;
+            params.arrivals.rate = 5000.0;
+            OrderFlowGenerator generator(params, 7);
+
+            std::vector<OrderFlowEvent> events(100000);
+            generator.generate(events.data(), events.size());
+
+            bool ordered = true;
+            for (size_t i = 1; i < events.size(); i++) ordered &= (events[i].timeNs >= events[i - 1].timeNs);
+            testResult &= ordered;
+
+            // 100000 events at 5000/s take ~20 s
+            double seconds = events.back().timeNs / 1e9;
+            testResult &= (std::fabs(seconds - 20.0) < 0.4);
+            testResult &= (generator.getTime() == events.back().timeNs);
+            logStatusUpdate("Arrival rate matches", testResult);
+
+            processTestResult("OrderFlow_UT::testPoissonArrivals()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test Hawkes arrival times.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testHawkesArrivals() {
+            bool testResult = true;
+
+            OrderFlowParams params;
+            params.arrivals.model = ArrivalModel::HAWKES;
+            params.arrivals.rate = 100.0;
+            params.arrivals.excitation = 600.0;
+            params.arrivals.decay = 1000.0;
+            OrderFlowGenerator generator(params, 11);
+
+            std::vector<OrderFlowEvent> events(200000);
+            generator.generate(events.data(), events.size());
+
+            // Stationary mean rate: 100 / (1 - 0.6) = 250/s
+            double seconds = events.back().timeNs / 1e9;
+            double rate = events.size() / seconds;
+            testResult &= (rate > 235.0 && rate < 265.0);
+            logStatusUpdate("Mean rate matches the stationary rate", testResult);
+
+            // Clustered: counts per 100ms window vary far more than Poisson's (variance = mean)
+            std::vector<double> counts(static_cast<size_t>(seconds * 10) + 1, 0.0);
+            for (const OrderFlowEvent& event : events) counts[static_cast<size_t>(event.timeNs / 100000000)]++;
+            counts.pop_back();
+
+            double mean = 0;
+            for (double count : counts) mean += count;
+            mean /= counts.size();
+            double variance = 0;
+            for (double count : counts) variance += (count - mean) * (count - mean);
+            variance /= counts.size();
+
+            testResult &= (variance > 2 * mean);
+            testResult &= (generator.getIntensity() > params.arrivals.rate);
+            logStatusUpdate("Arrivals cluster", testResult);
+
+            processTestResult("OrderFlow_UT::testHawkesArrivals()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test the event mix, sides, quantities and price offsets.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testEventMix() {
+            bool testResult = true;
+
+            OrderFlowParams params;
+            params.limitWeight = 6;
+            params.marketWeight = 1;
+            params.cancelWeight = 3;
+            params.buyProbability = 0.7;
+            params.minQty = 5;
+            params.maxQty = 9;
+            params.minOffsetTicks = -2;
+            params.maxOffsetTicks = 3;
+            OrderFlowGenerator uniform(params, 5);
+
+            size_t limits = 0, markets = 0, buys = 0;
+            bool inRange = true;
+            bool everyOffset[6] = {};
+            const size_t count = 100000;
+            for (size_t i = 0; i < count; i++) {
+                const OrderFlowEvent& event = uniform.next();
+                limits += (event.type == FlowEventType::LIMIT);
+                markets += (event.type == FlowEventType::MARKET);
+                buys += (event.side == OrderSide::BUY);
+                inRange &= (event.qty >= 5 && event.qty <= 9);
+                inRange &= (event.offsetTicks >= -2 && event.offsetTicks <= 3);
+                inRange &= (event.pick >= 0.0 && event.pick < 1.0);
+                if (event.offsetTicks >= -2 && event.offsetTicks <= 3) everyOffset[event.offsetTicks + 2] = true;
+            }
+
+            testResult &= (std::fabs(limits / double(count) - 0.6) < 0.01);
+            testResult &= (std::fabs(markets / double(count) - 0.1) < 0.01);
+            testResult &= (std::fabs(buys / double(count) - 0.7) < 0.01);
+            testResult &= inRange;
+            for (bool seen : everyOffset) testResult &= seen;
+            logStatusUpdate("Mix, sides, sizes and uniform offsets", testResult);
+
+            params.priceDistribution = PriceDistribution::EXPONENTIAL;
+            params.minOffsetTicks = 1;
+            params.maxOffsetTicks = 1000;
+            params.meanOffsetTicks = 4;
+            OrderFlowGenerator exponential(params, 5);
+
+            double sum = 0;
+            bool aboveMin = true;
+            for (size_t i = 0; i < count; i++) {
+                const OrderFlowEvent& event = exponential.next();
+                aboveMin &= (event.offsetTicks >= 1);
+                sum += event.offsetTicks - 1;
+            }
+            testResult &= aboveMin;
+            testResult &= (std::fabs(sum / count - 4.0) < 0.1);
+            logStatusUpdate("Exponential offsets have the configured mean", testResult);
+
+            processTestResult("OrderFlow_UT::testEventMix()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test pricing events against the book.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testResolvePrice() {
+            bool testResult = true;
+
+            OrderFlowParams params;
+            params.tickSize = 0.5;
+            params.referencePrice = 50.0;
+            OrderFlowGenerator generator(params, 1);
+
+            OrderFlowEvent buy{0, FlowEventType::LIMIT, OrderSide::BUY, 2, 10, 0.0};
+            OrderFlowEvent sell{0, FlowEventType::LIMIT, OrderSide::SELL, 2, 10, 0.0};
+            OrderFlowEvent market{0, FlowEventType::MARKET, OrderSide::BUY, 2, 10, 0.0};
+
+            testResult &= (generator.resolvePrice(buy, 99.0, 100.0) == 99.0);
+            testResult &= (generator.resolvePrice(sell, 99.0, 100.0) == 100.0);
+            testResult &= (generator.resolvePrice(market, 99.0, 100.0) == 100.0);
+            logStatusUpdate("Offsets from the opposite best price", testResult);
+
+            testResult &= (generator.resolvePrice(buy, 99.0, 0.0) == 98.5);
+            testResult &= (generator.resolvePrice(sell, 0.0, 0.0) == 51.0);
+            buy.offsetTicks = 1000;
+            testResult &= (generator.resolvePrice(buy, 99.0, 100.0) == 0.5);
+            logStatusUpdate("Empty sides and price floor", testResult);
+
+            processTestResult("OrderFlow_UT::testResolvePrice()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test order flow agents trading in virtual time.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testOrderFlowAgent() {
+            bool testResult = true;
+
+            OrderFlowParams params;
+            params.arrivals.rate = 200.0;
+            params.minOffsetTicks = -1;
+
+            AgentManager manager({"TEMP1", "TEMP2"}, 3);
+            for (uint32_t agentId = 0; agentId < 10; agentId++) {
+                manager.addAgent(std::make_unique<OrderFlowAgent>(agentId, 3, params, agentId % 2));
+            }
+            manager.runUntil(10000000000LL);
+
+            // 10 agents at 200/s for 10 s
+            const AgentManagerStats& stats = manager.getStats();
+            testResult &= (stats.wakeups > 19000 && stats.wakeups < 21000);
+            testResult &= (stats.orders > 0 && stats.cancels > 0 && stats.trades > 0);
+            testResult &= (manager.getLastTradePrice(0) > 0 && manager.getLastTradePrice(1) > 0);
+            logStatusUpdate("Agents trade at the arrival rate", testResult);
+
+            processTestResult("OrderFlow_UT::testOrderFlowAgent()", testResult);
+
+            return testResult;
+        }
+
+        // ========== UT Variables ==========
+        std::string testName = "OrderFlow_UT";
+};
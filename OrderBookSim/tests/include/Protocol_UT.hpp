@@ -0,0 +1,371 @@
+// Global Includes
+#include <string>
+#include <vector>
+
+// Project Includes
+#include <Protocol.hpp>
+#include <Types.hpp>
+#include <UnitTest.hpp>
+
+class Protocol_UT : public UnitTest {
+    public:
+        /**
+         * @brief Create the protocol unit test object.
+         */
+        Protocol_UT() {
+            logTestHeader(testName);
+        }
+
+        /**
+         * @brief Runs all Protocol unit tests.
+         *
+         * @return true if all unit tests pass; false otherwise
+         */
+        bool runTests() {
+            bool testResult = true;
+
+            // Run protocol unit tests
+            testResult &= testRequestRoundTrip();
+            testResult &= testResponseRoundTrip();
+            testResult &= testPipelinedFrames();
+            testResult &= testInvalidFrames();
+            testResult &= testMarketDataDatagram();
+            testResult &= testSnapshotRoundTrip();
+            testResult &= testQueryRoundTrip();
+
+            logTestResults(testName);
+
+            return testResult;
+        }
+
+    private:
+        // ========== UT Functions ==========
+        /**
+         * @brief Test serializing and deserializing order requests.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testRequestRoundTrip() {
+            bool testResult = true;
+
+            OrderRequest request{symbol, 100, 76.5, OrderSide::BUY, OrderType::LIMIT};
+            std::string buffer;
+            protocol::serialize(request, buffer);
+
+            protocol::Frame frame;
+            size_t frameSize = 0;
+            testResult &= (protocol::decodeFrame(buffer.data(), buffer.size(), frame, frameSize) == protocol::DecodeStatus::COMPLETE);
+            testResult &= (frameSize == buffer.size());
+            testResult &= (frame.type == MessageType::ORDER_REQUEST);
+
+            OrderRequest decoded;
+            testResult &= protocol::deserialize(frame, decoded);
+            testResult &= (decoded.symbol == request.symbol);
+            testResult &= (decoded.qty == request.qty);
+            testResult &= (decoded.price == request.price);
+            testResult &= (decoded.orderSide == request.orderSide);
+            testResult &= (decoded.orderType == request.orderType);
+            logStatusUpdate("Order request round trip", testResult);
+
+            // Modify and cancel requests
+            OrderModify modify{symbol, orderId, 50, 77.0};
+            OrderCancel cancel{symbol, orderId};
+            buffer.clear();
+            protocol::serialize(modify, buffer);
+            protocol::decodeFrame(buffer.data(), buffer.size(), frame, frameSize);
+
+            OrderModify decodedModify;
+            testResult &= protocol::deserialize(frame, decodedModify);
+            testResult &= (decodedModify.orderId == orderId && decodedModify.qty == 50 && decodedModify.price == 77.0);
+
+            buffer.clear();
+            protocol::serialize(cancel, buffer);
+            protocol::decodeFrame(buffer.data(), buffer.size(), frame, frameSize);
+
+            OrderCancel decodedCancel;
+            testResult &= protocol::deserialize(frame, decodedCancel);
+            testResult &= (decodedCancel.symbol == symbol && decodedCancel.orderId == orderId);
+            logStatusUpdate("Order modify/cancel round trip", testResult);
+
+            // Admin request
+            AdminRequest admin{AdminAction::HALT_SYMBOL, symbol};
+            buffer.clear();
+            protocol::serialize(admin, buffer);
+            protocol::decodeFrame(buffer.data(), buffer.size(), frame, frameSize);
+
+            AdminRequest decodedAdmin;
+            testResult &= (frame.type == MessageType::ADMIN_REQUEST);
+            testResult &= protocol::deserialize(frame, decodedAdmin);
+            testResult &= (decodedAdmin.action == AdminAction::HALT_SYMBOL && decodedAdmin.symbol == symbol);
+            logStatusUpdate("Admin request round trip", testResult);
+
+            processTestResult("Protocol_UT::testRequestRoundTrip()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test serializing and deserializing order responses.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testResponseRoundTrip() {
+            bool testResult = true;
+
+            OrderResponse response{orderId, ErrorCode::PARTIAL_FILL};
+            std::string buffer;
+            protocol::serialize(response, buffer);
+
+            protocol::Frame frame;
+            size_t frameSize = 0;
+            protocol::decodeFrame(buffer.data(), buffer.size(), frame, frameSize);
+
+            OrderResponse decoded;
+            testResult &= protocol::deserialize(frame, decoded);
+            testResult &= (decoded.orderId == orderId);
+            testResult &= (decoded.errCode == ErrorCode::PARTIAL_FILL);
+
+            // A response frame is not a valid request
+            OrderRequest request;
+            testResult &= !protocol::deserialize(frame, request);
+            logStatusUpdate("Order response round trip", testResult);
+
+            // Execution report
+            ExecutionReport report{symbol, orderId, ExecutionType::FILL, OrderSide::SELL, 101.25, 40, 60, 1234567};
+            buffer.clear();
+            protocol::serialize(report, buffer);
+            protocol::decodeFrame(buffer.data(), buffer.size(), frame, frameSize);
+
+            ExecutionReport decodedReport;
+            testResult &= (frame.type == MessageType::EXECUTION_REPORT);
+            testResult &= protocol::deserialize(frame, decodedReport);
+            testResult &= (decodedReport.symbol == symbol && decodedReport.orderId == orderId);
+            testResult &= (decodedReport.type == ExecutionType::FILL && decodedReport.side == OrderSide::SELL);
+            testResult &= (decodedReport.price == 101.25 && decodedReport.qty == 40);
+            testResult &= (decodedReport.leavesQty == 60 && decodedReport.timestamp == 1234567);
+            logStatusUpdate("Execution report round trip", testResult);
+
+            processTestResult("Protocol_UT::testResponseRoundTrip()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test decoding several pipelined frames from one buffer,
+         * including a trailing partial frame.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testPipelinedFrames() {
+            bool testResult = true;
+
+            std::string buffer;
+            for (int i = 1; i <= 3; i++) {
+                protocol::serialize(OrderRequest{symbol, i, 10.0, OrderSide::SELL, OrderType::LIMIT}, buffer);
+            }
+            size_t completeSize = buffer.size();
+            protocol::serialize(OrderRequest{symbol, 4, 10.0, OrderSide::SELL, OrderType::LIMIT}, buffer);
+
+            // Drop the last byte so the final frame is incomplete
+            buffer.pop_back();
+
+            size_t offset = 0;
+            int decodedFrames = 0;
+            protocol::Frame frame;
+            size_t frameSize = 0;
+
+            while (protocol::decodeFrame(buffer.data() + offset, buffer.size() - offset, frame, frameSize) == protocol::DecodeStatus::COMPLETE) {
+                OrderRequest request;
+                decodedFrames++;
+                testResult &= protocol::deserialize(frame, request);
+                testResult &= (request.qty == decodedFrames);
+                offset += frameSize;
+            }
+
+            testResult &= (decodedFrames == 3);
+            testResult &= (offset == completeSize);
+            logStatusUpdate("Decode pipelined frames", testResult);
+
+            processTestResult("Protocol_UT::testPipelinedFrames()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test rejection of malformed frames.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testInvalidFrames() {
+            bool testResult = true;
+
+            // Oversized payload length in the header
+            std::string buffer(protocol::HEADER_SIZE, '\xff');
+            protocol::Frame frame;
+            size_t frameSize = 0;
+            testResult &= (protocol::decodeFrame(buffer.data(), buffer.size(), frame, frameSize) == protocol::DecodeStatus::INVALID);
+            logStatusUpdate("Reject oversized frame", testResult);
+
+            // Truncated payload inside a complete frame
+            buffer.clear();
+            protocol::serialize(OrderCancel{symbol, orderId}, buffer);
+            protocol::decodeFrame(buffer.data(), buffer.size(), frame, frameSize);
+            frame.payloadSize -= 1;
+
+            OrderCancel cancel;
+            testResult &= !protocol::deserialize(frame, cancel);
+            logStatusUpdate("Reject truncated payload", testResult);
+
+            processTestResult("Protocol_UT::testInvalidFrames()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test packing market data updates into datagrams.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testMarketDataDatagram() {
+            bool testResult = true;
+
+            std::string datagram;
+            protocol::beginDatagram(7, datagram);
+            testResult &= (datagram.size() == protocol::DATAGRAM_HEADER_SIZE);
+
+            // Pack updates until the datagram is full
+            int appended = 0;
+            while (protocol::appendUpdate(MarketDataUpdate{MarketDataType::BOOK_UPDATE, symbol, static_cast<uint64_t>(appended + 1),
+                                                           OrderSide::BUY, 10.0 + appended, appended, 1000}, datagram)) {
+                appended++;
+            }
+            testResult &= (appended > 1);
+            testResult &= (datagram.size() <= protocol::MAX_DATAGRAM_SIZE);
+            logStatusUpdate("Pack updates up to the datagram size", testResult);
+
+            uint64_t packetSeq = 0;
+            std::vector<MarketDataUpdate> updates;
+            testResult &= protocol::decodeDatagram(datagram.data(), datagram.size(), packetSeq, updates);
+            testResult &= (packetSeq == 7);
+            testResult &= (static_cast<int>(updates.size()) == appended);
+            testResult &= (updates.back().symbol == symbol);
+            testResult &= (updates.back().seq == static_cast<uint64_t>(appended));
+            testResult &= (updates.back().price == 10.0 + (appended - 1));
+            logStatusUpdate("Decode datagram", testResult);
+
+            // Truncated datagram
+            updates.clear();
+            testResult &= !protocol::decodeDatagram(datagram.data(), datagram.size() - 1, packetSeq, updates);
+            logStatusUpdate("Reject truncated datagram", testResult);
+
+            processTestResult("Protocol_UT::testMarketDataDatagram()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test serializing and deserializing snapshot requests and snapshots.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testSnapshotRoundTrip() {
+            bool testResult = true;
+
+            std::string buffer;
+            protocol::serialize(SnapshotRequest{symbol}, buffer);
+            protocol::serialize(BookSnapshot{symbol, 42, true, ErrorCode::OK,
+                                             {{OrderSide::BUY, 9.5, 100}, {OrderSide::SELL, 10.5, 20}}}, buffer);
+
+            protocol::Frame frame;
+            size_t frameSize = 0;
+            SnapshotRequest request;
+            testResult &= (protocol::decodeFrame(buffer.data(), buffer.size(), frame, frameSize) == protocol::DecodeStatus::COMPLETE);
+            testResult &= (frame.type == MessageType::SNAPSHOT_REQUEST);
+            testResult &= protocol::deserialize(frame, request);
+            testResult &= (request.symbol == symbol);
+            logStatusUpdate("Snapshot request round trip", testResult);
+
+            size_t offset = frameSize;
+            BookSnapshot snapshot;
+            testResult &= (protocol::decodeFrame(buffer.data() + offset, buffer.size() - offset, frame, frameSize) == protocol::DecodeStatus::COMPLETE);
+            testResult &= (frame.type == MessageType::BOOK_SNAPSHOT);
+            testResult &= protocol::deserialize(frame, snapshot);
+            testResult &= (snapshot.symbol == symbol);
+            testResult &= (snapshot.seq == 42);
+            testResult &= snapshot.last;
+            testResult &= (snapshot.levels.size() == 2);
+            testResult &= (snapshot.levels[1].side == OrderSide::SELL);
+            testResult &= (snapshot.levels[1].price == 10.5);
+            testResult &= (snapshot.levels[1].qty == 20);
+            logStatusUpdate("Book snapshot round trip", testResult);
+
+            processTestResult("Protocol_UT::testSnapshotRoundTrip()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test serializing and deserializing query requests and pages.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testQueryRoundTrip() {
+            bool testResult = true;
+
+            std::string buffer;
+            protocol::serialize(QueryRequest{symbol, QueryType::ORDER_HISTORY, 4096, 100}, buffer);
+
+            protocol::Frame frame;
+            size_t frameSize = 0;
+            QueryRequest request;
+            testResult &= (protocol::decodeFrame(buffer.data(), buffer.size(), frame, frameSize) == protocol::DecodeStatus::COMPLETE);
+            testResult &= (frame.type == MessageType::QUERY_REQUEST);
+            testResult &= protocol::deserialize(frame, request);
+            testResult &= (request.symbol == symbol && request.type == QueryType::ORDER_HISTORY);
+            testResult &= (request.cursor == 4096 && request.maxItems == 100);
+            logStatusUpdate("Query request round trip", testResult);
+
+            // Order page
+            QueryPage orders{symbol, QueryType::ORDER_HISTORY, ErrorCode::OK, 10, 12, false,
+                             {{orderId, OrderStatus::MODIFY, OrderSide::SELL, OrderType::LIMIT, 10.5, 100, 40, 1234},
+                              {orderId, OrderStatus::CANCEL, OrderSide::BUY, OrderType::LIMIT, 9.5, 20, 20, 5678}}, {}};
+            buffer.clear();
+            protocol::serialize(orders, buffer);
+
+            QueryPage page;
+            testResult &= (buffer.size() == protocol::HEADER_SIZE + protocol::encodedPageHeaderSize(symbol) +
+                                            protocol::encodedSize(orders.orders[0]) + protocol::encodedSize(orders.orders[1]));
+            testResult &= (protocol::decodeFrame(buffer.data(), buffer.size(), frame, frameSize) == protocol::DecodeStatus::COMPLETE);
+            testResult &= protocol::deserialize(frame, page);
+            testResult &= (page.cursor == 10 && page.nextCursor == 12 && !page.last);
+            testResult &= (page.orders.size() == 2 && page.trades.empty());
+            testResult &= (page.orders[0].status == OrderStatus::MODIFY && page.orders[0].side == OrderSide::SELL);
+            testResult &= (page.orders[0].price == 10.5 && page.orders[0].qty == 100 && page.orders[0].remainingQty == 40);
+            testResult &= (page.orders[1].orderId == orderId && page.orders[1].timestamp == 5678);
+            logStatusUpdate("Order page round trip", testResult);
+
+            // Trade page
+            QueryPage trades{symbol, QueryType::TRADE_HISTORY, ErrorCode::OK, 0, 1, true, {},
+                             {{"T1", orderId, "S1", 10.25, 30, 999}}};
+            buffer.clear();
+            protocol::serialize(trades, buffer);
+
+            testResult &= (protocol::decodeFrame(buffer.data(), buffer.size(), frame, frameSize) == protocol::DecodeStatus::COMPLETE);
+            testResult &= protocol::deserialize(frame, page);
+            testResult &= (page.last && page.orders.empty() && page.trades.size() == 1);
+            testResult &= (page.trades[0].tradeId == "T1" && page.trades[0].buyOrderId == orderId);
+            testResult &= (page.trades[0].sellOrderId == "S1" && page.trades[0].price == 10.25);
+            testResult &= (page.trades[0].qty == 30 && page.trades[0].timestamp == 999);
+            logStatusUpdate("Trade page round trip", testResult);
+
+            processTestResult("Protocol_UT::testQueryRoundTrip()", testResult);
+
+            return testResult;
+        }
+
+        // ========== UT Variables ==========
+        const std::string symbol = "TEST";
+        const std::string orderId = "1757529878230_538411";
+
+        const std::string testName = "Protocol_UT";
+};
@@ -0,0 +1,187 @@
+// Global Includes
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Project Includes
+#include <RequestTrace.hpp>
+#include <UnitTest.hpp>
+
+class RequestTrace_UT : public UnitTest {
+    public:
+        /**
+         * @brief Create the request trace unit test object.
+         */
+        RequestTrace_UT() {
+            logTestHeader(testName);
+        }
+
+        /**
+         * @brief Runs all Request Trace unit tests.
+         *
+         * @return true if all unit tests pass; false otherwise
+         */
+        bool runTests() {
+            bool testResult = true;
+
+            // Run request trace unit tests
+            testResult &= testSampling();
+            testResult &= testRecordAndWrap();
+            testResult &= testChromeTrace();
+
+            logTestResults(testName);
+
+            return testResult;
+        }
+
+    private:
+        // ========== UT Functions ==========
+        /**
+         * @brief Test that one request in every sampleEvery is traced, and
+         * none while sampling is off.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testSampling() {
+            bool testResult = true;
+
+            trace::TraceBuffer buffer(16);
+            int sampled = 0;
+            for (int request = 0; request < 100; request++) {
+                sampled += buffer.sample() ? 1 : 0;
+            }
+            testResult &= (sampled == 0);
+            logStatusUpdate("Nothing sampled while disabled", testResult);
+
+            buffer.setSampleEvery(10);
+            for (int request = 0; request < 100; request++) {
+                sampled += buffer.sample() ? 1 : 0;
+            }
+            testResult &= (sampled == 10);
+
+            trace::RequestTrace stamps = buffer.begin(MessageType::ORDER_CANCEL, 42);
+            testResult &= (stamps.buffer == &buffer && stamps.type == MessageType::ORDER_CANCEL);
+            testResult &= (stamps.arrival == 42 && stamps.dequeue == 0 && stamps.symbolId == UINT32_MAX);
+            testResult &= (trace::RequestTrace().buffer == nullptr);
+            logStatusUpdate("One in ten sampled", testResult);
+
+            processTestResult("RequestTrace_UT::testSampling()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test that the records come back oldest first and only the
+         * most recent ones are kept once the ring wraps.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testRecordAndWrap() {
+            bool testResult = true;
+
+            trace::TraceBuffer buffer(4);
+            testResult &= buffer.snapshot().empty();
+
+            for (uint64_t seq = 0; seq < 3; seq++) {
+                buffer.record(makeRecord(buffer, seq));
+            }
+            std::vector<trace::TraceRecord> records = buffer.snapshot();
+            testResult &= (records.size() == 3);
+            for (size_t index = 0; index < records.size(); index++) {
+                testResult &= (records[index].seq == index && records[index].stamps.matchEnd == static_cast<int64_t>(400 + 10 * index));
+            }
+            logStatusUpdate("Records kept in order", testResult);
+
+            for (uint64_t seq = 3; seq < 10; seq++) {
+                buffer.record(makeRecord(buffer, seq));
+            }
+            records = buffer.snapshot();
+            testResult &= (records.size() == 4 && buffer.getRecorded() == 10);
+            for (size_t index = 0; index < records.size(); index++) {
+                testResult &= (records[index].seq == 6 + index);
+            }
+            logStatusUpdate("Oldest records overwritten", testResult);
+
+            processTestResult("RequestTrace_UT::testRecordAndWrap()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test the Chrome trace: a request slice per record, with the
+         * stage slices only for requests that reached an engine.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testChromeTrace() {
+            bool testResult = true;
+
+            trace::TraceBuffer buffer(8);
+            buffer.record(makeRecord(buffer, 0));
+
+            trace::TraceRecord rejected{buffer.begin(MessageType::ADMIN_REQUEST, 1000), 1500, 3, 1};
+            buffer.record(rejected);
+
+            std::ostringstream out;
+            buffer.writeChromeTrace(out);
+            std::string text = out.str();
+
+            testResult &= (text.compare(0, 38, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":") == 0);
+            testResult &= (text.substr(text.size() - 4) == "\n]}\n");
+            testResult &= (countOf(text, "\"name\":\"request\"") == 4);
+            testResult &= (countOf(text, "\"name\":\"match\"") == 2);
+            testResult &= (countOf(text, "\"name\":\"response\"") == 2);
+            logStatusUpdate("Stage slices only for engine requests", testResult);
+
+            testResult &= (text.find("\"args\":{\"type\":\"order\",\"session\":7,\"seq\":0,\"symbol_id\":5}") != std::string::npos);
+            testResult &= (text.find("\"args\":{\"type\":\"admin\",\"session\":3,\"seq\":1,\"symbol_id\":-1}") != std::string::npos);
+            testResult &= (text.find("\"name\":\"match\",\"cat\":\"request\",\"ph\":\"b\",\"id\":1,\"pid\":1,\"tid\":1,\"ts\":0.200") != std::string::npos);
+            testResult &= (text.find("\"name\":\"match\",\"cat\":\"request\",\"ph\":\"e\",\"id\":1,\"pid\":1,\"tid\":1,\"ts\":0.300") != std::string::npos);
+            logStatusUpdate("Request arguments and stage times (us)", testResult);
+
+            processTestResult("RequestTrace_UT::testChromeTrace()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Create the trace of an order that went through an engine:
+         * arrival at 100 ns, then 100 ns per stage (shifted by 10 ns per seq).
+         *
+         * @param buffer - buffer of the trace
+         * @param seq - position of the request in its session
+         *
+         * @return trace::TraceRecord - record
+         */
+        trace::TraceRecord makeRecord(trace::TraceBuffer& buffer, uint64_t seq) {
+            int64_t shift = static_cast<int64_t>(10 * seq);
+
+            trace::RequestTrace stamps = buffer.begin(MessageType::ORDER_REQUEST, 100 + shift);
+            stamps.symbolId = 5;
+            stamps.dequeue = 200 + shift;
+            stamps.matchStart = 300 + shift;
+            stamps.matchEnd = 400 + shift;
+
+            return trace::TraceRecord{stamps, 500 + shift, 7, seq};
+        }
+
+        /**
+         * @brief Count the occurrences of a pattern in a text.
+         *
+         * @param text - text to search
+         * @param pattern - pattern to count
+         *
+         * @return size_t - occurrences
+         */
+        size_t countOf(const std::string& text, const std::string& pattern) {
+            size_t count = 0;
+            for (size_t position = text.find(pattern); position != std::string::npos; position = text.find(pattern, position + 1)) {
+                count++;
+            }
+            return count;
+        }
+
+        // ========== UT Variables ==========
+        std::string testName = "RequestTrace_UT";
+};
@@ -0,0 +1,117 @@
+// Global Includes
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <thread>
+
+// Project Includes
+#include <StageTimers.hpp>
+#include <UnitTest.hpp>
+
+class StageTimers_UT : public UnitTest {
+    public:
+        /**
+         * @brief Create the stage timers unit test object.
+         */
+        StageTimers_UT() {
+            logTestHeader(testName);
+        }
+
+        /**
+         * @brief Runs all Stage Timers unit tests.
+         *
+         * @return true if all unit tests pass; false otherwise
+         */
+        bool runTests() {
+            bool testResult = true;
+
+            // Run stage timers unit tests
+            testResult &= testBuckets();
+            testResult &= testProbesAndDump();
+
+            logTestResults(testName);
+
+            return testResult;
+        }
+
+    private:
+        // ========== UT Functions ==========
+        /**
+         * @brief Test the tick buckets: exact for small durations, within the
+         * sub-bucket resolution above, and in range for any 64-bit duration.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testBuckets() {
+            bool testResult = true;
+
+            for (uint64_t ticks = 0; ticks < 32; ticks++) {
+                testResult &= (stages::StageHistogram::midpointOf(stages::StageHistogram::indexOf(ticks)) == ticks);
+            }
+            logStatusUpdate("Small durations exact", testResult);
+
+            size_t lastIndex = 0;
+            for (uint64_t ticks = 32; ticks < (1ULL << 40); ticks += ticks / 7 + 1) {
+                size_t index = stages::StageHistogram::indexOf(ticks);
+                double midpoint = stages::StageHistogram::midpointOf(index);
+
+                testResult &= (index >= lastIndex);
+                testResult &= (midpoint >= ticks * (1 - 1.0 / 16) && midpoint <= ticks * (1 + 1.0 / 16));
+                lastIndex = index;
+            }
+            testResult &= (stages::StageHistogram::indexOf(UINT64_MAX) == stages::StageHistogram::BUCKETS - 1);
+            logStatusUpdate("Durations within 1/16, largest in range", testResult);
+
+            processTestResult("StageTimers_UT::testBuckets()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test probes recording into the histograms of their thread and
+         * the dump listing them per thread and over all threads.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testProbesAndDump() {
+            bool testResult = true;
+
+            stages::ThreadStages* recorded = nullptr;
+            std::thread worker([&recorded]() {
+                stages::setThreadName("ut-worker");
+
+                for (int probe = 0; probe < 3; probe++) {
+                    stages::StageProbe timer(stages::Stage::MATCH);
+                }
+                { stages::StageProbe timer(stages::Stage::HISTORY); }
+
+                recorded = &stages::threadStages();
+            });
+            worker.join();
+
+            const stages::StageHistogram& match = recorded->histograms[static_cast<size_t>(stages::Stage::MATCH)];
+            const stages::StageHistogram& history = recorded->histograms[static_cast<size_t>(stages::Stage::HISTORY)];
+            const stages::StageHistogram& insert = recorded->histograms[static_cast<size_t>(stages::Stage::INSERT)];
+            testResult &= (match.total.load() == 3 && history.total.load() == 1 && insert.total.load() == 0);
+            logStatusUpdate("Probes recorded per stage", testResult);
+
+            std::ostringstream out;
+            stages::dump(out);
+            std::string text = out.str();
+            std::string threadName = stages::ENABLED ? "ut-worker" : "thread";
+
+            testResult &= (text.compare(0, 13, "Stage timers ") == 0);
+            testResult &= (text.find("\n" + threadName) != std::string::npos);
+            testResult &= (text.find(" match                 3 ") != std::string::npos);
+            testResult &= (text.find("\nall          match") != std::string::npos);
+            testResult &= (text.find("\nall          history") != std::string::npos);
+            logStatusUpdate("Dump lists the thread and the totals", testResult);
+
+            processTestResult("StageTimers_UT::testProbesAndDump()", testResult);
+
+            return testResult;
+        }
+
+        // ========== UT Variables ==========
+        std::string testName = "StageTimers_UT";
+};
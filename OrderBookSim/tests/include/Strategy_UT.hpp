@@ -0,0 +1,248 @@
+// Global Includes
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Project Includes
+#include <AgentManager.hpp>
+#include <CompletionQueue.hpp>
+#include <MatchingEngine.hpp>
+#include <OrderBook.hpp>
+#include <Strategy.hpp>
+#include <UnitTest.hpp>
+
+class Strategy_UT : public UnitTest {
+    public:
+        /**
+         * @brief Create the strategy unit test object.
+         */
+        Strategy_UT() {
+            logTestHeader(testName);
+        }
+
+        /**
+         * @brief Runs all Strategy unit tests.
+         *
+         * @return true if all unit tests pass; false otherwise
+         */
+        bool runTests() {
+            bool testResult = true;
+
+            // Run strategy unit tests
+            testResult &= testStrategyHost();
+            testResult &= testQuotingSimulation();
+            testResult &= testEngineStrategy();
+
+            logTestResults(testName);
+
+            return testResult;
+        }
+
+    private:
+        /**
+         * @brief Strategy that records its callbacks and places the orders it
+         * is told to.
+         */
+        class RecordingStrategy : public Strategy {
+            public:
+                void onStart() override {
+                    started = true;
+                    gateway().submitOrder(1, 10, 99.0, OrderSide::BUY, OrderType::LIMIT);
+                    gateway().submitOrder(2, 10, 101.0, OrderSide::SELL, OrderType::LIMIT);
+                }
+
+                void onBookUpdate(const BookLevelEvent& event) override {
+                    (void)event;
+                    bookUpdates++;
+                }
+
+                void onTrade(const TradeEvent& event) override {
+                    (void)event;
+                    trades++;
+                }
+
+                void onFill(const FillEvent& event) override {
+                    fills.push_back(event);
+                }
+
+                void onReject(uint64_t clientTag, ErrorCode errCode) override {
+                    rejects.push_back(clientTag);
+                    lastReject = errCode;
+                }
+
+                OrderGateway& orders() { return gateway(); }
+
+                bool started = false;
+                int bookUpdates = 0;
+                int trades = 0;
+                std::vector<FillEvent> fills;
+                std::vector<uint64_t> rejects;
+                ErrorCode lastReject = ErrorCode::OK;
+        };
+
+        // ========== UT Functions ==========
+        /**
+         * @brief Test a strategy hosted on a book: callbacks, fills by tag,
+         * cancels and rejects.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testStrategyHost() {
+            bool testResult = true;
+            ErrorCode errCode = ErrorCode::OK;
+
+            OrderBook book("TEMP");
+            RecordingStrategy strategy;
+            StrategyHost host(book, strategy);
+
+            testResult &= strategy.started && host.hasPending();
+            testResult &= (host.drain() == 2);
+            testResult &= (host.getOpenOrderCount() == 2 && !host.hasPending());
+            testResult &= (book.getBestBidPrice() == 99.0 && book.getBestAskPrice() == 101.0);
+            testResult &= (strategy.bookUpdates == 2 && strategy.fills.empty());
+            logStatusUpdate("Orders placed by onStart()", testResult);
+
+            // Another participant hits the strategy's bid
+            book.createOrder(4, 99.0, OrderSide::SELL, OrderType::LIMIT, errCode);
+            testResult &= (strategy.trades == 1 && strategy.fills.size() == 1);
+            testResult &= (strategy.fills[0].clientTag == 1 && strategy.fills[0].type == ExecutionType::FILL);
+            testResult &= (strategy.fills[0].qty == 4 && strategy.fills[0].leavesQty == 6);
+            testResult &= (host.getStats().fills == 1);
+            logStatusUpdate("Fill reported by tag", testResult);
+
+            // Cancel by tag; a second cancel of the same tag is rejected
+            strategy.orders().cancelOrder(2);
+            strategy.orders().cancelOrder(2);
+            testResult &= (host.drain() == 2);
+            testResult &= (strategy.fills.size() == 2 && strategy.fills[1].clientTag == 2);
+            testResult &= (strategy.fills[1].type == ExecutionType::CANCEL && strategy.fills[1].leavesQty == 0);
+            testResult &= (strategy.rejects.size() == 1 && strategy.rejects[0] == 2 && strategy.lastReject == ErrorCode::BAD_ID);
+            testResult &= (host.getOpenOrderCount() == 1 && book.getBestAskPrice() == 0);
+            logStatusUpdate("Cancel by tag, unknown tag rejected", testResult);
+
+            // The strategy's own order takes liquidity, then rests
+            book.createOrder(3, 100.0, OrderSide::SELL, OrderType::LIMIT, errCode);
+            strategy.orders().submitOrder(3, 5, 100.0, OrderSide::BUY, OrderType::LIMIT);
+            host.drain();
+            testResult &= (strategy.fills.size() == 3 && strategy.fills[2].clientTag == 3);
+            testResult &= (strategy.fills[2].qty == 3 && strategy.fills[2].leavesQty == 2);
+            testResult &= (host.getOpenOrderCount() == 2 && book.getBestBidPrice() == 100.0);
+
+            strategy.orders().cancelOrder(3);
+            host.drain();
+            testResult &= (strategy.fills.size() == 4 && strategy.fills[3].clientTag == 3 && strategy.fills[3].qty == 2);
+            logStatusUpdate("Own aggressive order tracked", testResult);
+
+            // Requests of a halted book are rejected without executing
+            strategy.orders().submitOrder(4, 1, 98.0, OrderSide::BUY, OrderType::LIMIT);
+            host.rejectPending(ErrorCode::SYMBOL_HALTED);
+            testResult &= (strategy.rejects.size() == 2 && strategy.lastReject == ErrorCode::SYMBOL_HALTED);
+            testResult &= (host.getOpenOrderCount() == 1);
+            logStatusUpdate("Pending requests rejected", testResult);
+
+            processTestResult("Strategy_UT::testStrategyHost()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test the example market maker against zero-intelligence agents.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testQuotingSimulation() {
+            bool testResult = true;
+
+            QuotingParams params;
+            params.halfSpreadTicks = 2;
+            params.maxPosition = 50;
+            QuotingStrategy maker(params);
+
+            AgentManager manager({"TEMP"}, 7);
+            StrategyHost& host = manager.addStrategy(0, maker);
+
+            testResult &= (maker.getBidPrice() == 99.98 && maker.getAskPrice() == 100.02);
+            testResult &= (host.getOpenOrderCount() == 2);
+            logStatusUpdate("Quotes placed on attach", testResult);
+
+            for (uint32_t agentId = 0; agentId < 50; agentId++) {
+                manager.addAgent(std::make_unique<ZeroIntelligenceAgent>(agentId, 7));
+            }
+            manager.run(200);
+
+            const StrategyStats& stats = host.getStats();
+            testResult &= (stats.fills > 0 && stats.orders > 2 && stats.cancels > 0);
+            testResult &= (maker.getPosition() <= params.maxPosition && maker.getPosition() >= -params.maxPosition);
+            testResult &= (host.getOpenOrderCount() <= 2);
+            logStatusUpdate("Market maker trades within its position limit", testResult);
+
+            processTestResult("Strategy_UT::testQuotingSimulation()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test a strategy run on a matching engine thread.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testEngineStrategy() {
+            bool testResult = true;
+
+            CompletionQueue completions([]() {});
+            MatchingEngine engine(0, [](uint32_t) {}, false);
+            OrderBookSlot slot;
+            QuotingStrategy maker;
+
+            std::vector<EngineCommand> commands;
+            commands.push_back(EngineCommand{0, &slot, ResponseRoute{&completions, nullptr, 0, {}}, AdminRequest{AdminAction::ADD_SYMBOL, "TEMP"}});
+
+            engine.start();
+            engine.submit(commands);
+            testResult &= (waitForCompletions(completions, 1) == 1);
+
+            // Attached before the next batch; the sell hits its bid
+            engine.addStrategy(&slot, maker);
+            commands.push_back(EngineCommand{0, &slot, ResponseRoute{&completions, nullptr, 1, {}}, OrderRequest{"TEMP", 10, 99.0, OrderSide::SELL, OrderType::LIMIT}});
+            engine.submit(commands);
+            testResult &= (waitForCompletions(completions, 1) == 1);
+            engine.stop();
+
+            testResult &= (maker.getPosition() == 10);
+            testResult &= (maker.getBidPrice() > 0 && maker.getAskPrice() > maker.getBidPrice());
+            testResult &= (slot.book.getBestBidPrice() == maker.getBidPrice());
+            logStatusUpdate("Strategy filled and requoted on the engine thread", testResult);
+
+            processTestResult("Strategy_UT::testEngineStrategy()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Wait for the engine to complete a number of commands.
+         *
+         * @param completions - completion queue of the commands
+         * @param count - number of completions expected
+         *
+         * @return size_t - number of completions delivered
+         */
+        size_t waitForCompletions(CompletionQueue& completions, size_t count) {
+            std::vector<Completion> drained;
+            std::vector<RoutedReport> reports;
+            size_t delivered = 0;
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+
+            while (delivered < count && std::chrono::steady_clock::now() < deadline) {
+                completions.drain(drained, reports);
+                delivered += drained.size();
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+
+            return delivered;
+        }
+
+        // ========== UT Variables ==========
+        std::string testName = "Strategy_UT";
+};
@@ -0,0 +1,188 @@
+// Global Includes
+#include <atomic>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Project Includes
+#include <SweepRunner.hpp>
+#include <UnitTest.hpp>
+#include <WorkStealingPool.hpp>
+
+class SweepRunner_UT : public UnitTest {
+    public:
+        /**
+         * @brief Create the sweep runner unit test object.
+         */
+        SweepRunner_UT() {
+            logTestHeader(testName);
+        }
+
+        /**
+         * @brief Runs all Sweep Runner unit tests.
+         *
+         * @return true if all unit tests pass; false otherwise
+         */
+        bool runTests() {
+            bool testResult = true;
+
+            // Run sweep runner unit tests
+            testResult &= testWorkStealingPool();
+            testResult &= testSweepFile();
+            testResult &= testSweepDeterminism();
+
+            logTestResults(testName);
+
+            return testResult;
+        }
+
+    private:
+        // ========== UT Functions ==========
+        /**
+         * @brief Test running batches on the work-stealing pool.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testWorkStealingPool() {
+            bool testResult = true;
+
+            WorkStealingPool pool(4);
+            testResult &= (pool.getWorkerCount() == 4);
+
+            // Uneven tasks: the first worker's range is by far the slowest
+            std::vector<std::atomic<int>> runs(103);
+            for (std::atomic<int>& count : runs) count = 0;
+
+            pool.run(runs.size(), [&runs](size_t task, uint32_t) {
+                if (task < 25) {
+                    volatile uint64_t spin = 0;
+                    for (int i = 0; i < 200000; i++) spin = spin + i;
+                }
+                runs[task]++;
+            });
+
+            bool once = true;
+            for (const std::atomic<int>& count : runs) once &= (count == 1);
+            testResult &= once;
+            logStatusUpdate("Every task ran exactly once", testResult);
+
+            // The pool is reusable and reports the first failure
+            bool thrown = false;
+            std::atomic<int> completed(0);
+            try {
+                pool.run(10, [&completed](size_t task, uint32_t) {
+                    if (task == 3) throw std::runtime_error("task failed");
+                    completed++;
+                });
+            }
+            catch (const std::runtime_error&) {
+                thrown = true;
+            }
+            testResult &= thrown;
+            testResult &= (completed == 9);
+            logStatusUpdate("Task failure rethrown after the batch", testResult);
+
+            processTestResult("SweepRunner_UT::testWorkStealingPool()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test parsing sweep lines and writing the result columns.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testSweepFile() {
+            bool testResult = true;
+
+            SweepRun base;
+            base.seed = 10;
+            std::vector<SweepRun> runs;
+            std::string error;
+
+            testResult &= SweepRunner::parseSweepLine("agents=50 steps=20 cancel-rate=0.5 repeat=3 # comment", base, runs, error);
+            testResult &= SweepRunner::parseSweepLine("   # only a comment", base, runs, error);
+            testResult &= SweepRunner::parseSweepLine("sim-seconds=5 latency-us=20 ttl-us=1000", base, runs, error);
+            testResult &= (runs.size() == 4);
+            testResult &= (runs[0].seed == 10 && runs[2].seed == 12 && runs[2].agents == 50);
+            testResult &= (runs[1].steps == 20 && runs[1].params.cancelRate == 0.5);
+            testResult &= (runs[3].simSeconds == 5 && runs[3].latencyNs == 20000 && runs[3].params.orderTimeToLiveNs == 1000000);
+            testResult &= (runs[3].agents == base.agents && runs[3].seed == 10);
+            logStatusUpdate("Lines applied over the base run", testResult);
+
+            testResult &= !SweepRunner::parseSweepLine("agents=-1", base, runs, error);
+            testResult &= !SweepRunner::parseSweepLine("cancel-rate=2", base, runs, error);
+            testResult &= !SweepRunner::parseSweepLine("colour=blue", base, runs, error);
+            testResult &= !SweepRunner::parseSweepLine("agents", base, runs, error);
+            testResult &= (runs.size() == 4);
+            logStatusUpdate("Invalid lines rejected", testResult);
+
+            std::vector<SweepResult> results(2);
+            results[1].runIndex = 1;
+            results[1].lastTradePrices = {101.5};
+            results[1].error = "out of memory, \"arena\"";
+
+            std::ostringstream out;
+            SweepRunner::writeColumns(out, {"TEMP"}, results);
+            std::string text = out.str();
+
+            testResult &= (text.compare(0, 9, "run,seed,") == 0);
+            testResult &= (text.find(",last_TEMP,error\n") != std::string::npos);
+            testResult &= (text.find(",101.5,\"out of memory, \"\"arena\"\"\"\n") != std::string::npos);
+            size_t lines = 0;
+            for (char c : text) lines += (c == '\n');
+            testResult &= (lines == 3);
+            logStatusUpdate("Header and one row per run", testResult);
+
+            processTestResult("SweepRunner_UT::testSweepFile()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test that a run's results do not depend on the workers.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testSweepDeterminism() {
+            bool testResult = true;
+
+            SweepRun base;
+            base.agents = 50;
+            base.steps = 50;
+            std::vector<SweepRun> runs;
+            std::string error;
+            SweepRunner::parseSweepLine("repeat=6", base, runs, error);
+            SweepRunner::parseSweepLine("sim-seconds=10 latency-us=100 repeat=2", base, runs, error);
+
+            SweepRunner serial({"TEMP1", "TEMP2"}, 1);
+            SweepRunner parallel({"TEMP1", "TEMP2"}, 4);
+            std::vector<SweepResult> first = serial.run(runs);
+            std::vector<SweepResult> second = parallel.run(runs);
+
+            testResult &= (first.size() == runs.size() && second.size() == runs.size());
+            bool same = true;
+            for (size_t i = 0; testResult && i < runs.size(); i++) {
+                same &= first[i].error.empty() && second[i].error.empty();
+                same &= (first[i].runIndex == i && second[i].runIndex == i);
+                same &= (first[i].stats.trades > 0);
+                same &= (first[i].stats.trades == second[i].stats.trades);
+                same &= (first[i].stats.orders == second[i].stats.orders);
+                same &= (first[i].stats.wakeups == second[i].stats.wakeups);
+                same &= (first[i].lastTradePrices == second[i].lastTradePrices);
+            }
+            testResult &= same;
+            logStatusUpdate("Same results on 1 and 4 workers", testResult);
+
+            testResult &= (first[0].stats.trades != first[1].stats.trades || first[0].lastTradePrices != first[1].lastTradePrices);
+            logStatusUpdate("Seeds give different runs", testResult);
+
+            processTestResult("SweepRunner_UT::testSweepDeterminism()", testResult);
+
+            return testResult;
+        }
+
+        // ========== UT Variables ==========
+        std::string testName = "SweepRunner_UT";
+};
@@ -0,0 +1,153 @@
+// Global Includes
+#include <string>
+
+// Project Includes
+#include <SymbolTable.hpp>
+#include <UnitTest.hpp>
+
+class SymbolTable_UT : public UnitTest {
+    public:
+        /**
+         * @brief Create the symbol table unit test object.
+         */
+        SymbolTable_UT() {
+            logTestHeader(testName);
+        }
+
+        /**
+         * @brief Runs all Symbol Table unit tests.
+         *
+         * @return true if all unit tests pass; false otherwise
+         */
+        bool runTests() {
+            bool testResult = true;
+
+            // Run symbol table unit tests
+            testResult &= testAddSymbols();
+            testResult &= testFindSymbols();
+            testResult &= testManySymbols();
+            testResult &= testRemoveSymbols();
+
+            logTestResults(testName);
+
+            return testResult;
+        }
+
+    private:
+        // ========== UT Functions ==========
+        /**
+         * @brief Test assigning dense IDs to symbols.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testAddSymbols() {
+            bool testResult = true;
+
+            testResult &= (symbolTable.add("AAPL") == 0);
+            testResult &= (symbolTable.add("MSFT") == 1);
+            testResult &= (symbolTable.add("TSLA") == 2);
+            logStatusUpdate("Assign dense IDs", testResult);
+
+            // Adding an existing symbol returns its ID
+            testResult &= (symbolTable.add("MSFT") == 1);
+            testResult &= (symbolTable.size() == 3);
+            logStatusUpdate("Duplicate symbol keeps its ID", testResult);
+
+            processTestResult("SymbolTable_UT::testAddSymbols()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test finding symbol IDs.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testFindSymbols() {
+            bool testResult = true;
+
+            testResult &= (symbolTable.find("TSLA") == 2);
+            testResult &= (symbolTable.getSymbol(2) == "TSLA");
+            logStatusUpdate("Find known symbol", testResult);
+
+            // Lookup from raw characters (e.g. a receive buffer)
+            const char* buffer = "AAPLXYZ";
+            testResult &= (symbolTable.find(buffer, 4) == 0);
+            logStatusUpdate("Find symbol from characters", testResult);
+
+            testResult &= (symbolTable.find("AAP") == SymbolTable::INVALID_ID);
+            testResult &= (symbolTable.find("") == SymbolTable::INVALID_ID);
+            logStatusUpdate("Unknown symbol", testResult);
+
+            processTestResult("SymbolTable_UT::testFindSymbols()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test a table with thousands of symbols (several rehashes).
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testManySymbols() {
+            bool testResult = true;
+
+            SymbolTable largeTable;
+            for (uint32_t i = 0; i < symbolCount; i++) {
+                testResult &= (largeTable.add("SYM" + std::to_string(i)) == i);
+            }
+            logStatusUpdate("Add many symbols", testResult);
+
+            for (uint32_t i = 0; i < symbolCount; i++) {
+                testResult &= (largeTable.find("SYM" + std::to_string(i)) == i);
+            }
+            testResult &= (largeTable.find("SYM" + std::to_string(symbolCount)) == SymbolTable::INVALID_ID);
+            logStatusUpdate("Find many symbols", testResult);
+
+            processTestResult("SymbolTable_UT::testManySymbols()", testResult);
+
+            return testResult;
+        }
+
+        /**
+         * @brief Test removing symbols, releasing their IDs and the capacity limit.
+         *
+         * @return true if passed test case; false otherwise
+         */
+        bool testRemoveSymbols() {
+            bool testResult = true;
+
+            SymbolTable boundedTable(2);
+            testResult &= (boundedTable.add("AAPL") == 0);
+            testResult &= (boundedTable.add("MSFT") == 1);
+            testResult &= (boundedTable.add("TSLA") == SymbolTable::INVALID_ID);
+            logStatusUpdate("Add beyond capacity", testResult);
+
+            // Removed symbol is no longer found, but its ID is held until released
+            testResult &= (boundedTable.remove("AAPL") == 0);
+            testResult &= (boundedTable.remove("AAPL") == SymbolTable::INVALID_ID);
+            testResult &= (boundedTable.find("AAPL") == SymbolTable::INVALID_ID);
+            testResult &= (boundedTable.find("MSFT") == 1);
+            testResult &= (boundedTable.count() == 1);
+            testResult &= (boundedTable.add("TSLA") == SymbolTable::INVALID_ID);
+            logStatusUpdate("Remove symbol", testResult);
+
+            // Released ID is reused by the next symbol
+            boundedTable.release(0);
+            testResult &= (boundedTable.add("TSLA") == 0);
+            testResult &= (boundedTable.find("TSLA") == 0);
+            testResult &= (boundedTable.getSymbol(0) == "TSLA");
+            testResult &= (boundedTable.count() == 2);
+            logStatusUpdate("Reuse released ID", testResult);
+
+            processTestResult("SymbolTable_UT::testRemoveSymbols()", testResult);
+
+            return testResult;
+        }
+
+        // ========== UT Variables ==========
+        SymbolTable symbolTable;
+        const uint32_t symbolCount = 5000;
+
+        const std::string testName = "SymbolTable_UT";
+};
@@ -0,0 +1,62 @@
+// Global Includes
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+// Project Includes
+#include <OrderBook_BM.hpp>
+
+/**
+ * @brief Run the micro-benchmark suites and write their results as JSON.
+ *
+ * Command line arguements
+ * --ops (n) : operations timed per case (default 20000)
+ * --filter (text) : only run the cases whose name contains text
+ * --out (file) : write the JSON results to a file instead of stdout
+ *
+ * A summary table is always written to stderr.
+ *
+ * @param argc - number of command line arguements
+ * @param argv - command line arguements
+ *
+ * @return int - status code
+ */
+int main(int argc, char* argv[]) {
+    uint64_t ops = 20000;
+    std::string filter;
+    std::string outFile;
+
+    for (int index = 1; index + 1 < argc; index += 2) {
+        std::string arg = argv[index];
+        std::string value = argv[index + 1];
+
+        if (arg == "--ops") ops = std::strtoull(value.c_str(), nullptr, 10);
+        else if (arg == "--filter") filter = value;
+        else if (arg == "--out") outFile = value;
+        else {
+            std::cerr << "benchmark: unknown option " << arg << "\n"
+                      << "Usage: benchmark [--ops <n>] [--filter <text>] [--out <file>]\n";
+            return 1;
+        }
+    }
+    if (ops == 0 || argc % 2 == 0) {
+        std::cerr << "Usage: benchmark [--ops <n>] [--filter <text>] [--out <file>]\n";
+        return 1;
+    }
+
+    // Run order book benchmarks
+    OrderBook_BM orderBookBM(ops, filter);
+    orderBookBM.runBenchmarks();
+    orderBookBM.logResults(std::cerr);
+
+    if (outFile.empty()) {
+        orderBookBM.writeJson(std::cout);
+    }
+    else {
+        std::ofstream out(outFile);
+        orderBookBM.writeJson(out);
+    }
+
+    return 0;
+}
@@ -0,0 +1,77 @@
+// Global Includes
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+// Project Includes
+#include <DifferentialFuzzer.hpp>
+#include <OrderBook.hpp>
+
+// Book under test; replace with an optimized backend to check it against OrderBook
+using CandidateBook = OrderBook;
+
+/**
+ * @brief Run random operation sequences through the reference OrderBook and
+ * the candidate book, and stop at the first sequence where they disagree.
+ *
+ * Command line arguements
+ * --seed (n) : seed of the first sequence; sequence i uses seed + i (default 1)
+ * --runs (n) : sequences to run (default 100)
+ * --ops (n) : operations per sequence (default 1000)
+ *
+ * A failing sequence is minimized and printed with the difference, and is
+ * reproduced with --seed (its seed) --runs 1 and the same --ops.
+ *
+ * @param argc - number of command line arguements
+ * @param argv - command line arguements
+ *
+ * @return int - 0 if every sequence passed; 1 otherwise
+ */
+int main(int argc, char* argv[]) {
+    uint64_t seed = 1;
+    uint64_t runs = 100;
+    uint64_t ops = 1000;
+
+    for (int index = 1; index + 1 < argc; index += 2) {
+        std::string arg = argv[index];
+        std::string value = argv[index + 1];
+
+        if (arg == "--seed") seed = std::strtoull(value.c_str(), nullptr, 10);
+        else if (arg == "--runs") runs = std::strtoull(value.c_str(), nullptr, 10);
+        else if (arg == "--ops") ops = std::strtoull(value.c_str(), nullptr, 10);
+        else {
+            std::cerr << "fuzz: unknown option " << arg << "\n"
+                      << "Usage: fuzz [--seed <n>] [--runs <n>] [--ops <n>]\n";
+            return 1;
+        }
+    }
+    if (ops == 0 || argc % 2 == 0) {
+        std::cerr << "Usage: fuzz [--seed <n>] [--runs <n>] [--ops <n>]\n";
+        return 1;
+    }
+
+    fuzz::DifferentialFuzzer<CandidateBook> fuzzer;
+
+    for (uint64_t run = 0; run < runs; run++) {
+        std::vector<fuzz::FuzzOp> sequence = fuzz::generateOps(seed + run, ops);
+        fuzz::FuzzResult result = fuzzer.run(sequence);
+
+        if (result.passed) continue;
+
+        std::cout << "seed " << seed + run << ": books differ at step " << result.step << "\n";
+
+        std::vector<fuzz::FuzzOp> minimized = fuzzer.minimize(sequence);
+        fuzz::FuzzResult minimizedResult = fuzzer.run(minimized);
+
+        std::cout << "minimized to " << minimized.size() << " operations:\n"
+                  << fuzz::describe(minimized)
+                  << "difference at step " << minimizedResult.step << ":\n"
+                  << minimizedResult.reason
+                  << "reproduce: fuzz --seed " << seed + run << " --runs 1 --ops " << ops << "\n";
+        return 1;
+    }
+
+    std::cout << runs << " sequences of " << ops << " operations passed (seeds " << seed << "-" << seed + runs - 1 << ")\n";
+
+    return 0;
+}
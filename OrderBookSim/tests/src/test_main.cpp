@@ -1,9 +1,106 @@
+// Global Includes
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
 // Project Includes
+#include <Admission_UT.hpp>
+#include <AllocationCounter.hpp>
+#include <AgentManager_UT.hpp>
+#include <AsyncLogger_UT.hpp>
+#include <Config_UT.hpp>
+#include <DifferentialFuzzer_UT.hpp>
+#include <LatencyHistogram_UT.hpp>
+#include <MatchingEngine_UT.hpp>
 #include <Order_UT.hpp>
+#include <OrderFlow_UT.hpp>
 #include <OrderBook_UT.hpp>
 #include <OrderBookManager_UT.hpp>
+#include <Protocol_UT.hpp>
+#include <RequestTrace_UT.hpp>
+#include <StageTimers_UT.hpp>
+#include <Strategy_UT.hpp>
+#include <SweepRunner_UT.hpp>
+#include <SymbolTable_UT.hpp>
 #include <Trade_UT.hpp>
 
+namespace {
+    thread_local uint64_t allocationCount = 0; // Allocations made by this thread
+
+    /**
+     * @brief Count an allocation and take its memory from malloc.
+     *
+     * @param size - bytes to allocate
+     * @param alignment - alignment of the memory (0 for the default)
+     * @return void* - allocated memory
+     */
+    void* countedAlloc(std::size_t size, std::size_t alignment) {
+        allocationCount++;
+
+        if (size == 0) size = 1;
+
+        void* memory = nullptr;
+        if (alignment > alignof(std::max_align_t)) {
+#ifdef _WIN32
+            memory = _aligned_malloc(size, alignment);
+#else
+            size = (size + alignment - 1) / alignment * alignment;
+            memory = std::aligned_alloc(alignment, size);
+#endif
+        }
+        else {
+            memory = std::malloc(size);
+        }
+
+        if (memory == nullptr) throw std::bad_alloc();
+
+        return memory;
+    }
+
+    /**
+     * @brief Release memory from countedAlloc(). Kept out of line, so the
+     * compiler does not pair the inlined free() with operator new.
+     *
+     * @param memory - memory to release
+     * @param aligned - true if it was allocated with an extended alignment
+     */
+    [[gnu::noinline]] void countedFree(void* memory, bool aligned) {
+#ifdef _WIN32
+        if (aligned) {
+            _aligned_free(memory);
+            return;
+        }
+#else
+        (void)aligned;
+#endif
+        std::free(memory);
+    }
+}
+
+//#########################################################################
+uint64_t allocations::threadAllocations() {
+    return allocationCount;
+}
+
+// Replace the global allocation functions, so every heap allocation is counted
+void* operator new(std::size_t size) { return countedAlloc(size, 0); }
+void* operator new[](std::size_t size) { return countedAlloc(size, 0); }
+void* operator new(std::size_t size, std::align_val_t alignment) { return countedAlloc(size, static_cast<std::size_t>(alignment)); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return countedAlloc(size, static_cast<std::size_t>(alignment)); }
+void operator delete(void* memory) noexcept { countedFree(memory, false); }
+void operator delete[](void* memory) noexcept { countedFree(memory, false); }
+void operator delete(void* memory, std::size_t) noexcept { countedFree(memory, false); }
+void operator delete[](void* memory, std::size_t) noexcept { countedFree(memory, false); }
+void operator delete(void* memory, std::align_val_t) noexcept { countedFree(memory, true); }
+void operator delete[](void* memory, std::align_val_t) noexcept { countedFree(memory, true); }
+void operator delete(void* memory, std::size_t, std::align_val_t) noexcept { countedFree(memory, true); }
+void operator delete[](void* memory, std::size_t, std::align_val_t) noexcept { countedFree(memory, true); }
+
 int main() {
     // Run order unit tests
     Order_UT orderUT;
@@ -19,5 +116,61 @@ int main() {
 
     // Run order book manager unit tests
 
+    // Run protocol unit tests
+    Protocol_UT protocolUT;
+    protocolUT.runTests();
+
+    // Run symbol table unit tests
+    SymbolTable_UT symbolTableUT;
+    symbolTableUT.runTests();
+
+    // Run matching engine unit tests
+    MatchingEngine_UT matchingEngineUT;
+    matchingEngineUT.runTests();
+
+    // Run admission unit tests
+    Admission_UT admissionUT;
+    admissionUT.runTests();
+
+    // Run async logger unit tests
+    AsyncLogger_UT asyncLoggerUT;
+    asyncLoggerUT.runTests();
+
+    // Run config unit tests
+    Config_UT configUT;
+    configUT.runTests();
+
+    // Run agent manager unit tests
+    AgentManager_UT agentManagerUT;
+    agentManagerUT.runTests();
+
+    // Run sweep runner unit tests
+    SweepRunner_UT sweepRunnerUT;
+    sweepRunnerUT.runTests();
+
+    // Run order flow unit tests
+    OrderFlow_UT orderFlowUT;
+    orderFlowUT.runTests();
+
+    // Run strategy unit tests
+    Strategy_UT strategyUT;
+    strategyUT.runTests();
+
+    // Run latency histogram unit tests
+    LatencyHistogram_UT latencyHistogramUT;
+    latencyHistogramUT.runTests();
+
+    // Run stage timers unit tests
+    StageTimers_UT stageTimersUT;
+    stageTimersUT.runTests();
+
+    // Run request trace unit tests
+    RequestTrace_UT requestTraceUT;
+    requestTraceUT.runTests();
+
+    // Run differential fuzzer unit tests
+    DifferentialFuzzer_UT differentialFuzzerUT;
+    differentialFuzzerUT.runTests();
+
     return 0;
 }
\ No newline at end of file